@@ -0,0 +1,331 @@
+/*
+This document is meant to store the implementation of the helpers shared by the
+benchmarks of every list implementation, and of the dynamic array baseline.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#define _POSIX_C_SOURCE 200112L
+// for syscall, which perf_event_open is only reached through
+#define _DEFAULT_SOURCE
+#include<linux/perf_event.h>
+#include<pthread.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<sys/syscall.h>
+#include<time.h>
+#include<unistd.h>
+#include"bench-harness.h"
+
+/*** Globals ***/
+static uint64_t random_state = 88172645463325252ULL;
+static FILE* csv_file = NULL;
+
+/*** Helper Functions ***/
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *((const double *) a);
+    double y = *((const double *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Returns the value below which the given fraction of the sorted
+ *        samples fall (nearest-rank percentile).
+ */
+static double percentile(double* sorted, uint64_t count, double fraction) {
+    uint64_t rank = (uint64_t) (fraction * count + 0.999999);
+    if (rank == 0) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+/**
+ * @brief The state shared by the threads of one threaded sample.
+ */
+typedef struct {
+    BenchThread thread;
+    void (*worker)(BenchThread*);
+    pthread_barrier_t* start;
+    uint64_t started_ns;
+    uint64_t finished_ns;
+} BenchThreadStart;
+
+/**
+ * @brief Waits until every thread of the sample exists, then runs the worker
+ *        and records when it started and finished.
+ */
+static void* run_bench_thread(void* arg) {
+    BenchThreadStart* start = (BenchThreadStart *) arg;
+    pthread_barrier_wait(start->start);
+    start->started_ns = bench_now_ns();
+    start->worker(&(start->thread));
+    start->finished_ns = bench_now_ns();
+    return NULL;
+}
+
+/*** Harness Function Implementations ***/
+
+uint64_t bench_now_ns() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec) * 1000000000ULL + now.tv_nsec;
+}
+
+void bench_seed(uint64_t seed) {
+    random_state = seed;
+}
+
+uint64_t bench_random() {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+uint64_t bench_max_size(int argc, char** argv) {
+    if (argc < 2) {
+        return BENCH_DEFAULT_MAX_SIZE;
+    }
+    return strtoull(argv[1], NULL, 10);
+}
+
+uint64_t bench_batch(uint64_t size) {
+    if (size >= BENCH_MIN_SAMPLE_WORK) {
+        return 1;
+    }
+    return BENCH_MIN_SAMPLE_WORK / size;
+}
+
+bool bench_open_csv(const char* path) {
+    csv_file = fopen(path, "w");
+    if (csv_file == NULL) {
+        return false;
+    }
+    fprintf(csv_file, "structure,operation,size,samples,ops,ops_per_sec,p50_ns,p99_ns\n");
+    return true;
+}
+
+void bench_close_csv() {
+    if (csv_file != NULL) {
+        fclose(csv_file);
+        csv_file = NULL;
+    }
+}
+
+BenchSamples* bench_start() {
+    BenchSamples* samples = (BenchSamples *) calloc(1, sizeof(BenchSamples));
+    samples->ns_per_op = (double *) malloc(sizeof(double) * BENCH_MAX_SAMPLES);
+    samples->started_ns = bench_now_ns();
+    return samples;
+}
+
+bool bench_add_sample(BenchSamples* samples, uint64_t elapsed_ns, uint64_t ops) {
+    if (samples->num_samples < BENCH_MAX_SAMPLES) {
+        samples->ns_per_op[samples->num_samples] = (double) elapsed_ns / ops;
+        samples->num_samples++;
+        samples->total_ops += ops;
+        samples->total_ns += elapsed_ns;
+    }
+    return bench_wants_more(samples);
+}
+
+bool bench_add_threaded_sample(BenchSamples* samples, uint64_t num_threads, uint64_t ops_per_thread,
+                               void (*worker)(BenchThread*), void* arg) {
+    pthread_t* threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    BenchThreadStart* starts = (BenchThreadStart *) malloc(sizeof(BenchThreadStart) * num_threads);
+    pthread_barrier_t barrier;
+    pthread_barrier_init(&barrier, NULL, num_threads);
+    for (uint64_t i = 0; i < num_threads; i++) {
+        BenchThread thread = {i, num_threads, ops_per_thread, bench_random() | 1, arg};
+        starts[i].thread = thread;
+        starts[i].worker = worker;
+        starts[i].start = &barrier;
+        pthread_create(&(threads[i]), NULL, run_bench_thread, &(starts[i]));
+    }
+    // the sample lasts from the first thread starting to the last one finishing
+    uint64_t started = UINT64_MAX;
+    uint64_t finished = 0;
+    uint64_t ops = 0;
+    for (uint64_t i = 0; i < num_threads; i++) {
+        pthread_join(threads[i], NULL);
+        started = (starts[i].started_ns < started) ? starts[i].started_ns : started;
+        finished = (starts[i].finished_ns > finished) ? starts[i].finished_ns : finished;
+        ops += starts[i].thread.ops;
+    }
+    uint64_t elapsed = finished - started;
+    pthread_barrier_destroy(&barrier);
+    free(starts);
+    free(threads);
+    return bench_add_sample(samples, elapsed, ops);
+}
+
+uint64_t bench_thread_random(BenchThread* thread) {
+    thread->random_state ^= thread->random_state << 13;
+    thread->random_state ^= thread->random_state >> 7;
+    thread->random_state ^= thread->random_state << 17;
+    return thread->random_state;
+}
+
+bool bench_wants_more(BenchSamples* samples) {
+    return (samples->num_samples < BENCH_MAX_SAMPLES)
+           && (bench_now_ns() - samples->started_ns < BENCH_TIME_BUDGET_NS);
+}
+
+void bench_report(BenchSamples* samples, const char* structure, const char* operation, uint64_t size) {
+    double ops_per_sec = 0.0;
+    double p50 = 0.0;
+    double p99 = 0.0;
+    if (samples->num_samples > 0) {
+        qsort(samples->ns_per_op, samples->num_samples, sizeof(double), compare_doubles);
+        p50 = percentile(samples->ns_per_op, samples->num_samples, 0.50);
+        p99 = percentile(samples->ns_per_op, samples->num_samples, 0.99);
+        if (samples->total_ns > 0) {
+            ops_per_sec = samples->total_ops * 1e9 / samples->total_ns;
+        }
+    }
+    printf("%-20s %-16s %10lu %14.0f ops/s  p50 %12.1f ns  p99 %12.1f ns\n",
+           structure, operation, size, ops_per_sec, p50, p99);
+    fflush(stdout);
+    if (csv_file != NULL) {
+        fprintf(csv_file, "%s,%s,%lu,%lu,%lu,%.0f,%.1f,%.1f\n", structure, operation, size,
+                samples->num_samples, samples->total_ops, ops_per_sec, p50, p99);
+    }
+    free(samples->ns_per_op);
+    free(samples);
+}
+
+int bench_open_cache_misses() {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    long counter = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return (counter < 0) ? -1 : (int) counter;
+}
+
+uint64_t bench_read_counter(int counter) {
+    uint64_t count = 0;
+    if ((counter < 0) || (read(counter, &count, sizeof(count)) != sizeof(count))) {
+        return 0;
+    }
+    return count;
+}
+
+void bench_close_counter(int counter) {
+    if (counter >= 0) {
+        close(counter);
+    }
+}
+
+uint64_t bench_resident_bytes() {
+    unsigned long pages = 0;
+    unsigned long resident = 0;
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (file == NULL) {
+        return 0;
+    }
+    if (fscanf(file, "%lu %lu", &pages, &resident) != 2) {
+        resident = 0;
+    }
+    fclose(file);
+    return (uint64_t) resident * sysconf(_SC_PAGESIZE);
+}
+
+/*** DynamicArray Function Implementations ***/
+
+/**
+ * @brief Makes sure the array has room for one more value.
+ */
+static void array_reserve(DynamicArray* array) {
+    if (array->size == array->capacity) {
+        array->capacity = (array->capacity == 0) ? 16 : 2 * array->capacity;
+        array->data = (int64_t *) realloc(array->data, sizeof(int64_t) * array->capacity);
+    }
+}
+
+void array_append(DynamicArray* array, int64_t data) {
+    array_reserve(array);
+    array->data[array->size] = data;
+    array->size++;
+}
+
+void array_prepend(DynamicArray* array, int64_t data) {
+    array_reserve(array);
+    memmove(array->data + 1, array->data, sizeof(int64_t) * array->size);
+    array->data[0] = data;
+    array->size++;
+}
+
+void array_delete_first(DynamicArray* array) {
+    if (array->size == 0) {
+        return;
+    }
+    array->size--;
+    memmove(array->data, array->data + 1, sizeof(int64_t) * array->size);
+}
+
+void array_delete_last(DynamicArray* array) {
+    if (array->size > 0) {
+        array->size--;
+    }
+}
+
+int64_t* array_get(DynamicArray* array, uint64_t index) {
+    if (index >= array->size) {
+        return NULL;
+    }
+    return &(array->data[index]);
+}
+
+uint64_t array_find(DynamicArray* array, int64_t data) {
+    for (uint64_t i = 0; i < array->size; i++) {
+        if (array->data[i] == data) {
+            return i;
+        }
+    }
+    return UINT64_MAX;
+}
+
+bool array_contains(DynamicArray* array, int64_t data) {
+    return (array_find(array, data) != UINT64_MAX);
+}
+
+void array_reverse(DynamicArray* array) {
+    if (array->size < 2) {
+        return;
+    }
+    for (uint64_t i = 0, j = array->size - 1; i < j; i++, j--) {
+        int64_t temp = array->data[i];
+        array->data[i] = array->data[j];
+        array->data[j] = temp;
+    }
+}
+
+int64_t* array_to_array(DynamicArray* array) {
+    if (array->size == 0) {
+        return NULL;
+    }
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * array->size);
+    memcpy(arr, array->data, sizeof(int64_t) * array->size);
+    return arr;
+}
+
+DynamicArray array_copy(DynamicArray* array) {
+    DynamicArray copy = {array_to_array(array), array->size, array->size};
+    return copy;
+}
+
+void array_clear(DynamicArray* array) {
+    free(array->data);
+    array->data = NULL;
+    array->size = 0;
+    array->capacity = 0;
+}
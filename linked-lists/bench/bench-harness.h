@@ -0,0 +1,258 @@
+/*
+This header file is used to declare the helpers shared by the benchmarks
+of every list implementation: a timer, a pseudo-random generator, sample
+collection with ops/sec and latency percentiles, CSV output, and a plain
+dynamic array used as the baseline the lists are compared against.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef BENCHHARNESS_H
+#define BENCHHARNESS_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+
+/*** Constants ***/
+// the largest list size benchmarked when no size is given on the command line
+#define BENCH_DEFAULT_MAX_SIZE 10000000
+// every measurement stops taking samples once it has run for this long...
+#define BENCH_TIME_BUDGET_NS 250000000ULL
+// ...or once it has this many samples, whichever comes first
+#define BENCH_MAX_SAMPLES 1000
+// operations which are O(n) are batched so one sample covers at least this many node visits
+#define BENCH_MIN_SAMPLE_WORK 1024
+// the file every benchmark writes its results to, relative to the list's directory
+#define BENCH_CSV_PATH "logs/bench.csv"
+// concurrent benchmarks double the number of threads from 1 up to this many
+#define BENCH_MAX_THREADS 64
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief A structure collecting the samples of one measurement.
+ * Each sample is the time taken by a batch of operations, stored as
+ * nanoseconds per operation so samples of different batch sizes can be
+ * compared. The totals are used to compute the overall ops/sec.
+ */
+typedef struct {
+    double* ns_per_op;
+    uint64_t num_samples;
+    uint64_t total_ops;
+    uint64_t total_ns;
+    uint64_t started_ns;
+} BenchSamples;
+
+/**
+ * @brief A structure describing one thread of a threaded sample.
+ * Contains the index of the thread, the number of threads in the sample,
+ * the number of operations the thread should run, a random state of its
+ * own (see bench_thread_random) and the argument shared by all threads.
+ */
+typedef struct {
+    uint64_t index;
+    uint64_t num_threads;
+    uint64_t ops;
+    uint64_t random_state;
+    void* arg;
+} BenchThread;
+
+/**
+ * @brief A plain growable array of 64-bit integers, used as the baseline
+ *        every list is compared against.
+ * Contains a pointer to the values, the number of values in use, and the
+ * number of values the allocation can hold.
+ */
+typedef struct {
+    int64_t* data;
+    uint64_t size;
+    uint64_t capacity;
+} DynamicArray;
+
+
+/*** Harness Functions ***/
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+uint64_t bench_now_ns();
+
+/**
+ * @brief Seeds the pseudo-random generator used by bench_random, so that
+ *        every run of a benchmark uses the same sequence of values.
+ * @param seed Any value except 0.
+ */
+void bench_seed(uint64_t seed);
+
+/**
+ * @brief Returns the next value of a xorshift64 pseudo-random generator.
+ */
+uint64_t bench_random();
+
+/**
+ * @brief Reads the largest size to benchmark from the first command line
+ *        argument, or returns BENCH_DEFAULT_MAX_SIZE if there is none.
+ */
+uint64_t bench_max_size(int argc, char** argv);
+
+/**
+ * @brief Returns how many O(n) operations on a list of the given size
+ *        should be timed together in one sample, so that very small lists
+ *        are not measured below the resolution of the timer.
+ */
+uint64_t bench_batch(uint64_t size);
+
+/**
+ * @brief Opens the CSV file results are written to and writes its header.
+ *        Returns false if the file could not be opened, in which case
+ *        results are only printed.
+ * @param path The path of the CSV file, usually BENCH_CSV_PATH.
+ */
+bool bench_open_csv(const char* path);
+
+/**
+ * @brief Closes the CSV file opened by bench_open_csv.
+ */
+void bench_close_csv();
+
+/**
+ * @brief Starts a new measurement with no samples.
+ *        Note: The samples are freed by bench_report.
+ */
+BenchSamples* bench_start();
+
+/**
+ * @brief Records one sample made of ops operations which took elapsed_ns
+ *        nanoseconds in total. Returns true while the measurement wants
+ *        more samples, and false once BENCH_MAX_SAMPLES samples were taken
+ *        or BENCH_TIME_BUDGET_NS has passed since bench_start.
+ * @param samples The measurement to add to.
+ * @param elapsed_ns The time taken by the whole batch.
+ * @param ops The number of operations in the batch.
+ */
+bool bench_add_sample(BenchSamples* samples, uint64_t elapsed_ns, uint64_t ops);
+
+/**
+ * @brief Starts num_threads threads running worker at the same time, each told
+ *        to run ops_per_thread operations, and records the time from the first
+ *        one starting to the last one finishing as one sample of num_threads *
+ *        ops_per_thread operations. A worker which does not run the operations
+ *        being counted (e.g. a consumer, when pushes are counted) sets its ops
+ *        to the number it did run, usually 0. Thread creation is not timed.
+ *        Returns the same as bench_add_sample.
+ * @param samples The measurement to add to.
+ * @param num_threads The number of threads to run.
+ * @param ops_per_thread The number of operations each thread runs.
+ * @param worker The function run by every thread.
+ * @param arg The argument shared by every thread, usually the structure.
+ */
+bool bench_add_threaded_sample(BenchSamples* samples, uint64_t num_threads, uint64_t ops_per_thread,
+                               void (*worker)(BenchThread*), void* arg);
+
+/**
+ * @brief Returns the next value of the xorshift64 generator of a thread, so
+ *        that threads do not share the state of bench_random.
+ */
+uint64_t bench_thread_random(BenchThread* thread);
+
+/**
+ * @brief Returns true while the measurement wants more samples.
+ */
+bool bench_wants_more(BenchSamples* samples);
+
+/**
+ * @brief Prints the ops/sec, p50 and p99 latency of the measurement, writes
+ *        them as a row of the CSV file, and frees the samples.
+ * @param samples The measurement to report.
+ * @param structure The name of the data structure, e.g. "SinglyLinkedList".
+ * @param operation The name of the measured function.
+ * @param size The number of elements in the structure.
+ */
+void bench_report(BenchSamples* samples, const char* structure, const char* operation, uint64_t size);
+
+/**
+ * @brief Opens a hardware counter of the cache misses of the calling thread,
+ *        counted in user space only, with perf_event_open. Returns -1 if the
+ *        kernel or the machine does not allow it, e.g. when
+ *        /proc/sys/kernel/perf_event_paranoid is 3 or in some virtual machines.
+ *        Note: The counter must be closed with bench_close_counter.
+ */
+int bench_open_cache_misses();
+
+/**
+ * @brief Returns the number of events a counter opened by
+ *        bench_open_cache_misses has counted so far, or 0 if counter is -1.
+ */
+uint64_t bench_read_counter(int counter);
+
+/**
+ * @brief Closes a counter opened by bench_open_cache_misses, if it is not -1.
+ */
+void bench_close_counter(int counter);
+
+/**
+ * @brief Returns the number of bytes of the process which are resident in
+ *        memory, read from /proc/self/statm, or 0 if it can not be read.
+ */
+uint64_t bench_resident_bytes();
+
+
+/*** DynamicArray Functions ***/
+
+/**
+ * @brief Appends a value, doubling the capacity when the array is full.
+ */
+void array_append(DynamicArray* array, int64_t data);
+
+/**
+ * @brief Prepends a value by shifting every value up by one slot.
+ */
+void array_prepend(DynamicArray* array, int64_t data);
+
+/**
+ * @brief Removes the first value by shifting every other value down by one slot.
+ */
+void array_delete_first(DynamicArray* array);
+
+/**
+ * @brief Removes the last value.
+ */
+void array_delete_last(DynamicArray* array);
+
+/**
+ * @brief Returns a pointer to the value at index, or NULL if out of bounds.
+ */
+int64_t* array_get(DynamicArray* array, uint64_t index);
+
+/**
+ * @brief Returns the index of the first value equal to data, or UINT64_MAX.
+ */
+uint64_t array_find(DynamicArray* array, int64_t data);
+
+/**
+ * @brief Returns true if one of the values is equal to data.
+ */
+bool array_contains(DynamicArray* array, int64_t data);
+
+/**
+ * @brief Reverses the order of the values in place.
+ */
+void array_reverse(DynamicArray* array);
+
+/**
+ * @brief Returns a heap-allocated copy of the values, or NULL if empty.
+ */
+int64_t* array_to_array(DynamicArray* array);
+
+/**
+ * @brief Returns a new DynamicArray holding a copy of the values.
+ */
+DynamicArray array_copy(DynamicArray* array);
+
+/**
+ * @brief Frees the values and resets the array to empty.
+ */
+void array_clear(DynamicArray* array);
+#endif
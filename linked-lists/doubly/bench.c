@@ -0,0 +1,1435 @@
+/*
+This file is used to benchmark the DoublyLinkedList implementation against a plain
+dynamic array. Every public operation is measured at sizes from 10 up to the size
+given on the command line (10,000,000 by default). Results are printed and written
+to logs/bench.csv so that runs can be compared with diff.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include"doubly-linked.h"
+#include"doubly-locked.h"
+#include"doubly-mapped.h"
+#include"doubly-stream.h"
+#include"doubly-xor.h"
+#include"doubly-arena.h"
+#include"doubly-parallel.h"
+#include"doubly-rcu.h"
+#include"../bench/bench-harness.h"
+#include"../stats/list-stats.h"
+#include<malloc.h>
+#include<pthread.h>
+#include<stdatomic.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<time.h>
+
+/*** Constants ***/
+#define LIST_NAME "DoublyLinkedList"
+#define ARRAY_NAME "DynamicArray"
+#define HASH_NAME "DoublyLinkedList+hash"
+#define LOCKED_NAME "LockedDoublyList"
+#define MUTEX_NAME "DoublyLinkedList+mutex"
+#define QSORT_NAME "DoublyLinkedList+qsort"
+#define MAPPED_NAME "MappedDoublyList"
+// the number of operations each thread runs in one sample of the contention benchmark
+#define OPS_PER_THREAD 256
+// the contention benchmark only runs up to this size, since every operation is O(n)
+#define CONTENTION_MAX_SIZE 1000
+// sorting is only measured on lists at least this long
+#define SORT_MIN_SIZE 1000000
+// starting up from a list file is only measured on lists at least this long
+#define MAPPED_MIN_SIZE 1000000
+// the list file written by the benchmark, deleted once it is done
+#define MAPPED_BENCH_PATH "logs/bench-mapped.list"
+#define STREAM_NAME "DoublyLinkedList+stream"
+// streams are only measured on lists at least this long
+#define STREAM_MIN_SIZE 1000000
+#define XOR_NAME "XorDoublyList"
+#define POOLED_NAME "DoublyLinkedList+pool"
+// node layouts are only compared on lists at least this long
+#define XOR_MIN_SIZE 1000000
+#define ARENA_NAME "ArenaDoublyList"
+// the arena is only compared on lists at least this long
+#define ARENA_MIN_SIZE 1000000
+#define CHAIN_NAME "DoublyLinkedList+one_chain"
+// searches of lists laid out at random in memory are only measured on lists at least this long
+#define PREFETCH_MIN_SIZE 1000000
+// compaction is only measured on lists at least this long
+#define COMPACT_MIN_SIZE 1000000
+// the most nodes moved by each compact_step call measured
+#define COMPACT_STEP_NODES 4096
+#define HEAD_WALK_NAME "DoublyLinkedList+from_head"
+#define CHECKPOINT_NAME "DoublyLinkedList+checkpoints"
+#define PARALLEL_NAME "DoublyLinkedList+parallel"
+// parallel searches are only measured on lists at least this long
+#define PARALLEL_SEARCH_MIN_SIZE 1000000
+// the number of checkpoints, and so of segments, of the lists searched in parallel
+#define PARALLEL_SEGMENTS 256
+// the most threads a parallel search is measured with
+#define PARALLEL_BENCH_THREADS 8
+#define RCU_NAME "RcuDoublyList"
+#define RWLOCK_NAME "DoublyLinkedList+rwlock"
+// read-mostly lists are only measured up to this size, since every lookup is O(n)
+#define RCU_BENCH_MAX_SIZE 10000
+// the most reader threads the read-mostly lists are measured with
+#define RCU_BENCH_READERS 16
+// the time the writer of the read-mostly benchmark waits between two changes
+#define RCU_WRITE_GAP_NS 100000
+
+// keeps the compiler from throwing away the results of measured calls
+volatile int64_t sink;
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Builds a list holding the values 0 to length - 1 with append_node,
+ *        so nodes are allocated one at a time like in regular use.
+ *        Note: The caller must clear and free the list.
+ */
+DoublyLinkedList* build_list(uint64_t length) {
+    DoublyLinkedList* list_ptr = (DoublyLinkedList *) calloc(1, sizeof(DoublyLinkedList));
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, i);
+    }
+    return list_ptr;
+}
+
+/**
+ * @brief Stores a fresh random value in every node of the list, in place.
+ */
+void shuffle_values(DoublyLinkedList* list_ptr) {
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        node->data = (int64_t) bench_random();
+    }
+}
+
+/**
+ * @brief Compares two 64-bit integers for qsort.
+ */
+int compare_values(const void* a, const void* b) {
+    int64_t x = *((const int64_t *) a);
+    int64_t y = *((const int64_t *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Bytes of a stream kept in memory, large enough for any stream of the
+ *        lists measured, written from the front and read from read_at.
+ */
+typedef struct {
+    uint8_t* bytes;
+    uint64_t length;
+    uint64_t read_at;
+} MemoryStream;
+
+/**
+ * @brief Takes the bytes of a stream into the MemoryStream in context.
+ */
+bool memory_write(void* context, const uint8_t* bytes, uint64_t length) {
+    MemoryStream* stream = (MemoryStream *) context;
+    memcpy(stream->bytes + stream->length, bytes, length);
+    stream->length += length;
+    return true;
+}
+
+/**
+ * @brief Gives the bytes of the MemoryStream in context.
+ */
+int64_t memory_read(void* context, uint8_t* bytes, uint64_t capacity) {
+    MemoryStream* stream = (MemoryStream *) context;
+    uint64_t length = stream->length - stream->read_at;
+    length = (length < capacity) ? length : capacity;
+    memcpy(bytes, stream->bytes + stream->read_at, length);
+    stream->read_at += length;
+    return length;
+}
+
+/**
+ * @brief Builds a dynamic array holding the values 0 to length - 1.
+ */
+DynamicArray build_array(uint64_t length) {
+    DynamicArray array = {NULL, 0, 0};
+    for (uint64_t i = 0; i < length; i++) {
+        array_append(&array, i);
+    }
+    return array;
+}
+
+/**
+ * @brief Inserts a node holding data after the first node holding after, with
+ *        between_nodes, and returns whether one was found. The list must not
+ *        be empty, and has no pool or hash index.
+ */
+bool insert_after_value(DoublyLinkedList* list_ptr, int64_t after, int64_t data) {
+    Node* node = list_ptr->head;
+    while ((node != NULL) && (node->data != after)) {
+        node = node->next;
+    }
+    if (node == NULL) {
+        return false;
+    } else if (node == list_ptr->tail) {
+        append_node(list_ptr, data);
+    } else {
+        between_nodes(data, node, node->next);
+        list_ptr->size++;
+    }
+    return true;
+}
+
+/**
+ * @brief Unlinks and frees the first node holding data, and returns whether one
+ *        was found. The list has no pool or hash index.
+ */
+bool delete_value(DoublyLinkedList* list_ptr, int64_t data) {
+    Node* node = list_ptr->head;
+    while ((node != NULL) && (node->data != data)) {
+        node = node->next;
+    }
+    if (node == NULL) {
+        return false;
+    } else if (node == list_ptr->head) {
+        delete_first(list_ptr);
+    } else if (node == list_ptr->tail) {
+        delete_last(list_ptr);
+    } else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        release_node(list_ptr->pool, node);
+        list_ptr->size--;
+    }
+    return true;
+}
+
+/**
+ * @brief The lists shared by the threads of a contention sample: a LockedDoublyList,
+ *        or a DoublyLinkedList with one mutex around every call, and the size the
+ *        list was built with.
+ */
+typedef struct {
+    LockedDoublyList* locked_ptr;
+    DoublyLinkedList* list_ptr;
+    pthread_mutex_t lock;
+    uint64_t length;
+} SharedList;
+
+/*** Workers ***/
+
+/**
+ * @brief Runs 40% forward_find, 40% backward_find, 10% inserts next to a random
+ *        node and 10% deletes on the LockedDoublyList. Lookups draw values from
+ *        twice the size of the list so that half of them walk the whole list.
+ *        Every thread deletes the value it inserted last, so the size stays put.
+ */
+void locked_worker(BenchThread* thread) {
+    SharedList* shared = (SharedList *) thread->arg;
+    int64_t own = -1 - (int64_t) thread->index;
+    bool inserted = false;
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        uint64_t roll = bench_thread_random(thread) % 10;
+        int64_t value = bench_thread_random(thread) % (2 * shared->length);
+        if ((roll == 8) && !inserted) {
+            // inserting before a node walks from the tail, after a node from the head
+            inserted = (i % 2 == 0) ? locked_insert_after(shared->locked_ptr, value / 2, own)
+                                    : locked_insert_before(shared->locked_ptr, value / 2, own);
+        } else if ((roll == 9) && inserted) {
+            sink = locked_delete(shared->locked_ptr, own);
+            inserted = false;
+        } else if (roll < 5) {
+            sink = locked_forward_find(shared->locked_ptr, value);
+        } else {
+            sink = locked_backward_find(shared->locked_ptr, value);
+        }
+    }
+    if (inserted) {
+        locked_delete(shared->locked_ptr, own);
+    }
+}
+
+/**
+ * @brief Runs the same mix on the DoublyLinkedList, holding the mutex for every call.
+ */
+void mutex_worker(BenchThread* thread) {
+    SharedList* shared = (SharedList *) thread->arg;
+    int64_t own = -1 - (int64_t) thread->index;
+    bool inserted = false;
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        uint64_t roll = bench_thread_random(thread) % 10;
+        int64_t value = bench_thread_random(thread) % (2 * shared->length);
+        pthread_mutex_lock(&(shared->lock));
+        if ((roll == 8) && !inserted) {
+            inserted = insert_after_value(shared->list_ptr, value / 2, own);
+        } else if ((roll == 9) && inserted) {
+            sink = delete_value(shared->list_ptr, own);
+            inserted = false;
+        } else if (roll < 5) {
+            sink = forward_find(shared->list_ptr, value);
+        } else {
+            sink = backward_find(shared->list_ptr, value);
+        }
+        pthread_mutex_unlock(&(shared->lock));
+    }
+    if (inserted) {
+        pthread_mutex_lock(&(shared->lock));
+        delete_value(shared->list_ptr, own);
+        pthread_mutex_unlock(&(shared->lock));
+    }
+}
+
+/**
+ * @brief The lists shared by the threads of a read-mostly sample: an RcuDoublyList,
+ *        or a DoublyLinkedList with a reader-writer lock around every call, the size
+ *        the lists were built with, and the number of readers still running.
+ */
+typedef struct {
+    RcuDoublyList* rcu_ptr;
+    DoublyLinkedList* list_ptr;
+    pthread_rwlock_t lock;
+    uint64_t length;
+    atomic_int_fast64_t readers_left;
+} ReadMostlyList;
+
+/**
+ * @brief Waits RCU_WRITE_GAP_NS, giving the core to the readers meanwhile.
+ */
+void writer_pause() {
+    struct timespec gap = {0, RCU_WRITE_GAP_NS};
+    nanosleep(&gap, NULL);
+}
+
+/**
+ * @brief Thread 0 is the writer, which replaces the node holding a random value with
+ *        a new one every RCU_WRITE_GAP_NS until the readers are done, and counts no
+ *        operations. Every other thread runs forward_find on the DoublyLinkedList
+ *        under the read lock, for values drawn from twice the size of the list so
+ *        that half of them walk it all.
+ */
+void rwlock_worker(BenchThread* thread) {
+    ReadMostlyList* shared = (ReadMostlyList *) thread->arg;
+    if (thread->index == 0) {
+        while (atomic_load(&(shared->readers_left)) > 0) {
+            int64_t value = bench_thread_random(thread) % shared->length;
+            pthread_rwlock_wrlock(&(shared->lock));
+            int64_t index = forward_find(shared->list_ptr, value);
+            delete_at(shared->list_ptr, index);
+            insert_at(shared->list_ptr, value, index);
+            pthread_rwlock_unlock(&(shared->lock));
+            writer_pause();
+        }
+        thread->ops = 0;
+        return;
+    }
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        int64_t value = bench_thread_random(thread) % (2 * shared->length);
+        pthread_rwlock_rdlock(&(shared->lock));
+        sink = forward_find(shared->list_ptr, value);
+        pthread_rwlock_unlock(&(shared->lock));
+    }
+    atomic_fetch_sub(&(shared->readers_left), 1);
+}
+
+/**
+ * @brief Runs the same mix on the RcuDoublyList, where the writer uses rcu_replace
+ *        and the readers rcu_forward_find, each from a reader slot of its own.
+ */
+void rcu_worker(BenchThread* thread) {
+    ReadMostlyList* shared = (ReadMostlyList *) thread->arg;
+    if (thread->index == 0) {
+        while (atomic_load(&(shared->readers_left)) > 0) {
+            int64_t value = bench_thread_random(thread) % shared->length;
+            rcu_replace(shared->rcu_ptr, value, value);
+            writer_pause();
+        }
+        thread->ops = 0;
+        return;
+    }
+    RcuReader* reader = rcu_register_reader(shared->rcu_ptr);
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        int64_t value = bench_thread_random(thread) % (2 * shared->length);
+        sink = rcu_forward_find(shared->rcu_ptr, reader, value);
+    }
+    rcu_unregister_reader(reader);
+    atomic_fetch_sub(&(shared->readers_left), 1);
+}
+
+/**
+ * @brief Returns the heap bytes in use, counting blocks malloc took with mmap.
+ */
+uint64_t heap_bytes() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+/**
+ * @brief Prints the heap bytes in use and the resident bytes a list added per node,
+ *        from the counts taken before it was built.
+ */
+void print_node_memory(const char* structure, uint64_t length, uint64_t heap_before, uint64_t resident_before) {
+    uint64_t heap = heap_bytes() - heap_before;
+    uint64_t resident = bench_resident_bytes() - resident_before;
+    printf("%s at %lu nodes: %.2f heap bytes per node, %.2f resident bytes per node\n",
+           structure, length, (double) heap / length, (double) resident / length);
+}
+
+/**
+ * @brief Measures walking every node of a DoublyLinkedList from both ends.
+ *        ops/s counts nodes visited per second.
+ */
+void bench_walks(DoublyLinkedList* list_ptr, const char* structure, uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        int64_t sum = 0;
+        for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+            sum += node->data;
+        }
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, structure, "walk_forward", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        int64_t sum = 0;
+        for (Node* node = list_ptr->tail; node != NULL; node = node->prev) {
+            sum += node->data;
+        }
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, structure, "walk_backward", length);
+}
+
+/**
+ * @brief Relinks the nodes of the list in a random order, without moving any
+ *        of them, so that walking the list jumps around memory.
+ */
+void shuffle_links(DoublyLinkedList* list_ptr) {
+    Node** nodes = (Node **) malloc(sizeof(Node *) * list_ptr->size);
+    int64_t count = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        nodes[count++] = node;
+    }
+    for (int64_t i = count - 1; i > 0; i--) {
+        int64_t j = bench_random() % (i + 1);
+        Node* swap = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = swap;
+    }
+    for (int64_t i = 0; i < count; i++) {
+        nodes[i]->prev = (i == 0) ? NULL : nodes[i - 1];
+        nodes[i]->next = (i == count - 1) ? NULL : nodes[i + 1];
+    }
+    list_ptr->head = nodes[0];
+    list_ptr->tail = nodes[count - 1];
+    free(nodes);
+}
+
+/**
+ * @brief Relinks the nodes of the ArenaDoublyList in a random order, without
+ *        moving any of them in the arena.
+ */
+void shuffle_arena_links(ArenaDoublyList* arena_ptr) {
+    uint32_t* order = (uint32_t *) malloc(sizeof(uint32_t) * arena_ptr->size);
+    int64_t count = 0;
+    for (uint32_t at = arena_ptr->head; at != ARENA_NIL; at = arena_ptr->nodes[at].next) {
+        order[count++] = at;
+    }
+    for (int64_t i = count - 1; i > 0; i--) {
+        int64_t j = bench_random() % (i + 1);
+        uint32_t swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+    for (int64_t i = 0; i < count; i++) {
+        arena_ptr->nodes[order[i]].prev = (i == 0) ? ARENA_NIL : order[i - 1];
+        arena_ptr->nodes[order[i]].next = (i == count - 1) ? ARENA_NIL : order[i + 1];
+    }
+    arena_ptr->head = order[0];
+    arena_ptr->tail = order[count - 1];
+    free(order);
+}
+
+/**
+ * @brief Returns the sum of the values of the DoublyLinkedList in list_ptr.
+ */
+int64_t walk_list(void* list_ptr) {
+    int64_t sum = 0;
+    for (Node* node = ((DoublyLinkedList *) list_ptr)->head; node != NULL; node = node->next) {
+        sum += node->data;
+    }
+    return sum;
+}
+
+/**
+ * @brief Returns the sum of the values of the ArenaDoublyList in arena_ptr.
+ */
+int64_t walk_arena(void* arena_ptr) {
+    const ArenaNode* nodes = ((ArenaDoublyList *) arena_ptr)->nodes;
+    int64_t sum = 0;
+    for (uint32_t at = ((ArenaDoublyList *) arena_ptr)->head; at != ARENA_NIL; at = nodes[at].next) {
+        sum += nodes[at].data;
+    }
+    return sum;
+}
+
+/**
+ * @brief Measures walking every node of a list with walk, where ops/s counts nodes
+ *        visited per second, then prints the cache misses per node of one more walk
+ *        when the machine lets them be counted.
+ */
+void bench_walk(int64_t (*walk)(void*), void* list_ptr, const char* structure, const char* operation,
+                uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = walk(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, structure, operation, length);
+
+    int counter = bench_open_cache_misses();
+    uint64_t misses = bench_read_counter(counter);
+    sink = walk(list_ptr);
+    misses = bench_read_counter(counter) - misses;
+    if (counter >= 0) {
+        printf("%s %s at %lu nodes: %.2f cache misses per node\n", structure, operation, length,
+               (double) misses / length);
+    }
+    bench_close_counter(counter);
+}
+
+/**
+ * @brief Returns the index of the first node holding data, walking the list from
+ *        the head as one chain, the way forward_find did before it walked from both
+ *        ends.
+ */
+int64_t chain_find(DoublyLinkedList* list_ptr, int64_t data) {
+    int64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        if (node->data == data) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Returns the data of the node at index, walking the list from the head
+ *        whatever the index, the way a singly linked list has to.
+ */
+int64_t head_get(DoublyLinkedList* list_ptr, int64_t index) {
+    Node* node = list_ptr->head;
+    for (int64_t i = 0; i < index; i++) {
+        node = node->next;
+    }
+    return node->data;
+}
+
+/**
+ * @brief Returns the smallest number of checkpoints k for which k * k is at least
+ *        length, so that the walks between checkpoints are about as long as the
+ *        updates of their indices.
+ */
+int64_t checkpoint_count(uint64_t length) {
+    int64_t count = 1;
+    while ((uint64_t) (count * count) < length) {
+        count++;
+    }
+    return count;
+}
+
+/*** Benchmarks ***/
+
+/**
+ * @brief Measures adding and removing values at both ends of a structure which
+ *        holds length values. Every timed batch of adds is undone by an untimed
+ *        batch of deletes, and the other way around, so the size stays at length.
+ */
+void bench_ends(uint64_t length) {
+    DoublyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+    uint64_t batch = bench_batch(length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            append_node(list_ptr, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_last(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "append_node", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            array_append(&array, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        array.size = length;
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "append", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            prepend_node(list_ptr, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_first(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "prepend_node", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            array_prepend(&array, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            array_delete_first(&array);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "prepend", length);
+
+    // deletes take at most length values out before putting them back
+    uint64_t deletes = (length < BENCH_MIN_SAMPLE_WORK) ? length : BENCH_MIN_SAMPLE_WORK;
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < deletes; i++) {
+            delete_first(list_ptr);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, deletes);
+        for (uint64_t i = 0; i < deletes; i++) {
+            prepend_node(list_ptr, i);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "delete_first", length);
+
+    batch = (batch < length) ? batch : length;
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            array_delete_first(&array);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            array_prepend(&array, i);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "delete_first", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < deletes; i++) {
+            delete_last(list_ptr);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, deletes);
+        for (uint64_t i = 0; i < deletes; i++) {
+            append_node(list_ptr, i);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "delete_last", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < deletes; i++) {
+            array_delete_last(&array);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, deletes);
+        array.size = length;
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "delete_last", length);
+
+    clear(list_ptr);
+    free(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Measures forward_find and backward_find for random values that are in
+ *        the list, against a linear search of the array.
+ */
+void bench_lookups(uint64_t length) {
+    DoublyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+    uint64_t batch = bench_batch(length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = forward_find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "forward_find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = backward_find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "backward_find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = array_find(&array, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "find", length);
+
+    clear(list_ptr);
+    free(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Prints the memory used by a hash index, then measures forward_find and
+ *        backward_find with it, for values that are in the list and for values that
+ *        are not, and what the index adds to appending.
+ */
+void bench_hash_index(uint64_t length) {
+    DoublyLinkedList* list_ptr = build_list(length);
+    enable_hash_index(list_ptr);
+    HashIndexStats stats = hash_index_stats(list_ptr);
+    printf("%s index at %lu nodes: %lu slots, %lu bytes, %.2f bytes per node\n",
+           HASH_NAME, length, stats.capacity, stats.bytes, stats.bytes_per_node);
+    BenchSamples* samples;
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = forward_find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "forward_find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = backward_find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "backward_find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = forward_find(list_ptr, length + bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "find_missing", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            append_node(list_ptr, length + i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_last(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "append", length);
+
+    disable_hash_index(list_ptr);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Measures the mix of the workers on both lists at the given size for
+ *        1, 2, 4, ... BENCH_MAX_THREADS threads.
+ */
+void bench_contention(uint64_t length) {
+    char operation[32];
+    for (uint64_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2) {
+        snprintf(operation, sizeof(operation), "mixed_t%lu", threads);
+
+        SharedList shared;
+        shared.length = length;
+        shared.locked_ptr = create_locked_list();
+        shared.list_ptr = build_list(length);
+        pthread_mutex_init(&(shared.lock), NULL);
+        for (uint64_t i = 0; i < length; i++) {
+            locked_append(shared.locked_ptr, i);
+        }
+
+        BenchSamples* samples = bench_start();
+        while (bench_add_threaded_sample(samples, threads, OPS_PER_THREAD, locked_worker, &shared));
+        bench_report(samples, LOCKED_NAME, operation, length);
+
+        samples = bench_start();
+        while (bench_add_threaded_sample(samples, threads, OPS_PER_THREAD, mutex_worker, &shared));
+        bench_report(samples, MUTEX_NAME, operation, length);
+
+        pthread_mutex_destroy(&(shared.lock));
+        destroy_locked_list(shared.locked_ptr);
+        clear(shared.list_ptr);
+        free(shared.list_ptr);
+    }
+}
+
+/**
+ * @brief Measures clear on a list built with append_node, and on an array.
+ *        Every sample needs a freshly built structure, which is not timed.
+ */
+void bench_clear(uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        DoublyLinkedList* list_ptr = build_list(length);
+        uint64_t start = bench_now_ns();
+        clear(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        free(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "clear", length);
+
+    samples = bench_start();
+    do {
+        DynamicArray array = build_array(length);
+        uint64_t start = bench_now_ns();
+        array_clear(&array);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "clear", length);
+}
+
+/**
+ * @brief Measures radix_sort_list against copying the values out to an array,
+ *        sorting them with qsort and storing them back in the nodes in order.
+ *        Every sample sorts a freshly built list of random values, since a sorted
+ *        list has its nodes scattered in memory, and the building is not timed.
+ *        ops/s counts values sorted per second.
+ */
+void bench_sort(uint64_t length) {
+    if (length < SORT_MIN_SIZE) {
+        return;
+    }
+    BenchSamples* samples = bench_start();
+    do {
+        DoublyLinkedList* list_ptr = build_list(length);
+        shuffle_values(list_ptr);
+        uint64_t start = bench_now_ns();
+        radix_sort_list(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        clear(list_ptr);
+        free(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "radix_sort_list", length);
+
+    samples = bench_start();
+    do {
+        DoublyLinkedList* list_ptr = build_list(length);
+        shuffle_values(list_ptr);
+        uint64_t start = bench_now_ns();
+        int64_t* values = (int64_t *) malloc(sizeof(int64_t) * length);
+        uint64_t i = 0;
+        for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+            values[i++] = node->data;
+        }
+        qsort(values, length, sizeof(int64_t), compare_values);
+        i = 0;
+        for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+            node->data = values[i++];
+        }
+        free(values);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        clear(list_ptr);
+        free(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, QSORT_NAME, "radix_sort_list", length);
+}
+
+/**
+ * @brief Measures starting up from a list file: mapping it with open_mapped_list,
+ *        and mapping it and walking every node, against building the list again
+ *        with append_node for every value, the way it is done without a list
+ *        file. Every operation is one start-up of the whole list, and the file
+ *        is already in the page cache.
+ */
+void bench_mapped(uint64_t length) {
+    if (length < MAPPED_MIN_SIZE) {
+        return;
+    }
+    DoublyLinkedList* list_ptr = build_list(length);
+    save_mapped_list(list_ptr, MAPPED_BENCH_PATH);
+    clear(list_ptr);
+    free(list_ptr);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        MappedDoublyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        close_mapped_list(mapped_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, MAPPED_NAME, "open_mapped_list", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        MappedDoublyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+        int64_t sum = 0;
+        for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node)) {
+            sum += node->data;
+        }
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        close_mapped_list(mapped_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, MAPPED_NAME, "open_and_walk", length);
+
+    MappedDoublyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        list_ptr = (DoublyLinkedList *) calloc(1, sizeof(DoublyLinkedList));
+        for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node)) {
+            append_node(list_ptr, node->data);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        clear(list_ptr);
+        free(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "rebuild", length);
+    close_mapped_list(mapped_ptr);
+    remove(MAPPED_BENCH_PATH);
+}
+
+/**
+ * @brief Measures writing a list to a stream in memory with encode_list, and
+ *        reading it back into a new list with decode_list, against shipping the
+ *        raw values: copying them to an array of 8 bytes per value, and calling
+ *        append_node for every value of the array. Lists of consecutive values,
+ *        of values a small random step apart, and of random 64-bit values are
+ *        measured, and the bytes per value of each stream are printed. ops/s
+ *        counts values per second.
+ */
+void bench_stream(uint64_t length) {
+    if (length < STREAM_MIN_SIZE) {
+        return;
+    }
+    const char* kinds[3] = {"consecutive", "close", "random"};
+    MemoryStream stream = {(uint8_t *) malloc(STREAM_VARINT_BYTES * length + 64), 0, 0};
+    char operation[32];
+    for (int kind = 0; kind < 3; kind++) {
+        DoublyLinkedList* list_ptr = build_list(length);
+        int64_t value = 0;
+        for (Node* node = list_ptr->head; (node != NULL) && (kind > 0); node = node->next) {
+            value += (int64_t) (bench_random() % 201) - 100;
+            node->data = (kind == 1) ? value : (int64_t) bench_random();
+        }
+
+        BenchSamples* samples = bench_start();
+        do {
+            stream.length = 0;
+            uint64_t start = bench_now_ns();
+            encode_list(list_ptr, memory_write, &stream);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+        } while (bench_wants_more(samples));
+        snprintf(operation, sizeof(operation), "encode_%s", kinds[kind]);
+        bench_report(samples, STREAM_NAME, operation, length);
+        printf("Stream of %s values at %lu values: %lu bytes, %.2f bytes per value\n",
+               kinds[kind], length, stream.length, (double) stream.length / length);
+
+        samples = bench_start();
+        do {
+            stream.read_at = 0;
+            DoublyLinkedList decoded = {0};
+            uint64_t start = bench_now_ns();
+            decode_list(&decoded, memory_read, &stream);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+            clear(&decoded);
+        } while (bench_wants_more(samples));
+        snprintf(operation, sizeof(operation), "decode_%s", kinds[kind]);
+        bench_report(samples, STREAM_NAME, operation, length);
+        clear(list_ptr);
+        free(list_ptr);
+    }
+
+    DoublyLinkedList* list_ptr = build_list(length);
+    int64_t* values = (int64_t *) stream.bytes;
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        uint64_t i = 0;
+        for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+            values[i++] = node->data;
+        }
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "raw_export", length);
+
+    samples = bench_start();
+    do {
+        DoublyLinkedList decoded = {0};
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < length; i++) {
+            append_node(&decoded, values[i]);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        clear(&decoded);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "raw_import", length);
+    clear(list_ptr);
+    free(list_ptr);
+    free(stream.bytes);
+}
+
+/**
+ * @brief Compares the memory and walking speed of the XorDoublyList, with one link per
+ *        node, against the DoublyLinkedList with a malloc call per node and with a
+ *        NodePool. The heap bytes in use and the resident bytes each list adds are
+ *        printed per node, then every node is walked from both ends, and forward_find
+ *        looks for random values. Each list is built by appends, so its nodes lie in
+ *        order in memory.
+ */
+void bench_xor(uint64_t length) {
+    if (length < XOR_MIN_SIZE) {
+        return;
+    }
+    malloc_trim(0);
+    uint64_t heap_before = heap_bytes();
+    uint64_t resident_before = bench_resident_bytes();
+    DoublyLinkedList* list_ptr = build_list(length);
+    print_node_memory(LIST_NAME, length, heap_before, resident_before);
+    bench_walks(list_ptr, LIST_NAME, length);
+    clear(list_ptr);
+    free(list_ptr);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    NodePool* pool = create_node_pool(XOR_DEFAULT_NODES_PER_SLAB);
+    list_ptr = (DoublyLinkedList *) calloc(1, sizeof(DoublyLinkedList));
+    attach_pool(list_ptr, pool);
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, i);
+    }
+    print_node_memory(POOLED_NAME, length, heap_before, resident_before);
+    bench_walks(list_ptr, POOLED_NAME, length);
+    uint64_t batch = bench_batch(length);
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = forward_find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, POOLED_NAME, "forward_find", length);
+    clear(list_ptr);
+    free(list_ptr);
+    destroy_node_pool(pool);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    XorDoublyList* xor_ptr = create_xor_list(0);
+    for (uint64_t i = 0; i < length; i++) {
+        xor_append(xor_ptr, i);
+    }
+    print_node_memory(XOR_NAME, length, heap_before, resident_before);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        int64_t sum = 0;
+        XorCursor cursor = xor_cursor_head(xor_ptr);
+        while (cursor.node != NULL) {
+            sum += cursor.node->data;
+            xor_cursor_next(&cursor);
+        }
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, XOR_NAME, "walk_forward", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        int64_t sum = 0;
+        XorCursor cursor = xor_cursor_tail(xor_ptr);
+        do {
+            sum += cursor.node->data;
+        } while (xor_cursor_prev(&cursor));
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, XOR_NAME, "walk_backward", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = xor_forward_find(xor_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, XOR_NAME, "forward_find", length);
+    destroy_xor_list(xor_ptr);
+}
+
+/**
+ * @brief Compares the ArenaDoublyList, with 16 byte nodes linked by 32-bit indices,
+ *        against the DoublyLinkedList with a malloc call per node and with a NodePool.
+ *        The heap bytes in use and the resident bytes each list adds are printed per
+ *        node. Every list is walked with its nodes linked in the order they lie in
+ *        memory, and again once they are relinked in a random order, when nearly
+ *        every step is a cache miss. Last, arena_copy is measured against building
+ *        the list again with append_node.
+ */
+void bench_arena(uint64_t length) {
+    if (length < ARENA_MIN_SIZE) {
+        return;
+    }
+    malloc_trim(0);
+    uint64_t heap_before = heap_bytes();
+    uint64_t resident_before = bench_resident_bytes();
+    DoublyLinkedList* list_ptr = build_list(length);
+    print_node_memory(LIST_NAME, length, heap_before, resident_before);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_in_order", length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    NodePool* pool = create_node_pool(XOR_DEFAULT_NODES_PER_SLAB);
+    list_ptr = (DoublyLinkedList *) calloc(1, sizeof(DoublyLinkedList));
+    attach_pool(list_ptr, pool);
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, i);
+    }
+    print_node_memory(POOLED_NAME, length, heap_before, resident_before);
+    bench_walk(walk_list, list_ptr, POOLED_NAME, "walk_in_order", length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, POOLED_NAME, "walk_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+    destroy_node_pool(pool);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    ArenaDoublyList* arena_ptr = create_arena_list(length);
+    for (uint64_t i = 0; i < length; i++) {
+        arena_append(arena_ptr, i);
+    }
+    print_node_memory(ARENA_NAME, length, heap_before, resident_before);
+    bench_walk(walk_arena, arena_ptr, ARENA_NAME, "walk_in_order", length);
+    shuffle_arena_links(arena_ptr);
+    bench_walk(walk_arena, arena_ptr, ARENA_NAME, "walk_shuffled", length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        ArenaDoublyList* copy_ptr = arena_copy(arena_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_arena_list(copy_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARENA_NAME, "arena_copy", length);
+    destroy_arena_list(arena_ptr);
+
+    list_ptr = build_list(length);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        DoublyLinkedList copied = {0};
+        for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+            append_node(&copied, node->data);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        clear(&copied);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "copy", length);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Compares searching a list for a value it does not hold, so every node is
+ *        compared, as one chain from the head against forward_find and backward_find,
+ *        which walk from both ends at once. The nodes are relinked in a random order
+ *        first, so that nearly every step is a cache miss once the list is larger than
+ *        the cache. ops/s counts the nodes compared per second.
+ */
+void bench_prefetch(uint64_t length) {
+    if (length < PREFETCH_MIN_SIZE) {
+        return;
+    }
+    DoublyLinkedList* list_ptr = build_list(length);
+    shuffle_links(list_ptr);
+    int64_t missing = -1;
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = chain_find(list_ptr, missing);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, CHAIN_NAME, "find_shuffled", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = forward_find(list_ptr, missing);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "forward_find_shuffled", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = backward_find(list_ptr, missing);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "backward_find_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Walks a list of malloc'd nodes relinked in a random order, moves it into one
+ *        block of a NodePool of its own with compact_list, and walks it again. The same list is
+ *        then shuffled once more and compacted by compact_step calls of
+ *        COMPACT_STEP_NODES nodes, each measured as one sample, to show the pause a
+ *        single step costs.
+ */
+void bench_compact(uint64_t length) {
+    if (length < COMPACT_MIN_SIZE) {
+        return;
+    }
+    DoublyLinkedList* list_ptr = build_list(length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_shuffled", length);
+
+    uint64_t start = bench_now_ns();
+    compact_list(list_ptr, NULL, NULL);
+    uint64_t elapsed = bench_now_ns() - start;
+    printf("%s compact_list at %lu nodes: %.1f ms, %.1f ns per node\n", LIST_NAME, length,
+           elapsed / 1e6, (double) elapsed / length);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_compacted", length);
+
+    shuffle_links(list_ptr);
+    BenchSamples* samples = bench_start();
+    bool more = true;
+    while (more) {
+        start = bench_now_ns();
+        more = compact_step(list_ptr, COMPACT_STEP_NODES, NULL, NULL);
+        bench_add_sample(samples, bench_now_ns() - start, COMPACT_STEP_NODES);
+    }
+    bench_report(samples, LIST_NAME, "compact_step", length);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_stepped", length);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/*** Program Starting Point */
+/**
+ * @brief Measures get at random indices walking from the head, from the closer end,
+ *        and from the nearest of about sqrt(length) checkpoints, then insert_at and
+ *        delete_at at random indices, with and without the checkpoints. Every insert
+ *        is followed by a delete at the same index, so the size stays at length.
+ */
+void bench_positional(uint64_t length) {
+    DoublyLinkedList* list_ptr = build_list(length);
+    uint64_t batch = bench_batch(length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = head_get(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HEAD_WALK_NAME, "get", length);
+
+    for (int with_checkpoints = 0; with_checkpoints < 2; with_checkpoints++) {
+        const char* structure = LIST_NAME;
+        if (with_checkpoints) {
+            structure = CHECKPOINT_NAME;
+            enable_checkpoints(list_ptr, checkpoint_count(length));
+        }
+        samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            for (uint64_t i = 0; i < batch; i++) {
+                sink = *get(list_ptr, bench_random() % length);
+            }
+            bench_add_sample(samples, bench_now_ns() - start, batch);
+        } while (bench_wants_more(samples));
+        bench_report(samples, structure, "get", length);
+
+        samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            for (uint64_t i = 0; i < batch; i++) {
+                int64_t index = bench_random() % length;
+                insert_at(list_ptr, i, index);
+                delete_at(list_ptr, index);
+            }
+            bench_add_sample(samples, bench_now_ns() - start, 2 * batch);
+        } while (bench_wants_more(samples));
+        bench_report(samples, structure, "insert_at+delete_at", length);
+    }
+
+    disable_checkpoints(list_ptr);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Measures forward_find against parallel_find with 2 up to PARALLEL_BENCH_THREADS
+ *        threads, for values at random places in the list and for missing values,
+ *        which make every segment be scanned.
+ */
+void bench_parallel(uint64_t length) {
+    if (length < PARALLEL_SEARCH_MIN_SIZE) {
+        return;
+    }
+    DoublyLinkedList* list_ptr = build_list(length);
+    enable_checkpoints(list_ptr, PARALLEL_SEGMENTS);
+    uint64_t batch = bench_batch(length);
+
+    for (int missing = 0; missing < 2; missing++) {
+        const char* operation = missing ? "find_missing" : "find";
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            for (uint64_t i = 0; i < batch; i++) {
+                sink = forward_find(list_ptr, missing ? -1 : (int64_t) (bench_random() % length));
+            }
+            bench_add_sample(samples, bench_now_ns() - start, batch);
+        } while (bench_wants_more(samples));
+        bench_report(samples, LIST_NAME, operation, length);
+
+        for (int64_t threads = 2; threads <= PARALLEL_BENCH_THREADS; threads *= 2) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%ld", PARALLEL_NAME, threads);
+            samples = bench_start();
+            do {
+                uint64_t start = bench_now_ns();
+                for (uint64_t i = 0; i < batch; i++) {
+                    sink = parallel_find(list_ptr, missing ? -1 : (int64_t) (bench_random() % length), threads);
+                }
+                bench_add_sample(samples, bench_now_ns() - start, batch);
+            } while (bench_wants_more(samples));
+            bench_report(samples, name, operation, length);
+        }
+    }
+
+    disable_checkpoints(list_ptr);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Measures the lookups of 1, 2, 4, ... RCU_BENCH_READERS readers on both
+ *        read-mostly lists at the given size, with one writer changing the list
+ *        now and then. ops/s counts the lookups of all the readers together.
+ */
+void bench_read_mostly(uint64_t length) {
+    if (length > RCU_BENCH_MAX_SIZE) {
+        return;
+    }
+    ReadMostlyList shared;
+    shared.length = length;
+    shared.rcu_ptr = create_rcu_list();
+    shared.list_ptr = build_list(length);
+    pthread_rwlock_init(&(shared.lock), NULL);
+    for (uint64_t i = 0; i < length; i++) {
+        rcu_append(shared.rcu_ptr, i);
+    }
+
+    char operation[32];
+    for (uint64_t readers = 1; readers <= RCU_BENCH_READERS; readers *= 2) {
+        snprintf(operation, sizeof(operation), "find_r%lu", readers);
+        BenchSamples* samples = bench_start();
+        do {
+            atomic_store(&(shared.readers_left), readers);
+        } while (bench_add_threaded_sample(samples, readers + 1, OPS_PER_THREAD, rwlock_worker, &shared));
+        bench_report(samples, RWLOCK_NAME, operation, length);
+
+        samples = bench_start();
+        do {
+            atomic_store(&(shared.readers_left), readers);
+        } while (bench_add_threaded_sample(samples, readers + 1, OPS_PER_THREAD, rcu_worker, &shared));
+        bench_report(samples, RCU_NAME, operation, length);
+    }
+
+    pthread_rwlock_destroy(&(shared.lock));
+    destroy_rcu_list(shared.rcu_ptr);
+    clear(shared.list_ptr);
+    free(shared.list_ptr);
+}
+
+int main(int argc, char** argv) {
+    uint64_t max_size = bench_max_size(argc, argv);
+    if (!bench_open_csv(BENCH_CSV_PATH)) {
+        printf("Could not open %s, results are only printed.\n", BENCH_CSV_PATH);
+    }
+    bench_seed(12);
+    for (uint64_t length = 10; length <= max_size; length *= 10) {
+        bench_ends(length);
+        bench_lookups(length);
+        bench_hash_index(length);
+        bench_clear(length);
+        bench_sort(length);
+        bench_mapped(length);
+        bench_stream(length);
+        bench_xor(length);
+        bench_arena(length);
+        bench_prefetch(length);
+        bench_compact(length);
+        bench_positional(length);
+        bench_parallel(length);
+        bench_read_mostly(length);
+        if (length <= CONTENTION_MAX_SIZE) {
+            bench_contention(length);
+        }
+    }
+    // only built with make bench STATS=1, in which case every time above includes the counting
+    ListStats stats = list_stats_snapshot();
+    if (stats.enabled) {
+        printf("Instrumentation of the main thread:\n");
+        list_stats_print(&stats);
+    }
+    bench_close_csv();
+    return 0;
+}
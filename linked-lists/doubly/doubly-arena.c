@@ -0,0 +1,223 @@
+/*
+This document is meant to store the implementation of the arena mode of the
+doubly linked list. Nodes are stored in one array which is grown with realloc,
+and are linked by their indices in it, so the list stays valid wherever the
+array is moved or copied.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdlib.h>
+#include<string.h>
+#include"doubly-arena.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Doubles the number of nodes the arena has room for, up to
+ *        ARENA_MAX_NODES. Returns false if it is full or realloc failed.
+ */
+static bool grow_arena(ArenaDoublyList* arena_ptr) {
+    if (arena_ptr->capacity == ARENA_MAX_NODES) {
+        return false;
+    }
+    uint64_t capacity = 2 * (uint64_t) arena_ptr->capacity;
+    if (capacity > ARENA_MAX_NODES) {
+        capacity = ARENA_MAX_NODES;
+    }
+    ArenaNode* nodes = (ArenaNode *) realloc(arena_ptr->nodes, capacity * sizeof(ArenaNode));
+    if (nodes == NULL) {
+        return false;
+    }
+    arena_ptr->nodes = nodes;
+    arena_ptr->capacity = (uint32_t) capacity;
+    return true;
+}
+
+/**
+ * @brief Takes a slot for a new node holding data, from the deleted nodes
+ *        first, and returns its index, or ARENA_NIL if the arena could not grow.
+ */
+static uint32_t arena_slot(ArenaDoublyList* arena_ptr, int64_t data) {
+    uint32_t at = arena_ptr->free_list;
+    if (at != ARENA_NIL) {
+        arena_ptr->free_list = arena_ptr->nodes[at].next;
+    } else {
+        if ((arena_ptr->used == arena_ptr->capacity) && !grow_arena(arena_ptr)) {
+            return ARENA_NIL;
+        }
+        at = arena_ptr->used++;
+    }
+    arena_ptr->nodes[at].data = data;
+    return at;
+}
+
+/*** ArenaDoublyList Functions ***/
+
+ArenaDoublyList* create_arena_list(uint32_t capacity) {
+    if (capacity == 0) {
+        capacity = ARENA_DEFAULT_CAPACITY;
+    } else if (capacity > ARENA_MAX_NODES) {
+        capacity = ARENA_MAX_NODES;
+    }
+    ArenaDoublyList* arena_ptr = (ArenaDoublyList *) malloc(sizeof(ArenaDoublyList));
+    ArenaNode* nodes = (ArenaNode *) malloc((uint64_t) capacity * sizeof(ArenaNode));
+    if ((arena_ptr == NULL) || (nodes == NULL)) {
+        free(arena_ptr);
+        free(nodes);
+        return NULL;
+    }
+    arena_ptr->nodes = nodes;
+    arena_ptr->capacity = capacity;
+    clear_arena_list(arena_ptr);
+    return arena_ptr;
+}
+
+ArenaDoublyList* arena_from_list(DoublyLinkedList* list_ptr) {
+    if (list_ptr->size > ARENA_MAX_NODES) {
+        return NULL;
+    }
+    ArenaDoublyList* arena_ptr = create_arena_list((uint32_t) list_ptr->size);
+    if (arena_ptr == NULL) {
+        return NULL;
+    }
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        arena_append(arena_ptr, node->data);
+    }
+    return arena_ptr;
+}
+
+ArenaDoublyList* arena_copy(ArenaDoublyList* arena_ptr) {
+    ArenaDoublyList* copy_ptr = create_arena_list(arena_ptr->capacity);
+    if (copy_ptr == NULL) {
+        return NULL;
+    }
+    ArenaNode* nodes = copy_ptr->nodes;
+    *copy_ptr = *arena_ptr;
+    copy_ptr->nodes = nodes;
+    memcpy(nodes, arena_ptr->nodes, (uint64_t) arena_ptr->used * sizeof(ArenaNode));
+    return copy_ptr;
+}
+
+void destroy_arena_list(ArenaDoublyList* arena_ptr) {
+    free(arena_ptr->nodes);
+    free(arena_ptr);
+}
+
+void clear_arena_list(ArenaDoublyList* arena_ptr) {
+    arena_ptr->used = 0;
+    arena_ptr->head = ARENA_NIL;
+    arena_ptr->tail = ARENA_NIL;
+    arena_ptr->free_list = ARENA_NIL;
+    arena_ptr->size = 0;
+}
+
+uint32_t arena_size(ArenaDoublyList* arena_ptr) {
+    return arena_ptr->size;
+}
+
+uint32_t arena_head(ArenaDoublyList* arena_ptr) {
+    return arena_ptr->head;
+}
+
+uint32_t arena_tail(ArenaDoublyList* arena_ptr) {
+    return arena_ptr->tail;
+}
+
+uint32_t arena_next(ArenaDoublyList* arena_ptr, uint32_t at) {
+    return arena_ptr->nodes[at].next;
+}
+
+uint32_t arena_prev(ArenaDoublyList* arena_ptr, uint32_t at) {
+    return arena_ptr->nodes[at].prev;
+}
+
+int64_t arena_data(ArenaDoublyList* arena_ptr, uint32_t at) {
+    return arena_ptr->nodes[at].data;
+}
+
+int64_t arena_forward_find(ArenaDoublyList* arena_ptr, int64_t data) {
+    const ArenaNode* nodes = arena_ptr->nodes;
+    int64_t index = 0;
+    for (uint32_t at = arena_ptr->head; at != ARENA_NIL; at = nodes[at].next) {
+        if (nodes[at].data == data) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+int64_t arena_backward_find(ArenaDoublyList* arena_ptr, int64_t data) {
+    const ArenaNode* nodes = arena_ptr->nodes;
+    int64_t index = 0;
+    for (uint32_t at = arena_ptr->tail; at != ARENA_NIL; at = nodes[at].prev) {
+        if (nodes[at].data == data) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+bool arena_append(ArenaDoublyList* arena_ptr, int64_t data) {
+    return arena_insert_between(arena_ptr, arena_ptr->tail, ARENA_NIL, data) != ARENA_NIL;
+}
+
+bool arena_prepend(ArenaDoublyList* arena_ptr, int64_t data) {
+    return arena_insert_between(arena_ptr, ARENA_NIL, arena_ptr->head, data) != ARENA_NIL;
+}
+
+uint32_t arena_insert_between(ArenaDoublyList* arena_ptr, uint32_t prev, uint32_t next, int64_t data) {
+    uint32_t at = arena_slot(arena_ptr, data);
+    if (at == ARENA_NIL) {
+        return ARENA_NIL;
+    }
+    ArenaNode* nodes = arena_ptr->nodes;
+    nodes[at].prev = prev;
+    nodes[at].next = next;
+    if (prev == ARENA_NIL) {
+        arena_ptr->head = at;
+    } else {
+        nodes[prev].next = at;
+    }
+    if (next == ARENA_NIL) {
+        arena_ptr->tail = at;
+    } else {
+        nodes[next].prev = at;
+    }
+    arena_ptr->size++;
+    return at;
+}
+
+void arena_delete(ArenaDoublyList* arena_ptr, uint32_t at) {
+    ArenaNode* nodes = arena_ptr->nodes;
+    uint32_t prev = nodes[at].prev;
+    uint32_t next = nodes[at].next;
+    if (prev == ARENA_NIL) {
+        arena_ptr->head = next;
+    } else {
+        nodes[prev].next = next;
+    }
+    if (next == ARENA_NIL) {
+        arena_ptr->tail = prev;
+    } else {
+        nodes[next].prev = prev;
+    }
+    arena_ptr->size--;
+    nodes[at].next = arena_ptr->free_list;
+    arena_ptr->free_list = at;
+}
+
+void arena_delete_first(ArenaDoublyList* arena_ptr) {
+    if (arena_ptr->head != ARENA_NIL) {
+        arena_delete(arena_ptr, arena_ptr->head);
+    }
+}
+
+void arena_delete_last(ArenaDoublyList* arena_ptr) {
+    if (arena_ptr->tail != ARENA_NIL) {
+        arena_delete(arena_ptr, arena_ptr->tail);
+    }
+}
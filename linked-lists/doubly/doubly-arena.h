@@ -0,0 +1,235 @@
+/*
+This header file is used to declare the ArenaNode struct, and the functions
+used to manage the arena mode of the doubly linked list, where every node
+lives in one contiguous array and links to its neighbours by their 32-bit
+indices in the array instead of by their addresses.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYARENA_H
+#define DOUBLYARENA_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"doubly-linked.h"
+
+/*** Constants ***/
+// the index which stands for no node, like NULL does for a pointer
+#define ARENA_NIL UINT32_MAX
+// the most nodes an arena can hold, since ARENA_NIL is not a node
+#define ARENA_MAX_NODES (ARENA_NIL - 1)
+// the number of nodes a new arena has room for when no capacity is given
+#define ARENA_DEFAULT_CAPACITY 1024
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @struct ArenaNode
+ * @brief A node of an ArenaDoublyList, 16 bytes instead of the 24 bytes of a Node.
+ */
+typedef struct {
+    int64_t data;            /**< The data stored in this node */
+    uint32_t prev;           /**< The index of the previous node in the arena, or ARENA_NIL for the first node */
+    uint32_t next;           /**< The index of the next node in the arena, or ARENA_NIL for the last node */
+} ArenaNode;
+
+/**
+ * @struct ArenaDoublyList
+ * @brief A doubly linked list whose nodes all live in one array.
+ *
+ * Nodes are added at the end of the array, which doubles with realloc when it is
+ * full, and deleted nodes are kept on a free list (linked through next) to be
+ * reused first. Since no node holds an address, the array can be moved or copied
+ * with memcpy and still be the same list.
+ *
+ * @note Nodes are named by their index in the arena, which stays the same for as
+ *       long as the node is in the list, even when the arena moves.
+ */
+typedef struct {
+    ArenaNode* nodes;        /**< The arena, holding capacity nodes */
+    uint32_t capacity;       /**< The number of nodes the arena has room for */
+    uint32_t used;           /**< The number of nodes of the arena ever used */
+    uint32_t head;           /**< The index of the first node, or ARENA_NIL if the list is empty */
+    uint32_t tail;           /**< The index of the last node, or ARENA_NIL if the list is empty */
+    uint32_t free_list;      /**< The index of a deleted node waiting to be reused, or ARENA_NIL */
+    uint32_t size;           /**< The number of nodes in the list */
+} ArenaDoublyList;
+
+
+/*** ArenaDoublyList Functions ***/
+
+/**
+ * @brief Creates an empty ArenaDoublyList.
+ *
+ * @param capacity The number of nodes the arena has room for before it has to grow,
+ *        or 0 to use ARENA_DEFAULT_CAPACITY
+ * @return Pointer to the new ArenaDoublyList, or NULL if memory allocation fails
+ * @note The caller must call destroy_arena_list when the list is no longer needed.
+ */
+ArenaDoublyList* create_arena_list(uint32_t capacity);
+
+/**
+ * @brief Creates an ArenaDoublyList holding the values of a DoublyLinkedList in order,
+ *        with the nodes one after the other in the arena.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to copy
+ * @return Pointer to the new ArenaDoublyList, or NULL if memory allocation fails or
+ *         the list is longer than ARENA_MAX_NODES
+ */
+ArenaDoublyList* arena_from_list(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Copies the list with a single memcpy of its arena, without walking a single node.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to copy
+ * @return Pointer to the new ArenaDoublyList, in which every node has the same index,
+ *         or NULL if memory allocation fails
+ */
+ArenaDoublyList* arena_copy(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Frees the arena of the list, and then the list itself.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to destroy
+ */
+void destroy_arena_list(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Deletes every node of the list, keeping the arena so that new nodes are stored
+ *        in it again from the start.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to clear
+ */
+void clear_arena_list(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Returns the number of nodes in the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @return uint32_t The number of nodes
+ */
+uint32_t arena_size(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Returns the index in the arena of the first node of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @return uint32_t The index of the head, or ARENA_NIL if the list is empty
+ */
+uint32_t arena_head(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Returns the index in the arena of the last node of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @return uint32_t The index of the tail, or ARENA_NIL if the list is empty
+ */
+uint32_t arena_tail(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Returns the index in the arena of the node after a node.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @param at The index in the arena of a node of the list
+ * @return uint32_t The index of the next node, or ARENA_NIL if at is the tail
+ */
+uint32_t arena_next(ArenaDoublyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Returns the index in the arena of the node before a node.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @param at The index in the arena of a node of the list
+ * @return uint32_t The index of the previous node, or ARENA_NIL if at is the head
+ */
+uint32_t arena_prev(ArenaDoublyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Returns the data of a node.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList
+ * @param at The index in the arena of a node of the list
+ * @return int64_t The data stored in the node
+ */
+int64_t arena_data(ArenaDoublyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Searches for a value from the head to the tail of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the first node holding the value, counted from the
+ *         head, or -1 if the value was not found.
+ */
+int64_t arena_forward_find(ArenaDoublyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Searches for a value from the tail to the head of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the last node holding the value, counted from the
+ *         tail, or -1 if the value was not found.
+ */
+int64_t arena_backward_find(ArenaDoublyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Appends a new node with the specified data to the end of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to append to
+ * @param data The value to store in the new node
+ * @return true if the node was appended, false if the arena could not grow
+ */
+bool arena_append(ArenaDoublyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node with the specified data at the beginning of the list.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to prepend to
+ * @param data The value to store in the new node
+ * @return true if the node was prepended, false if the arena could not grow
+ */
+bool arena_prepend(ArenaDoublyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Creates a new node and inserts it between two adjacent nodes.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to insert into
+ * @param prev The index of the node that should precede the new node, or ARENA_NIL to
+ *        insert it at the head
+ * @param next The index of the node that should follow the new node, or ARENA_NIL to
+ *        insert it at the tail
+ * @param data The value to store in the new node
+ * @return uint32_t The index in the arena of the new node, or ARENA_NIL if the arena
+ *         could not grow
+ * @note prev and next must be adjacent nodes of the list, like for between_nodes.
+ */
+uint32_t arena_insert_between(ArenaDoublyList* arena_ptr, uint32_t prev, uint32_t next, int64_t data);
+
+/**
+ * @brief Deletes a node from the list. Its slot is reused by the next node added.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to delete from
+ * @param at The index in the arena of a node of the list
+ */
+void arena_delete(ArenaDoublyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Deletes the first node of the list, if there is one.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to delete from
+ */
+void arena_delete_first(ArenaDoublyList* arena_ptr);
+
+/**
+ * @brief Deletes the last node of the list, if there is one.
+ *
+ * @param arena_ptr Pointer to the ArenaDoublyList to delete from
+ */
+void arena_delete_last(ArenaDoublyList* arena_ptr);
+
+#endif
@@ -0,0 +1,295 @@
+/*
+This header file is used to generate doubly linked lists specialized for any
+type of element. DEFINE_DOUBLY_LIST stamps out a node struct which stores the
+element inline, a list struct, and the functions of the list, all calling the
+equality and hash functions given for the type directly, so that the compiler
+can inline them and no call goes through a function pointer.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYGENERIC_H
+#define DOUBLYGENERIC_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdlib.h>
+
+/*** Constants ***/
+// the number of slots the hash index of a generated list starts with, always a power of two
+#define GENERIC_HASH_MIN_CAPACITY 16
+
+
+/*** List Generator ***/
+
+/**
+ * @def DEFINE_DOUBLY_LIST
+ * @brief Defines a doubly linked list of elements of type Type.
+ *
+ * The macro defines:
+ * - Name##Node, holding a Type in data and pointers to the previous and next nodes.
+ * - Name, holding the head, tail and size of the list, and its hash index. A Name is
+ *   empty when it is zeroed, e.g. Name list = {0}.
+ * - prefix_is_empty, prefix_append, prefix_prepend, prefix_forward_find,
+ *   prefix_backward_find, prefix_contains, prefix_delete_first, prefix_delete_last,
+ *   prefix_delete_node and prefix_clear, which behave like the functions of the
+ *   DoublyLinkedList of the same name, but take elements by pointer.
+ * - prefix_enable_hash_index and prefix_disable_hash_index, which keep an
+ *   open-addressing table counting the nodes holding every element, so that
+ *   prefix_contains takes O(1) time, and the finds return at once for elements which
+ *   are not in the list.
+ *
+ * @param Name The name of the list type, e.g. PointList
+ * @param prefix The prefix of the function names, e.g. point_list
+ * @param Type The type of the elements, stored by value in every node
+ * @param equal A function or macro taking two const Type* and returning true if the
+ *        elements are equal
+ * @param hash A function or macro taking a const Type* and returning a uint64_t, the
+ *        same for every pair of elements which are equal. It is only called while the
+ *        hash index is enabled.
+ * @note Every function is static inline, so the macro may be used in any number of
+ *       files, and functions which are not called are not compiled in.
+ */
+#define DEFINE_DOUBLY_LIST(Name, prefix, Type, equal, hash)                                   \
+                                                                                              \
+typedef struct Name##Node {                                                                   \
+    Type data;                                                                                \
+    struct Name##Node* prev;                                                                  \
+    struct Name##Node* next;                                                                  \
+} Name##Node;                                                                                 \
+                                                                                              \
+typedef struct {                                                                              \
+    Type data;                                                                                \
+    uint64_t count;                                                                           \
+} Name##HashSlot;                                                                             \
+                                                                                              \
+typedef struct {                                                                              \
+    Name##Node* head;                                                                         \
+    Name##Node* tail;                                                                         \
+    uint64_t size;                                                                            \
+    Name##HashSlot* slots;                                                                    \
+    uint64_t capacity;                                                                        \
+    uint64_t used;                                                                            \
+} Name;                                                                                       \
+                                                                                              \
+/* returns the slot holding the element, or the empty slot it would be stored in */          \
+static inline Name##HashSlot* prefix##_hash_slot(Name* list_ptr, const Type* data) {          \
+    uint64_t mask = list_ptr->capacity - 1;                                                   \
+    uint64_t i = (hash(data)) & mask;                                                         \
+    while ((list_ptr->slots[i].count != 0) && !(equal(&(list_ptr->slots[i].data), data))) {   \
+        i = (i + 1) & mask;                                                                   \
+    }                                                                                         \
+    return &(list_ptr->slots[i]);                                                             \
+}                                                                                             \
+                                                                                              \
+/* moves every used slot into a new table of the given capacity */                           \
+static inline bool prefix##_hash_resize(Name* list_ptr, uint64_t capacity) {                  \
+    Name##HashSlot* old_slots = list_ptr->slots;                                              \
+    uint64_t old_capacity = list_ptr->capacity;                                               \
+    Name##HashSlot* slots = (Name##HashSlot *) calloc(capacity, sizeof(Name##HashSlot));      \
+    if (slots == NULL) {                                                                      \
+        return false;                                                                         \
+    }                                                                                         \
+    list_ptr->slots = slots;                                                                  \
+    list_ptr->capacity = capacity;                                                            \
+    for (uint64_t i = 0; i < old_capacity; i++) {                                             \
+        if (old_slots[i].count != 0) {                                                        \
+            *prefix##_hash_slot(list_ptr, &(old_slots[i].data)) = old_slots[i];               \
+        }                                                                                     \
+    }                                                                                         \
+    free(old_slots);                                                                          \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline void prefix##_disable_hash_index(Name* list_ptr) {                              \
+    free(list_ptr->slots);                                                                    \
+    list_ptr->slots = NULL;                                                                   \
+    list_ptr->capacity = 0;                                                                   \
+    list_ptr->used = 0;                                                                       \
+}                                                                                             \
+                                                                                              \
+/* counts one more node holding the element, keeping the table at most half full,   */      \
+/* and drops the index if it can not grow, since it would no longer be complete      */      \
+static inline void prefix##_hash_add(Name* list_ptr, const Type* data) {                      \
+    if ((2 * (list_ptr->used + 1) > list_ptr->capacity)                                       \
+        && !prefix##_hash_resize(list_ptr, 2 * list_ptr->capacity)) {                         \
+        prefix##_disable_hash_index(list_ptr);                                                \
+        return;                                                                               \
+    }                                                                                         \
+    Name##HashSlot* slot = prefix##_hash_slot(list_ptr, data);                                \
+    if (slot->count == 0) {                                                                   \
+        slot->data = *data;                                                                   \
+        list_ptr->used++;                                                                     \
+    }                                                                                         \
+    slot->count++;                                                                            \
+}                                                                                             \
+                                                                                              \
+/* counts one node less holding the element, emptying its slot at 0 by moving back  */      \
+/* the slots after it which would otherwise no longer be found                       */      \
+static inline void prefix##_hash_remove(Name* list_ptr, const Type* data) {                   \
+    Name##HashSlot* slot = prefix##_hash_slot(list_ptr, data);                                \
+    slot->count--;                                                                            \
+    if (slot->count != 0) {                                                                   \
+        return;                                                                               \
+    }                                                                                         \
+    uint64_t mask = list_ptr->capacity - 1;                                                   \
+    uint64_t empty = (uint64_t) (slot - list_ptr->slots);                                     \
+    uint64_t i = empty;                                                                       \
+    while (true) {                                                                            \
+        i = (i + 1) & mask;                                                                   \
+        if (list_ptr->slots[i].count == 0) {                                                  \
+            break;                                                                            \
+        }                                                                                     \
+        uint64_t home = (hash(&(list_ptr->slots[i].data))) & mask;                            \
+        /* the slot stays if its home lies cyclically after the empty slot, up to i */        \
+        if (((i - home) & mask) >= ((i - empty) & mask)) {                                    \
+            list_ptr->slots[empty] = list_ptr->slots[i];                                      \
+            list_ptr->slots[i].count = 0;                                                     \
+            empty = i;                                                                        \
+        }                                                                                     \
+    }                                                                                         \
+    list_ptr->used--;                                                                         \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_enable_hash_index(Name* list_ptr) {                               \
+    if (list_ptr->slots != NULL) {                                                            \
+        return true;                                                                          \
+    }                                                                                         \
+    uint64_t capacity = GENERIC_HASH_MIN_CAPACITY;                                            \
+    while (capacity < 2 * list_ptr->size) {                                                   \
+        capacity *= 2;                                                                        \
+    }                                                                                         \
+    if (!prefix##_hash_resize(list_ptr, capacity)) {                                          \
+        return false;                                                                         \
+    }                                                                                         \
+    for (Name##Node* node = list_ptr->head; node != NULL; node = node->next) {                \
+        prefix##_hash_add(list_ptr, &(node->data));                                           \
+        if (list_ptr->slots == NULL) {                                                        \
+            return false;                                                                     \
+        }                                                                                     \
+    }                                                                                         \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_is_empty(Name* list_ptr) {                                        \
+    return list_ptr->size == 0;                                                               \
+}                                                                                             \
+                                                                                              \
+/* links a new node holding the element between two adjacent nodes, either of which */      \
+/* may be NULL at the ends of the list                                                */      \
+static inline bool prefix##_insert_between(Name* list_ptr, const Type* data,                  \
+                                           Name##Node* prev, Name##Node* next) {              \
+    Name##Node* node = (Name##Node *) malloc(sizeof(Name##Node));                             \
+    if (node == NULL) {                                                                       \
+        return false;                                                                         \
+    }                                                                                         \
+    node->data = *data;                                                                       \
+    node->prev = prev;                                                                        \
+    node->next = next;                                                                        \
+    if (prev == NULL) {                                                                       \
+        list_ptr->head = node;                                                                \
+    } else {                                                                                  \
+        prev->next = node;                                                                    \
+    }                                                                                         \
+    if (next == NULL) {                                                                       \
+        list_ptr->tail = node;                                                                \
+    } else {                                                                                  \
+        next->prev = node;                                                                    \
+    }                                                                                         \
+    list_ptr->size++;                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_add(list_ptr, data);                                                    \
+    }                                                                                         \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_append(Name* list_ptr, const Type* data) {                        \
+    return prefix##_insert_between(list_ptr, data, list_ptr->tail, NULL);                     \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_prepend(Name* list_ptr, const Type* data) {                       \
+    return prefix##_insert_between(list_ptr, data, NULL, list_ptr->head);                     \
+}                                                                                             \
+                                                                                              \
+static inline int64_t prefix##_forward_find(Name* list_ptr, const Type* data) {               \
+    if ((list_ptr->slots != NULL) && (prefix##_hash_slot(list_ptr, data)->count == 0)) {      \
+        return -1;                                                                            \
+    }                                                                                         \
+    int64_t index = 0;                                                                        \
+    for (Name##Node* node = list_ptr->head; node != NULL; node = node->next) {                \
+        if (equal(&(node->data), data)) {                                                     \
+            return index;                                                                     \
+        }                                                                                     \
+        index++;                                                                              \
+    }                                                                                         \
+    return -1;                                                                                \
+}                                                                                             \
+                                                                                              \
+static inline int64_t prefix##_backward_find(Name* list_ptr, const Type* data) {              \
+    if ((list_ptr->slots != NULL) && (prefix##_hash_slot(list_ptr, data)->count == 0)) {      \
+        return -1;                                                                            \
+    }                                                                                         \
+    int64_t index = 0;                                                                        \
+    for (Name##Node* node = list_ptr->tail; node != NULL; node = node->prev) {                \
+        if (equal(&(node->data), data)) {                                                     \
+            return index;                                                                     \
+        }                                                                                     \
+        index++;                                                                              \
+    }                                                                                         \
+    return -1;                                                                                \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_contains(Name* list_ptr, const Type* data) {                      \
+    if (list_ptr->slots != NULL) {                                                            \
+        return prefix##_hash_slot(list_ptr, data)->count != 0;                                \
+    }                                                                                         \
+    return prefix##_forward_find(list_ptr, data) != -1;                                       \
+}                                                                                             \
+                                                                                              \
+/* unlinks a node of the list and frees it */                                                \
+static inline void prefix##_delete_node(Name* list_ptr, Name##Node* node) {                   \
+    if (node->prev == NULL) {                                                                 \
+        list_ptr->head = node->next;                                                          \
+    } else {                                                                                  \
+        node->prev->next = node->next;                                                        \
+    }                                                                                         \
+    if (node->next == NULL) {                                                                 \
+        list_ptr->tail = node->prev;                                                          \
+    } else {                                                                                  \
+        node->next->prev = node->prev;                                                        \
+    }                                                                                         \
+    list_ptr->size--;                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_remove(list_ptr, &(node->data));                                        \
+    }                                                                                         \
+    free(node);                                                                               \
+}                                                                                             \
+                                                                                              \
+static inline void prefix##_delete_first(Name* list_ptr) {                                    \
+    if (list_ptr->head != NULL) {                                                             \
+        prefix##_delete_node(list_ptr, list_ptr->head);                                       \
+    }                                                                                         \
+}                                                                                             \
+                                                                                              \
+static inline void prefix##_delete_last(Name* list_ptr) {                                     \
+    if (list_ptr->tail != NULL) {                                                             \
+        prefix##_delete_node(list_ptr, list_ptr->tail);                                       \
+    }                                                                                         \
+}                                                                                             \
+                                                                                              \
+/* frees every node and the hash index, leaving the list empty */                            \
+static inline void prefix##_clear(Name* list_ptr) {                                           \
+    Name##Node* node = list_ptr->head;                                                        \
+    while (node != NULL) {                                                                    \
+        Name##Node* next = node->next;                                                        \
+        free(node);                                                                           \
+        node = next;                                                                          \
+    }                                                                                         \
+    list_ptr->head = NULL;                                                                    \
+    list_ptr->tail = NULL;                                                                    \
+    list_ptr->size = 0;                                                                       \
+    prefix##_disable_hash_index(list_ptr);                                                    \
+}
+
+#endif
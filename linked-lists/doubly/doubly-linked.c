@@ -7,14 +7,14 @@ Creation Date: April 4, 2025.
 */
 
 /*** Depedencies ***/
+#include<string.h>
 #include"doubly-linked.h"
+#include"../stats/list-stats.h"
 
 /*** Node Functions ***/
 
 Node* dangling_node(int64_t data) {
-    Node* node = (Node *) malloc(sizeof(Node));
-    node->data = data;
-    return node;
+    return pool_node(NULL, data);
 }
 
 Node* next_node(int64_t data, Node* prev) {
@@ -40,66 +40,1438 @@ Node* between_nodes(int64_t data, Node* prev, Node* next) {
     return node;
 }
 
+/*** NodePool Functions ***/
+
+NodePool* create_node_pool(uint64_t nodes_per_slab) {
+    NodePool* pool = (NodePool *) calloc(1, sizeof(NodePool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->nodes_per_slab = (nodes_per_slab == 0) ? DEFAULT_NODES_PER_SLAB : nodes_per_slab;
+    return pool;
+}
+
+void destroy_node_pool(NodePool* pool) {
+    NodeSlab* slab = pool->slabs;
+    while (slab != NULL) {
+        NodeSlab* next = slab->next;
+        STATS_FREE(sizeof(NodeSlab) + sizeof(Node) * slab->capacity);
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+Node* pool_node(NodePool* pool, int64_t data) {
+    Node* node;
+    if (pool == NULL) {
+        node = (Node *) malloc(sizeof(Node));
+    } else if (pool->free_list != NULL) {
+        node = pool->free_list;
+        pool->free_list = node->next;
+        pool->free_nodes--;
+    } else {
+        // only go to the allocator once the newest slab is used up
+        if ((pool->slabs == NULL) || (pool->slab_used == pool->slabs->capacity)) {
+            NodeSlab* slab = (NodeSlab *) malloc(sizeof(NodeSlab) + sizeof(Node) * pool->nodes_per_slab);
+            if (slab == NULL) {
+                return NULL;
+            }
+            STATS_MALLOC(sizeof(NodeSlab) + sizeof(Node) * pool->nodes_per_slab);
+            slab->next = pool->slabs;
+            slab->capacity = pool->nodes_per_slab;
+            pool->slabs = slab;
+            pool->slab_used = 0;
+            pool->num_slabs++;
+            pool->capacity += pool->nodes_per_slab;
+        }
+        node = &(pool->slabs->nodes[pool->slab_used]);
+        pool->slab_used++;
+    }
+    if (node == NULL) {
+        return NULL;
+    }
+    if (pool != NULL) {
+        pool->live_nodes++;
+    } else {
+        STATS_MALLOC(sizeof(Node));
+    }
+    node->data = data;
+    node->prev = NULL;
+    node->next = NULL;
+    return node;
+}
+
+void release_node(NodePool* pool, Node* node) {
+    if (pool == NULL) {
+        STATS_FREE(sizeof(Node));
+        free(node);
+    } else {
+        node->next = pool->free_list;
+        pool->free_list = node;
+        pool->live_nodes--;
+        pool->free_nodes++;
+    }
+}
+
+Node* pool_block(NodePool* pool, uint64_t count) {
+    // only go to the allocator once the newest slab is used up
+    if ((pool->slabs == NULL) || (pool->slabs->capacity - pool->slab_used < count)) {
+        uint64_t capacity = (count > pool->nodes_per_slab) ? count : pool->nodes_per_slab;
+        NodeSlab* slab = (NodeSlab *) malloc(sizeof(NodeSlab) + sizeof(Node) * capacity);
+        if (slab == NULL) {
+            return NULL;
+        }
+        STATS_MALLOC(sizeof(NodeSlab) + sizeof(Node) * capacity);
+        slab->next = pool->slabs;
+        slab->capacity = capacity;
+        pool->slabs = slab;
+        pool->slab_used = 0;
+        pool->num_slabs++;
+        pool->capacity += capacity;
+    }
+    Node* block = &(pool->slabs->nodes[pool->slab_used]);
+    pool->slab_used += count;
+    pool->live_nodes += count;
+    return block;
+}
+
+NodePoolStats pool_stats(NodePool* pool) {
+    NodePoolStats stats;
+    stats.mallocs = pool->num_slabs;
+    stats.live_nodes = pool->live_nodes;
+    stats.free_nodes = pool->free_nodes;
+    stats.capacity = pool->capacity;
+    uint64_t reserved = pool->num_slabs * sizeof(NodeSlab) + pool->capacity * sizeof(Node);
+    stats.bytes_per_node = (pool->live_nodes == 0) ? 0.0 : ((double) reserved / pool->live_nodes);
+    return stats;
+}
+
+/*** HashIndex Helper Functions ***/
+
+/**
+ * @brief Mixes the bits of a value so that nearby values land in distant
+ *        slots (the finalizer of splitmix64).
+ */
+static uint64_t hash_value(int64_t data) {
+    uint64_t x = (uint64_t) data;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Returns the slot holding data, or NULL if no node holds data.
+ */
+static HashSlot* hash_lookup(HashIndex* hash, int64_t data) {
+    uint64_t mask = hash->capacity - 1;
+    uint64_t i = hash_value(data) & mask;
+    while (hash->slots[i].count != 0) {
+        if (hash->slots[i].data == data) {
+            return &(hash->slots[i]);
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Moves every slot into a new table of the given capacity.
+ */
+static bool hash_resize(HashIndex* hash, uint64_t capacity) {
+    HashSlot* slots = (HashSlot *) calloc(capacity, sizeof(HashSlot));
+    if (slots == NULL) {
+        return false;
+    }
+    uint64_t mask = capacity - 1;
+    for (uint64_t j = 0; j < hash->capacity; j++) {
+        if (hash->slots[j].count != 0) {
+            uint64_t i = hash_value(hash->slots[j].data) & mask;
+            while (slots[i].count != 0) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = hash->slots[j];
+        }
+    }
+    free(hash->slots);
+    hash->slots = slots;
+    hash->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Returns the slot holding data, claiming an empty slot (with a count
+ *        of 0) if no node holds data yet. The table is doubled first if it
+ *        would become more than half full. Returns NULL, leaving the table
+ *        unchanged, if it has to grow and memory allocation failed.
+ */
+static HashSlot* hash_claim(HashIndex* hash, int64_t data) {
+    HashSlot* slot = hash_lookup(hash, data);
+    if (slot != NULL) {
+        return slot;
+    }
+    if ((2 * (hash->used + 1) > hash->capacity) && !hash_resize(hash, 2 * hash->capacity)) {
+        // claiming a slot anyway would fill the table, and probing it would never end
+        return NULL;
+    }
+    uint64_t mask = hash->capacity - 1;
+    uint64_t i = hash_value(data) & mask;
+    while (hash->slots[i].count != 0) {
+        i = (i + 1) & mask;
+    }
+    hash->slots[i].data = data;
+    hash->slots[i].first = NULL;
+    hash->used++;
+    return &(hash->slots[i]);
+}
+
+/**
+ * @brief Empties a slot, shifting back any later slot of the same probe run
+ *        which would otherwise no longer be reachable from its home slot.
+ */
+static void hash_remove(HashIndex* hash, HashSlot* slot) {
+    uint64_t mask = hash->capacity - 1;
+    uint64_t hole = slot - hash->slots;
+    uint64_t i = hole;
+    while (true) {
+        i = (i + 1) & mask;
+        if (hash->slots[i].count == 0) {
+            break;
+        }
+        uint64_t home = hash_value(hash->slots[i].data) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            hash->slots[hole] = hash->slots[i];
+            hole = i;
+        }
+    }
+    hash->slots[hole].count = 0;
+    hash->used--;
+}
+
+/**
+ * @brief Records a node which was just linked into the list at the given index.
+ *        The size of the list already includes the node.
+ */
+static void hash_link(DoublyLinkedList* list_ptr, Node* node, uint64_t index) {
+    HashIndex* hash = list_ptr->hash;
+    if (index == 0) {
+        // every other node moved back by one
+        hash->offset--;
+    } else if (index < (uint64_t) list_ptr->size - 1) {
+        hash->stale = true;
+    }
+    HashSlot* slot = hash_claim(hash, node->data);
+    if (slot == NULL) {
+        disable_hash_index(list_ptr);
+        return;
+    }
+    if ((slot->count == 0) || (index == 0)) {
+        slot->first = node;
+        slot->position = index + hash->offset;
+    }
+    slot->count++;
+}
+
+/**
+ * @brief Forgets a node which is about to be unlinked from the given index of
+ *        the list. The size of the list still includes the node.
+ */
+static void hash_unlink(DoublyLinkedList* list_ptr, Node* node, uint64_t index) {
+    HashIndex* hash = list_ptr->hash;
+    HashSlot* slot = hash_lookup(hash, node->data);
+    slot->count--;
+    if (slot->count == 0) {
+        hash_remove(hash, slot);
+    } else if (slot->first == node) {
+        // the next occurrence is somewhere further down the list
+        hash->stale = true;
+    }
+    if (index == 0) {
+        hash->offset++;
+    } else if (index < (uint64_t) list_ptr->size - 1) {
+        hash->stale = true;
+    }
+}
+
+/**
+ * @brief Recomputes the first occurrence and its position for every slot
+ *        with one pass over the list.
+ */
+static void hash_refresh(DoublyLinkedList* list_ptr) {
+    HashIndex* hash = list_ptr->hash;
+    for (uint64_t i = 0; i < hash->capacity; i++) {
+        hash->slots[i].first = NULL;
+    }
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, index++) {
+        HashSlot* slot = hash_lookup(hash, node->data);
+        if (slot->first == NULL) {
+            slot->first = node;
+            slot->position = index + hash->offset;
+        }
+    }
+    hash->stale = false;
+}
+
+/*** Traversal Helper Functions ***/
+
+/**
+ * @brief Searches for data from both ends of the list at once, and returns the
+ *        index of the match nearest to the near end, counted from that end, or -1.
+ *        The walk from the near end stops at its first match, and the walk from
+ *        the far end keeps the last match it saw, until the walks meet. The two
+ *        chains do not depend on each other, so their cache misses overlap, and
+ *        the next node of both is prefetched as soon as it is known.
+ */
+static inline int64_t find_both_ways(DoublyLinkedList* list_ptr, int64_t data, bool from_tail) {
+    Node* near = from_tail ? list_ptr->tail : list_ptr->head;
+    Node* far = from_tail ? list_ptr->head : list_ptr->tail;
+    int64_t near_index = 0;
+    int64_t far_index = (int64_t) list_ptr->size - 1;
+    int64_t found = -1;
+    while (near_index < far_index) {
+        if (near->data == data) {
+            return near_index;
+        } else if (far->data == data) {
+            found = far_index;
+        }
+        near = from_tail ? near->prev : near->next;
+        far = from_tail ? far->next : far->prev;
+        __builtin_prefetch(near);
+        __builtin_prefetch(far);
+        STATS_HOPS(2);
+        near_index++;
+        far_index--;
+    }
+    if ((near_index == far_index) && (near->data == data)) {
+        return near_index;
+    }
+    return found;
+}
+
+/*** Checkpoint Helper Functions ***/
+
+/**
+ * @brief Marks the checkpoint table of the list stale, if it has one.
+ */
+static void checkpoint_invalidate(DoublyLinkedList* list_ptr) {
+    if (list_ptr->checkpoints != NULL) {
+        list_ptr->checkpoints->stale = true;
+    }
+}
+
+/**
+ * @brief Moves up the index of every checkpoint at or after index, once a node has
+ *        been linked into the list there.
+ */
+static void checkpoint_link(DoublyLinkedList* list_ptr, int64_t index) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    if (table->stale) {
+        return;
+    }
+    for (int64_t i = table->count - 1; (i >= 0) && (table->points[i].index >= index); i--) {
+        table->points[i].index++;
+    }
+}
+
+/**
+ * @brief Moves down the index of every checkpoint after index, before the node at
+ *        index is unlinked from the list. A checkpoint on the node itself moves to
+ *        the next node, or to the previous one if the node is the tail.
+ */
+static void checkpoint_unlink(DoublyLinkedList* list_ptr, Node* node, int64_t index) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    if (table->stale) {
+        return;
+    }
+    for (int64_t i = table->count - 1; (i >= 0) && (table->points[i].index >= index); i--) {
+        Checkpoint* point = &(table->points[i]);
+        if (point->node != node) {
+            point->index--;
+        } else if (node->next != NULL) {
+            point->node = node->next;
+        } else if (node->prev != NULL) {
+            point->node = node->prev;
+            point->index--;
+        } else {
+            // the list is about to be empty
+            table->stale = true;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Places the checkpoints evenly along the list again, with one pass over it.
+ */
+static void checkpoint_rebuild(DoublyLinkedList* list_ptr) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    table->spacing = (list_ptr->size + table->capacity - 1) / table->capacity;
+    if (table->spacing == 0) {
+        table->spacing = 1;
+    }
+    table->count = 0;
+    int64_t until_next = 0;
+    int64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, index++) {
+        if (until_next == 0) {
+            table->points[table->count].node = node;
+            table->points[table->count].index = index;
+            table->count++;
+            until_next = table->spacing;
+        }
+        until_next--;
+    }
+    STATS_HOPS(list_ptr->size);
+    table->stale = false;
+}
+
+/**
+ * @brief Returns true if nodes added or removed since the last rebuild have left more
+ *        than twice the spacing between two checkpoints, before the first one, or
+ *        after the last one, which appends and prepends do without marking the table
+ *        stale. Takes O(k) time for k checkpoints.
+ */
+static bool checkpoint_spread(DoublyLinkedList* list_ptr) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    int64_t limit = 2 * table->spacing;
+    if (table->count == 0) {
+        return list_ptr->size > limit;
+    } else if ((table->points[0].index > limit)
+               || (list_ptr->size - table->points[table->count - 1].index > limit)) {
+        return true;
+    }
+    for (int64_t i = 1; i < table->count; i++) {
+        if (table->points[i].index - table->points[i - 1].index > limit) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the checkpoint nearest to index, found by a binary search, or NULL
+ *        if the table has none.
+ */
+static Checkpoint* checkpoint_search(CheckpointTable* table, int64_t index) {
+    if (table->count == 0) {
+        return NULL;
+    }
+    // the last checkpoint at or before index, or the first one if there is none
+    int64_t low = 0;
+    int64_t high = table->count - 1;
+    while (low < high) {
+        int64_t middle = low + (high - low + 1) / 2;
+        if (table->points[middle].index <= index) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+    Checkpoint* nearest = &(table->points[low]);
+    if ((low + 1 < table->count) && (table->points[low + 1].index - index < llabs(nearest->index - index))) {
+        nearest = &(table->points[low + 1]);
+    }
+    return nearest;
+}
+
+/**
+ * @brief Returns the node at index, which must be in range, walking from the closest
+ *        of the head, the tail and the checkpoints. The checkpoint table is rebuilt
+ *        first if it is stale, or if even the closest start is more than spacing
+ *        nodes away, after inserts and deletes have spread the checkpoints apart.
+ */
+static Node* node_at(DoublyLinkedList* list_ptr, int64_t index) {
+    Node* node = list_ptr->head;
+    int64_t position = 0;
+    if (list_ptr->size - 1 - index < index) {
+        node = list_ptr->tail;
+        position = list_ptr->size - 1;
+    }
+    CheckpointTable* table = list_ptr->checkpoints;
+    if (table != NULL) {
+        if (table->stale) {
+            checkpoint_rebuild(list_ptr);
+        }
+        Checkpoint* point = checkpoint_search(table, index);
+        int64_t distance = llabs(position - index);
+        if ((point != NULL) && (llabs(point->index - index) < distance)) {
+            distance = llabs(point->index - index);
+        }
+        if (distance > table->spacing) {
+            checkpoint_rebuild(list_ptr);
+            point = checkpoint_search(table, index);
+        }
+        if ((point != NULL) && (llabs(point->index - index) < llabs(position - index))) {
+            node = point->node;
+            position = point->index;
+        }
+    }
+    STATS_HOPS(llabs(position - index));
+    while (position < index) {
+        node = node->next;
+        position++;
+    }
+    while (position > index) {
+        node = node->prev;
+        position--;
+    }
+    return node;
+}
+
+/*** Compaction Helper Functions ***/
+
+/**
+ * @brief Ends the incremental compaction running on the list, if there is one,
+ *        returning the nodes of its block which were never used to the pool.
+ */
+static void compact_finish(DoublyLinkedList* list_ptr) {
+    CompactPass* pass = list_ptr->compact;
+    if (pass == NULL) {
+        return;
+    }
+    for (uint64_t i = pass->used; i < pass->capacity; i++) {
+        release_node(list_ptr->pool, &(pass->block[i]));
+    }
+    free(pass);
+    list_ptr->compact = NULL;
+}
+
+/**
+ * @brief Moves old, the node after the last one moved by the incremental
+ *        compaction, into the next node of its block.
+ */
+static void compact_move(DoublyLinkedList* list_ptr, Node* old, NodeRemap remap, void* context) {
+    CompactPass* pass = list_ptr->compact;
+    Node* node = &(pass->block[pass->used++]);
+    node->data = old->data;
+    node->prev = pass->prev;
+    node->next = old->next;
+    if (pass->prev == NULL) {
+        list_ptr->head = node;
+    } else {
+        pass->prev->next = node;
+    }
+    if (old->next == NULL) {
+        list_ptr->tail = node;
+    } else {
+        old->next->prev = node;
+    }
+    if ((list_ptr->hash != NULL) && !list_ptr->hash->stale) {
+        HashSlot* slot = hash_lookup(list_ptr->hash, old->data);
+        if ((slot != NULL) && (slot->first == old)) {
+            slot->first = node;
+        }
+    }
+    if (remap != NULL) {
+        remap(old, node, context);
+    }
+    release_node(list_ptr->pool, old);
+    checkpoint_invalidate(list_ptr);
+    pass->prev = node;
+}
+
+/*** Splice Helper Functions ***/
+
+/**
+ * @brief Makes the list, which must be empty, let go of its pool and go back to
+ *        malloc. A pool it owns is destroyed once no other list owns it.
+ */
+static void drop_pool(DoublyLinkedList* list_ptr) {
+    if (list_ptr->owns_pool && (--list_ptr->pool->owners == 0)) {
+        destroy_node_pool(list_ptr->pool);
+    }
+    list_ptr->pool = NULL;
+    list_ptr->owns_pool = false;
+}
+
+/**
+ * @brief Makes the list take its nodes from pool, and own it along with the lists
+ *        already owning it if owned is set.
+ */
+static void use_pool(DoublyLinkedList* list_ptr, NodePool* pool, bool owned) {
+    list_ptr->pool = pool;
+    list_ptr->owns_pool = owned;
+    if (owned) {
+        pool->owners++;
+    }
+}
+
+/**
+ * @brief Moves every slab and free node of other into pool, and frees other.
+ *        The nodes other handed out are then nodes of pool.
+ */
+static void pool_absorb(NodePool* pool, NodePool* other) {
+    if (other->slabs != NULL) {
+        // the unused end of the newest slab of other is only reachable from the free list
+        for (uint64_t i = other->slab_used; i < other->slabs->capacity; i++) {
+            other->slabs->nodes[i].next = other->free_list;
+            other->free_list = &(other->slabs->nodes[i]);
+            other->free_nodes++;
+        }
+        NodeSlab* last = other->slabs;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        if (pool->slabs == NULL) {
+            pool->slabs = other->slabs;
+            pool->slab_used = other->slabs->capacity;
+        } else {
+            // the newest slab of pool stays first, so that it keeps handing out nodes
+            last->next = pool->slabs->next;
+            pool->slabs->next = other->slabs;
+        }
+    }
+    if (other->free_list != NULL) {
+        Node* last = other->free_list;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        last->next = pool->free_list;
+        pool->free_list = other->free_list;
+    }
+    pool->num_slabs += other->num_slabs;
+    pool->capacity += other->capacity;
+    pool->live_nodes += other->live_nodes;
+    pool->free_nodes += other->free_nodes;
+    free(other);
+}
+
+/**
+ * @brief Makes sure the nodes of src can be released by dest once they are linked
+ *        into it. Lists on the same pool (or both malloc) need nothing, and an empty
+ *        dest takes on the pool of src, owning it too if src does. When every node
+ *        of src moves (whole), a pool only src owns is merged into the pool of dest.
+ *        Returns false otherwise.
+ */
+static bool share_pool(DoublyLinkedList* src, DoublyLinkedList* dest, bool whole) {
+    if (src->pool == dest->pool) {
+        return true;
+    } else if (is_empty(dest)) {
+        compact_finish(dest);
+        drop_pool(dest);
+        use_pool(dest, src->pool, src->owns_pool);
+        return true;
+    } else if (whole && src->owns_pool && (src->pool->owners == 1) && (dest->pool != NULL)) {
+        pool_absorb(dest->pool, src->pool);
+        src->pool = NULL;
+        src->owns_pool = false;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Counts the values of the nodes from first to last out of the hash index of
+ *        src and into the hash index of dest, for the lists which have one. Both are
+ *        left stale, since the positions of the nodes change. dest drops its index
+ *        if it can not grow.
+ */
+static void hash_move(DoublyLinkedList* src, DoublyLinkedList* dest, Node* first, Node* last) {
+    for (Node* node = first; src != dest; node = node->next) {
+        if (src->hash != NULL) {
+            HashSlot* slot = hash_lookup(src->hash, node->data);
+            slot->count--;
+            if (slot->count == 0) {
+                hash_remove(src->hash, slot);
+            }
+        }
+        if (dest->hash != NULL) {
+            HashSlot* slot = hash_claim(dest->hash, node->data);
+            if (slot == NULL) {
+                disable_hash_index(dest);
+            } else {
+                if (slot->count == 0) {
+                    slot->first = node;
+                }
+                slot->count++;
+            }
+        }
+        if (node == last) {
+            break;
+        }
+    }
+    if (src->hash != NULL) {
+        src->hash->stale = true;
+    }
+    if (dest->hash != NULL) {
+        dest->hash->stale = true;
+    }
+}
+
+/**
+ * @brief Unlinks the count nodes from first to last out of src, and links them into
+ *        dest right after the node after, or at the head if after is NULL.
+ */
+static void move_range(DoublyLinkedList* src, Node* first, Node* last, int64_t count,
+                       DoublyLinkedList* dest, Node* after) {
+    if ((src->hash != NULL) || (dest->hash != NULL)) {
+        hash_move(src, dest, first, last);
+    }
+    checkpoint_invalidate(src);
+    checkpoint_invalidate(dest);
+    if (first->prev == NULL) {
+        src->head = last->next;
+    } else {
+        first->prev->next = last->next;
+    }
+    if (last->next == NULL) {
+        src->tail = first->prev;
+    } else {
+        last->next->prev = first->prev;
+    }
+    src->size -= count;
+    // found after the unlink, in case the range was right after "after" in the same list
+    Node* next = (after == NULL) ? dest->head : after->next;
+    first->prev = after;
+    last->next = next;
+    if (after == NULL) {
+        dest->head = first;
+    } else {
+        after->next = first;
+    }
+    if (next == NULL) {
+        dest->tail = last;
+    } else {
+        next->prev = last;
+    }
+    dest->size += count;
+    // an emptied list lets go of a pool it owns, so it can be freed without clear
+    if ((src->size == 0) && src->owns_pool) {
+        drop_pool(src);
+    }
+}
+
+/*** Batch Helper Functions ***/
+
+/**
+ * @brief Links node into the list right after prev, or as the new head if prev is
+ *        NULL, where it becomes the node at the given index.
+ */
+static void link_after(DoublyLinkedList* list_ptr, Node* prev, Node* node, int64_t index) {
+    Node* next = (prev == NULL) ? list_ptr->head : prev->next;
+    node->prev = prev;
+    node->next = next;
+    if (prev == NULL) {
+        list_ptr->head = node;
+    } else {
+        prev->next = node;
+    }
+    if (next == NULL) {
+        list_ptr->tail = node;
+    } else {
+        next->prev = node;
+    }
+    list_ptr->size++;
+    if (list_ptr->hash != NULL) {
+        hash_link(list_ptr, node, (uint64_t) index);
+    }
+    if (list_ptr->checkpoints != NULL) {
+        checkpoint_link(list_ptr, index);
+    }
+}
+
+/**
+ * @brief Unlinks the node at the given index out of the list, and releases it.
+ */
+static void unlink_at(DoublyLinkedList* list_ptr, Node* node, int64_t index) {
+    if (list_ptr->hash != NULL) {
+        hash_unlink(list_ptr, node, (uint64_t) index);
+    }
+    if (list_ptr->checkpoints != NULL) {
+        checkpoint_unlink(list_ptr, node, index);
+    }
+    if ((list_ptr->compact != NULL) && (list_ptr->compact->prev == node)) {
+        list_ptr->compact->prev = node->prev;
+    }
+    if (node->prev == NULL) {
+        list_ptr->head = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next == NULL) {
+        list_ptr->tail = node->prev;
+    } else {
+        node->next->prev = node->prev;
+    }
+    release_node(list_ptr->pool, node);
+    list_ptr->size--;
+}
+
+/*** Sort Helper Functions ***/
+
+/**
+ * @brief The first and last nodes of a chain of nodes ending in NULL.
+ */
+typedef struct {
+    Node* head;
+    Node* tail;
+} SortRun;
+
+/**
+ * @brief Returns data as an unsigned key which sorts in the same order, by flipping
+ *        the sign bit so that negative values come before the others.
+ */
+static uint64_t radix_key(int64_t data) {
+    return ((uint64_t) data) ^ (UINT64_C(1) << 63);
+}
+
+/**
+ * @brief Moves the nodes of the chain from head, in order, to the end of the chain
+ *        of the digit of their key at shift, counting the nodes of every chain in
+ *        lengths if it is not NULL. Each chain starts at a dummy node so that
+ *        appending to it needs no branch. The prev pointers are set on the way,
+ *        except for the first node of every chain.
+ */
+static void radix_scatter(Node* head, unsigned shift, Node* dummies, Node** tails, uint64_t* lengths) {
+    uint64_t mask = (UINT64_C(1) << RADIX_BITS) - 1;
+    for (uint64_t d = 0; d <= mask; d++) {
+        tails[d] = &(dummies[d]);
+    }
+    for (Node* node = head; node != NULL; node = node->next) {
+        uint64_t d = (radix_key(node->data) >> shift) & mask;
+        tails[d]->next = node;
+        node->prev = tails[d];
+        tails[d] = node;
+        if (lengths != NULL) {
+            lengths[d]++;
+        }
+    }
+}
+
+/**
+ * @brief Sorts the chain from head on its lowest digits, least significant digit
+ *        first, skipping the digits which are the same in every node.
+ */
+static SortRun radix_lsd(Node* head, unsigned digits) {
+    Node dummies[1 << RADIX_BITS];
+    Node* tails[1 << RADIX_BITS];
+    uint64_t first = radix_key(head->data);
+    uint64_t differ = 0;
+    SortRun sorted = {head, head};
+    for (; sorted.tail->next != NULL; sorted.tail = sorted.tail->next) {
+        differ |= radix_key(sorted.tail->next->data) ^ first;
+    }
+    uint64_t mask = (UINT64_C(1) << RADIX_BITS) - 1;
+    for (unsigned digit = 0; digit < digits; digit++) {
+        if (((differ >> (digit * RADIX_BITS)) & mask) == 0) {
+            continue;
+        }
+        radix_scatter(sorted.head, digit * RADIX_BITS, dummies, tails, NULL);
+        Node start;
+        sorted.tail = &start;
+        for (uint64_t d = 0; d <= mask; d++) {
+            if (tails[d] != &(dummies[d])) {
+                sorted.tail->next = dummies[d].next;
+                dummies[d].next->prev = sorted.tail;
+                sorted.tail = tails[d];
+            }
+        }
+        sorted.tail->next = NULL;
+        sorted.head = start.next;
+    }
+    return sorted;
+}
+
+/**
+ * @brief Sorts the chain of length nodes from head on its lowest digits. Chains
+ *        which do not fit in the cache are first split on their highest digit,
+ *        most significant digit first, and every part is sorted on the digits
+ *        below it, so that the many passes of radix_lsd are made over nodes
+ *        which are already in the cache. The prev pointer of the head is not set.
+ */
+static SortRun radix_msd(Node* head, uint64_t length, unsigned digits) {
+    if ((length <= RADIX_CACHE_NODES) || (digits == 1)) {
+        return radix_lsd(head, digits);
+    }
+    Node dummies[1 << RADIX_BITS];
+    Node* tails[1 << RADIX_BITS];
+    uint64_t lengths[1 << RADIX_BITS] = {0};
+    radix_scatter(head, (digits - 1) * RADIX_BITS, dummies, tails, lengths);
+    Node start;
+    SortRun sorted = {NULL, &start};
+    for (uint64_t d = 0; d < (UINT64_C(1) << RADIX_BITS); d++) {
+        if (lengths[d] > 0) {
+            tails[d]->next = NULL;
+            SortRun part = radix_msd(dummies[d].next, lengths[d], digits - 1);
+            sorted.tail->next = part.head;
+            part.head->prev = sorted.tail;
+            sorted.tail = part.tail;
+        }
+    }
+    sorted.head = start.next;
+    return sorted;
+}
+
 /*** DoublyLinkedList Functions ***/
 
 bool is_empty(DoublyLinkedList* list_ptr) {
     return (list_ptr->size == 0);
 }
 
+bool attach_pool(DoublyLinkedList* list_ptr, NodePool* pool) {
+    if (!is_empty(list_ptr)) {
+        return false;
+    }
+    compact_finish(list_ptr);
+    drop_pool(list_ptr);
+    list_ptr->pool = pool;
+    return true;
+}
+
+bool enable_hash_index(DoublyLinkedList* list_ptr) {
+    if (list_ptr->hash != NULL) {
+        return true;
+    }
+    HashIndex* hash = (HashIndex *) calloc(1, sizeof(HashIndex));
+    if (hash == NULL) {
+        return false;
+    }
+    // keep the table at most half full so that probe runs stay short
+    hash->capacity = HASH_MIN_CAPACITY;
+    while (hash->capacity < 2 * (uint64_t) list_ptr->size) {
+        hash->capacity *= 2;
+    }
+    hash->slots = (HashSlot *) calloc(hash->capacity, sizeof(HashSlot));
+    if (hash->slots == NULL) {
+        free(hash);
+        return false;
+    }
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, index++) {
+        HashSlot* slot = hash_claim(hash, node->data);
+        if (slot == NULL) {
+            free(hash->slots);
+            free(hash);
+            return false;
+        }
+        if (slot->count == 0) {
+            slot->first = node;
+            slot->position = index;
+        }
+        slot->count++;
+    }
+    list_ptr->hash = hash;
+    return true;
+}
+
+void disable_hash_index(DoublyLinkedList* list_ptr) {
+    HashIndex* hash = list_ptr->hash;
+    if (hash == NULL) {
+        return;
+    }
+    free(hash->slots);
+    free(hash);
+    list_ptr->hash = NULL;
+}
+
+HashIndexStats hash_index_stats(DoublyLinkedList* list_ptr) {
+    HashIndexStats stats = {0};
+    HashIndex* hash = list_ptr->hash;
+    if (hash == NULL) {
+        return stats;
+    }
+    stats.distinct_values = hash->used;
+    stats.capacity = hash->capacity;
+    stats.bytes = sizeof(HashIndex) + hash->capacity * sizeof(HashSlot);
+    if (list_ptr->size > 0) {
+        stats.bytes_per_node = (double) stats.bytes / (double) list_ptr->size;
+    }
+    return stats;
+}
+
+bool enable_checkpoints(DoublyLinkedList* list_ptr, int64_t count) {
+    if (count <= 0) {
+        return false;
+    }
+    CheckpointTable* table = (CheckpointTable *) calloc(1, sizeof(CheckpointTable));
+    if (table == NULL) {
+        return false;
+    }
+    table->points = (Checkpoint *) malloc(count * sizeof(Checkpoint));
+    if (table->points == NULL) {
+        free(table);
+        return false;
+    }
+    table->capacity = count;
+    table->stale = true;
+    disable_checkpoints(list_ptr);
+    list_ptr->checkpoints = table;
+    return true;
+}
+
+void disable_checkpoints(DoublyLinkedList* list_ptr) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    if (table == NULL) {
+        return;
+    }
+    free(table->points);
+    free(table);
+    list_ptr->checkpoints = NULL;
+}
+
+bool refresh_checkpoints(DoublyLinkedList* list_ptr) {
+    if (list_ptr->checkpoints == NULL) {
+        return false;
+    } else if (list_ptr->checkpoints->stale || checkpoint_spread(list_ptr)) {
+        checkpoint_rebuild(list_ptr);
+    }
+    return true;
+}
+
+int64_t* get(DoublyLinkedList* list_ptr, int64_t index) {
+    STATS_OP(LIST_OP_GET);
+    if ((index < 0) || (index >= list_ptr->size)) {
+        return NULL;
+    }
+    return &(node_at(list_ptr, index)->data);
+}
+
+bool insert_at(DoublyLinkedList* list_ptr, int64_t data, int64_t index) {
+    STATS_OP(LIST_OP_INSERT);
+    if ((index < 0) || (index > list_ptr->size)) {
+        return false;
+    }
+    Node* prev = (index == 0) ? NULL : node_at(list_ptr, index - 1);
+    Node* node = pool_node(list_ptr->pool, data);
+    if (node == NULL) {
+        return false;
+    }
+    link_after(list_ptr, prev, node, index);
+    return true;
+}
+
+bool delete_at(DoublyLinkedList* list_ptr, int64_t index) {
+    STATS_OP(LIST_OP_DELETE);
+    if ((index < 0) || (index >= list_ptr->size)) {
+        return false;
+    }
+    unlink_at(list_ptr, node_at(list_ptr, index), index);
+    return true;
+}
+
 int64_t forward_find(DoublyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_FIND);
     if (is_empty(list_ptr)) {
         return -1;
-    } else {
-        int64_t index = 0;
-        Node* node = list_ptr->head;
-        while (node != NULL) {
-            if (node->data == data) {
-                return index;
-            }
-            node = node->next;
-            index++;
+    } else if (list_ptr->hash != NULL) {
+        HashIndex* hash = list_ptr->hash;
+        HashSlot* slot = hash_lookup(hash, data);
+        if (slot == NULL) {
+            return -1;
         }
-        return -1;
+        if (hash->stale) {
+            hash_refresh(list_ptr);
+        }
+        return (int64_t) (slot->position - hash->offset);
+    } else {
+        return find_both_ways(list_ptr, data, false);
     }
 }
 
 int64_t backward_find(DoublyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_FIND);
     if (is_empty(list_ptr)) {
         return -1;
     } else {
-        int64_t index = 0;
-        Node* node = list_ptr->tail;
-        while (node != NULL) {
-            if (node->data == data) {
-                return index;
+        if (list_ptr->hash != NULL) {
+            HashSlot* slot = hash_lookup(list_ptr->hash, data);
+            if (slot == NULL) {
+                return -1;
+            } else if (slot->count == 1) {
+                // the only occurrence is the first one from either end
+                return list_ptr->size - 1 - forward_find(list_ptr, data);
             }
-            node = node->prev;
-            index++;
         }
-        return -1;
+        return find_both_ways(list_ptr, data, true);
     }
 }
 
 void append_node(DoublyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_APPEND);
+    Node* node = pool_node(list_ptr->pool, data);
     if (list_ptr->size == 0) {
-        Node* node = dangling_node(data);
         list_ptr->head = node;
-        list_ptr->tail = node;
     } else {
-        Node* node = next_node(data, list_ptr->tail);
-        list_ptr->tail = node;
+        list_ptr->tail->next = node;
+        node->prev = list_ptr->tail;
     }
+    list_ptr->tail = node;
     list_ptr->size++;
+    if (list_ptr->hash != NULL) {
+        hash_link(list_ptr, node, list_ptr->size - 1);
+    }
 }
 
 void prepend_node(DoublyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_PREPEND);
+    Node* node = pool_node(list_ptr->pool, data);
     if (list_ptr->size == 0) {
-        Node* node = dangling_node(data);
-        list_ptr->head = node;
         list_ptr->tail = node;
     } else {
-        Node* node = prev_node(data, list_ptr->head);
-        list_ptr->head = node;
+        list_ptr->head->prev = node;
+        node->next = list_ptr->head;
     }
+    list_ptr->head = node;
     list_ptr->size++;
+    if (list_ptr->hash != NULL) {
+        hash_link(list_ptr, node, 0);
+    }
+    if (list_ptr->checkpoints != NULL) {
+        checkpoint_link(list_ptr, 0);
+    }
+}
+
+void delete_first(DoublyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_DELETE);
+    if (is_empty(list_ptr)) {
+        return;
+    }
+    Node* node = list_ptr->head;
+    if (list_ptr->hash != NULL) {
+        hash_unlink(list_ptr, node, 0);
+    }
+    if (list_ptr->checkpoints != NULL) {
+        checkpoint_unlink(list_ptr, node, 0);
+    }
+    if ((list_ptr->compact != NULL) && (list_ptr->compact->prev == node)) {
+        list_ptr->compact->prev = NULL;
+    }
+    list_ptr->head = node->next;
+    if (list_ptr->head == NULL) {
+        list_ptr->tail = NULL;
+    } else {
+        list_ptr->head->prev = NULL;
+    }
+    release_node(list_ptr->pool, node);
+    list_ptr->size--;
+}
+
+void delete_last(DoublyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_DELETE);
+    if (is_empty(list_ptr)) {
+        return;
+    }
+    Node* node = list_ptr->tail;
+    if (list_ptr->hash != NULL) {
+        hash_unlink(list_ptr, node, list_ptr->size - 1);
+    }
+    if (list_ptr->checkpoints != NULL) {
+        checkpoint_unlink(list_ptr, node, list_ptr->size - 1);
+    }
+    if ((list_ptr->compact != NULL) && (list_ptr->compact->prev == node)) {
+        list_ptr->compact->prev = node->prev;
+    }
+    list_ptr->tail = node->prev;
+    if (list_ptr->tail == NULL) {
+        list_ptr->head = NULL;
+    } else {
+        list_ptr->tail->next = NULL;
+    }
+    release_node(list_ptr->pool, node);
+    list_ptr->size--;
+}
+
+void clear(DoublyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_CLEAR);
+    compact_finish(list_ptr);
+    // a pool only this list owns is destroyed whole, without returning its nodes one by one
+    bool whole = list_ptr->owns_pool && (list_ptr->pool->owners == 1);
+    Node* node = list_ptr->head;
+    while (!whole && (node != NULL)) {
+        Node* next = node->next;
+        release_node(list_ptr->pool, node);
+        node = next;
+    }
+    list_ptr->head = NULL;
+    list_ptr->tail = NULL;
+    list_ptr->size = 0;
+    if (list_ptr->owns_pool) {
+        drop_pool(list_ptr);
+    }
+    if (list_ptr->hash != NULL) {
+        HashIndex* hash = list_ptr->hash;
+        memset(hash->slots, 0, hash->capacity * sizeof(HashSlot));
+        hash->used = 0;
+        hash->offset = 0;
+        hash->stale = false;
+    }
+    checkpoint_invalidate(list_ptr);
+}
+
+bool insert_nodes(DoublyLinkedList* list_ptr, const IndexedValue* inserts, int64_t count) {
+    STATS_OP(LIST_OP_BATCH);
+    for (int64_t i = 0; i < count; i++) {
+        if ((inserts[i].index < 0) || (inserts[i].index > list_ptr->size)
+            || ((i > 0) && (inserts[i].index < inserts[i - 1].index))) {
+            return false;
+        }
+    }
+    if (count == 0) {
+        return true;
+    }
+    checkpoint_invalidate(list_ptr);
+    if (list_ptr->size - inserts[0].index < inserts[count - 1].index) {
+        // from the tail, the inserts after an index do not move it
+        Node* next = NULL;
+        int64_t position = list_ptr->size;
+        for (int64_t i = count - 1; i >= 0; i--) {
+            STATS_HOPS(position - inserts[i].index);
+            while (position > inserts[i].index) {
+                next = (next == NULL) ? list_ptr->tail : next->prev;
+                position--;
+            }
+            Node* node = pool_node(list_ptr->pool, inserts[i].data);
+            link_after(list_ptr, (next == NULL) ? list_ptr->tail : next->prev, node, position);
+            next = node;
+        }
+    } else {
+        // position is the index of the node after prev, as the list grows
+        Node* prev = NULL;
+        int64_t position = 0;
+        for (int64_t i = 0; i < count; i++) {
+            int64_t target = inserts[i].index + i;
+            STATS_HOPS(target - position);
+            while (position < target) {
+                prev = (prev == NULL) ? list_ptr->head : prev->next;
+                position++;
+            }
+            Node* node = pool_node(list_ptr->pool, inserts[i].data);
+            link_after(list_ptr, prev, node, target);
+            prev = node;
+            position++;
+        }
+    }
+    return true;
+}
+
+bool delete_nodes(DoublyLinkedList* list_ptr, const int64_t* indices, int64_t count) {
+    STATS_OP(LIST_OP_BATCH);
+    for (int64_t i = 0; i < count; i++) {
+        if ((indices[i] < 0) || (indices[i] >= list_ptr->size) || ((i > 0) && (indices[i] <= indices[i - 1]))) {
+            return false;
+        }
+    }
+    if (count == 0) {
+        return true;
+    }
+    checkpoint_invalidate(list_ptr);
+    if (list_ptr->size - 1 - indices[0] < indices[count - 1]) {
+        // from the tail, the deletes after an index do not move it
+        Node* node = list_ptr->tail;
+        int64_t position = list_ptr->size - 1;
+        for (int64_t i = count - 1; i >= 0; i--) {
+            STATS_HOPS(position - indices[i]);
+            while (position > indices[i]) {
+                node = node->prev;
+                position--;
+            }
+            Node* prev = node->prev;
+            unlink_at(list_ptr, node, position);
+            node = prev;
+            position--;
+        }
+    } else {
+        Node* node = list_ptr->head;
+        int64_t position = 0;
+        for (int64_t i = 0; i < count; i++) {
+            int64_t target = indices[i] - i;
+            STATS_HOPS(target - position);
+            while (position < target) {
+                node = node->next;
+                position++;
+            }
+            Node* next = node->next;
+            unlink_at(list_ptr, node, target);
+            node = next;
+        }
+    }
+    return true;
+}
+
+void radix_sort_list(DoublyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_SORT);
+    if (list_ptr->size < 2) {
+        return;
+    }
+    SortRun sorted = radix_msd(list_ptr->head, list_ptr->size, RADIX_DIGITS);
+    sorted.head->prev = NULL;
+    list_ptr->head = sorted.head;
+    list_ptr->tail = sorted.tail;
+    compact_finish(list_ptr);
+    checkpoint_invalidate(list_ptr);
+    if (list_ptr->hash != NULL) {
+        list_ptr->hash->stale = true;
+    }
+}
+
+bool compact_list(DoublyLinkedList* list_ptr, NodeRemap remap, void* context) {
+    STATS_OP(LIST_OP_COMPACT);
+    compact_finish(list_ptr);
+    uint64_t length = (uint64_t) list_ptr->size;
+    if (length == 0) {
+        return true;
+    }
+    NodePool* pool = list_ptr->pool;
+    // a pool attached by the caller keeps the list, anything else is swapped for a new pool
+    bool shared = (pool != NULL) && !list_ptr->owns_pool;
+    NodePool* target = shared ? pool : create_node_pool(0);
+    Node* block = (target == NULL) ? NULL : pool_block(target, length);
+    if (block == NULL) {
+        if (!shared && (target != NULL)) {
+            destroy_node_pool(target);
+        }
+        return false;
+    }
+    checkpoint_invalidate(list_ptr);
+    // copy every node, and point the old node and its copy at each other
+    Node* node = list_ptr->head;
+    for (uint64_t i = 0; i < length; i++) {
+        Node* next = node->next;
+        block[i].data = node->data;
+        block[i].next = node;
+        node->next = &(block[i]);
+        node = next;
+    }
+    if ((list_ptr->hash != NULL) && !list_ptr->hash->stale) {
+        HashIndex* hash = list_ptr->hash;
+        for (uint64_t i = 0; i < hash->capacity; i++) {
+            if (hash->slots[i].count > 0) {
+                hash->slots[i].first = hash->slots[i].first->next;
+            }
+        }
+    }
+    for (uint64_t i = 0; i < length; i++) {
+        Node* old = block[i].next;
+        if (remap != NULL) {
+            remap(old, &(block[i]), context);
+        }
+        // nodes of a pool about to be destroyed need not go back to it
+        if ((pool == NULL) || shared || (pool->owners > 1)) {
+            release_node(pool, old);
+        }
+        block[i].prev = (i > 0) ? &(block[i - 1]) : NULL;
+        block[i].next = (i + 1 < length) ? &(block[i + 1]) : NULL;
+    }
+    if (!shared) {
+        drop_pool(list_ptr);
+        use_pool(list_ptr, target, true);
+    }
+    list_ptr->head = block;
+    list_ptr->tail = &(block[length - 1]);
+    return true;
+}
+
+bool compact_step(DoublyLinkedList* list_ptr, uint64_t max_nodes, NodeRemap remap, void* context) {
+    STATS_OP(LIST_OP_COMPACT);
+    NodePool* pool = list_ptr->pool;
+    if (pool == NULL) {
+        return false;
+    }
+    CompactPass* pass = list_ptr->compact;
+    if (pass == NULL) {
+        if (is_empty(list_ptr)) {
+            return false;
+        }
+        pass = (CompactPass *) malloc(sizeof(CompactPass));
+        Node* block = (pass == NULL) ? NULL : pool_block(pool, (uint64_t) list_ptr->size);
+        if (block == NULL) {
+            free(pass);
+            return false;
+        }
+        pass->block = block;
+        pass->capacity = (uint64_t) list_ptr->size;
+        pass->used = 0;
+        pass->prev = NULL;
+        list_ptr->compact = pass;
+    }
+    Node* old = (pass->prev == NULL) ? list_ptr->head : pass->prev->next;
+    for (uint64_t moved = 0; (moved < max_nodes) && (old != NULL); moved++) {
+        if (pass->used == pass->capacity) {
+            // nodes were added since the pass started, so take another block
+            Node* block = pool_block(pool, pool->nodes_per_slab);
+            if (block == NULL) {
+                compact_finish(list_ptr);
+                return false;
+            }
+            pass->block = block;
+            pass->capacity = pool->nodes_per_slab;
+            pass->used = 0;
+        }
+        compact_move(list_ptr, old, remap, context);
+        old = pass->prev->next;
+    }
+    if (old == NULL) {
+        compact_finish(list_ptr);
+        return false;
+    }
+    return true;
+}
+
+bool concat(DoublyLinkedList* src, DoublyLinkedList* dest) {
+    STATS_OP(LIST_OP_SPLICE);
+    return splice_after(dest, dest->tail, src);
+}
+
+bool splice_after(DoublyLinkedList* dest, Node* after, DoublyLinkedList* src) {
+    STATS_OP(LIST_OP_SPLICE);
+    if (src == dest) {
+        return false;
+    } else if (is_empty(src)) {
+        return true;
+    }
+    // the pool of src may be merged away, so its compaction block goes back to it first
+    compact_finish(src);
+    if (!share_pool(src, dest, true)) {
+        return false;
+    }
+    move_range(src, src->head, src->tail, src->size, dest, after);
+    return true;
+}
+
+bool split_at(DoublyLinkedList* list_ptr, int64_t index, DoublyLinkedList* dest) {
+    STATS_OP(LIST_OP_SPLICE);
+    if ((list_ptr == dest) || (index < 0) || (index > list_ptr->size)) {
+        return false;
+    } else if (!share_pool(list_ptr, dest, false)) {
+        return false;
+    } else if (index == list_ptr->size) {
+        return true;
+    }
+    Node* first;
+    STATS_HOPS((index <= list_ptr->size / 2) ? index : list_ptr->size - 1 - index);
+    if (index <= list_ptr->size / 2) {
+        first = list_ptr->head;
+        for (int64_t i = 0; i < index; i++) {
+            first = first->next;
+        }
+    } else {
+        first = list_ptr->tail;
+        for (int64_t i = list_ptr->size - 1; i > index; i--) {
+            first = first->prev;
+        }
+    }
+    compact_finish(list_ptr);
+    move_range(list_ptr, first, list_ptr->tail, list_ptr->size - index, dest, dest->tail);
+    return true;
+}
+
+int64_t splice_range(DoublyLinkedList* src, Node* first, Node* last, DoublyLinkedList* dest, Node* after) {
+    STATS_OP(LIST_OP_SPLICE);
+    int64_t count = 0;
+    for (Node* node = first; ; node = node->next) {
+        if ((node == NULL) || ((src == dest) && (node == after))) {
+            return -1;
+        }
+        count++;
+        if (node == last) {
+            break;
+        }
+    }
+    compact_finish(src);
+    if (!share_pool(src, dest, (first == src->head) && (last == src->tail))) {
+        return -1;
+    }
+    move_range(src, first, last, count, dest, after);
+    return count;
 }
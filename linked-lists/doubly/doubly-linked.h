@@ -13,6 +13,16 @@ Creation Date: April 4, 2025.
 #include<stdlib.h>
 #include<stdbool.h>
 
+/*** Constants ***/
+#define DEFAULT_NODES_PER_SLAB 1024
+#define HASH_MIN_CAPACITY 16
+// radix_sort_list sorts on digits of this many bits, one pass per digit of a 64-bit value
+#define RADIX_BITS 8
+#define RADIX_DIGITS ((64 + RADIX_BITS - 1) / RADIX_BITS)
+// radix_sort_list splits lists longer than this on their highest digit first, so that
+// the passes over the lower digits run on parts which fit in the cache
+#define RADIX_CACHE_NODES 16384
+
 
 /*** Struct Defintiions */
 
@@ -30,6 +40,150 @@ typedef struct Node {
     struct Node* next;       /**< Pointer to the next node in the list, or NULL if this is the last node */
 } Node;
 
+/**
+ * @struct NodeSlab
+ * @brief A block of Nodes allocated with a single malloc call.
+ *
+ * Slabs are chained together so the owning NodePool can free all of them
+ * when it is destroyed.
+ */
+typedef struct NodeSlab {
+    struct NodeSlab* next;   /**< The slab allocated before this one, or NULL */
+    uint64_t capacity;       /**< The number of nodes in this slab */
+    Node nodes[];            /**< The nodes carved out of this slab */
+} NodeSlab;
+
+/**
+ * @struct NodePool
+ * @brief A structure representing a pool of Nodes allocated in slabs.
+ *
+ * Instead of one malloc per node, the pool allocates nodes_per_slab nodes at a
+ * time and hands them out in order. Released nodes are pushed onto a free list
+ * (linked through their next pointers) and are reused before the slab is.
+ */
+typedef struct {
+    NodeSlab* slabs;         /**< The most recently allocated slab, or NULL */
+    Node* free_list;         /**< Released nodes waiting to be reused, or NULL */
+    uint64_t nodes_per_slab; /**< The number of nodes allocated by each malloc call */
+    uint64_t slab_used;      /**< The number of nodes handed out from the newest slab */
+    uint64_t num_slabs;      /**< The number of slabs allocated so far */
+    uint64_t capacity;       /**< The number of nodes the allocated slabs can hold */
+    uint64_t live_nodes;     /**< The number of nodes currently in use */
+    uint64_t free_nodes;     /**< The number of nodes on the free list */
+    uint64_t owners;         /**< The number of lists owning the pool (see compact_list), 0 for pools of the caller */
+} NodePool;
+
+/**
+ * @struct NodePoolStats
+ * @brief A snapshot of the allocation counters of a NodePool.
+ */
+typedef struct {
+    uint64_t mallocs;        /**< The number of malloc calls made by the pool */
+    uint64_t live_nodes;     /**< The number of nodes currently in use */
+    uint64_t free_nodes;     /**< The number of nodes on the free list */
+    uint64_t capacity;       /**< The number of nodes the allocated slabs can hold */
+    double bytes_per_node;   /**< Heap bytes reserved by the pool per node in use */
+} NodePoolStats;
+
+/**
+ * @struct HashSlot
+ * @brief One slot of a HashIndex, describing every node holding a value.
+ *
+ * A slot with a count of 0 is empty.
+ */
+typedef struct {
+    int64_t data;            /**< The value held by the nodes */
+    uint64_t count;          /**< The number of nodes holding the value */
+    Node* first;             /**< The node nearest the head holding the value */
+    uint64_t position;       /**< The index of first plus the offset of the HashIndex */
+} HashSlot;
+
+/**
+ * @struct HashIndex
+ * @brief An open-addressing (linear probing) hash table kept next to a list.
+ *
+ * Maps every value in the list to the number of nodes holding it and to its first
+ * occurrence. Positions are stored plus an offset, so prepends and delete_first only
+ * change the offset instead of every slot.
+ */
+typedef struct {
+    HashSlot* slots;         /**< The slots of the table */
+    uint64_t capacity;       /**< The number of slots, always a power of two */
+    uint64_t used;           /**< The number of non-empty slots */
+    uint64_t offset;         /**< Subtracted from a stored position to get an index */
+    bool stale;              /**< Set when a first occurrence is unknown until the next find */
+} HashIndex;
+
+/**
+ * @struct HashIndexStats
+ * @brief A snapshot of the memory used by a HashIndex.
+ */
+typedef struct {
+    uint64_t distinct_values; /**< The number of distinct values in the list */
+    uint64_t capacity;        /**< The number of slots in the table */
+    uint64_t bytes;           /**< Heap bytes used by the index */
+    double bytes_per_node;    /**< Heap bytes used by the index per node in the list */
+} HashIndexStats;
+
+/**
+ * @brief Called by compact_list and compact_step for every node they move.
+ *
+ * Receives the old address of the node, the new one, and the context given by the
+ * caller, so that pointers to nodes held outside of the list can be updated. The old
+ * node is released right after the call.
+ */
+typedef void (*NodeRemap)(Node* old_node, Node* new_node, void* context);
+
+/**
+ * @struct CompactPass
+ * @brief The state of an incremental compaction of a list (see compact_step).
+ */
+typedef struct {
+    Node* block;             /**< The nodes of the pool the list is moved into */
+    uint64_t capacity;       /**< The number of nodes in block */
+    uint64_t used;           /**< The number of nodes of block already used */
+    Node* prev;              /**< The last node moved, or NULL until the head has been moved */
+} CompactPass;
+
+/**
+ * @struct IndexedValue
+ * @brief One insert of a batch given to insert_nodes.
+ */
+typedef struct {
+    int64_t index;           /**< The index of the insert, counted in the list as it was before the batch */
+    int64_t data;            /**< The value to insert */
+} IndexedValue;
+
+/**
+ * @struct Checkpoint
+ * @brief A node of a list and its index, kept by a CheckpointTable.
+ */
+typedef struct {
+    Node* node;              /**< The node */
+    int64_t index;           /**< The index of the node in the list */
+} Checkpoint;
+
+/**
+ * @struct CheckpointTable
+ * @brief Pointers to the nodes at evenly spaced indices of a list, so that get,
+ *        insert_at and delete_at can walk from the nearest one.
+ *
+ * Those three functions, and the ones changing the ends of the list, move the indices
+ * of the checkpoints along in O(k) time for k checkpoints, so the checkpoints drift
+ * apart as nodes come and go. Every other change made in the middle of the list marks
+ * the table stale. The table is rebuilt, evenly spaced again, by one O(n) pass at the
+ * next positional access which finds it stale, or finds its nearest node more than
+ * spacing nodes away, and by refresh_checkpoints once two checkpoints, or an end of
+ * the list and the checkpoint nearest to it, are more than twice spacing apart.
+ */
+typedef struct {
+    Checkpoint* points;      /**< The checkpoints, in increasing order of index */
+    int64_t capacity;        /**< The most checkpoints the table holds */
+    int64_t count;           /**< The number of checkpoints in use */
+    int64_t spacing;         /**< The number of nodes between checkpoints when last rebuilt */
+    bool stale;              /**< Set when the table must be rebuilt before its next use */
+} CheckpointTable;
+
 /**
  * @struct DoublyLinkedList
  * @brief A structure representing a doubly linked list.
@@ -41,6 +195,11 @@ typedef struct {
     Node* head;       /**< Pointer to the first node in the list, or NULL if the list is empty */
     Node* tail;       /**< Pointer to the last node in the list, or NULL if the list is empty */
     int64_t size;     /**< The number of nodes in the list */
+    NodePool* pool;   /**< The pool nodes are allocated from, or NULL to use malloc */
+    bool owns_pool;   /**< Set when the list created its pool itself, and destroys it with its last node */
+    HashIndex* hash;  /**< The hash index over the values of the list, or NULL */
+    CompactPass* compact; /**< The incremental compaction running on the list, or NULL */
+    CheckpointTable* checkpoints; /**< The checkpoints used by positional accesses, or NULL */
 } DoublyLinkedList;
 
 
@@ -105,6 +264,72 @@ Node* prev_node(int64_t data, Node* next);
  */
 Node* between_nodes(int64_t data, Node* prev, Node* next);
 
+/*** NodePool Functions ***/
+
+/**
+ * @brief Creates an empty NodePool.
+ *
+ * No memory for nodes is allocated until the first node is requested from the pool.
+ *
+ * @param nodes_per_slab The number of nodes allocated by each malloc call, or 0
+ *        to use DEFAULT_NODES_PER_SLAB
+ * @return Pointer to the new NodePool, or NULL if memory allocation fails
+ * @note The caller must call destroy_node_pool when the pool is no longer needed.
+ */
+NodePool* create_node_pool(uint64_t nodes_per_slab);
+
+/**
+ * @brief Frees every slab owned by the pool, and then the pool itself.
+ *
+ * @param pool Pointer to the NodePool to destroy
+ * @note Every node that came from the pool is invalid afterwards, so lists attached
+ *       to the pool must be cleared or discarded first.
+ */
+void destroy_node_pool(NodePool* pool);
+
+/**
+ * @brief Creates a new Node from the given pool with NULL prev and next pointers.
+ *
+ * Nodes on the free list are reused first, then the newest slab is used, and a new
+ * slab is only allocated when both are exhausted.
+ *
+ * @param pool Pointer to the NodePool to allocate from, or NULL to use malloc
+ * @param data The value to store in the new node
+ * @return Pointer to the new Node, or NULL if memory allocation fails
+ */
+Node* pool_node(NodePool* pool, int64_t data);
+
+/**
+ * @brief Returns a Node to the pool it was allocated from.
+ *
+ * @param pool Pointer to the NodePool the node came from, or NULL if it came from malloc
+ * @param node Pointer to the Node to release
+ * @note The node is pushed onto the free list when pool is not NULL, and freed otherwise.
+ */
+void release_node(NodePool* pool, Node* node);
+
+/**
+ * @brief Takes count adjacent nodes out of the newest slab of the pool.
+ *
+ * If the slab does not have count unused nodes left, a new slab holding at least
+ * count nodes is allocated.
+ *
+ * @param pool Pointer to the NodePool to allocate from
+ * @param count The number of nodes to take, must be greater than 0
+ * @return Pointer to the first of the nodes, or NULL if memory allocation fails
+ * @note The nodes are counted as in use, but their data and links are left for the
+ *       caller to set.
+ */
+Node* pool_block(NodePool* pool, uint64_t count);
+
+/**
+ * @brief Returns a snapshot of the allocation counters of the pool.
+ *
+ * @param pool Pointer to the NodePool to report on
+ * @return The current NodePoolStats of the pool
+ */
+NodePoolStats pool_stats(NodePool* pool);
+
 /*** DoublyLinkedList Functions */
 
 /**
@@ -119,12 +344,136 @@ Node* between_nodes(int64_t data, Node* prev, Node* next);
  */
 bool is_empty(DoublyLinkedList *list_ptr);
 
+/**
+ * @brief Attaches a NodePool to the doubly linked list.
+ *
+ * Every node the list creates afterwards is taken from the pool, and every node it
+ * deletes is returned to the pool. A pool can be shared between several lists.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to attach the pool to
+ * @param pool Pointer to the NodePool, or NULL to go back to malloc
+ * @return true if the pool was attached, false if the list is not empty
+ * @note Only an empty list can change pools, since existing nodes came from elsewhere.
+ */
+bool attach_pool(DoublyLinkedList* list_ptr, NodePool* pool);
+
+/**
+ * @brief Builds a HashIndex over the values of the doubly linked list.
+ *
+ * While it is enabled, forward_find takes O(1) average time, and so does backward_find
+ * for a value which is missing or held by a single node. Every list function keeps the
+ * index up to date, and frees it, as disable_hash_index does, if it has to grow and can
+ * not. Deleting the first occurrence of a value which is held by several
+ * nodes makes the next forward_find recompute the first occurrences in one O(n) pass.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to index
+ * @return true if the index was built (or already existed), false if allocation failed
+ * @note The index must be freed with disable_hash_index before the list goes away.
+ */
+bool enable_hash_index(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Frees the HashIndex of the doubly linked list, if it has one.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList
+ */
+void disable_hash_index(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Returns the memory used by the HashIndex of the doubly linked list.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList
+ * @return HashIndexStats The snapshot, or all zeroes if the list has no HashIndex
+ */
+HashIndexStats hash_index_stats(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Builds a CheckpointTable of count nodes at evenly spaced indices of the doubly
+ *        linked list.
+ *
+ * While it is enabled, get, insert_at and delete_at walk from the nearest checkpoint
+ * instead of the nearer end, which takes O(n/k + k) time for k checkpoints instead of
+ * O(n). Around the square root of the expected size is a good count. The table is only
+ * filled in by the first positional access.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to add checkpoints to
+ * @param count The number of checkpoints, must be greater than 0
+ * @return true if the table was built, replacing any table the list had, false if count
+ *         is not positive or allocation failed, in which case the list keeps its table
+ * @note The table must be freed with disable_checkpoints before the list goes away.
+ */
+bool enable_checkpoints(DoublyLinkedList* list_ptr, int64_t count);
+
+/**
+ * @brief Frees the CheckpointTable of the doubly linked list, if it has one.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList
+ */
+void disable_checkpoints(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Rebuilds the CheckpointTable of the doubly linked list if it is stale, so that
+ *        every checkpoint is on the node at its index, or if appends, prepends, inserts
+ *        and deletes have left more than twice its spacing between two checkpoints or at
+ *        either end, so that the checkpoints are evenly spaced again.
+ *
+ * Checking the spacing takes O(k) time for k checkpoints, and a rebuild O(n).
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList
+ * @return true if the list has a CheckpointTable, false otherwise
+ */
+bool refresh_checkpoints(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Returns a pointer to the data of the node at the given index.
+ *
+ * Walks from the head, the tail, or the nearest checkpoint, whichever is closest to
+ * index, in either direction.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to read from
+ * @param index The 0-based index of the node
+ * @return int64_t* Pointer to the data of the node, or NULL if index is out of range
+ * @note The pointer is valid until the node is deleted.
+ */
+int64_t* get(DoublyLinkedList* list_ptr, int64_t index);
+
+/**
+ * @brief Inserts a new node with the specified data at the given index of the doubly
+ *        linked list.
+ *
+ * The node which was at index, and every node after it, move up by one. Like get,
+ * the walk starts from the closest of the head, the tail and the checkpoints.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to insert into
+ * @param data The value to store in the new node
+ * @param index The index of the new node, from 0 to the size of the list
+ * @return true if the node was inserted, false if index is out of range or memory
+ *         allocation failed, in which case the list is unchanged
+ */
+bool insert_at(DoublyLinkedList* list_ptr, int64_t data, int64_t index);
+
+/**
+ * @brief Deletes the node at the given index of the doubly linked list.
+ *
+ * Like get, the walk starts from the closest of the head, the tail and the checkpoints.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to delete from
+ * @param index The 0-based index of the node to delete
+ * @return true if the node was deleted, false if index is out of range
+ */
+bool delete_at(DoublyLinkedList* list_ptr, int64_t index);
+
 /**
  * @brief Searches for a specific data value by iterating from the head to the tail of the list.
  * 
  * This function traverses the doubly linked list in a forward direction (head -> tail)
  * searching for the first occurrence of the specified data value. If the value is found,
  * the function returns the index (0-based) of the node containing the value.
+ *
+ * The list is walked from both ends at once, meeting in the middle: a match met from the
+ * tail is kept until the walk from the head has passed it, while a match met from the head
+ * is returned at once. Since the two walks do not wait on each other, their cache misses
+ * overlap, which makes searching a list which does not fit in the cache about twice as fast.
  * 
  * @param list_ptr Pointer to the DoublyLinkedList to search within
  * @param data The integer value to search for in the list
@@ -140,6 +489,8 @@ int64_t forward_find(DoublyLinkedList *list_ptr, int64_t data);
  * This function traverses the doubly linked list in a backward direction (tail -> head)
  * searching for the first occurrence of the specified data value. If the value is found,
  * the function returns the index (0-based) of the node containing the value.
+ *
+ * Like forward_find, the list is walked from both ends at once, with the ends swapped.
  * 
  * @param list_ptr Pointer to the DoublyLinkedList to search within
  * @param data The integer value to search for in the list
@@ -175,4 +526,201 @@ void append_node(DoublyLinkedList* list_ptr, int64_t data);
  */
 void prepend_node(DoublyLinkedList* list_ptr, int64_t data);
 
+/**
+ * @brief Deletes the first node of the doubly linked list.
+ *
+ * The node is returned to the list's pool (or freed), the head is moved to the next
+ * node and the size of the list is decremented.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to modify
+ * @note If the list is empty, no action is performed.
+ */
+void delete_first(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Deletes the last node of the doubly linked list.
+ *
+ * The node is returned to the list's pool (or freed), the tail is moved to the
+ * previous node and the size of the list is decremented.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to modify
+ * @note If the list is empty, no action is performed.
+ */
+void delete_last(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Deletes every node of the doubly linked list.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to clear
+ * @note The list itself is not freed, and keeps a pool attached with attach_pool. A
+ *       pool the list created itself is destroyed once no other list owns it, and the
+ *       list goes back to malloc.
+ */
+void clear(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Inserts a batch of values in one pass over the doubly linked list.
+ *
+ * Every index is counted in the list as it was before the batch: a value goes right
+ * before the node which was at its index, or at the end for an index equal to the size.
+ * Values with the same index keep the order of the array. The pass starts from the end
+ * closer to the indices: from the head it walks to the last index, and from the tail
+ * it walks back to the first one, whichever is shorter. It takes O(n + k) time for k
+ * inserts in the worst case.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to modify
+ * @param inserts The inserts, sorted by index
+ * @param count The number of inserts
+ * @return true if every value was inserted, false if the inserts are not sorted or an
+ *         index is out of range, in which case the list is unchanged
+ */
+bool insert_nodes(DoublyLinkedList* list_ptr, const IndexedValue* inserts, int64_t count);
+
+/**
+ * @brief Deletes a batch of nodes in one pass over the doubly linked list.
+ *
+ * Every index is counted in the list as it was before the batch. Like insert_nodes,
+ * the pass starts from the end closer to the indices, and takes O(n + k) time for k
+ * indices in the worst case.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to modify
+ * @param indices The indices of the nodes to delete, in increasing order
+ * @param count The number of indices
+ * @return true if every node was deleted, false if the indices are not in increasing
+ *         order, repeat, or one is out of range, in which case the list is unchanged
+ */
+bool delete_nodes(DoublyLinkedList* list_ptr, const int64_t* indices, int64_t count);
+
+/**
+ * @brief Sorts the doubly linked list in ascending order with a radix sort which
+ *        relinks the nodes, RADIX_BITS bits at a time.
+ *
+ * Every pass moves the nodes into one chain per digit, keeping their order, and
+ * links the chains back together, so the sort is stable and allocates nothing.
+ * Lists longer than RADIX_CACHE_NODES are first split on their highest digit,
+ * and every part is then sorted on its lower digits least significant digit
+ * first, while its nodes are in the cache. Digits which are the same in every
+ * node of a part are skipped. The prev pointers and the tail are correct
+ * afterwards.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to sort
+ * @note A hash index is brought up to date by the next find.
+ */
+void radix_sort_list(DoublyLinkedList* list_ptr);
+
+/**
+ * @brief Moves every node of the doubly linked list into one contiguous block, in list
+ *        order.
+ *
+ * Walking the list then reads memory front to back again, after inserts and deletes
+ * have scattered its nodes. If the list owns its pool, or has none, the nodes move to
+ * a new pool owned by the list, and the old pool (unless another list still owns it)
+ * or every malloc'd node is freed. A pool attached with attach_pool is kept: the block
+ * is taken from it, and the old nodes go back to its free list. The hash index follows
+ * the nodes; any other pointer to a node of the list must be updated through remap.
+ * Any incremental compaction running on the list is finished first.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to compact
+ * @param remap Called for every node moved, or NULL
+ * @param context Passed to remap
+ * @return true if the list was compacted, false if memory allocation failed, in which
+ *         case the list is unchanged
+ */
+bool compact_list(DoublyLinkedList* list_ptr, NodeRemap remap, void* context);
+
+/**
+ * @brief Runs an incremental compaction of the doubly linked list for at most
+ *        max_nodes nodes.
+ *
+ * A large list can be compacted in steps of bounded time while it is in use. The
+ * first call takes one block for every node from the pool of the list, and every call
+ * moves the next nodes, from the head on, into it. The list may be changed in between
+ * steps: nodes prepended behind the pass are left where they are, nodes appended are
+ * moved into a further block, and clear and radix_sort_list end the pass.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to compact
+ * @param max_nodes The most nodes this step moves
+ * @param remap Called for every node moved, or NULL
+ * @param context Passed to remap
+ * @return true while the pass has nodes left to move, false once it is over, or if it
+ *         could not run
+ * @note Lists without a pool are not compacted by steps; compact_list moves them to one.
+ */
+bool compact_step(DoublyLinkedList* list_ptr, uint64_t max_nodes, NodeRemap remap, void* context);
+
+/**
+ * @brief Moves every node of src to the end of dest, leaving src empty.
+ *
+ * Takes O(1) time: the tail of dest is linked to the head of src, and no node is
+ * copied or allocated. The same as splice_after(dest, dest->tail, src).
+ *
+ * @param src Pointer to the DoublyLinkedList whose nodes are moved
+ * @param dest Pointer to the DoublyLinkedList the nodes are appended to
+ * @return true if the nodes were moved, false if the lists are the same or use
+ *         different pools
+ * @note See splice_after for the rules on pools and hash indices.
+ */
+bool concat(DoublyLinkedList* src, DoublyLinkedList* dest);
+
+/**
+ * @brief Moves every node of src into dest right after the node after, leaving src
+ *        empty.
+ *
+ * Takes O(1) time, and no node is copied or allocated. The nodes keep being released
+ * to the pool they came from, so both lists must use the same pool (or both malloc),
+ * unless dest is empty, in which case it takes on the pool of src, or src owns its
+ * pool (see compact_list) alone and dest has one, in which case the slabs and free
+ * nodes of the pool of src are moved into it. Splitting off part of a list never
+ * merges pools, and a list on malloc is never spliced into a pooled one. Hash indices count
+ * the moved values out of src and into dest in O(m) time for the m nodes moved, and
+ * find their first occurrences again on the next find. An incremental compaction
+ * running on src ends.
+ *
+ * @param dest Pointer to the DoublyLinkedList the nodes are moved into
+ * @param after The node of dest the nodes are linked after, or NULL to link them
+ *        before the head
+ * @param src Pointer to the DoublyLinkedList whose nodes are moved
+ * @return true if the nodes were moved, false if the lists are the same or use
+ *         different pools, in which case both lists are unchanged
+ */
+bool splice_after(DoublyLinkedList* dest, Node* after, DoublyLinkedList* src);
+
+/**
+ * @brief Splits the doubly linked list at index, moving the node at index and every
+ *        node after it to the end of dest.
+ *
+ * Walks to index from the closer end of the list, so it takes O(min(index, size -
+ * index)) time, and no node is copied or allocated.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to split
+ * @param index The index of the first node moved, from 0 to the size of the list
+ * @param dest Pointer to the DoublyLinkedList the nodes are appended to
+ * @return true if the list was split, false if index is out of range, or if the lists
+ *         are the same or use different pools, in which case both lists are unchanged
+ * @note See splice_after for the rules on pools and hash indices.
+ */
+bool split_at(DoublyLinkedList* list_ptr, int64_t index, DoublyLinkedList* dest);
+
+/**
+ * @brief Moves the nodes from first to last, both included, out of src and into dest
+ *        right after the node after.
+ *
+ * Takes O(k) time for the k nodes of the range, which are counted to keep both sizes
+ * right, and no node is copied or allocated. src and dest may be the same list, to
+ * move a range within it, as long as after is not in the range.
+ *
+ * @param src Pointer to the DoublyLinkedList holding the range
+ * @param first The first node of the range
+ * @param last The last node of the range, which must come at or after first in src
+ * @param dest Pointer to the DoublyLinkedList the range is moved into
+ * @param after The node of dest the range is linked after, or NULL to link it before
+ *        the head
+ * @return The number of nodes moved, or -1 if last does not follow first, if after is
+ *         in the range, or if the lists use different pools, in which case both lists
+ *         are unchanged
+ * @note See splice_after for the rules on pools and hash indices; a range holding all
+ *       of src counts as the whole list.
+ */
+int64_t splice_range(DoublyLinkedList* src, Node* first, Node* last, DoublyLinkedList* dest, Node* after);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,324 @@
+/*
+This document is meant to store the implementation of the thread-safe mode of
+the doubly linked list. Every node has a one byte spinlock, threads walking
+forward lock the next node before letting go of the current one, and threads
+walking backward only try the lock of the previous node, backing off when it
+is taken, so that no two threads can wait on each other in a cycle.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<sched.h>
+#include<stdlib.h>
+#include"doubly-locked.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Waits until the lock of the node is free and takes it.
+ */
+static void lock_node(LockedNode* node) {
+    uint64_t spins = 0;
+    while (atomic_exchange_explicit(&(node->locked), true, memory_order_acquire)) {
+        // wait on a plain load so the cache line is not written while it is taken
+        while (atomic_load_explicit(&(node->locked), memory_order_relaxed)) {
+            if (++spins % LOCK_SPINS == 0) {
+                sched_yield();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Takes the lock of the node if it is free, and returns whether it did.
+ */
+static bool try_lock_node(LockedNode* node) {
+    return !atomic_load_explicit(&(node->locked), memory_order_relaxed)
+           && !atomic_exchange_explicit(&(node->locked), true, memory_order_acquire);
+}
+
+static void unlock_node(LockedNode* node) {
+    atomic_store_explicit(&(node->locked), false, memory_order_release);
+}
+
+static LockedNode* new_locked_node(int64_t data) {
+    LockedNode* node = (LockedNode *) malloc(sizeof(LockedNode));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->data = data;
+    node->prev = NULL;
+    node->next = NULL;
+    atomic_init(&(node->locked), false);
+    node->deleted = false;
+    node->retired = NULL;
+    return node;
+}
+
+/**
+ * @brief Links node between prev and next, whose locks the caller holds.
+ */
+static void link_between(LockedDoublyList* list_ptr, LockedNode* node, LockedNode* prev, LockedNode* next) {
+    node->prev = prev;
+    node->next = next;
+    prev->next = node;
+    next->prev = node;
+    atomic_fetch_add(&(list_ptr->size), 1);
+}
+
+/**
+ * @brief Locks the node before node, which the caller holds, keeping node locked.
+ *        Since a thread walking forward may hold the node before and be waiting
+ *        for node, node is let go and taken again whenever the lock before it is
+ *        taken. Returns NULL, with node unlocked, if node was deleted meanwhile.
+ */
+static LockedNode* lock_prev(LockedNode* node) {
+    while (true) {
+        LockedNode* prev = node->prev;
+        if (try_lock_node(prev)) {
+            return prev;
+        }
+        unlock_node(node);
+        sched_yield();
+        lock_node(node);
+        if (node->deleted) {
+            unlock_node(node);
+            return NULL;
+        }
+    }
+}
+
+/**
+ * @brief Walks forward from the head to the first node holding data. Returns it
+ *        locked, together with the node before it in prev_out, also locked, or
+ *        NULL with nothing locked if no node holds data.
+ */
+static LockedNode* find_forward(LockedDoublyList* list_ptr, int64_t data, LockedNode** prev_out, int64_t* index_out) {
+    LockedNode* prev = &(list_ptr->head);
+    lock_node(prev);
+    LockedNode* node = prev->next;
+    int64_t index = 0;
+    while (node != &(list_ptr->tail)) {
+        lock_node(node);
+        if (node->data == data) {
+            *prev_out = prev;
+            *index_out = index;
+            return node;
+        }
+        unlock_node(prev);
+        prev = node;
+        node = node->next;
+        index++;
+    }
+    unlock_node(prev);
+    return NULL;
+}
+
+/**
+ * @brief Walks backward from the tail to the first node holding data. Returns it
+ *        locked, or NULL with nothing locked if no node holds data. The walk
+ *        starts over if the node it stands on is deleted while it backs off.
+ */
+static LockedNode* find_backward(LockedDoublyList* list_ptr, int64_t data, int64_t* index_out) {
+    while (true) {
+        LockedNode* node = &(list_ptr->tail);
+        lock_node(node);
+        int64_t index = 0;
+        while (true) {
+            LockedNode* prev = lock_prev(node);
+            if (prev == NULL) {
+                break;
+            }
+            unlock_node(node);
+            if (prev == &(list_ptr->head)) {
+                unlock_node(prev);
+                return NULL;
+            }
+            node = prev;
+            if (node->data == data) {
+                *index_out = index;
+                return node;
+            }
+            index++;
+        }
+    }
+}
+
+/**
+ * @brief Keeps a node which was just unlinked until the list is cleared, since a
+ *        thread walking backward may still take its lock again.
+ */
+static void retire(LockedDoublyList* list_ptr, LockedNode* node) {
+    LockedNode* head = atomic_load(&(list_ptr->retired));
+    do {
+        node->retired = head;
+    } while (!atomic_compare_exchange_weak(&(list_ptr->retired), &head, node));
+}
+
+/*** LockedDoublyList Functions ***/
+
+LockedDoublyList* create_locked_list() {
+    LockedDoublyList* list_ptr = (LockedDoublyList *) malloc(sizeof(LockedDoublyList));
+    if (list_ptr == NULL) {
+        return NULL;
+    }
+    LockedNode* sentinels[2] = {&(list_ptr->head), &(list_ptr->tail)};
+    for (int i = 0; i < 2; i++) {
+        sentinels[i]->data = 0;
+        atomic_init(&(sentinels[i]->locked), false);
+        sentinels[i]->deleted = false;
+        sentinels[i]->retired = NULL;
+    }
+    list_ptr->head.prev = NULL;
+    list_ptr->head.next = &(list_ptr->tail);
+    list_ptr->tail.prev = &(list_ptr->head);
+    list_ptr->tail.next = NULL;
+    atomic_init(&(list_ptr->size), 0);
+    atomic_init(&(list_ptr->retired), NULL);
+    return list_ptr;
+}
+
+void destroy_locked_list(LockedDoublyList* list_ptr) {
+    clear_locked_list(list_ptr);
+    free(list_ptr);
+}
+
+void clear_locked_list(LockedDoublyList* list_ptr) {
+    LockedNode* node = list_ptr->head.next;
+    while (node != &(list_ptr->tail)) {
+        LockedNode* next = node->next;
+        free(node);
+        node = next;
+    }
+    node = atomic_load(&(list_ptr->retired));
+    while (node != NULL) {
+        LockedNode* next = node->retired;
+        free(node);
+        node = next;
+    }
+    list_ptr->head.next = &(list_ptr->tail);
+    list_ptr->tail.prev = &(list_ptr->head);
+    atomic_store(&(list_ptr->size), 0);
+    atomic_store(&(list_ptr->retired), NULL);
+}
+
+int64_t locked_size(LockedDoublyList* list_ptr) {
+    return atomic_load(&(list_ptr->size));
+}
+
+int64_t locked_forward_find(LockedDoublyList* list_ptr, int64_t data) {
+    LockedNode* prev;
+    int64_t index;
+    LockedNode* node = find_forward(list_ptr, data, &prev, &index);
+    if (node == NULL) {
+        return -1;
+    }
+    unlock_node(prev);
+    unlock_node(node);
+    return index;
+}
+
+int64_t locked_backward_find(LockedDoublyList* list_ptr, int64_t data) {
+    int64_t index;
+    LockedNode* node = find_backward(list_ptr, data, &index);
+    if (node == NULL) {
+        return -1;
+    }
+    unlock_node(node);
+    return index;
+}
+
+bool locked_append(LockedDoublyList* list_ptr, int64_t data) {
+    LockedNode* node = new_locked_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    LockedNode* tail = &(list_ptr->tail);
+    lock_node(tail);
+    // the tail sentinel is never deleted, so this always succeeds
+    LockedNode* last = lock_prev(tail);
+    link_between(list_ptr, node, last, tail);
+    unlock_node(last);
+    unlock_node(tail);
+    return true;
+}
+
+bool locked_prepend(LockedDoublyList* list_ptr, int64_t data) {
+    LockedNode* node = new_locked_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    LockedNode* head = &(list_ptr->head);
+    lock_node(head);
+    LockedNode* first = head->next;
+    lock_node(first);
+    link_between(list_ptr, node, head, first);
+    unlock_node(first);
+    unlock_node(head);
+    return true;
+}
+
+bool locked_insert_after(LockedDoublyList* list_ptr, int64_t after, int64_t data) {
+    LockedNode* node = new_locked_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    LockedNode* prev;
+    int64_t index;
+    LockedNode* found = find_forward(list_ptr, after, &prev, &index);
+    if (found == NULL) {
+        free(node);
+        return false;
+    }
+    unlock_node(prev);
+    LockedNode* next = found->next;
+    lock_node(next);
+    link_between(list_ptr, node, found, next);
+    unlock_node(next);
+    unlock_node(found);
+    return true;
+}
+
+bool locked_insert_before(LockedDoublyList* list_ptr, int64_t before, int64_t data) {
+    LockedNode* node = new_locked_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    while (true) {
+        int64_t index;
+        LockedNode* found = find_backward(list_ptr, before, &index);
+        if (found == NULL) {
+            free(node);
+            return false;
+        }
+        LockedNode* prev = lock_prev(found);
+        // the found node was deleted while stepping back, so search again
+        if (prev != NULL) {
+            link_between(list_ptr, node, prev, found);
+            unlock_node(prev);
+            unlock_node(found);
+            return true;
+        }
+    }
+}
+
+bool locked_delete(LockedDoublyList* list_ptr, int64_t data) {
+    LockedNode* prev;
+    int64_t index;
+    LockedNode* node = find_forward(list_ptr, data, &prev, &index);
+    if (node == NULL) {
+        return false;
+    }
+    LockedNode* next = node->next;
+    lock_node(next);
+    prev->next = next;
+    next->prev = prev;
+    node->deleted = true;
+    atomic_fetch_sub(&(list_ptr->size), 1);
+    unlock_node(next);
+    unlock_node(node);
+    unlock_node(prev);
+    retire(list_ptr, node);
+    return true;
+}
@@ -0,0 +1,180 @@
+/*
+This header file is used to declare the LockedNode struct, and the functions
+used to manage the thread-safe mode of the doubly linked list, where every
+node has a lock of its own and threads lock their way along the list hand
+over hand, so that threads working on different parts of the list do not
+wait for each other.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYLOCKED_H
+#define DOUBLYLOCKED_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdatomic.h>
+
+/*** Constants ***/
+// a thread spins this many times on a taken node lock before yielding the core
+#define LOCK_SPINS 64
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @struct LockedNode
+ * @brief A node of a LockedDoublyList, with a lock of its own.
+ *
+ * A thread must hold the lock of a node to read or change its prev and next
+ * pointers, and must hold both locks of two neighbours to link or unlink a
+ * node between them.
+ */
+typedef struct LockedNode {
+    int64_t data;                /**< The data stored in this node */
+    struct LockedNode* prev;     /**< Pointer to the previous node, or the head sentinel */
+    struct LockedNode* next;     /**< Pointer to the next node, or the tail sentinel */
+    atomic_bool locked;          /**< Set while a thread holds the lock of this node */
+    bool deleted;                /**< Set, under the lock, once the node was unlinked */
+    struct LockedNode* retired;  /**< The node deleted before this one, once deleted */
+} LockedNode;
+
+/**
+ * @struct LockedDoublyList
+ * @brief A doubly linked list which any number of threads can search and change at once.
+ *
+ * The list is framed by two sentinel nodes which are never deleted, so that the
+ * first and last nodes are changed under the locks of their neighbours like any
+ * other node. Threads walking forward wait for the lock of the next node while
+ * holding their own. Threads walking backward only try the lock of the previous
+ * node, and let go of their own lock if it is taken, so the two directions can
+ * never wait on each other in a cycle.
+ *
+ * @note Deleted nodes are not freed until clear_locked_list or destroy_locked_list,
+ *       since a thread walking backward may still come back to them.
+ */
+typedef struct {
+    LockedNode head;                 /**< The sentinel before the first node */
+    LockedNode tail;                 /**< The sentinel after the last node */
+    atomic_int_fast64_t size;        /**< The number of nodes, not counting the sentinels */
+    _Atomic(LockedNode*) retired;    /**< The most recently deleted node, or NULL */
+} LockedDoublyList;
+
+
+/*** LockedDoublyList Functions ***/
+
+/**
+ * @brief Creates an empty LockedDoublyList.
+ *
+ * @return Pointer to the new LockedDoublyList, or NULL if memory allocation fails
+ * @note The caller must call destroy_locked_list when the list is no longer needed.
+ */
+LockedDoublyList* create_locked_list();
+
+/**
+ * @brief Frees every node of the list, deleted or not, and then the list itself.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to destroy
+ * @note No other thread may be using the list.
+ */
+void destroy_locked_list(LockedDoublyList* list_ptr);
+
+/**
+ * @brief Deletes and frees every node of the list, including the deleted nodes kept until now.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to clear
+ * @note No other thread may be using the list.
+ */
+void clear_locked_list(LockedDoublyList* list_ptr);
+
+/**
+ * @brief Returns the number of nodes in the list.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList
+ * @return int64_t The size, which may already be out of date while other threads change the list
+ */
+int64_t locked_size(LockedDoublyList* list_ptr);
+
+/**
+ * @brief Searches for a value by locking the nodes from the head to the tail, hand over hand.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the first node holding the value, counted from the
+ *         head, or -1 if the value was not found.
+ * @note Safe to call from any number of threads at once.
+ */
+int64_t locked_forward_find(LockedDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Searches for a value by locking the nodes from the tail to the head, hand over hand.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the last node holding the value, counted from the
+ *         tail, or -1 if the value was not found.
+ * @note Safe to call from any number of threads at once. The walk starts over from the
+ *       tail if the node it stands on is deleted while it steps back.
+ */
+int64_t locked_backward_find(LockedDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Appends a new node with the specified data to the end of the list.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to append to
+ * @param data The value to store in the new node
+ * @return true if the node was appended, false if memory allocation failed
+ * @note Safe to call from any number of threads at once.
+ */
+bool locked_append(LockedDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node with the specified data at the beginning of the list.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to prepend to
+ * @param data The value to store in the new node
+ * @return true if the node was prepended, false if memory allocation failed
+ * @note Safe to call from any number of threads at once.
+ */
+bool locked_prepend(LockedDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node right after the first node holding a value, found by
+ *        walking forward from the head.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to insert into
+ * @param after The value held by the node the new node should follow
+ * @param data The value to store in the new node
+ * @return true if the node was inserted, false if no node holds after or memory
+ *         allocation failed
+ * @note Safe to call from any number of threads at once.
+ */
+bool locked_insert_after(LockedDoublyList* list_ptr, int64_t after, int64_t data);
+
+/**
+ * @brief Inserts a new node right before the last node holding a value, found by
+ *        walking backward from the tail.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to insert into
+ * @param before The value held by the node the new node should precede
+ * @param data The value to store in the new node
+ * @return true if the node was inserted, false if no node holds before or memory
+ *         allocation failed
+ * @note Safe to call from any number of threads at once.
+ */
+bool locked_insert_before(LockedDoublyList* list_ptr, int64_t before, int64_t data);
+
+/**
+ * @brief Deletes the first node holding a value, found by walking forward from the head.
+ *
+ * @param list_ptr Pointer to the LockedDoublyList to delete from
+ * @param data The value held by the node to delete
+ * @return true if a node was deleted, false if no node holds the value
+ * @note Safe to call from any number of threads at once. The node is only freed by
+ *       clear_locked_list or destroy_locked_list.
+ */
+bool locked_delete(LockedDoublyList* list_ptr, int64_t data);
+
+#endif
@@ -0,0 +1,173 @@
+/*
+This header file is used to declare the MappedNode struct, and the functions
+used to keep a doubly linked list in a file which is mapped into memory, so
+that a list written by one run of a program can be walked, in either
+direction, by the next one without reading it in node by node.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYMAPPED_H
+#define DOUBLYMAPPED_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"doubly-linked.h"
+
+/*** Constants ***/
+// the first bytes of every list file, which also change with the layout of a MappedNode
+#define MAPPED_MAGIC "DLLMAP01"
+// the number of nodes a new list file has room for when no capacity is given
+#define MAPPED_DEFAULT_CAPACITY 1024
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @struct MappedNode
+ * @brief A node as it is stored in a list file.
+ *
+ * The links are distances in bytes from the node itself, so the file can be
+ * mapped at any address and walked without changing a single byte.
+ */
+typedef struct {
+    int64_t data;    /**< The data stored in this node */
+    int64_t next;    /**< The distance in bytes to the next node, or 0 for the last node */
+    int64_t prev;    /**< The distance in bytes to the previous node, or 0 for the first node */
+} MappedNode;
+
+/**
+ * @struct MappedHeader
+ * @brief The header at the start of every list file.
+ *
+ * The header is at offset 0, so 0 is never the offset of a node.
+ */
+typedef struct {
+    char magic[8];        /**< MAPPED_MAGIC */
+    uint64_t node_size;   /**< The size of a MappedNode when the file was written */
+    uint64_t size;        /**< The number of nodes */
+    uint64_t head;        /**< The offset of the first node in the file, or 0 if the list is empty */
+    uint64_t tail;        /**< The offset of the last node in the file, or 0 if the list is empty */
+    uint64_t used;        /**< The number of bytes in use, after which the next node is written */
+} MappedHeader;
+
+/**
+ * @struct MappedDoublyList
+ * @brief A list file which is open and mapped into memory.
+ */
+typedef struct {
+    int fd;                  /**< The file descriptor of the file */
+    MappedHeader* header;    /**< The address the file is mapped at, which starts with the header */
+    uint64_t capacity;       /**< The number of bytes mapped, which is the length of the file while it is open */
+} MappedDoublyList;
+
+
+/*** MappedDoublyList Functions ***/
+
+/**
+ * @brief Creates a list file holding an empty list, replacing any file already at
+ *        path, and maps it into memory.
+ *
+ * @param path The path of the file to create
+ * @param capacity The number of nodes the file has room for before it has to grow,
+ *        or 0 to use MAPPED_DEFAULT_CAPACITY
+ * @return Pointer to the open MappedDoublyList, or NULL if the file could not be
+ *         created or mapped
+ * @note The caller must call close_mapped_list when the list is no longer needed.
+ */
+MappedDoublyList* create_mapped_list(const char* path, uint64_t capacity);
+
+/**
+ * @brief Maps an existing list file into memory, without reading or changing any
+ *        of its nodes, so it takes the same time for any length of list.
+ *
+ * @param path The path of the file to open
+ * @return Pointer to the open MappedDoublyList, or NULL if the file does not exist,
+ *         could not be mapped, or its header does not describe a valid list file
+ * @note The caller must call close_mapped_list when the list is no longer needed.
+ */
+MappedDoublyList* open_mapped_list(const char* path);
+
+/**
+ * @brief Writes every change to the file with msync, trims the space kept for more
+ *        nodes off the end of the file, and closes it.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList to close, which is freed
+ */
+void close_mapped_list(MappedDoublyList* mapped_ptr);
+
+/**
+ * @brief Writes every change made to the list so far to the file with msync, and
+ *        waits until it is written.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList to write
+ * @return true if the changes were written, false if msync failed
+ */
+bool mapped_sync(MappedDoublyList* mapped_ptr);
+
+/**
+ * @brief Writes a new node holding data after the last node of the file.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList to append to
+ * @param data The value to store in the new node
+ * @return true if the node was appended, false if the file could not grow
+ * @note The file doubles in length whenever it is full, which maps it again, possibly
+ *       at another address, so MappedNode pointers taken before an append must not be
+ *       used after it. The node is in the file once mapped_sync or close_mapped_list
+ *       is called.
+ */
+bool mapped_append(MappedDoublyList* mapped_ptr, int64_t data);
+
+/**
+ * @brief Returns the number of nodes in the list file.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList
+ * @return uint64_t The number of nodes
+ */
+uint64_t mapped_size(MappedDoublyList* mapped_ptr);
+
+/**
+ * @brief Returns the first node of the list file.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList
+ * @return Pointer to the first node, or NULL if the list is empty
+ */
+MappedNode* mapped_head(MappedDoublyList* mapped_ptr);
+
+/**
+ * @brief Returns the last node of the list file.
+ *
+ * @param mapped_ptr Pointer to the MappedDoublyList
+ * @return Pointer to the last node, or NULL if the list is empty
+ */
+MappedNode* mapped_tail(MappedDoublyList* mapped_ptr);
+
+/**
+ * @brief Returns the node after node in its list file.
+ *
+ * @param node Pointer to a node of an open MappedDoublyList
+ * @return Pointer to the next node, or NULL if node is the last one
+ */
+MappedNode* mapped_next(MappedNode* node);
+
+/**
+ * @brief Returns the node before node in its list file.
+ *
+ * @param node Pointer to a node of an open MappedDoublyList
+ * @return Pointer to the previous node, or NULL if node is the first one
+ */
+MappedNode* mapped_prev(MappedNode* node);
+
+/**
+ * @brief Writes the values of a DoublyLinkedList, in order, to a new list file at
+ *        path, replacing any file already there.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to write
+ * @param path The path of the file to write
+ * @return true if the file was written, false if it could not be created
+ */
+bool save_mapped_list(DoublyLinkedList* list_ptr, const char* path);
+
+#endif
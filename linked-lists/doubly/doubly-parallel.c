@@ -0,0 +1,147 @@
+/*
+This document is meant to store the implementation of the parallel search of
+the doubly linked list. The checkpoints of the list mark where the segments
+start, threads take the segments in list order from a shared counter, and the
+lowest match found so far is kept in an atomic, which every thread checks to
+stop early.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<pthread.h>
+#include<stdatomic.h>
+#include<stdlib.h>
+#include"doubly-parallel.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief The state shared by the threads of one search. The segment i starts at
+ *        starts[i] and ends where the next one starts, or at the tail.
+ */
+typedef struct {
+    Checkpoint* starts;
+    int64_t count;
+    int64_t size;
+    int64_t data;
+    bool any;                        // stop at a match anywhere, not only before the node
+    atomic_int_fast64_t next;        // the next segment to take
+    atomic_int_fast64_t found;       // the lowest match so far, or INT64_MAX
+} ParallelSearch;
+
+/**
+ * @brief Lowers the match found by the search to index, unless a lower one was
+ *        found in the meantime.
+ */
+static void record_match(ParallelSearch* search, int64_t index) {
+    int_fast64_t found = atomic_load_explicit(&(search->found), memory_order_relaxed);
+    while ((index < found)
+           && !atomic_compare_exchange_weak_explicit(&(search->found), &found, index,
+                                                     memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Returns true once a match was found which makes scanning from index
+ *        pointless: any match for a contains, or one before index for a find.
+ */
+static bool search_over(ParallelSearch* search, int64_t index) {
+    int_fast64_t found = atomic_load_explicit(&(search->found), memory_order_relaxed);
+    return search->any ? (found != INT64_MAX) : (found < index);
+}
+
+/**
+ * @brief Takes segments until there are none left or the search is over, and
+ *        scans each one. Segments are taken in list order, so after a match a
+ *        thread has nothing lower left to scan.
+ */
+static void* search_segments(void* arg) {
+    ParallelSearch* search = (ParallelSearch *) arg;
+    while (true) {
+        int64_t segment = atomic_fetch_add_explicit(&(search->next), 1, memory_order_relaxed);
+        if ((segment >= search->count) || search_over(search, search->starts[segment].index)) {
+            return NULL;
+        }
+        int64_t index = search->starts[segment].index;
+        int64_t end = (segment + 1 < search->count) ? search->starts[segment + 1].index : search->size;
+        Node* node = search->starts[segment].node;
+        while (index < end) {
+            int64_t stop = (end - index > PARALLEL_CANCEL_NODES) ? index + PARALLEL_CANCEL_NODES : end;
+            for (; index < stop; index++) {
+                if (node->data == search->data) {
+                    record_match(search, index);
+                    return NULL;
+                }
+                node = node->next;
+            }
+            if (search_over(search, index)) {
+                return NULL;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs a search on the calling thread and threads - 1 new ones, and
+ *        returns the lowest match, or -1. Returns -2 if the list has to be
+ *        searched by forward_find instead.
+ */
+static int64_t search_in_parallel(DoublyLinkedList* list_ptr, int64_t data, int64_t threads, bool any) {
+    if ((threads < 2) || (list_ptr->size < PARALLEL_MIN_NODES) || (list_ptr->hash != NULL)
+        || !refresh_checkpoints(list_ptr)) {
+        return -2;
+    }
+    CheckpointTable* table = list_ptr->checkpoints;
+    ParallelSearch search;
+    search.starts = (Checkpoint *) malloc(sizeof(Checkpoint) * (table->count + 1));
+    if (search.starts == NULL) {
+        return -2;
+    }
+    // nodes prepended since the table was built come before the first checkpoint
+    search.count = 0;
+    if ((table->count == 0) || (table->points[0].index > 0)) {
+        search.starts[0].node = list_ptr->head;
+        search.starts[0].index = 0;
+        search.count = 1;
+    }
+    for (int64_t i = 0; i < table->count; i++) {
+        search.starts[search.count++] = table->points[i];
+    }
+    search.size = list_ptr->size;
+    search.data = data;
+    search.any = any;
+    atomic_init(&(search.next), 0);
+    atomic_init(&(search.found), INT64_MAX);
+
+    if (threads > PARALLEL_MAX_THREADS) {
+        threads = PARALLEL_MAX_THREADS;
+    }
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    int64_t started = 0;
+    for (; started < threads - 1; started++) {
+        // the threads which did start, and this one, still scan every segment
+        if (pthread_create(&(workers[started]), NULL, search_segments, &search) != 0) {
+            break;
+        }
+    }
+    search_segments(&search);
+    for (int64_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(search.starts);
+    int_fast64_t found = atomic_load(&(search.found));
+    return (found == INT64_MAX) ? -1 : (int64_t) found;
+}
+
+/*** Parallel Search Functions ***/
+
+int64_t parallel_find(DoublyLinkedList* list_ptr, int64_t data, int64_t threads) {
+    int64_t found = search_in_parallel(list_ptr, data, threads, false);
+    return (found == -2) ? forward_find(list_ptr, data) : found;
+}
+
+bool parallel_contains(DoublyLinkedList* list_ptr, int64_t data, int64_t threads) {
+    int64_t found = search_in_parallel(list_ptr, data, threads, true);
+    return ((found == -2) ? forward_find(list_ptr, data) : found) != -1;
+}
@@ -0,0 +1,71 @@
+/*
+This header file is used to declare the functions which search a doubly linked
+list with several threads at once. The list is cut into segments at its
+checkpoints, and every thread scans whole segments, stopping as soon as a match
+is found earlier in the list than the segment it is on.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYPARALLEL_H
+#define DOUBLYPARALLEL_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"doubly-linked.h"
+
+/*** Constants ***/
+// lists shorter than this are searched by the calling thread alone, since starting
+// threads would take longer than the search
+#define PARALLEL_MIN_NODES 65536
+// the most threads a search starts
+#define PARALLEL_MAX_THREADS 64
+// a thread checks whether the search is over every this many nodes
+#define PARALLEL_CANCEL_NODES 1024
+
+
+/*** Parallel Search Functions ***/
+
+/**
+ * @brief Searches for a value with several threads, and returns the index of its first
+ *        occurrence, like forward_find.
+ *
+ * The segments are the stretches of the list between its checkpoints (see
+ * enable_checkpoints), which insert_at, delete_at and the changes at the ends keep up to
+ * date, so no walk is needed to split the list. Once nodes added at the ends or in the
+ * middle leave a segment more than twice the spacing long, the checkpoints are spaced
+ * evenly again first (see refresh_checkpoints), so that no thread gets most of the list.
+ * The calling thread and threads - 1 new
+ * ones take the segments in list order, one at a time, so a thread which finishes early
+ * takes the next one; a few times more checkpoints than threads keeps them all busy. A
+ * thread stops at the first match in its segment, and every thread stops once a match
+ * was found before the node it is on. The lowest matching index is returned.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to search within
+ * @param data The integer value to search for in the list
+ * @param threads The number of threads to search with, at most PARALLEL_MAX_THREADS
+ * @return int64_t The 0-based index of the first node holding the value, or -1 if the
+ *         value was not found or the list is empty
+ * @note With fewer than 2 threads, and for lists with a hash index, without checkpoints,
+ *       or with fewer than PARALLEL_MIN_NODES nodes, forward_find runs on the calling
+ *       thread. No other thread may change the list during the search.
+ */
+int64_t parallel_find(DoublyLinkedList* list_ptr, int64_t data, int64_t threads);
+
+/**
+ * @brief Searches for a value with several threads, and returns whether any node holds
+ *        it.
+ *
+ * The same as parallel_find, except that every thread stops once a match was found
+ * anywhere in the list.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to search within
+ * @param data The integer value to search for in the list
+ * @param threads The number of threads to search with, at most PARALLEL_MAX_THREADS
+ * @return true if a node holds the value, false otherwise
+ * @note See parallel_find for the lists which are searched by the calling thread alone.
+ */
+bool parallel_contains(DoublyLinkedList* list_ptr, int64_t data, int64_t threads);
+
+#endif
@@ -0,0 +1,356 @@
+/*
+This document is meant to store the implementation of the read-mostly mode of
+the doubly linked list. Readers walk the next pointers with plain loads, and at
+the end of every search copy the current epoch into a slot of their own. The
+writer stamps the nodes it unlinks with the epoch, moves the epoch on when it
+wants to free them, and frees the ones stamped before the oldest epoch any
+online reader has copied.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<sched.h>
+#include<stdlib.h>
+#include"doubly-rcu.h"
+
+/*** Helper Functions ***/
+
+static RcuNode* new_rcu_node(int64_t data) {
+    RcuNode* node = (RcuNode *) malloc(sizeof(RcuNode));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->data = data;
+    atomic_init(&(node->next), NULL);
+    node->prev = NULL;
+    node->epoch = 0;
+    return node;
+}
+
+/**
+ * @brief Records that the reader holds no node anymore, by copying the current
+ *        epoch into its slot. The slot is only written when the epoch moved on,
+ *        so searches between two reclaims leave its cache line alone.
+ */
+static inline void rcu_quiescent(RcuDoublyList* list_ptr, RcuReader* reader) {
+    uint_fast64_t epoch = atomic_load_explicit(&(list_ptr->epoch), memory_order_acquire);
+    if (atomic_load_explicit(&(reader->epoch), memory_order_relaxed) != epoch) {
+        // the release keeps every load of the search before the store
+        atomic_store_explicit(&(reader->epoch), epoch, memory_order_release);
+    }
+}
+
+/**
+ * @brief Returns the first node holding data, or NULL. Only the writer changes
+ *        the list, so it reads the pointers without ordering.
+ */
+static RcuNode* writer_find(RcuDoublyList* list_ptr, int64_t data) {
+    RcuNode* node = atomic_load_explicit(&(list_ptr->head), memory_order_relaxed);
+    while ((node != NULL) && (node->data != data)) {
+        node = atomic_load_explicit(&(node->next), memory_order_relaxed);
+    }
+    return node;
+}
+
+/**
+ * @brief Points whatever comes before prev's successor, prev or the head when
+ *        prev is NULL, at node, publishing node to the readers.
+ */
+static void publish_after(RcuDoublyList* list_ptr, RcuNode* prev, RcuNode* node) {
+    if (prev == NULL) {
+        atomic_store_explicit(&(list_ptr->head), node, memory_order_release);
+    } else {
+        atomic_store_explicit(&(prev->next), node, memory_order_release);
+    }
+}
+
+/**
+ * @brief Stamps an unlinked node with the current epoch and queues it to be
+ *        freed. Its next is left as it was, for the readers still on it.
+ */
+static void retire(RcuDoublyList* list_ptr, RcuNode* node) {
+    node->epoch = atomic_load_explicit(&(list_ptr->epoch), memory_order_relaxed);
+    node->prev = NULL;
+    if (list_ptr->last_retired == NULL) {
+        list_ptr->retired = node;
+    } else {
+        list_ptr->last_retired->prev = node;
+    }
+    list_ptr->last_retired = node;
+    list_ptr->retired_count++;
+}
+
+/**
+ * @brief Unlinks node from the list and queues it to be freed, trying to free
+ *        the queue every RCU_RECLAIM_BATCH nodes.
+ */
+static void unlink_node(RcuDoublyList* list_ptr, RcuNode* node) {
+    RcuNode* next = atomic_load_explicit(&(node->next), memory_order_relaxed);
+    publish_after(list_ptr, node->prev, next);
+    if (next == NULL) {
+        list_ptr->tail = node->prev;
+    } else {
+        next->prev = node->prev;
+    }
+    atomic_fetch_sub_explicit(&(list_ptr->size), 1, memory_order_relaxed);
+    retire(list_ptr, node);
+    if (list_ptr->retired_count % RCU_RECLAIM_BATCH == 0) {
+        rcu_reclaim(list_ptr);
+    }
+}
+
+/**
+ * @brief Moves the epoch on, so that the nodes unlinked until now are stamped
+ *        with an older one than any reader copies from then on, and returns the
+ *        epoch they were stamped with at most.
+ */
+static uint64_t advance_epoch(RcuDoublyList* list_ptr) {
+    uint64_t epoch = atomic_fetch_add(&(list_ptr->epoch), 1);
+    // pairs with the fence of rcu_reader_online, so a reader coming back either
+    // shows up in its slot below or sees the list without the unlinked nodes
+    atomic_thread_fence(memory_order_seq_cst);
+    return epoch;
+}
+
+/**
+ * @brief Frees the queued nodes stamped before the given epoch, oldest first,
+ *        and returns how many it freed.
+ */
+static int64_t free_retired(RcuDoublyList* list_ptr, uint64_t before) {
+    int64_t freed = 0;
+    while ((list_ptr->retired != NULL) && (list_ptr->retired->epoch < before)) {
+        RcuNode* node = list_ptr->retired;
+        list_ptr->retired = node->prev;
+        free(node);
+        freed++;
+    }
+    if (list_ptr->retired == NULL) {
+        list_ptr->last_retired = NULL;
+    }
+    list_ptr->retired_count -= freed;
+    return freed;
+}
+
+/*** RcuDoublyList Functions ***/
+
+RcuDoublyList* create_rcu_list() {
+    RcuDoublyList* list_ptr = (RcuDoublyList *) aligned_alloc(_Alignof(RcuDoublyList), sizeof(RcuDoublyList));
+    if (list_ptr == NULL) {
+        return NULL;
+    }
+    atomic_init(&(list_ptr->head), NULL);
+    list_ptr->tail = NULL;
+    atomic_init(&(list_ptr->size), 0);
+    // 0 marks an offline reader, so the epochs start at 1
+    atomic_init(&(list_ptr->epoch), 1);
+    list_ptr->retired = NULL;
+    list_ptr->last_retired = NULL;
+    list_ptr->retired_count = 0;
+    for (int i = 0; i < RCU_MAX_READERS; i++) {
+        atomic_init(&(list_ptr->readers[i].epoch), 0);
+        atomic_init(&(list_ptr->readers[i].in_use), false);
+    }
+    return list_ptr;
+}
+
+void destroy_rcu_list(RcuDoublyList* list_ptr) {
+    RcuNode* node = atomic_load(&(list_ptr->head));
+    while (node != NULL) {
+        RcuNode* next = atomic_load_explicit(&(node->next), memory_order_relaxed);
+        free(node);
+        node = next;
+    }
+    free_retired(list_ptr, UINT64_MAX);
+    free(list_ptr);
+}
+
+void clear_rcu_list(RcuDoublyList* list_ptr) {
+    RcuNode* node = atomic_load_explicit(&(list_ptr->head), memory_order_relaxed);
+    atomic_store_explicit(&(list_ptr->head), NULL, memory_order_release);
+    list_ptr->tail = NULL;
+    atomic_store_explicit(&(list_ptr->size), 0, memory_order_relaxed);
+    while (node != NULL) {
+        RcuNode* next = atomic_load_explicit(&(node->next), memory_order_relaxed);
+        retire(list_ptr, node);
+        node = next;
+    }
+    rcu_reclaim(list_ptr);
+}
+
+int64_t rcu_size(RcuDoublyList* list_ptr) {
+    return atomic_load_explicit(&(list_ptr->size), memory_order_relaxed);
+}
+
+/*** Reader Functions ***/
+
+RcuReader* rcu_register_reader(RcuDoublyList* list_ptr) {
+    for (int i = 0; i < RCU_MAX_READERS; i++) {
+        RcuReader* reader = &(list_ptr->readers[i]);
+        bool free_slot = false;
+        if (!atomic_load_explicit(&(reader->in_use), memory_order_relaxed)
+            && atomic_compare_exchange_strong(&(reader->in_use), &free_slot, true)) {
+            rcu_reader_online(list_ptr, reader);
+            return reader;
+        }
+    }
+    return NULL;
+}
+
+void rcu_unregister_reader(RcuReader* reader) {
+    rcu_reader_offline(reader);
+    atomic_store_explicit(&(reader->in_use), false, memory_order_release);
+}
+
+void rcu_reader_offline(RcuReader* reader) {
+    atomic_store_explicit(&(reader->epoch), 0, memory_order_release);
+}
+
+void rcu_reader_online(RcuDoublyList* list_ptr, RcuReader* reader) {
+    uint_fast64_t epoch = atomic_load_explicit(&(list_ptr->epoch), memory_order_acquire);
+    atomic_store_explicit(&(reader->epoch), epoch, memory_order_relaxed);
+    // the slot must be visible to the writer before the first node is loaded
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+int64_t rcu_forward_find(RcuDoublyList* list_ptr, RcuReader* reader, int64_t data) {
+    int64_t found = -1;
+    int64_t index = 0;
+    RcuNode* node = atomic_load_explicit(&(list_ptr->head), memory_order_acquire);
+    while (node != NULL) {
+        if (node->data == data) {
+            found = index;
+            break;
+        }
+        node = atomic_load_explicit(&(node->next), memory_order_acquire);
+        index++;
+    }
+    rcu_quiescent(list_ptr, reader);
+    return found;
+}
+
+bool rcu_contains(RcuDoublyList* list_ptr, RcuReader* reader, int64_t data) {
+    return rcu_forward_find(list_ptr, reader, data) != -1;
+}
+
+/*** Writer Functions ***/
+
+bool rcu_append(RcuDoublyList* list_ptr, int64_t data) {
+    RcuNode* node = new_rcu_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    node->prev = list_ptr->tail;
+    publish_after(list_ptr, list_ptr->tail, node);
+    list_ptr->tail = node;
+    atomic_fetch_add_explicit(&(list_ptr->size), 1, memory_order_relaxed);
+    return true;
+}
+
+bool rcu_prepend(RcuDoublyList* list_ptr, int64_t data) {
+    RcuNode* node = new_rcu_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    RcuNode* first = atomic_load_explicit(&(list_ptr->head), memory_order_relaxed);
+    atomic_init(&(node->next), first);
+    if (first == NULL) {
+        list_ptr->tail = node;
+    } else {
+        first->prev = node;
+    }
+    publish_after(list_ptr, NULL, node);
+    atomic_fetch_add_explicit(&(list_ptr->size), 1, memory_order_relaxed);
+    return true;
+}
+
+bool rcu_insert_after(RcuDoublyList* list_ptr, int64_t after, int64_t data) {
+    RcuNode* found = writer_find(list_ptr, after);
+    if (found == NULL) {
+        return false;
+    }
+    RcuNode* node = new_rcu_node(data);
+    if (node == NULL) {
+        return false;
+    }
+    RcuNode* next = atomic_load_explicit(&(found->next), memory_order_relaxed);
+    node->prev = found;
+    atomic_init(&(node->next), next);
+    if (next == NULL) {
+        list_ptr->tail = node;
+    } else {
+        next->prev = node;
+    }
+    publish_after(list_ptr, found, node);
+    atomic_fetch_add_explicit(&(list_ptr->size), 1, memory_order_relaxed);
+    return true;
+}
+
+bool rcu_delete(RcuDoublyList* list_ptr, int64_t data) {
+    RcuNode* node = writer_find(list_ptr, data);
+    if (node == NULL) {
+        return false;
+    }
+    unlink_node(list_ptr, node);
+    return true;
+}
+
+bool rcu_replace(RcuDoublyList* list_ptr, int64_t data, int64_t new_data) {
+    RcuNode* old = writer_find(list_ptr, data);
+    if (old == NULL) {
+        return false;
+    }
+    RcuNode* node = new_rcu_node(new_data);
+    if (node == NULL) {
+        return false;
+    }
+    RcuNode* next = atomic_load_explicit(&(old->next), memory_order_relaxed);
+    node->prev = old->prev;
+    atomic_init(&(node->next), next);
+    if (next == NULL) {
+        list_ptr->tail = node;
+    } else {
+        next->prev = node;
+    }
+    // readers reach old or node from here on, and both lead to next
+    publish_after(list_ptr, old->prev, node);
+    retire(list_ptr, old);
+    if (list_ptr->retired_count % RCU_RECLAIM_BATCH == 0) {
+        rcu_reclaim(list_ptr);
+    }
+    return true;
+}
+
+int64_t rcu_reclaim(RcuDoublyList* list_ptr) {
+    if (list_ptr->retired == NULL) {
+        return 0;
+    }
+    advance_epoch(list_ptr);
+    // an online reader which copied the epoch e is done with every node stamped before e
+    uint64_t oldest = UINT64_MAX;
+    for (int i = 0; i < RCU_MAX_READERS; i++) {
+        uint64_t epoch = atomic_load_explicit(&(list_ptr->readers[i].epoch), memory_order_acquire);
+        if ((epoch != 0) && (epoch < oldest)) {
+            oldest = epoch;
+        }
+    }
+    return free_retired(list_ptr, oldest);
+}
+
+void rcu_synchronize(RcuDoublyList* list_ptr) {
+    uint64_t stamped = advance_epoch(list_ptr);
+    for (int i = 0; i < RCU_MAX_READERS; i++) {
+        RcuReader* reader = &(list_ptr->readers[i]);
+        uint64_t spins = 0;
+        while (true) {
+            uint64_t epoch = atomic_load_explicit(&(reader->epoch), memory_order_acquire);
+            if ((epoch == 0) || (epoch > stamped)) {
+                break;
+            }
+            if (++spins % RCU_WAIT_SPINS == 0) {
+                sched_yield();
+            }
+        }
+    }
+    free_retired(list_ptr, UINT64_MAX);
+}
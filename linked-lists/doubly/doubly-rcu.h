@@ -0,0 +1,264 @@
+/*
+This header file is used to declare the RcuNode struct, and the functions used
+to manage the read-mostly mode of the doubly linked list, where one writer
+changes the list while any number of readers search it without taking a lock
+or writing to any shared memory. The writer publishes every change with a
+single pointer store, and frees the nodes it unlinked only once every reader
+has finished the search it was in when they were unlinked.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYRCU_H
+#define DOUBLYRCU_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdatomic.h>
+
+/*** Constants ***/
+// the most readers registered with a list at once
+#define RCU_MAX_READERS 64
+// the writer tries to free the nodes it unlinked once this many are waiting
+#define RCU_RECLAIM_BATCH 64
+// the writer spins this many times on a reader which is still in an old search before yielding the core
+#define RCU_WAIT_SPINS 64
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @struct RcuNode
+ * @brief A node of an RcuDoublyList.
+ *
+ * Readers only follow next, so prev belongs to the writer alone. Once the node
+ * is unlinked its next is left as it was, so that a reader standing on it still
+ * walks back into the list, and prev chains it to the other unlinked nodes
+ * waiting to be freed.
+ */
+typedef struct RcuNode {
+    int64_t data;                   /**< The data stored in this node, never changed once published */
+    _Atomic(struct RcuNode*) next;  /**< Pointer to the next node, or NULL */
+    struct RcuNode* prev;           /**< Pointer to the previous node, or the next unlinked node */
+    uint64_t epoch;                 /**< The epoch the node was unlinked in, once unlinked */
+} RcuNode;
+
+/**
+ * @struct RcuReader
+ * @brief The slot through which one reader thread tells the writer how far along it is.
+ *
+ * Each slot fills a cache line of its own, which only its reader writes to, and
+ * only when the writer has moved on to a new epoch since its last search.
+ */
+typedef struct {
+    _Alignas(64) atomic_uint_fast64_t epoch;  /**< The epoch seen at the end of the last search, 0 while offline */
+    atomic_bool in_use;                       /**< Set while a thread is registered with the slot */
+} RcuReader;
+
+/**
+ * @struct RcuDoublyList
+ * @brief A doubly linked list which one writer changes while many readers search it.
+ *
+ * The writer builds every new node in full before linking it in with a release
+ * store, so that a reader which loads the pointer also sees what it points to.
+ * Readers only load, and at the end of every search store the epoch they saw in
+ * their own slot. An unlinked node is stamped with the epoch it was unlinked in,
+ * and the epoch is then moved on, so once every online reader has stored a later
+ * epoch, no reader can still be on the node and it is freed.
+ *
+ * @note Only one thread at a time may call the writer functions (the ones not
+ *       taking an RcuReader).
+ */
+typedef struct {
+    _Atomic(RcuNode*) head;            /**< Pointer to the first node, or NULL */
+    RcuNode* tail;                     /**< Pointer to the last node, read by the writer only */
+    atomic_int_fast64_t size;          /**< The number of nodes, changed by the writer only */
+    _Alignas(64) atomic_uint_fast64_t epoch;  /**< The current epoch, moved on by the writer only */
+    RcuNode* retired;                  /**< The oldest unlinked node not freed yet, or NULL */
+    RcuNode* last_retired;             /**< The newest unlinked node not freed yet, or NULL */
+    int64_t retired_count;             /**< The number of unlinked nodes not freed yet */
+    RcuReader readers[RCU_MAX_READERS];  /**< The slots of the readers */
+} RcuDoublyList;
+
+
+/*** RcuDoublyList Functions ***/
+
+/**
+ * @brief Creates an empty RcuDoublyList.
+ *
+ * @return Pointer to the new RcuDoublyList, or NULL if memory allocation fails
+ * @note The caller must call destroy_rcu_list when the list is no longer needed.
+ */
+RcuDoublyList* create_rcu_list();
+
+/**
+ * @brief Frees every node of the list, unlinked or not, and then the list itself.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to destroy
+ * @note No other thread may be using the list.
+ */
+void destroy_rcu_list(RcuDoublyList* list_ptr);
+
+/**
+ * @brief Unlinks every node of the list at once, to be freed like the nodes unlinked
+ *        by rcu_delete.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to clear
+ * @note Writer only. Readers in a search keep walking the old nodes until they finish.
+ */
+void clear_rcu_list(RcuDoublyList* list_ptr);
+
+/**
+ * @brief Returns the number of nodes in the list.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList
+ * @return int64_t The size, which may already be out of date while the writer changes the list
+ */
+int64_t rcu_size(RcuDoublyList* list_ptr);
+
+/*** Reader Functions ***/
+
+/**
+ * @brief Takes a free reader slot for the calling thread, which starts out online.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to read
+ * @return RcuReader* The slot to pass to the search functions, or NULL if all
+ *         RCU_MAX_READERS slots are taken
+ * @note Safe to call from any number of threads at once. The slot must only be used
+ *       by the thread which registered it.
+ */
+RcuReader* rcu_register_reader(RcuDoublyList* list_ptr);
+
+/**
+ * @brief Gives the slot of a reader back, so that the writer no longer waits for it.
+ *
+ * @param reader The slot returned by rcu_register_reader
+ */
+void rcu_unregister_reader(RcuReader* reader);
+
+/**
+ * @brief Tells the writer that the reader will not search the list for a while,
+ *        so that it does not hold back the freeing of nodes while it is away.
+ *
+ * @param reader The slot of the calling thread
+ */
+void rcu_reader_offline(RcuReader* reader);
+
+/**
+ * @brief Tells the writer that the reader is about to search the list again after
+ *        rcu_reader_offline.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList
+ * @param reader The slot of the calling thread
+ * @note This is the only reader function with a full memory fence, so that the
+ *       writer cannot miss the reader coming back.
+ */
+void rcu_reader_online(RcuDoublyList* list_ptr, RcuReader* reader);
+
+/**
+ * @brief Searches for a value from the head to the tail without taking any lock.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to search within
+ * @param reader The slot of the calling thread, which must be online
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the first node holding the value, or -1 if
+ *         the value was not found
+ * @note Safe to call from any number of readers while the writer changes the list.
+ *       The search sees every change the writer finished before it started, and
+ *       any mix of the changes made while it runs.
+ */
+int64_t rcu_forward_find(RcuDoublyList* list_ptr, RcuReader* reader, int64_t data);
+
+/**
+ * @brief Searches for a value without taking any lock, and returns whether any node holds it.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to search within
+ * @param reader The slot of the calling thread, which must be online
+ * @param data The integer value to search for in the list
+ * @return true if a node holds the value, false otherwise
+ * @note See rcu_forward_find.
+ */
+bool rcu_contains(RcuDoublyList* list_ptr, RcuReader* reader, int64_t data);
+
+/*** Writer Functions ***/
+
+/**
+ * @brief Appends a new node with the specified data to the end of the list.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to append to
+ * @param data The value to store in the new node
+ * @return true if the node was appended, false if memory allocation failed
+ * @note Writer only.
+ */
+bool rcu_append(RcuDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node with the specified data at the beginning of the list.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to prepend to
+ * @param data The value to store in the new node
+ * @return true if the node was prepended, false if memory allocation failed
+ * @note Writer only.
+ */
+bool rcu_prepend(RcuDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node right after the first node holding a value.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to insert into
+ * @param after The value held by the node the new node should follow
+ * @param data The value to store in the new node
+ * @return true if the node was inserted, false if no node holds after or memory
+ *         allocation failed
+ * @note Writer only.
+ */
+bool rcu_insert_after(RcuDoublyList* list_ptr, int64_t after, int64_t data);
+
+/**
+ * @brief Unlinks the first node holding a value, and frees it once no reader can be on it.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to delete from
+ * @param data The value held by the node to delete
+ * @return true if a node was unlinked, false if no node holds the value
+ * @note Writer only. Every RCU_RECLAIM_BATCH unlinked nodes, rcu_reclaim is called.
+ */
+bool rcu_delete(RcuDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Replaces the first node holding a value with a new node holding another,
+ *        so that every reader sees either the old value or the new one there.
+ *
+ * Nodes are never changed once readers can reach them, so the new node is built
+ * aside, pointed at the rest of the list, and swapped in with one store.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList to change
+ * @param data The value held by the node to replace
+ * @param new_data The value to store in the new node
+ * @return true if the node was replaced, false if no node holds data or memory
+ *         allocation failed
+ * @note Writer only. The old node is freed like the nodes unlinked by rcu_delete.
+ */
+bool rcu_replace(RcuDoublyList* list_ptr, int64_t data, int64_t new_data);
+
+/**
+ * @brief Frees the unlinked nodes which no online reader can be on anymore, without waiting.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList
+ * @return int64_t The number of nodes freed
+ * @note Writer only.
+ */
+int64_t rcu_reclaim(RcuDoublyList* list_ptr);
+
+/**
+ * @brief Waits until every online reader has finished the search it is in, and
+ *        then frees every unlinked node.
+ *
+ * @param list_ptr Pointer to the RcuDoublyList
+ * @note Writer only, and the writer must not be an online reader itself, which would
+ *       wait for itself forever.
+ */
+void rcu_synchronize(RcuDoublyList* list_ptr);
+
+#endif
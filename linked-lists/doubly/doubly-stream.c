@@ -0,0 +1,222 @@
+/*
+This document is meant to store the implementation of the streams of the
+doubly linked list. Values are written as zigzag encoded varints of their
+difference from the value before them, one chunk at a time, so that both
+ends of a stream only ever hold a single chunk in memory.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<errno.h>
+#include<string.h>
+#include<unistd.h>
+#include"doubly-stream.h"
+
+/*** Struct Definitions ***/
+
+/**
+ * @brief The bytes of a stream which were read but not decoded yet.
+ * Contains the function the bytes are read with and its context, the
+ * buffer, which holds a whole chunk and its header, the bytes from
+ * start to end which are not decoded yet, and whether read failed.
+ */
+typedef struct {
+    StreamReader read;
+    void* context;
+    uint8_t bytes[STREAM_CHUNK_BYTES + 2 * STREAM_VARINT_BYTES];
+    uint64_t start;
+    uint64_t end;
+    bool failed;
+} StreamInput;
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Returns the difference of value from prev, zigzag encoded so that
+ *        differences close to 0 of either sign become small numbers. The
+ *        difference wraps around, so that every pair of values has one.
+ */
+static uint64_t zigzag(int64_t value, int64_t prev) {
+    uint64_t delta = (uint64_t) value - (uint64_t) prev;
+    return (delta << 1) ^ (0 - (delta >> 63));
+}
+
+/**
+ * @brief Returns the value which zigzag encoded as code after prev.
+ */
+static int64_t unzigzag(uint64_t code, int64_t prev) {
+    uint64_t delta = (code >> 1) ^ (0 - (code & 1));
+    return (int64_t) ((uint64_t) prev + delta);
+}
+
+/**
+ * @brief Writes number as a varint, 7 bits per byte with the top bit set on
+ *        every byte but the last, and returns the number of bytes written.
+ */
+static uint64_t put_varint(uint8_t* bytes, uint64_t number) {
+    uint64_t length = 0;
+    while (number >= 0x80) {
+        bytes[length++] = (uint8_t) (number | 0x80);
+        number >>= 7;
+    }
+    bytes[length++] = (uint8_t) number;
+    return length;
+}
+
+/**
+ * @brief Reads a varint from bytes, starting at *at and ending before end, into
+ *        number, and moves *at past it. Returns false if the varint runs past
+ *        end or does not fit in 64 bits.
+ */
+static bool get_varint(const uint8_t* bytes, uint64_t end, uint64_t* at, uint64_t* number) {
+    uint64_t result = 0;
+    for (unsigned shift = 0; (shift < 7 * STREAM_VARINT_BYTES) && (*at < end); shift += 7) {
+        uint8_t byte = bytes[(*at)++];
+        if ((shift == 7 * (STREAM_VARINT_BYTES - 1)) && (byte > 1)) {
+            return false;
+        }
+        result |= (uint64_t) (byte & 0x7F) << shift;
+        if (byte < 0x80) {
+            *number = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Reads from the stream until at least need bytes are waiting to be decoded,
+ *        moving the waiting bytes to the front of the buffer first. Returns false
+ *        if the stream ends or read fails first, setting failed in the latter case.
+ */
+static bool fill_input(StreamInput* input, uint64_t need) {
+    if (input->end - input->start >= need) {
+        return true;
+    }
+    memmove(input->bytes, input->bytes + input->start, input->end - input->start);
+    input->end -= input->start;
+    input->start = 0;
+    while (input->end < need) {
+        int64_t length = input->read(input->context, input->bytes + input->end, sizeof(input->bytes) - input->end);
+        if (length <= 0) {
+            input->failed = (length < 0);
+            return false;
+        }
+        input->end += length;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes all length bytes to the file descriptor in context, however many
+ *        calls to write it takes.
+ */
+static bool write_fd(void* context, const uint8_t* bytes, uint64_t length) {
+    int fd = *((int *) context);
+    while (length > 0) {
+        ssize_t written = write(fd, bytes, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += written;
+        length -= written;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads at most capacity bytes from the file descriptor in context.
+ */
+static int64_t read_fd(void* context, uint8_t* bytes, uint64_t capacity) {
+    int fd = *((int *) context);
+    ssize_t length;
+    do {
+        length = read(fd, bytes, capacity);
+    } while ((length < 0) && (errno == EINTR));
+    return length;
+}
+
+/*** Stream Functions ***/
+
+bool encode_list(DoublyLinkedList* list_ptr, StreamWriter write, void* context) {
+    uint8_t chunk[STREAM_CHUNK_BYTES];
+    uint8_t header[2 * STREAM_VARINT_BYTES];
+    if (!write(context, (const uint8_t *) STREAM_MAGIC, strlen(STREAM_MAGIC))) {
+        return false;
+    }
+    Node* node = list_ptr->head;
+    while (true) {
+        uint64_t count = 0;
+        uint64_t length = 0;
+        int64_t prev = 0;
+        while ((node != NULL) && (length + STREAM_VARINT_BYTES <= STREAM_CHUNK_BYTES)) {
+            length += put_varint(chunk + length, zigzag(node->data, prev));
+            prev = node->data;
+            node = node->next;
+            count++;
+        }
+        uint64_t header_length = put_varint(header, count);
+        header_length += put_varint(header + header_length, length);
+        if (!write(context, header, header_length) || ((length > 0) && !write(context, chunk, length))) {
+            return false;
+        }
+        if (count == 0) {
+            return true;
+        }
+    }
+}
+
+bool encode_list_fd(DoublyLinkedList* list_ptr, int fd) {
+    return encode_list(list_ptr, write_fd, &fd);
+}
+
+bool decode_list(DoublyLinkedList* list_ptr, StreamReader read, void* context) {
+    StreamInput input;
+    input.read = read;
+    input.context = context;
+    input.start = 0;
+    input.end = 0;
+    input.failed = false;
+    uint64_t magic_length = strlen(STREAM_MAGIC);
+    if (!fill_input(&input, magic_length) || (memcmp(input.bytes, STREAM_MAGIC, magic_length) != 0)) {
+        return false;
+    }
+    input.start = magic_length;
+    while (true) {
+        // the last header of a stream may be shorter than the longest header
+        fill_input(&input, 2 * STREAM_VARINT_BYTES);
+        uint64_t count;
+        uint64_t length;
+        if (input.failed || !get_varint(input.bytes, input.end, &(input.start), &count)
+            || !get_varint(input.bytes, input.end, &(input.start), &length)) {
+            return false;
+        }
+        if (count == 0) {
+            return length == 0;
+        }
+        if ((length > STREAM_CHUNK_BYTES) || (count > length) || !fill_input(&input, length)) {
+            return false;
+        }
+        uint64_t end = input.start + length;
+        int64_t prev = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t code;
+            if (!get_varint(input.bytes, end, &(input.start), &code)) {
+                return false;
+            }
+            prev = unzigzag(code, prev);
+            append_node(list_ptr, prev);
+        }
+        if (input.start != end) {
+            return false;
+        }
+    }
+}
+
+bool decode_list_fd(DoublyLinkedList* list_ptr, int fd) {
+    return decode_list(list_ptr, read_fd, &fd);
+}
@@ -0,0 +1,108 @@
+/*
+This header file is used to declare the functions used to write a doubly
+linked list to a stream of bytes, and to append the values of such a stream
+to a list, in a compact format which takes a fixed amount of memory whatever
+the length of the list. The format is the same as the one of the singly
+linked list, so a stream written by either list can be read by the other.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYSTREAM_H
+#define DOUBLYSTREAM_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"doubly-linked.h"
+
+/*** Constants ***/
+// the first bytes of every stream
+#define STREAM_MAGIC "LLS1"
+// the most bytes of encoded values in one chunk of a stream
+#define STREAM_CHUNK_BYTES 65536
+// the most bytes a value takes once encoded as a varint
+#define STREAM_VARINT_BYTES 10
+
+
+/*** Stream Types ***/
+
+/**
+ * @brief A function which takes the next bytes of a stream being written.
+ *
+ * @param context The pointer given to encode_list
+ * @param bytes The next bytes of the stream
+ * @param length The number of bytes
+ * @return true if all length bytes were taken, false to stop encoding
+ */
+typedef bool (*StreamWriter)(void* context, const uint8_t* bytes, uint64_t length);
+
+/**
+ * @brief A function which gives the next bytes of a stream being read.
+ *
+ * @param context The pointer given to decode_list
+ * @param bytes Where to store the next bytes of the stream
+ * @param capacity The most bytes to store
+ * @return int64_t The number of bytes stored, 0 at the end of the stream, or -1 to
+ *         stop decoding with an error
+ */
+typedef int64_t (*StreamReader)(void* context, uint8_t* bytes, uint64_t capacity);
+
+
+/*** Stream Functions ***/
+
+/**
+ * @brief Writes the values of the doubly linked list, from the head to the tail, to a stream.
+ *
+ * The stream starts with STREAM_MAGIC, and is followed by chunks of at most
+ * STREAM_CHUNK_BYTES bytes. Every chunk starts with the number of values in it and
+ * its length in bytes, and holds the difference of every value from the one before
+ * it (the first value of a chunk is taken from 0), zigzag encoded so that small
+ * negative differences stay small, as a varint of 7 bits per byte. A chunk of no
+ * values ends the stream. Lists of close values take one or two bytes per value,
+ * and no value takes more than STREAM_VARINT_BYTES.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to write
+ * @param write The function which takes the bytes of the stream
+ * @param context The pointer passed to every call of write
+ * @return true if the whole stream was written, false if write failed
+ * @note Only one chunk is held in memory at a time.
+ */
+bool encode_list(DoublyLinkedList* list_ptr, StreamWriter write, void* context);
+
+/**
+ * @brief Writes the values of the doubly linked list to a file descriptor in the
+ *        format of encode_list.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to write
+ * @param fd The file descriptor to write to, such as a file, pipe or socket
+ * @return true if the whole stream was written, false if a write failed
+ */
+bool encode_list_fd(DoublyLinkedList* list_ptr, int fd);
+
+/**
+ * @brief Reads a stream written by encode_list and appends its values, in order, to
+ *        the end of the doubly linked list as every chunk is read.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to append to
+ * @param read The function which gives the bytes of the stream
+ * @param context The pointer passed to every call of read
+ * @return true if the whole stream was read, false if read failed or the stream is not
+ *         in the format of encode_list
+ * @note The values are appended straight from the chunk, without collecting them in an
+ *       array first. On an error, the values decoded before it are kept in the list.
+ */
+bool decode_list(DoublyLinkedList* list_ptr, StreamReader read, void* context);
+
+/**
+ * @brief Reads a stream written by encode_list from a file descriptor and appends its
+ *        values to the end of the doubly linked list.
+ *
+ * @param list_ptr Pointer to the DoublyLinkedList to append to
+ * @param fd The file descriptor to read from, such as a file, pipe or socket
+ * @return true if the whole stream was read, false if a read failed or the stream is
+ *         not in the format of encode_list
+ */
+bool decode_list_fd(DoublyLinkedList* list_ptr, int fd);
+
+#endif
@@ -0,0 +1,245 @@
+/*
+This document is meant to store the implementation of the XOR-linked variant
+of the doubly linked list. Every node links to both of its neighbours through
+one field holding their addresses XORed together, and is taken from a slab
+owned by the list.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdlib.h>
+#include"doubly-xor.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Returns the neighbour of node on the other side from other, which may be NULL.
+ */
+static inline XorNode* xor_other(XorNode* node, XorNode* other) {
+    return (XorNode *) (node->link ^ (uintptr_t) other);
+}
+
+/**
+ * @brief Takes a node from the free list, or from the newest slab, allocating a new
+ *        slab when it is used up, and stores data in it. Returns NULL on failure.
+ */
+static XorNode* xor_new_node(XorDoublyList* list_ptr, int64_t data) {
+    XorNode* node;
+    if (list_ptr->free_list != NULL) {
+        node = list_ptr->free_list;
+        list_ptr->free_list = (XorNode *) node->link;
+    } else {
+        if ((list_ptr->slabs == NULL) || (list_ptr->slab_used == list_ptr->nodes_per_slab)) {
+            XorSlab* slab = (XorSlab *) malloc(sizeof(XorSlab) + sizeof(XorNode) * list_ptr->nodes_per_slab);
+            if (slab == NULL) {
+                return NULL;
+            }
+            slab->next = list_ptr->slabs;
+            list_ptr->slabs = slab;
+            list_ptr->slab_used = 0;
+            list_ptr->num_slabs++;
+        }
+        node = &(list_ptr->slabs->nodes[list_ptr->slab_used]);
+        list_ptr->slab_used++;
+    }
+    node->data = data;
+    return node;
+}
+
+/**
+ * @brief Puts a node which is no longer linked into the list on the free list.
+ */
+static void xor_release_node(XorDoublyList* list_ptr, XorNode* node) {
+    node->link = (uintptr_t) list_ptr->free_list;
+    list_ptr->free_list = node;
+}
+
+/**
+ * @brief Links a new node holding data between the adjacent nodes prev and next,
+ *        either of which may be NULL at an end of the list. Returns the new node,
+ *        or NULL if memory allocation failed.
+ */
+static XorNode* xor_link_between(XorDoublyList* list_ptr, XorNode* prev, XorNode* next, int64_t data) {
+    XorNode* node = xor_new_node(list_ptr, data);
+    if (node == NULL) {
+        return NULL;
+    }
+    node->link = (uintptr_t) prev ^ (uintptr_t) next;
+    // swap next for node in the link of prev, and prev for node in the link of next
+    if (prev == NULL) {
+        list_ptr->head = node;
+    } else {
+        prev->link ^= (uintptr_t) next ^ (uintptr_t) node;
+    }
+    if (next == NULL) {
+        list_ptr->tail = node;
+    } else {
+        next->link ^= (uintptr_t) prev ^ (uintptr_t) node;
+    }
+    list_ptr->size++;
+    return node;
+}
+
+/**
+ * @brief Unlinks node from between its neighbours prev and next, either of which may
+ *        be NULL at an end of the list, and puts it on the free list.
+ */
+static void xor_unlink(XorDoublyList* list_ptr, XorNode* prev, XorNode* node, XorNode* next) {
+    if (prev == NULL) {
+        list_ptr->head = next;
+    } else {
+        prev->link ^= (uintptr_t) node ^ (uintptr_t) next;
+    }
+    if (next == NULL) {
+        list_ptr->tail = prev;
+    } else {
+        next->link ^= (uintptr_t) node ^ (uintptr_t) prev;
+    }
+    list_ptr->size--;
+    xor_release_node(list_ptr, node);
+}
+
+/*** XorDoublyList Functions ***/
+
+XorDoublyList* create_xor_list(uint64_t nodes_per_slab) {
+    XorDoublyList* list_ptr = (XorDoublyList *) calloc(1, sizeof(XorDoublyList));
+    if (list_ptr == NULL) {
+        return NULL;
+    }
+    list_ptr->nodes_per_slab = (nodes_per_slab == 0) ? XOR_DEFAULT_NODES_PER_SLAB : nodes_per_slab;
+    return list_ptr;
+}
+
+void destroy_xor_list(XorDoublyList* list_ptr) {
+    clear_xor_list(list_ptr);
+    free(list_ptr);
+}
+
+void clear_xor_list(XorDoublyList* list_ptr) {
+    XorSlab* slab = list_ptr->slabs;
+    while (slab != NULL) {
+        XorSlab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    list_ptr->head = NULL;
+    list_ptr->tail = NULL;
+    list_ptr->size = 0;
+    list_ptr->slabs = NULL;
+    list_ptr->free_list = NULL;
+    list_ptr->slab_used = 0;
+    list_ptr->num_slabs = 0;
+}
+
+int64_t xor_size(XorDoublyList* list_ptr) {
+    return list_ptr->size;
+}
+
+bool xor_append(XorDoublyList* list_ptr, int64_t data) {
+    return xor_link_between(list_ptr, list_ptr->tail, NULL, data) != NULL;
+}
+
+bool xor_prepend(XorDoublyList* list_ptr, int64_t data) {
+    return xor_link_between(list_ptr, NULL, list_ptr->head, data) != NULL;
+}
+
+int64_t xor_forward_find(XorDoublyList* list_ptr, int64_t data) {
+    XorNode* prev = NULL;
+    XorNode* node = list_ptr->head;
+    int64_t index = 0;
+    while (node != NULL) {
+        if (node->data == data) {
+            return index;
+        }
+        XorNode* next = xor_other(node, prev);
+        prev = node;
+        node = next;
+        index++;
+    }
+    return -1;
+}
+
+int64_t xor_backward_find(XorDoublyList* list_ptr, int64_t data) {
+    XorNode* next = NULL;
+    XorNode* node = list_ptr->tail;
+    int64_t index = 0;
+    while (node != NULL) {
+        if (node->data == data) {
+            return index;
+        }
+        XorNode* prev = xor_other(node, next);
+        next = node;
+        node = prev;
+        index++;
+    }
+    return -1;
+}
+
+void xor_delete_first(XorDoublyList* list_ptr) {
+    if (list_ptr->head != NULL) {
+        XorNode* head = list_ptr->head;
+        xor_unlink(list_ptr, NULL, head, xor_other(head, NULL));
+    }
+}
+
+void xor_delete_last(XorDoublyList* list_ptr) {
+    if (list_ptr->tail != NULL) {
+        XorNode* tail = list_ptr->tail;
+        xor_unlink(list_ptr, xor_other(tail, NULL), tail, NULL);
+    }
+}
+
+void xor_reverse_list(XorDoublyList* list_ptr) {
+    XorNode* head = list_ptr->head;
+    list_ptr->head = list_ptr->tail;
+    list_ptr->tail = head;
+}
+
+/*** XorCursor Functions ***/
+
+XorCursor xor_cursor_head(XorDoublyList* list_ptr) {
+    XorCursor cursor = {NULL, list_ptr->head};
+    return cursor;
+}
+
+XorCursor xor_cursor_tail(XorDoublyList* list_ptr) {
+    XorCursor cursor = {NULL, list_ptr->tail};
+    if (list_ptr->tail != NULL) {
+        cursor.prev = xor_other(list_ptr->tail, NULL);
+    }
+    return cursor;
+}
+
+bool xor_cursor_next(XorCursor* cursor_ptr) {
+    XorNode* next = xor_other(cursor_ptr->node, cursor_ptr->prev);
+    cursor_ptr->prev = cursor_ptr->node;
+    cursor_ptr->node = next;
+    return next != NULL;
+}
+
+bool xor_cursor_prev(XorCursor* cursor_ptr) {
+    if (cursor_ptr->prev == NULL) {
+        return false;
+    }
+    XorNode* prev = xor_other(cursor_ptr->prev, cursor_ptr->node);
+    cursor_ptr->node = cursor_ptr->prev;
+    cursor_ptr->prev = prev;
+    return true;
+}
+
+bool xor_insert_between(XorDoublyList* list_ptr, XorCursor* cursor_ptr, int64_t data) {
+    XorNode* node = xor_link_between(list_ptr, cursor_ptr->prev, cursor_ptr->node, data);
+    if (node == NULL) {
+        return false;
+    }
+    cursor_ptr->prev = node;
+    return true;
+}
+
+void xor_cursor_delete(XorDoublyList* list_ptr, XorCursor* cursor_ptr) {
+    XorNode* node = cursor_ptr->node;
+    XorNode* next = xor_other(node, cursor_ptr->prev);
+    xor_unlink(list_ptr, cursor_ptr->prev, node, next);
+    cursor_ptr->node = next;
+}
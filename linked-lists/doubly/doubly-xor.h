@@ -0,0 +1,239 @@
+/*
+This header file is used to declare the XorNode struct, and the functions
+used to manage the XOR-linked variant of the doubly linked list, where every
+node stores the address of its previous node XORed with the address of its
+next node in a single field, so that a node takes 16 bytes instead of 24
+and the list can still be walked in both directions.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+#ifndef DOUBLYXOR_H
+#define DOUBLYXOR_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+
+/*** Constants ***/
+#define XOR_DEFAULT_NODES_PER_SLAB 4096
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @struct XorNode
+ * @brief A node of a XorDoublyList.
+ *
+ * The link of the first node is the address of the second, and the link of the
+ * last node is the address of the one before it, since NULL XORs to nothing.
+ * A node on its own can not be followed in either direction: walking the list
+ * takes the address of the node it came from as well, which is what XorCursor keeps.
+ */
+typedef struct XorNode {
+    int64_t data;            /**< The data stored in this node */
+    uintptr_t link;          /**< The address of the previous node XORed with the address of the next one */
+} XorNode;
+
+/**
+ * @struct XorSlab
+ * @brief A block of XorNodes allocated with a single malloc call.
+ */
+typedef struct XorSlab {
+    struct XorSlab* next;    /**< The slab allocated before this one, or NULL */
+    XorNode nodes[];         /**< The nodes carved out of this slab */
+} XorSlab;
+
+/**
+ * @struct XorDoublyList
+ * @brief A doubly linked list of XorNodes.
+ *
+ * Nodes are always taken from slabs owned by the list, since malloc rounds a 16 byte
+ * node up to the same 32 byte chunk as a 24 byte one, which would throw the saving
+ * away. Deleted nodes are kept on a free list, linked through their link fields, and
+ * are reused before the newest slab is.
+ */
+typedef struct {
+    XorNode* head;           /**< Pointer to the first node in the list, or NULL if the list is empty */
+    XorNode* tail;           /**< Pointer to the last node in the list, or NULL if the list is empty */
+    int64_t size;            /**< The number of nodes in the list */
+    XorSlab* slabs;          /**< The most recently allocated slab, or NULL */
+    XorNode* free_list;      /**< Deleted nodes waiting to be reused, or NULL */
+    uint64_t nodes_per_slab; /**< The number of nodes allocated by each malloc call */
+    uint64_t slab_used;      /**< The number of nodes handed out from the newest slab */
+    uint64_t num_slabs;      /**< The number of slabs allocated so far */
+} XorDoublyList;
+
+/**
+ * @struct XorCursor
+ * @brief A position in a XorDoublyList, between prev and node.
+ *
+ * Both neighbours are kept, since either one is needed to find the other from the
+ * link of a node. A cursor past the last node has node set to NULL and prev set to
+ * the tail, and a cursor before the first node has prev set to NULL.
+ */
+typedef struct {
+    XorNode* prev;           /**< The node before the cursor, or NULL at the start of the list */
+    XorNode* node;           /**< The node after the cursor, or NULL at the end of the list */
+} XorCursor;
+
+
+/*** XorDoublyList Functions ***/
+
+/**
+ * @brief Creates an empty XorDoublyList.
+ *
+ * No memory for nodes is allocated until the first node is added.
+ *
+ * @param nodes_per_slab The number of nodes allocated by each malloc call, or 0
+ *        to use XOR_DEFAULT_NODES_PER_SLAB
+ * @return Pointer to the new XorDoublyList, or NULL if memory allocation fails
+ * @note The caller must call destroy_xor_list when the list is no longer needed.
+ */
+XorDoublyList* create_xor_list(uint64_t nodes_per_slab);
+
+/**
+ * @brief Frees every slab of the list, and then the list itself.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to destroy
+ */
+void destroy_xor_list(XorDoublyList* list_ptr);
+
+/**
+ * @brief Deletes every node of the list and frees its slabs, leaving it empty.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to clear
+ */
+void clear_xor_list(XorDoublyList* list_ptr);
+
+/**
+ * @brief Returns the number of nodes in the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList
+ * @return int64_t The number of nodes
+ */
+int64_t xor_size(XorDoublyList* list_ptr);
+
+/**
+ * @brief Appends a new node with the specified data to the end of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to append to
+ * @param data The value to store in the new node
+ * @return true if the node was appended, false if memory allocation failed
+ */
+bool xor_append(XorDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a new node with the specified data at the beginning of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to prepend to
+ * @param data The value to store in the new node
+ * @return true if the node was prepended, false if memory allocation failed
+ */
+bool xor_prepend(XorDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Searches for a value from the head to the tail of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the first node holding the value, counted from the
+ *         head, or -1 if the value was not found.
+ */
+int64_t xor_forward_find(XorDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Searches for a value from the tail to the head of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to search within
+ * @param data The integer value to search for in the list
+ * @return int64_t The 0-based index of the last node holding the value, counted from the
+ *         tail, or -1 if the value was not found.
+ */
+int64_t xor_backward_find(XorDoublyList* list_ptr, int64_t data);
+
+/**
+ * @brief Deletes the first node of the list, if there is one.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to delete from
+ */
+void xor_delete_first(XorDoublyList* list_ptr);
+
+/**
+ * @brief Deletes the last node of the list, if there is one.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to delete from
+ */
+void xor_delete_last(XorDoublyList* list_ptr);
+
+/**
+ * @brief Reverses the list in O(1) time.
+ *
+ * Every link reads the same whichever way the list is walked, so only the head and
+ * tail are swapped.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to reverse
+ * @note Cursors taken before the reversal must not be used after it.
+ */
+void xor_reverse_list(XorDoublyList* list_ptr);
+
+/*** XorCursor Functions ***/
+
+/**
+ * @brief Returns a cursor before the first node of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList
+ * @return XorCursor A cursor whose node is the head, or NULL if the list is empty
+ */
+XorCursor xor_cursor_head(XorDoublyList* list_ptr);
+
+/**
+ * @brief Returns a cursor on the last node of the list.
+ *
+ * @param list_ptr Pointer to the XorDoublyList
+ * @return XorCursor A cursor whose node is the tail, or NULL if the list is empty
+ */
+XorCursor xor_cursor_tail(XorDoublyList* list_ptr);
+
+/**
+ * @brief Moves the cursor one node toward the tail.
+ *
+ * @param cursor_ptr Pointer to the XorCursor to move, whose node must not be NULL
+ * @return true if the cursor is on a node afterwards, false if it moved past the tail
+ */
+bool xor_cursor_next(XorCursor* cursor_ptr);
+
+/**
+ * @brief Moves the cursor one node toward the head.
+ *
+ * @param cursor_ptr Pointer to the XorCursor to move, whose prev must not be NULL
+ * @return true if the cursor was moved, false if it was already at the head
+ */
+bool xor_cursor_prev(XorCursor* cursor_ptr);
+
+/**
+ * @brief Creates a new node and inserts it between the two nodes of the cursor.
+ *
+ * A cursor at the start of the list prepends the node, and one past the tail appends it.
+ * The cursor stays on the same node, so the new node becomes its prev.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to insert into
+ * @param cursor_ptr Pointer to an XorCursor of the list
+ * @param data The value to store in the new node
+ * @return true if the node was inserted, false if memory allocation failed
+ * @note Other cursors of the list whose two nodes are the same as this one's must not
+ *       be used afterwards.
+ */
+bool xor_insert_between(XorDoublyList* list_ptr, XorCursor* cursor_ptr, int64_t data);
+
+/**
+ * @brief Deletes the node of the cursor, which moves on to the node after it.
+ *
+ * @param list_ptr Pointer to the XorDoublyList to delete from
+ * @param cursor_ptr Pointer to an XorCursor of the list whose node is not NULL
+ * @note Other cursors next to the deleted node must not be used afterwards.
+ */
+void xor_cursor_delete(XorDoublyList* list_ptr, XorCursor* cursor_ptr);
+
+#endif
@@ -7,10 +7,23 @@ Creation Date: April 4, 2025.
 
 /*** Dependencies ***/
 #include"doubly-linked.h"
+#include"doubly-locked.h"
+#include"doubly-mapped.h"
+#include"doubly-stream.h"
+#include"doubly-xor.h"
+#include"doubly-arena.h"
+#include"doubly-generic.h"
+#include"doubly-parallel.h"
+#include"doubly-rcu.h"
+#include"../stats/list-stats.h"
+#include<pthread.h>
+#include<sched.h>
 #include<stdbool.h>
 #include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
 
 /*** Constants ***/
 // for some later clarity
@@ -23,6 +36,65 @@ int8_t NEXT_NODE_NUM_TESTS = 5;
 int8_t PREV_NODE_NUM_TESTS = 5;
 int8_t BETWEEN_NODE_NUM_TESTS = 7;
 
+// for NodePool functions
+int8_t NODE_POOL_NUM_TESTS = 4;
+int8_t ATTACH_POOL_NUM_TESTS = 5;
+
+// for DoublyLinkedList functions
+int8_t HASH_INDEX_NUM_TESTS = 5;
+int8_t FIND_NUM_TESTS = 4;
+int8_t RADIX_SORT_NUM_TESTS = 5;
+int8_t COMPACT_NUM_TESTS = 5;
+int8_t SPLICE_NUM_TESTS = 6;
+int8_t BATCH_NUM_TESTS = 4;
+int8_t POSITIONAL_NUM_TESTS = 5;
+int8_t PARALLEL_NUM_TESTS = 6;
+
+// for the instrumentation, whose counters are all 0 when it is compiled out
+int8_t STATS_NUM_TESTS = 3;
+#ifdef LIST_STATS
+#define STATS_EXPECT(n) (n)
+#else
+#define STATS_EXPECT(n) 0
+#endif
+
+// for MappedDoublyList functions
+int8_t MAPPED_LIST_NUM_TESTS = 5;
+// the list file written by the tests
+#define MAPPED_TEST_PATH "build/test-mapped.list"
+
+// for stream functions
+int8_t STREAM_NUM_TESTS = 4;
+// the stream file written by the tests
+#define STREAM_TEST_PATH "build/test-stream.bin"
+
+// for XorDoublyList functions
+int8_t XOR_LIST_NUM_TESTS = 6;
+
+// for ArenaDoublyList functions
+int8_t ARENA_LIST_NUM_TESTS = 5;
+
+// for lists made by DEFINE_DOUBLY_LIST
+int8_t GENERIC_LIST_NUM_TESTS = 5;
+
+// for LockedDoublyList functions
+int8_t LOCKED_LIST_NUM_TESTS = 6;
+int8_t LOCKED_CONCURRENT_NUM_TESTS = 4;
+// the number of threads, values inserted per thread, and values already in the
+// list of the concurrent test
+#define LOCKED_THREADS 8
+#define LOCKED_VALUES_PER_THREAD 400
+#define LOCKED_ANCHORS 64
+
+// for RcuDoublyList functions
+int8_t RCU_LIST_NUM_TESTS = 6;
+int8_t RCU_CONCURRENT_NUM_TESTS = 4;
+// the number of reader threads, values which are always in the list, and rounds of
+// changes made by the writer in the concurrent test
+#define RCU_READERS 4
+#define RCU_STABLE_VALUES 256
+#define RCU_WRITES 20000
+
 /*** Node Unit Tests */
 
 /**
@@ -192,60 +264,2220 @@ bool* test_between_node() {
     return tests_status;
 }
 
-/*** Helper Functions */
+/*** NodePool Unit Tests */
 
 /**
- * @brief Displays the results of unit test functions
- *
- * This function processes an array of test results and displays whether tests passed or failed.
- * It can show detailed results for each individual test when verbose mode is enabled,
- * and always displays a summary message indicating overall test success or failure.
- *
- * @param tests_status Pointer to a boolean array containing test results (PASS/FAIL)
- * @param num_tests The number of test results in the array
- * @param verbose If true, displays detailed results for each individual test
+ * @brief Tests the pool_node and release_node functions
+ * 
+ * This function tests if the NodePool correctly hands out nodes with:
+ * 1. The data set and both pointers set to NULL
+ * 2. Consecutive nodes placed next to each other in the same slab
+ * 3. Released nodes reused before new slab memory
+ * 4. A new slab allocated only once the first slab is used up
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
  */
-void display_test_results(bool* tests_status, int8_t num_tests, bool verbose) {
-    bool all_passed = true;
-    for (int8_t i = 0; i < num_tests; i++) {
-        if (tests_status[i] == PASS) {
-            if (verbose) {
-                printf("Test %d passed", i + 1);
+bool* test_node_pool() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * NODE_POOL_NUM_TESTS);
+    NodePool* pool = create_node_pool(2);
+
+    // Test 1: data is set and pointers are NULL
+    Node* first = pool_node(pool, 5);
+    tests_status[0] = (first->data == 5) && (first->prev == NULL) && (first->next == NULL);
+
+    // Test 2: nodes are adjacent inside a slab
+    Node* second = pool_node(pool, 6);
+    tests_status[1] = (second == first + 1);
+
+    // Test 3: a released node is reused first
+    release_node(pool, first);
+    tests_status[2] = (pool_node(pool, 7) == first);
+
+    // Test 4: a second slab is allocated once the first is full
+    bool one_slab = (pool_stats(pool).mallocs == 1);
+    pool_node(pool, 8);
+    tests_status[3] = one_slab && (pool_stats(pool).mallocs == 2);
+
+    destroy_node_pool(pool);
+
+    return tests_status;
+}
+
+/**
+ * @brief Tests the attach_pool function together with the delete functions
+ * 
+ * This function tests if a DoublyLinkedList with an attached pool:
+ * 1. Accepts the pool while it is empty
+ * 2. Takes appended and prepended nodes from the pool
+ * 3. Returns nodes removed by delete_first and delete_last to the free list
+ * 4. Keeps head, tail and the prev/next pointers consistent after deletes
+ * 5. Refuses to switch pools while it has nodes
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_attach_pool() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * ATTACH_POOL_NUM_TESTS);
+    NodePool* pool = create_node_pool(0);
+    DoublyLinkedList list = {0};
+
+    // Test 1: the pool is attached to the empty list
+    tests_status[0] = attach_pool(&list, pool);
+
+    // Test 2: nodes are taken from the pool
+    append_node(&list, 2);
+    append_node(&list, 3);
+    prepend_node(&list, 1);
+    tests_status[1] = (pool_stats(pool).live_nodes == 3) && (list.size == 3);
+
+    // Test 3: deleted nodes are returned to the pool
+    delete_first(&list);
+    delete_last(&list);
+    NodePoolStats stats = pool_stats(pool);
+    tests_status[2] = (stats.live_nodes == 1) && (stats.free_nodes == 2);
+
+    // Test 4: the remaining node is both head and tail with NULL links
+    tests_status[3] = (list.head == list.tail) && (list.head->data == 2)
+                      && (list.head->prev == NULL) && (list.head->next == NULL);
+
+    // Test 5: a list with nodes cannot switch pools
+    tests_status[4] = !attach_pool(&list, NULL) && (list.pool == pool);
+
+    clear(&list);
+    destroy_node_pool(pool);
+
+    return tests_status;
+}
+
+/*** DoublyLinkedList Unit Tests */
+
+/**
+ * @brief Returns true if forward_find and backward_find give the same answers as a
+ *        linear search of the array for every value in [0, range).
+ */
+bool hash_index_matches(DoublyLinkedList* list_ptr, int64_t* arr, int64_t length, int64_t range) {
+    for (int64_t value = 0; value < range; value++) {
+        int64_t forward = -1;
+        int64_t backward = -1;
+        for (int64_t i = 0; i < length; i++) {
+            if (arr[i] == value) {
+                forward = (forward == -1) ? i : forward;
+                backward = length - 1 - i;
             }
+        }
+        if ((forward_find(list_ptr, value) != forward) || (backward_find(list_ptr, value) != backward)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns true if the list holds exactly the values of the array, in order
+ *        from the head and in reverse from the tail.
+ */
+bool list_matches(DoublyLinkedList* list_ptr, int64_t* arr, int64_t length) {
+    int64_t i = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, i++) {
+        if ((i == length) || (node->data != arr[i])) {
+            return false;
+        }
+    }
+    for (Node* node = list_ptr->tail; node != NULL; node = node->prev) {
+        if ((i == 0) || (node->data != arr[--i])) {
+            return false;
+        }
+    }
+    return (i == 0) && (list_ptr->size == length);
+}
+
+/**
+ * @brief Tests the enable_hash_index function together with the find functions
+ * 
+ * This function tests if a DoublyLinkedList with a hash index:
+ * 1. Answers forward_find and backward_find for a list built before the index
+ * 2. Keeps both answers correct through random appends, prepends and deletes at both ends
+ * 3. Counts the distinct values and stays at most half full in hash_index_stats
+ * 4. Is left empty and usable by clear
+ * 5. Leaves the list unchanged when disable_hash_index frees it
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_hash_index() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * HASH_INDEX_NUM_TESTS);
+    int64_t arr[600];
+    int64_t range = 64;
+    int64_t length = 300;
+    DoublyLinkedList list = {0};
+    for (int64_t i = 0; i < length; i++) {
+        arr[i] = (i * 7) % range;
+        append_node(&list, arr[i]);
+    }
+
+    // Test 1: index over an existing list
+    tests_status[0] = enable_hash_index(&list) && hash_index_matches(&list, arr, length, range + 8);
+
+    // Test 2: random operations against an array, with a small range of values to get duplicates
+    srand(6);
+    bool matches = true;
+    for (int i = 0; i < 3000; i++) {
+        int op = rand() % 4;
+        int64_t value = rand() % range;
+        if ((op == 0) && (length < 600)) {
+            append_node(&list, value);
+            arr[length++] = value;
+        } else if ((op == 1) && (length < 600)) {
+            prepend_node(&list, value);
+            memmove(arr + 1, arr, sizeof(int64_t) * length++);
+            arr[0] = value;
+        } else if ((op == 2) && (length > 0)) {
+            delete_first(&list);
+            memmove(arr, arr + 1, sizeof(int64_t) * --length);
+        } else if (length > 0) {
+            delete_last(&list);
+            length--;
+        }
+        if (i % 10 == 0) {
+            matches = matches && hash_index_matches(&list, arr, length, range);
+        }
+    }
+    tests_status[1] = matches && hash_index_matches(&list, arr, length, range) && (list.size == length);
+
+    // Test 3: stats
+    uint64_t distinct = 0;
+    for (int64_t value = 0; value < range; value++) {
+        distinct += (forward_find(&list, value) != -1);
+    }
+    HashIndexStats stats = hash_index_stats(&list);
+    tests_status[2] = (stats.distinct_values == distinct) && (stats.capacity >= 2 * distinct)
+                      && ((stats.capacity & (stats.capacity - 1)) == 0)
+                      && (stats.bytes == sizeof(HashIndex) + stats.capacity * sizeof(HashSlot));
+
+    // Test 4: clear
+    clear(&list);
+    append_node(&list, 7);
+    prepend_node(&list, 6);
+    append_node(&list, 6);
+    tests_status[3] = (hash_index_stats(&list).distinct_values == 2) && (forward_find(&list, 6) == 0)
+                      && (backward_find(&list, 6) == 0) && (backward_find(&list, 7) == 1)
+                      && (forward_find(&list, 5) == -1);
+
+    // Test 5: disable
+    disable_hash_index(&list);
+    tests_status[4] = (list.hash == NULL) && (hash_index_stats(&list).bytes == 0)
+                      && (forward_find(&list, 7) == 1) && (forward_find(&list, 5) == -1);
+
+    clear(&list);
+    return tests_status;
+}
+
+/**
+ * @brief Tests forward_find and backward_find without a hash index
+ * 
+ * This function tests if the walks from both ends of a DoublyLinkedList:
+ * 1. Return -1 on an empty list
+ * 2. Find the first match from either end on lists of odd and even lengths, with matches
+ *    on both halves, where the walks meet, and nowhere
+ * 3. Find a value held only by the middle node of a list of odd length from both ends
+ * 4. Find every value of a long list of random values, most of them held by several nodes
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_find() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * FIND_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    int64_t arr[5001];
+
+    // Test 1: empty list
+    tests_status[0] = (forward_find(&list, 0) == -1) && (backward_find(&list, 0) == -1);
+
+    // Test 2: short lists
+    bool matches = true;
+    for (int64_t length = 1; length <= 40; length++) {
+        append_node(&list, length % 7);
+        arr[length - 1] = length % 7;
+        matches = matches && hash_index_matches(&list, arr, length, 10);
+    }
+    tests_status[1] = matches;
+    clear(&list);
+
+    // Test 3: middle node
+    for (int64_t i = 0; i < 9; i++) {
+        append_node(&list, (i == 4) ? 100 : i);
+    }
+    tests_status[2] = (forward_find(&list, 100) == 4) && (backward_find(&list, 100) == 4);
+    clear(&list);
+
+    // Test 4: long list
+    srand(18);
+    for (int64_t i = 0; i < 5001; i++) {
+        arr[i] = rand() % 3000;
+        append_node(&list, arr[i]);
+    }
+    tests_status[3] = hash_index_matches(&list, arr, 5001, 3100);
+    clear(&list);
+
+    return tests_status;
+}
+
+/**
+ * @brief Orders the nodes of a list by their data, and nodes holding equal data by
+ *        their position in the list, which is stored in prev while sorting.
+ */
+int compare_nodes(const void* a, const void* b) {
+    Node* x = *((Node* const *) a);
+    Node* y = *((Node* const *) b);
+    if (x->data != y->data) {
+        return (x->data > y->data) - (x->data < y->data);
+    }
+    return (x->prev > y->prev) - (x->prev < y->prev);
+}
+
+/**
+ * @brief Sorts the list with radix_sort_list and returns true if its nodes end up
+ *        in the order of a stable sort, linked the same way through next from the
+ *        head and through prev from the tail.
+ */
+bool radix_sorts_stably(DoublyLinkedList* list_ptr) {
+    int64_t length = list_ptr->size;
+    Node** nodes = (Node **) malloc(sizeof(Node*) * (length + 1));
+    Node** prevs = (Node **) malloc(sizeof(Node*) * (length + 1));
+    int64_t i = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, i++) {
+        nodes[i] = node;
+        prevs[i] = node->prev;
+    }
+    // stand in the position of every node for its prev, until qsort is done
+    for (i = 0; i < length; i++) {
+        nodes[i]->prev = (Node *) (uintptr_t) (i + 1);
+    }
+    qsort(nodes, length, sizeof(Node*), compare_nodes);
+    for (i = 0; i < length; i++) {
+        nodes[i]->prev = prevs[(uintptr_t) nodes[i]->prev - 1];
+    }
+    radix_sort_list(list_ptr);
+    bool sorted = (list_ptr->size == length);
+    Node* node = list_ptr->head;
+    for (i = 0; (i < length) && sorted; i++, node = node->next) {
+        sorted = (node == nodes[i]) && (node->prev == ((i == 0) ? NULL : nodes[i - 1]));
+    }
+    sorted = sorted && (node == NULL) && (list_ptr->tail == ((length == 0) ? NULL : nodes[length - 1]));
+    free(nodes);
+    free(prevs);
+    return sorted;
+}
+
+/**
+ * @brief Tests the radix_sort_list function of the DoublyLinkedList implementation
+ * 
+ * This function tests if radix_sort_list:
+ * 1. Leaves empty and single node lists unchanged
+ * 2. Sorts random values spread over the whole range of int64_t stably, with prev and tail correct
+ * 3. Orders negative values and the extreme values of int64_t correctly
+ * 4. Keeps the order of values differing in a single digit, and of values which are all equal
+ * 5. Leaves a hash index correct, and the list usable from both ends
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_radix_sort_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RADIX_SORT_NUM_TESTS);
+    DoublyLinkedList list = {0};
+
+    // Test 1: empty and single node lists
+    bool unchanged = radix_sorts_stably(&list) && (list.head == NULL);
+    append_node(&list, -5);
+    tests_status[0] = unchanged && radix_sorts_stably(&list) && (list.head->data == -5);
+    clear(&list);
+
+    // Test 2: the whole range, with repeats
+    srand(12);
+    for (int i = 0; i < 100000; i++) {
+        uint64_t bits = ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand();
+        append_node(&list, ((i % 3 == 0) && (i > 0)) ? list.head->data + (i % 2) : (int64_t) bits);
+    }
+    tests_status[1] = radix_sorts_stably(&list);
+    clear(&list);
+
+    // Test 3: signs and extremes
+    int64_t signs[9] = {3, INT64_MIN, -1, INT64_MAX, 0, -256, INT64_MIN + 1, 256, INT64_MIN};
+    int64_t signs_sorted[9] = {INT64_MIN, INT64_MIN, INT64_MIN + 1, -256, -1, 0, 3, 256, INT64_MAX};
+    for (int i = 0; i < 9; i++) {
+        append_node(&list, signs[i]);
+    }
+    bool ordered = radix_sorts_stably(&list);
+    Node* node = list.head;
+    for (int i = 0; i < 9; i++, node = node->next) {
+        ordered = ordered && (node->data == signs_sorted[i]);
+    }
+    tests_status[2] = ordered;
+    clear(&list);
+
+    // Test 4: a single differing digit, then all equal
+    for (int i = 0; i < 1000; i++) {
+        append_node(&list, -1000000 + ((int64_t) (rand() % 4) << 16));
+    }
+    bool one_digit = radix_sorts_stably(&list);
+    clear(&list);
+    for (int i = 0; i < 1000; i++) {
+        append_node(&list, 7);
+    }
+    tests_status[3] = one_digit && radix_sorts_stably(&list);
+    clear(&list);
+
+    // Test 5: hash index and both ends after sorting
+    int64_t small[8] = {7, -3, 9, -3, 1, 8, 2, 6};
+    for (int i = 0; i < 8; i++) {
+        append_node(&list, small[i]);
+    }
+    enable_hash_index(&list);
+    forward_find(&list, 7);
+    radix_sort_list(&list);
+    bool indexed = (forward_find(&list, -3) == 0) && (backward_find(&list, -3) == 6)
+                   && (forward_find(&list, 9) == 7) && (backward_find(&list, 1) == 5);
+    append_node(&list, 10);
+    prepend_node(&list, -10);
+    delete_last(&list);
+    tests_status[4] = indexed && (list.head->data == -10) && (list.tail->data == 9)
+                      && (list.tail->prev->data == 8) && (list.head->next->prev == list.head);
+    clear(&list);
+    disable_hash_index(&list);
+    return tests_status;
+}
+
+/**
+ * @brief What the remap callback of the compaction tests saw: the number of calls, and
+ *        a node held outside of the list which must follow it.
+ */
+typedef struct {
+    int64_t calls;
+    Node* held;
+} RemapLog;
+
+void log_remap(Node* old_node, Node* new_node, void* context) {
+    RemapLog* log = (RemapLog *) context;
+    log->calls++;
+    if (log->held == old_node) {
+        log->held = new_node;
+    }
+}
+
+/**
+ * @brief Returns true if the nodes of the list sit next to each other in memory, in list
+ *        order, hold the values of the array, and link back to each other.
+ */
+bool is_compact(DoublyLinkedList* list_ptr, int64_t* arr, int64_t length) {
+    Node* node = list_ptr->head;
+    for (int64_t i = 0; i < length; i++) {
+        Node* prev = (i == 0) ? NULL : &(list_ptr->head[i - 1]);
+        if ((node != &(list_ptr->head[i])) || (node->data != arr[i]) || (node->prev != prev)) {
+            return false;
+        }
+        node = node->next;
+    }
+    return (node == NULL) && (list_ptr->tail == &(list_ptr->head[length - 1])) && (list_ptr->size == length);
+}
+
+/**
+ * @brief Tests the compact_list and compact_step functions
+ * 
+ * This function tests if compaction:
+ * 1. Moves a list of malloc'd nodes into one block of a pool the list owns, in list order
+ * 2. Calls remap for every node, so that a held node can follow the list
+ * 3. Keeps the hash index correct
+ * 4. Moves a list within a pool attached with attach_pool, returning the old nodes to it
+ * 5. Runs in steps of bounded size while nodes are appended, prepended and deleted in between
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_compact() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * COMPACT_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    int64_t length = 3000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * (length + 200));
+    for (int64_t i = 0; i < length; i++) {
+        arr[i] = (i * 37) % 1000;
+        append_node(&list, arr[i]);
+    }
+    enable_hash_index(&list);
+
+    // Test 1: malloc'd nodes
+    RemapLog log = {0, list.tail->prev};
+    tests_status[0] = compact_list(&list, log_remap, &log) && list.owns_pool && (list.pool != NULL)
+                      && (list.pool->live_nodes == (uint64_t) length) && is_compact(&list, arr, length);
+
+    // Test 2: remap
+    tests_status[1] = (log.calls == length) && (log.held == &(list.head[length - 2]));
+
+    // Test 3: hash index
+    tests_status[2] = hash_index_matches(&list, arr, length, 1100);
+
+    // Test 4: an attached pool
+    for (int64_t i = 0; i < length; i++) {
+        arr[i] = i;
+    }
+    clear(&list);
+    NodePool* pool = create_node_pool(64);
+    bool dropped = (list.pool == NULL) && !list.owns_pool && attach_pool(&list, pool);
+    for (int64_t i = 0; i < length; i++) {
+        append_node(&list, i);
+        prepend_node(&list, -1);
+    }
+    for (int64_t i = 0; i < length; i++) {
+        delete_first(&list);
+    }
+    tests_status[3] = dropped && compact_list(&list, NULL, NULL) && (list.pool == pool) && !list.owns_pool
+                      && (pool->live_nodes == (uint64_t) length) && is_compact(&list, arr, length)
+                      && hash_index_matches(&list, arr, length, 100);
+
+    // Test 5: steps
+    int64_t steps = 0;
+    while (compact_step(&list, 50, NULL, NULL)) {
+        steps++;
+        if (steps % 3 == 0) {
+            prepend_node(&list, -steps);
+            memmove(arr + 1, arr, sizeof(int64_t) * length);
+            arr[0] = -steps;
+            length++;
+        } else if (steps % 3 == 1) {
+            append_node(&list, length + steps);
+            arr[length] = length + steps;
+            length++;
         } else {
-            if (verbose) {
-                printf("Test %d failed\n", i + 1);
-            }
-            all_passed = false;
+            delete_last(&list);
+            delete_first(&list);
+            memmove(arr, arr + 1, sizeof(int64_t) * (length - 2));
+            length -= 2;
         }
     }
-    if (all_passed) {
-        printf("All tests passed!\n");
-    } else {
-        printf("Some tests failed!\n");
+    bool stepped = (steps >= 50) && (list.compact == NULL) && hash_index_matches(&list, arr, length, 10);
+    DoublyLinkedList unpooled = {0};
+    append_node(&unpooled, 1);
+    tests_status[4] = stepped && (list.size == length) && !compact_step(&unpooled, 10, NULL, NULL)
+                      && (unpooled.compact == NULL);
+    for (int64_t i = 0; stepped && (i < length); i++) {
+        tests_status[4] = tests_status[4] && (forward_find(&list, arr[i]) == i);
     }
+    clear(&unpooled);
+    clear(&list);
+    disable_hash_index(&list);
+    destroy_node_pool(pool);
+    free(arr);
+    return tests_status;
 }
 
-/*** Program Starting Point */
-int main() {
-    bool* tests_status = test_dangling_node();
-    printf("Testing dangling_node function: ");
-    display_test_results(tests_status, DANGLING_NODE_NUM_TESTS, false);
-    free(tests_status);
-    
-    tests_status = test_next_node();
-    printf("Testing next_node function: ");
-    display_test_results(tests_status, NEXT_NODE_NUM_TESTS, false);
-    free(tests_status);
-    
-    tests_status = test_prev_node();
-    printf("Testing prev_node function: ");
-    display_test_results(tests_status, PREV_NODE_NUM_TESTS, false);
-    free(tests_status);
+/**
+ * @brief Tests the concat, splice_after, split_at and splice_range functions
+ * 
+ * This function tests if the splicing functions:
+ * 1. Link two lists with concat without copying, leaving src empty and usable
+ * 2. Insert a whole list at the head, in the middle and at the tail with splice_after
+ * 3. Split a list at both ends and in the middle with split_at
+ * 4. Move ranges between lists and within one list with splice_range, refusing bad ranges
+ * 5. Keep hash indices right, and refuse lists on different pools unless dest is empty
+ * 6. Merge a pool only src owns into the pool of dest when the whole list moves, and
+ *    never when part of it does, even at the end with split_at
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_splice() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SPLICE_NUM_TESTS);
+    DoublyLinkedList src = {0};
+    DoublyLinkedList dest = {0};
+    int64_t arr[100];
+    for (int64_t i = 0; i < 100; i++) {
+        arr[i] = i;
+    }
 
-    tests_status = test_between_node();
-    printf("Testing between_node function: ");
-    display_test_results(tests_status, BETWEEN_NODE_NUM_TESTS, false);
+    // Test 1: concat
+    for (int64_t i = 0; i < 50; i++) {
+        append_node(&dest, i);
+        append_node(&src, 50 + i);
+    }
+    Node* src_head = src.head;
+    bool linked = concat(&src, &dest) && list_matches(&dest, arr, 100) && (dest.head->next->next != NULL)
+                  && (forward_find(&dest, 50) == 50);
+    for (Node* node = dest.head; node != NULL; node = node->next) {
+        linked = linked && ((node->data != 50) || (node == src_head));
+    }
+    append_node(&src, 7);
+    tests_status[0] = linked && (src.size == 1) && (src.head == src.tail) && (src.head->prev == NULL)
+                      && concat(&src, &dest) && !concat(&dest, &dest) && is_empty(&src)
+                      && (dest.tail->data == 7) && (dest.size == 101);
+    delete_last(&dest);
+
+    // Test 2: splice_after
+    prepend_node(&src, -1);
+    bool spliced = splice_after(&dest, NULL, &src) && (dest.head->data == -1) && (dest.head->next->prev == dest.head);
+    delete_first(&dest);
+    append_node(&src, -2);
+    append_node(&src, -3);
+    spliced = spliced && splice_after(&dest, dest.head->next, &src) && (dest.head->next->next->data == -2)
+              && (dest.head->next->next->next->next->data == 2) && (dest.size == 102);
+    Node* middle = dest.head->next->next;
+    spliced = spliced && (splice_range(&dest, middle, middle->next, &src, NULL) == 2) && list_matches(&dest, arr, 100)
+              && splice_after(&dest, dest.tail, &src) && (dest.tail->data == -3) && (dest.tail->prev->data == -2);
+    delete_last(&dest);
+    delete_last(&dest);
+    tests_status[1] = spliced && list_matches(&dest, arr, 100) && is_empty(&src) && (src.head == NULL) && (src.tail == NULL);
+
+    // Test 3: split_at
+    bool split = split_at(&dest, 100, &src) && is_empty(&src) && !split_at(&dest, 101, &src) && !split_at(&dest, -1, &src)
+                 && split_at(&dest, 70, &src) && list_matches(&dest, arr, 70) && list_matches(&src, arr + 70, 30)
+                 && split_at(&dest, 10, &src) && list_matches(&dest, arr, 10) && (src.head->data == 70)
+                 && (src.tail->data == 69) && (src.size == 90);
+    split = split && split_at(&src, 30, &dest) && concat(&src, &dest) && list_matches(&dest, arr, 100);
+    tests_status[2] = split && split_at(&dest, 0, &src) && is_empty(&dest) && list_matches(&src, arr, 100);
+    concat(&src, &dest);
+
+    // Test 4: splice_range
+    Node* first = dest.head->next->next;
+    Node* last = first->next->next;
+    bool ranged = (splice_range(&dest, last, first, &src, NULL) == -1)
+                  && (splice_range(&dest, first, last, &dest, first->next) == -1)
+                  && (splice_range(&dest, first, last, &src, NULL) == 3) && (dest.size == 97) && (src.size == 3)
+                  && (src.head == first) && (src.tail == last) && (first->prev == NULL) && (last->next == NULL)
+                  && (dest.head->next->next->data == 5);
+    splice_range(&src, first, last, &dest, dest.head->next);
+    ranged = ranged && list_matches(&dest, arr, 100) && is_empty(&src);
+    // moving the head to the tail within the list
+    splice_range(&dest, dest.head, dest.head, &dest, dest.tail);
+    splice_range(&dest, dest.tail, dest.tail, &dest, NULL);
+    tests_status[3] = ranged && list_matches(&dest, arr, 100)
+                      && (splice_range(&dest, dest.head, dest.tail, &dest, NULL) == 100) && list_matches(&dest, arr, 100);
+
+    // Test 5: hash indices and pools
+    enable_hash_index(&dest);
+    enable_hash_index(&src);
+    forward_find(&dest, 0);
+    split_at(&dest, 40, &src);
+    bool hashed = hash_index_matches(&dest, arr, 40, 110) && hash_index_matches(&src, arr + 40, 60, 110);
+    splice_range(&src, src.head, src.head->next, &dest, NULL);
+    hashed = hashed && (forward_find(&dest, 41) == 1) && (forward_find(&dest, 39) == 41) && (backward_find(&src, 40) == -1);
+    splice_range(&dest, dest.head, dest.head->next, &dest, dest.tail);
+    concat(&src, &dest);
+    hashed = hashed && hash_index_matches(&dest, arr, 100, 110) && (forward_find(&src, 50) == -1);
+    NodePool* pool = create_node_pool(0);
+    DoublyLinkedList pooled = {0};
+    attach_pool(&pooled, pool);
+    append_node(&pooled, 100);
+    bool refused = !concat(&pooled, &dest) && !split_at(&dest, 50, &pooled)
+                   && (splice_range(&dest, dest.head, dest.head, &pooled, NULL) == -1) && (dest.size == 100);
+    DoublyLinkedList empty = {0};
+    tests_status[4] = hashed && refused && concat(&pooled, &empty) && (empty.pool == pool) && (empty.size == 1);
+    clear(&empty);
+    clear(&dest);
+    disable_hash_index(&src);
+    disable_hash_index(&dest);
+    destroy_node_pool(pool);
+
+    // Test 6: owned pools
+    DoublyLinkedList front = {0};
+    DoublyLinkedList back = {0};
+    DoublyLinkedList rest = {0};
+    for (int64_t i = 0; i < 50; i++) {
+        append_node(&front, i);
+        append_node(&back, 50 + i);
+    }
+    compact_list(&front, NULL, NULL);
+    compact_list(&back, NULL, NULL);
+    NodePool* front_pool = front.pool;
+    bool merged = front.owns_pool && back.owns_pool && (front_pool != back.pool)
+                  && !split_at(&back, 10, &front) && !split_at(&back, 50, &front)
+                  && split_at(&back, 50, &rest) && (rest.pool == back.pool) && (back.pool->owners == 2)
+                  && !concat(&back, &front);
+    clear(&rest);
+    append_node(&rest, -1);
+    merged = merged && (rest.pool == NULL) && !concat(&rest, &front) && concat(&back, &front)
+             && (back.pool == NULL) && !back.owns_pool && (front.pool == front_pool)
+             && (front_pool->live_nodes == 100) && list_matches(&front, arr, 100);
+    uint64_t free_nodes = front_pool->free_nodes;
+    delete_last(&front);
+    append_node(&back, 1);
+    tests_status[5] = merged && (front_pool->free_nodes == free_nodes + 1) && (back.pool == NULL)
+                      && (back.size == 1);
+    clear(&rest);
+    clear(&back);
+    clear(&front);
+    return tests_status;
+}
+
+/**
+ * @brief Applies a batch of sorted inserts to an array of length values, the way
+ *        insert_nodes applies them to a list, and returns the new length.
+ */
+int64_t array_insert_batch(int64_t* arr, int64_t length, IndexedValue* inserts, int64_t count) {
+    int64_t* old = (int64_t *) malloc(sizeof(int64_t) * (length + 1));
+    memcpy(old, arr, sizeof(int64_t) * length);
+    int64_t out = 0;
+    int64_t next = 0;
+    for (int64_t i = 0; i <= length; i++) {
+        while ((next < count) && (inserts[next].index == i)) {
+            arr[out++] = inserts[next++].data;
+        }
+        if (i < length) {
+            arr[out++] = old[i];
+        }
+    }
+    free(old);
+    return out;
+}
+
+/**
+ * @brief Applies a batch of increasing delete indices to an array of length values,
+ *        and returns the new length.
+ */
+int64_t array_delete_batch(int64_t* arr, int64_t length, int64_t* indices, int64_t count) {
+    int64_t out = 0;
+    int64_t next = 0;
+    for (int64_t i = 0; i < length; i++) {
+        if ((next < count) && (indices[next] == i)) {
+            next++;
+        } else {
+            arr[out++] = arr[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Tests the insert_nodes and delete_nodes functions
+ * 
+ * This function tests if batches:
+ * 1. Insert at the head, in the middle, at the tail and at repeated indices, from either end
+ * 2. Delete the head, middle nodes and the tail, from either end
+ * 3. Leave the list unchanged when unsorted, repeated or out of range, and fill an empty list
+ * 4. Give the same list as the same random changes applied to an array, with a hash index
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_batch() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * BATCH_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    int64_t arr[30000];
+    int64_t length = 20;
+    for (int64_t i = 0; i < length; i++) {
+        arr[i] = i;
+        append_node(&list, i);
+    }
+
+    // Test 1: inserts from the head, then from the tail
+    IndexedValue near_head[4] = {{0, 100}, {0, 101}, {3, 102}, {5, 103}};
+    IndexedValue near_tail[4] = {{19, 104}, {24, 105}, {24, 106}, {24, 107}};
+    bool inserted = insert_nodes(&list, near_head, 4);
+    length = array_insert_batch(arr, length, near_head, 4);
+    inserted = inserted && list_matches(&list, arr, length) && insert_nodes(&list, near_tail, 4);
+    length = array_insert_batch(arr, length, near_tail, 4);
+    tests_status[0] = inserted && list_matches(&list, arr, length) && (list.tail->data == 107);
+
+    // Test 2: deletes from the head, then from the tail
+    int64_t head_deletes[3] = {0, 1, 6};
+    int64_t tail_deletes[3] = {15, 20, 24};
+    bool deleted = delete_nodes(&list, head_deletes, 3);
+    length = array_delete_batch(arr, length, head_deletes, 3);
+    deleted = deleted && list_matches(&list, arr, length) && delete_nodes(&list, tail_deletes, 3);
+    length = array_delete_batch(arr, length, tail_deletes, 3);
+    tests_status[1] = deleted && list_matches(&list, arr, length) && (length == 22);
+
+    // Test 3: bad batches and empty lists
+    IndexedValue unsorted[2] = {{3, 0}, {2, 0}};
+    IndexedValue too_far[1] = {{23, 0}};
+    int64_t repeated[2] = {4, 4};
+    int64_t negative[1] = {-1};
+    bool refused = !insert_nodes(&list, unsorted, 2) && !insert_nodes(&list, too_far, 1)
+                   && !delete_nodes(&list, repeated, 2) && !delete_nodes(&list, negative, 1)
+                   && insert_nodes(&list, unsorted, 0) && delete_nodes(&list, negative, 0)
+                   && list_matches(&list, arr, length);
+    int64_t all[22];
+    for (int64_t i = 0; i < 22; i++) {
+        all[i] = i;
+    }
+    IndexedValue first[2] = {{0, 1}, {0, 2}};
+    int64_t expected[2] = {1, 2};
+    tests_status[2] = refused && delete_nodes(&list, all, 22) && is_empty(&list) && (list.tail == NULL)
+                      && insert_nodes(&list, first, 2) && list_matches(&list, expected, 2);
+    clear(&list);
+
+    // Test 4: random batches
+    srand(21);
+    enable_hash_index(&list);
+    length = 0;
+    bool matches = true;
+    for (int round = 0; round < 20; round++) {
+        int64_t count = 1 + rand() % 1000;
+        IndexedValue* batch = (IndexedValue *) malloc(sizeof(IndexedValue) * count);
+        // a narrow window, so that some batches are closer to the tail
+        int64_t low = rand() % (length + 1);
+        for (int64_t i = 0; i < count; i++) {
+            batch[i].index = low + rand() % (length - low + 1);
+            batch[i].data = rand() % 5000;
+        }
+        for (int64_t i = 1; i < count; i++) {
+            for (int64_t j = i; (j > 0) && (batch[j].index < batch[j - 1].index); j--) {
+                IndexedValue swap = batch[j];
+                batch[j] = batch[j - 1];
+                batch[j - 1] = swap;
+            }
+        }
+        matches = matches && insert_nodes(&list, batch, count);
+        length = array_insert_batch(arr, length, batch, count);
+        int64_t* indices = (int64_t *) malloc(sizeof(int64_t) * length);
+        int64_t num_deletes = 0;
+        low = rand() % (length + 1);
+        for (int64_t i = low; i < length; i++) {
+            if (rand() % 4 == 0) {
+                indices[num_deletes++] = i;
+            }
+        }
+        matches = matches && delete_nodes(&list, indices, num_deletes);
+        length = array_delete_batch(arr, length, indices, num_deletes);
+        matches = matches && list_matches(&list, arr, length);
+        free(indices);
+        free(batch);
+    }
+    tests_status[3] = matches && hash_index_matches(&list, arr, length, 100);
+    clear(&list);
+    disable_hash_index(&list);
+    return tests_status;
+}
+
+/*** LockedDoublyList Unit Tests */
+
+/**
+ * @brief Copies the values of the list into arr in order and returns how many there
+ *        are, or -1 if some node's prev pointer does not point back to the node
+ *        before it. Must only be called while no other thread is changing the list.
+ */
+int64_t locked_values(LockedDoublyList* list_ptr, int64_t* arr, int64_t capacity) {
+    int64_t count = 0;
+    LockedNode* prev = &(list_ptr->head);
+    for (LockedNode* node = prev->next; node != &(list_ptr->tail); node = node->next) {
+        if ((node->prev != prev) || (count == capacity)) {
+            return -1;
+        }
+        arr[count++] = node->data;
+        prev = node;
+    }
+    return (list_ptr->tail.prev == prev) ? count : -1;
+}
+
+/**
+ * @brief The argument of every thread of the concurrent test: the list, the index of
+ *        the thread, and whether it saw a wrong answer.
+ */
+typedef struct {
+    LockedDoublyList* list_ptr;
+    int64_t index;
+    bool failed;
+} LockedThread;
+
+/**
+ * @brief Inserts the values LOCKED_ANCHORS + index * LOCKED_VALUES_PER_THREAD + i next to
+ *        anchors spread over the list, alternating insert_after and insert_before, and
+ *        checks that both finds see every value it inserted. Every third value is deleted
+ *        again, and must then be missing.
+ */
+void* locked_insert_values(void* arg) {
+    LockedThread* thread = (LockedThread *) arg;
+    for (int64_t i = 0; i < LOCKED_VALUES_PER_THREAD; i++) {
+        int64_t value = LOCKED_ANCHORS + thread->index * LOCKED_VALUES_PER_THREAD + i;
+        int64_t anchor = (thread->index * 7 + i * 13) % LOCKED_ANCHORS;
+        bool inserted = (i % 2 == 0) ? locked_insert_after(thread->list_ptr, anchor, value)
+                                     : locked_insert_before(thread->list_ptr, anchor, value);
+        if (!inserted || (locked_forward_find(thread->list_ptr, value) == -1)
+            || (locked_backward_find(thread->list_ptr, value) == -1)) {
+            thread->failed = true;
+        }
+        if ((i % 3 == 0) && (!locked_delete(thread->list_ptr, value)
+                             || (locked_forward_find(thread->list_ptr, value) != -1))) {
+            thread->failed = true;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Checks that every checkpoint of the list is on the node at its index,
+ *        unless the table is stale and will be rebuilt anyway.
+ */
+bool checkpoints_match(DoublyLinkedList* list_ptr) {
+    CheckpointTable* table = list_ptr->checkpoints;
+    if (table->stale) {
+        return true;
+    }
+    for (int64_t i = 0; i < table->count; i++) {
+        Node* node = list_ptr->head;
+        for (int64_t j = 0; (node != NULL) && (j < table->points[i].index); j++) {
+            node = node->next;
+        }
+        if ((node != table->points[i].node) || ((i > 0) && (table->points[i].index < table->points[i - 1].index))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that get returns the right value for every index of the list.
+ */
+bool get_matches(DoublyLinkedList* list_ptr, int64_t* arr, int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+        int64_t* data = get(list_ptr, i);
+        if ((data == NULL) || (*data != arr[i])) {
+            return false;
+        }
+    }
+    return (get(list_ptr, length) == NULL) && (get(list_ptr, -1) == NULL);
+}
+
+/**
+ * @brief Tests the get, insert_at and delete_at functions
+ * 
+ * This function tests if:
+ * 1. get reads every index from either end, and returns NULL out of range
+ * 2. insert_at and delete_at change the head, the middle and the tail, and refuse bad indices
+ * 3. With checkpoints, random inserts, deletes and gets give the same list as an array
+ * 4. The checkpoints are rebuilt after sorts, splices, batches, compaction and clear
+ * 5. enable_checkpoints refuses a count of 0, and a list can be emptied and refilled
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_positional() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * POSITIONAL_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    int64_t arr[5000];
+    int64_t length = 100;
+    for (int64_t i = 0; i < length; i++) {
+        arr[i] = 2 * i;
+        append_node(&list, 2 * i);
+    }
+
+    // Test 1: reads without checkpoints
+    tests_status[0] = get_matches(&list, arr, length) && (*get(&list, 0) == 0) && (*get(&list, 99) == 198);
+
+    // Test 2: inserts and deletes at either end and in the middle
+    bool changed = insert_at(&list, -1, 0) && insert_at(&list, 500, 101) && insert_at(&list, 77, 30)
+                   && insert_at(&list, 78, 80) && !insert_at(&list, 0, 105) && !insert_at(&list, 0, -1);
+    changed = changed && (list.head->data == -1) && (list.tail->data == 500) && (list.size == 104);
+    changed = changed && delete_at(&list, 0) && delete_at(&list, 102) && delete_at(&list, 29)
+              && delete_at(&list, 78) && !delete_at(&list, 100) && !delete_at(&list, -1);
+    tests_status[1] = changed && list_matches(&list, arr, length) && (list.head->prev == NULL)
+                      && (list.tail->next == NULL);
+
+    // Test 3: random changes with checkpoints and a hash index
+    srand(22);
+    enable_hash_index(&list);
+    bool matches = enable_checkpoints(&list, 8);
+    for (int round = 0; round < 4000; round++) {
+        int64_t index = rand() % (length + 1);
+        int64_t kind = rand() % 4;
+        if ((kind == 0) && (length < 5000)) {
+            matches = matches && insert_at(&list, round, index);
+            memmove(&arr[index + 1], &arr[index], sizeof(int64_t) * (length - index));
+            arr[index] = round;
+            length++;
+        } else if ((kind == 1) && (index < length)) {
+            matches = matches && delete_at(&list, index);
+            memmove(&arr[index], &arr[index + 1], sizeof(int64_t) * (length - index - 1));
+            length--;
+        } else if (index < length) {
+            matches = matches && (*get(&list, index) == arr[index]);
+        }
+        if (round % 500 == 0) {
+            matches = matches && checkpoints_match(&list);
+        }
+    }
+    tests_status[2] = matches && list_matches(&list, arr, length) && checkpoints_match(&list)
+                      && get_matches(&list, arr, length) && hash_index_matches(&list, arr, length, 100);
+    disable_hash_index(&list);
+
+    // Test 4: other changes to the list
+    prepend_node(&list, -5);
+    append_node(&list, -6);
+    delete_first(&list);
+    delete_last(&list);
+    bool rebuilt = checkpoints_match(&list) && get_matches(&list, arr, length);
+    radix_sort_list(&list);
+    for (int64_t i = 1; i < length; i++) {
+        for (int64_t j = i; (j > 0) && (arr[j] < arr[j - 1]); j--) {
+            int64_t swap = arr[j];
+            arr[j] = arr[j - 1];
+            arr[j - 1] = swap;
+        }
+    }
+    rebuilt = rebuilt && list.checkpoints->stale && get_matches(&list, arr, length);
+    DoublyLinkedList back = {0};
+    rebuilt = rebuilt && split_at(&list, length / 2, &back) && (get(&list, length / 2) == NULL)
+              && concat(&back, &list) && get_matches(&list, arr, length);
+    int64_t deletes[3] = {0, 1, 2};
+    rebuilt = rebuilt && delete_nodes(&list, deletes, 3) && get_matches(&list, &arr[3], length - 3);
+    rebuilt = rebuilt && compact_list(&list, NULL, NULL) && get_matches(&list, &arr[3], length - 3);
+    clear(&list);
+    tests_status[3] = rebuilt && (get(&list, 0) == NULL) && insert_at(&list, 9, 0) && (*get(&list, 0) == 9);
+    clear(&list);
+
+    // Test 5: bad counts and emptied lists
+    bool refused = !enable_checkpoints(&list, 0) && (list.checkpoints != NULL) && enable_checkpoints(&list, 3);
+    for (int64_t i = 0; i < 10; i++) {
+        refused = refused && insert_at(&list, i, i);
+    }
+    while (!is_empty(&list)) {
+        refused = refused && delete_at(&list, list.size / 2) && checkpoints_match(&list);
+    }
+    refused = refused && (list.head == NULL) && (list.tail == NULL) && insert_at(&list, 4, 0)
+              && insert_at(&list, 5, 1) && (*get(&list, 1) == 5) && (list.tail->data == 5);
+    clear(&list);
+    disable_checkpoints(&list);
+    tests_status[4] = refused && (list.checkpoints == NULL);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the parallel_find and parallel_contains functions
+ * 
+ * This function tests if:
+ * 1. Short lists, and lists without checkpoints, give the same results as forward_find
+ * 2. The first occurrence is found with many threads, at the head, the tail and in between
+ * 3. The value held by a node in every segment is found at its lowest index
+ * 4. The results stay right after insert_at, delete_at, prepends and a sort move the checkpoints
+ * 5. parallel_contains finds values which are held and not the others, with 1 to 100 threads
+ * 6. Nodes appended and prepended after a search are spread over the segments of the next one
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_parallel() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * PARALLEL_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    for (int64_t i = 0; i < 1000; i++) {
+        append_node(&list, i % 300);
+    }
+
+    // Test 1: lists searched by the calling thread
+    bool same = (parallel_find(&list, 299, 4) == 299) && (parallel_find(&list, 1000, 4) == -1);
+    for (int64_t i = 0; i < PARALLEL_MIN_NODES; i++) {
+        append_node(&list, i);
+    }
+    tests_status[0] = same && (parallel_find(&list, 5000, 4) == 6000) && (parallel_find(&list, -1, 4) == -1)
+                      && (list.checkpoints == NULL);
+    clear(&list);
+
+    // Test 2: first occurrences with checkpoints
+    int64_t length = 4 * PARALLEL_MIN_NODES;
+    for (int64_t i = 0; i < length; i++) {
+        append_node(&list, i);
+    }
+    append_node(&list, 0);
+    append_node(&list, length - 1);
+    length += 2;
+    bool found = enable_checkpoints(&list, 64) && (parallel_find(&list, 0, 8) == 0)
+                 && (parallel_find(&list, length - 3, 8) == length - 3)
+                 && (parallel_find(&list, 12345, 8) == 12345) && (parallel_find(&list, length, 8) == -1);
+    for (int64_t i = 1; i < 20; i++) {
+        int64_t value = (i * 104729) % (length - 2);
+        found = found && (parallel_find(&list, value, 4) == value);
+    }
+    tests_status[1] = found;
+
+    // Test 3: a value in every segment
+    int64_t spacing = list.checkpoints->spacing;
+    for (Node* node = list.head; node != NULL; node = node->next) {
+        if (node->data % (spacing / 2) == 77) {
+            node->data = -7;
+        }
+    }
+    bool lowest = true;
+    for (int64_t threads = 1; threads <= 16; threads *= 2) {
+        lowest = lowest && (parallel_find(&list, -7, threads) == 77);
+    }
+    tests_status[2] = lowest;
+
+    // Test 4: moved checkpoints
+    bool moved = insert_at(&list, -9, length / 2) && delete_at(&list, 10) && (parallel_find(&list, -9, 8) == length / 2 - 1)
+                 && (parallel_find(&list, 11, 8) == 10);
+    for (int64_t i = 0; i < 100; i++) {
+        prepend_node(&list, -100 - i);
+    }
+    moved = moved && (list.checkpoints->points[0].index == 100) && (parallel_find(&list, -150, 8) == 49)
+            && (parallel_find(&list, -7, 8) == 176) && (parallel_find(&list, 11, 8) == 110);
+    radix_sort_list(&list);
+    tests_status[3] = moved && (parallel_find(&list, -7, 8) == forward_find(&list, -7))
+                      && (parallel_find(&list, 500, 8) == forward_find(&list, 500));
+
+    // Test 5: contains
+    bool contains = true;
+    for (int64_t threads = 1; threads <= 100; threads *= 10) {
+        contains = contains && parallel_contains(&list, -9, threads) && parallel_contains(&list, length - 3, threads)
+                   && !parallel_contains(&list, 77, threads) && !parallel_contains(&list, -8, threads);
+    }
+    tests_status[4] = contains;
+    clear(&list);
+
+    // Test 6: segments after appends and prepends
+    for (int64_t i = 0; i < PARALLEL_MIN_NODES; i++) {
+        append_node(&list, i);
+    }
+    bool balanced = enable_checkpoints(&list, 64) && (parallel_find(&list, 100, 4) == 100);
+    int64_t old_spacing = list.checkpoints->spacing;
+    for (int64_t i = 0; i < 4 * PARALLEL_MIN_NODES; i++) {
+        append_node(&list, PARALLEL_MIN_NODES + i);
+    }
+    for (int64_t i = 0; i < PARALLEL_MIN_NODES; i++) {
+        prepend_node(&list, -1 - i);
+    }
+    CheckpointTable* table = list.checkpoints;
+    balanced = balanced && (parallel_find(&list, 3 * PARALLEL_MIN_NODES, 4) == 4 * PARALLEL_MIN_NODES)
+               && (table->spacing > old_spacing) && (table->points[0].index == 0)
+               && (list.size - table->points[table->count - 1].index <= table->spacing);
+    for (int64_t i = 1; i < table->count; i++) {
+        balanced = balanced && (table->points[i].index - table->points[i - 1].index == table->spacing);
+    }
+    tests_status[5] = balanced;
+    clear(&list);
+    disable_checkpoints(&list);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the instrumentation of the DoublyLinkedList functions
+ * 
+ * This function tests if, with every counter staying at 0 when the instrumentation is
+ * compiled out:
+ * 1. Appends are counted, with one node malloc each and the bytes they hold
+ * 2. forward_find counts the nodes hopped over from both ends, and get those from the closer end
+ * 3. Calls made inside another function count only for it, and deletes free every byte
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_stats() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * STATS_NUM_TESTS);
+    DoublyLinkedList list = {0};
+    list_stats_reset();
+    ListStats stats = list_stats_snapshot();
+    // bytes still held by the nodes of earlier tests
+    uint64_t held = stats.live_bytes;
+
+    // Test 1: appends
+    for (int64_t i = 0; i < 100; i++) {
+        append_node(&list, i);
+    }
+    stats = list_stats_snapshot();
+    tests_status[0] = (stats.enabled == (STATS_EXPECT(1) == 1)) && (stats.ops[LIST_OP_APPEND].calls == STATS_EXPECT(100))
+                      && (stats.mallocs == STATS_EXPECT(100)) && (stats.live_bytes == held + STATS_EXPECT(100 * sizeof(Node)));
+
+    // Test 2: hops
+    bool found = (forward_find(&list, 10) == 10) && (*get(&list, 90) == 90) && (*get(&list, 30) == 30);
+    stats = list_stats_snapshot();
+    tests_status[1] = found && (stats.ops[LIST_OP_FIND].calls == STATS_EXPECT(1))
+                      && (stats.ops[LIST_OP_FIND].hops == STATS_EXPECT(20))
+                      && (stats.ops[LIST_OP_GET].calls == STATS_EXPECT(2))
+                      && (stats.ops[LIST_OP_GET].hops == STATS_EXPECT(39));
+
+    // Test 3: nested calls and frees
+    DoublyLinkedList other = {0};
+    append_node(&other, 100);
+    bool counted = concat(&other, &list) && delete_at(&list, 50);
+    clear(&list);
+    stats = list_stats_snapshot();
+    tests_status[2] = counted && (stats.ops[LIST_OP_SPLICE].calls == STATS_EXPECT(1))
+                      && (stats.ops[LIST_OP_DELETE].calls == STATS_EXPECT(1))
+                      && (stats.ops[LIST_OP_CLEAR].calls == STATS_EXPECT(1))
+                      && (stats.frees == STATS_EXPECT(101)) && (stats.live_bytes == held);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the LockedDoublyList functions from a single thread
+ *
+ * This function tests if a LockedDoublyList:
+ * 1. Is empty when created, and finds nothing
+ * 2. Keeps the order and size of appends and prepends, with both links of every node set
+ * 3. Answers forward_find from the head and backward_find from the tail, like a DoublyLinkedList
+ * 4. Inserts after the first and before the last node holding a value
+ * 5. Deletes only the first node holding a value
+ * 6. Refuses to insert next to, or delete, a missing value
+ *
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ *
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_locked_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * LOCKED_LIST_NUM_TESTS);
+    LockedDoublyList* list_ptr = create_locked_list();
+    int64_t arr[16];
+
+    // Test 1: empty list
+    tests_status[0] = (locked_size(list_ptr) == 0) && (locked_values(list_ptr, arr, 16) == 0)
+                      && (locked_forward_find(list_ptr, 1) == -1) && (locked_backward_find(list_ptr, 1) == -1);
+
+    // Test 2: appends and prepends
+    locked_append(list_ptr, 2);
+    locked_append(list_ptr, 3);
+    locked_prepend(list_ptr, 1);
+    locked_append(list_ptr, 2);
+    int64_t count = locked_values(list_ptr, arr, 16);
+    tests_status[1] = (count == 4) && (locked_size(list_ptr) == 4) && (arr[0] == 1) && (arr[1] == 2)
+                      && (arr[2] == 3) && (arr[3] == 2);
+
+    // Test 3: finds from both ends
+    tests_status[2] = (locked_forward_find(list_ptr, 2) == 1) && (locked_backward_find(list_ptr, 2) == 0)
+                      && (locked_forward_find(list_ptr, 1) == 0) && (locked_backward_find(list_ptr, 1) == 3);
+
+    // Test 4: insert after the first 2 and before the last 2
+    locked_insert_after(list_ptr, 2, 5);
+    locked_insert_before(list_ptr, 2, 6);
+    count = locked_values(list_ptr, arr, 16);
+    tests_status[3] = (count == 6) && (arr[1] == 2) && (arr[2] == 5) && (arr[4] == 6) && (arr[5] == 2);
+
+    // Test 5: delete the first 2
+    bool deleted = locked_delete(list_ptr, 2);
+    count = locked_values(list_ptr, arr, 16);
+    tests_status[4] = deleted && (count == 5) && (arr[0] == 1) && (arr[1] == 5) && (arr[4] == 2)
+                      && (locked_size(list_ptr) == 5);
+
+    // Test 6: missing values
+    tests_status[5] = !locked_insert_after(list_ptr, 9, 0) && !locked_insert_before(list_ptr, 9, 0)
+                      && !locked_delete(list_ptr, 9) && (locked_size(list_ptr) == 5);
+
+    destroy_locked_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests LOCKED_THREADS threads inserting, searching in both directions and
+ *        deleting at once
+ *
+ * This function tests if a LockedDoublyList used by several threads:
+ * 1. Finishes, so forward and backward walks never waited on each other in a cycle
+ * 2. Let every thread find what it inserted, and not what it deleted
+ * 3. Keeps every prev pointer pointing back to the node before it
+ * 4. Holds every anchor and every value that was not deleted exactly once, matching the size
+ *
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ *
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_locked_concurrent() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * LOCKED_CONCURRENT_NUM_TESTS);
+    LockedDoublyList* list_ptr = create_locked_list();
+    for (int64_t i = 0; i < LOCKED_ANCHORS; i++) {
+        locked_append(list_ptr, i);
+    }
+    pthread_t threads[LOCKED_THREADS];
+    LockedThread args[LOCKED_THREADS];
+    for (int64_t i = 0; i < LOCKED_THREADS; i++) {
+        args[i].list_ptr = list_ptr;
+        args[i].index = i;
+        args[i].failed = false;
+        pthread_create(&(threads[i]), NULL, locked_insert_values, &(args[i]));
+    }
+    bool failed = false;
+    for (int64_t i = 0; i < LOCKED_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        failed = failed || args[i].failed;
+    }
+
+    // Test 1: every thread finished
+    tests_status[0] = true;
+
+    // Test 2: answers seen by the threads
+    tests_status[1] = !failed;
+
+    // Test 3: links
+    int64_t total = LOCKED_ANCHORS + LOCKED_THREADS * LOCKED_VALUES_PER_THREAD;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * total);
+    int64_t count = locked_values(list_ptr, arr, total);
+    tests_status[2] = (count != -1);
+
+    // Test 4: values left
+    uint8_t* seen = (uint8_t *) calloc(total, sizeof(uint8_t));
+    bool once = (count == locked_size(list_ptr));
+    for (int64_t i = 0; i < count; i++) {
+        once = once && (arr[i] >= 0) && (arr[i] < total) && (seen[arr[i]]++ == 0);
+    }
+    for (int64_t value = 0; value < total; value++) {
+        bool kept = (value < LOCKED_ANCHORS) || ((value - LOCKED_ANCHORS) % LOCKED_VALUES_PER_THREAD % 3 != 0);
+        once = once && (seen[value] == kept);
+    }
+    tests_status[3] = once;
+
+    free(seen);
+    free(arr);
+    destroy_locked_list(list_ptr);
+    return tests_status;
+}
+
+/*** RcuDoublyList Unit Tests */
+
+/**
+ * @brief Copies the values of the list into arr in order and returns how many there
+ *        are, or -1 if some node's prev pointer does not point back to the node
+ *        before it. Must only be called by the writer.
+ */
+int64_t rcu_values(RcuDoublyList* list_ptr, int64_t* arr, int64_t capacity) {
+    int64_t count = 0;
+    RcuNode* prev = NULL;
+    for (RcuNode* node = atomic_load(&(list_ptr->head)); node != NULL; node = atomic_load(&(node->next))) {
+        if ((node->prev != prev) || (count == capacity)) {
+            return -1;
+        }
+        arr[count++] = node->data;
+        prev = node;
+    }
+    return (list_ptr->tail == prev) ? count : -1;
+}
+
+/**
+ * @brief The argument of every reader of the concurrent test: the list, the index of
+ *        the reader, whether the writer is done, whether the reader saw a wrong answer,
+ *        and how many readers have started.
+ */
+typedef struct {
+    RcuDoublyList* list_ptr;
+    int64_t index;
+    atomic_bool* done;
+    atomic_int* started;
+    bool failed;
+} RcuThread;
+
+/**
+ * @brief Searches for the values which are always in the list until the writer is
+ *        done, checking that each one is at its own index, and now and then for a
+ *        value which never is. The first reader goes offline for a moment every
+ *        256 searches.
+ */
+void* rcu_read_values(void* arg) {
+    RcuThread* thread = (RcuThread *) arg;
+    RcuReader* reader = rcu_register_reader(thread->list_ptr);
+    atomic_fetch_add(thread->started, 1);
+    if (reader == NULL) {
+        thread->failed = true;
+        return NULL;
+    }
+    for (int64_t i = 0; !atomic_load(thread->done); i++) {
+        int64_t value = (thread->index * 31 + i * 7) % RCU_STABLE_VALUES;
+        if (rcu_forward_find(thread->list_ptr, reader, value) != value) {
+            thread->failed = true;
+        }
+        if ((i % 64 == 0) && rcu_contains(thread->list_ptr, reader, -1)) {
+            thread->failed = true;
+        }
+        if ((thread->index == 0) && (i % 256 == 0)) {
+            rcu_reader_offline(reader);
+            sched_yield();
+            rcu_reader_online(thread->list_ptr, reader);
+        }
+    }
+    rcu_unregister_reader(reader);
+    return NULL;
+}
+
+/**
+ * @brief Tests the RcuDoublyList functions from a single thread
+ *
+ * This function tests if an RcuDoublyList:
+ * 1. Is empty when created, finds nothing, and hands out reader slots
+ * 2. Keeps the order and size of appends and prepends, with both links of every node set
+ * 3. Inserts after the first node holding a value, and replaces the first one in place
+ * 4. Deletes only the first node holding a value, and refuses to change missing values
+ * 5. Keeps the unlinked nodes until an online reader has finished a search after they were unlinked
+ * 6. Does not wait for offline readers, and frees every node unlinked by clear_rcu_list
+ *
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ *
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_rcu_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RCU_LIST_NUM_TESTS);
+    RcuDoublyList* list_ptr = create_rcu_list();
+    RcuReader* reader = rcu_register_reader(list_ptr);
+    int64_t arr[16];
+
+    // Test 1: empty list
+    tests_status[0] = (reader != NULL) && (rcu_size(list_ptr) == 0) && (rcu_values(list_ptr, arr, 16) == 0)
+                      && (rcu_forward_find(list_ptr, reader, 1) == -1) && !rcu_contains(list_ptr, reader, 1);
+
+    // Test 2: appends and prepends
+    rcu_append(list_ptr, 2);
+    rcu_append(list_ptr, 3);
+    rcu_prepend(list_ptr, 1);
+    rcu_append(list_ptr, 2);
+    int64_t count = rcu_values(list_ptr, arr, 16);
+    tests_status[1] = (count == 4) && (rcu_size(list_ptr) == 4) && (arr[0] == 1) && (arr[1] == 2)
+                      && (arr[2] == 3) && (arr[3] == 2) && (rcu_forward_find(list_ptr, reader, 2) == 1)
+                      && rcu_contains(list_ptr, reader, 3);
+
+    // Test 3: insert after the first 2, and replace the first 3 and the last node
+    bool changed = rcu_insert_after(list_ptr, 2, 5) && rcu_replace(list_ptr, 3, 7) && rcu_insert_after(list_ptr, 7, 3)
+                   && rcu_replace(list_ptr, 2, 8) && rcu_replace(list_ptr, 2, 9);
+    count = rcu_values(list_ptr, arr, 16);
+    tests_status[2] = changed && (count == 6) && (arr[0] == 1) && (arr[1] == 8) && (arr[2] == 5) && (arr[3] == 7)
+                      && (arr[4] == 3) && (arr[5] == 9) && (rcu_forward_find(list_ptr, reader, 9) == 5);
+
+    // Test 4: delete the first 3, then the head and the tail
+    bool deleted = rcu_delete(list_ptr, 3) && rcu_delete(list_ptr, 1) && rcu_delete(list_ptr, 9);
+    count = rcu_values(list_ptr, arr, 16);
+    tests_status[3] = deleted && (count == 3) && (arr[0] == 8) && (arr[1] == 5) && (arr[2] == 7)
+                      && (rcu_size(list_ptr) == 3) && !rcu_delete(list_ptr, 3) && !rcu_replace(list_ptr, 3, 0)
+                      && !rcu_insert_after(list_ptr, 3, 0) && (rcu_size(list_ptr) == 3);
+
+    // Test 5: the reader has not searched since the nodes were unlinked, and then does
+    int64_t unlinked = list_ptr->retired_count;
+    int64_t freed_early = rcu_reclaim(list_ptr);
+    rcu_contains(list_ptr, reader, 5);
+    int64_t freed = rcu_reclaim(list_ptr);
+    tests_status[4] = (unlinked == 6) && (freed_early == 0) && (freed == unlinked) && (list_ptr->retired_count == 0)
+                      && (list_ptr->retired == NULL);
+
+    // Test 6: an offline reader, then a clear with no readers at all
+    rcu_reader_offline(reader);
+    rcu_delete(list_ptr, 5);
+    freed_early = rcu_reclaim(list_ptr);
+    rcu_reader_online(list_ptr, reader);
+    bool found = (rcu_forward_find(list_ptr, reader, 7) == 1);
+    rcu_unregister_reader(reader);
+    clear_rcu_list(list_ptr);
+    tests_status[5] = (freed_early == 1) && found && (rcu_size(list_ptr) == 0) && (list_ptr->retired_count == 0)
+                      && (rcu_values(list_ptr, arr, 16) == 0) && (rcu_register_reader(list_ptr) == reader);
+
+    destroy_rcu_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests RCU_READERS readers searching while the writer keeps replacing nodes,
+ *        and appending and deleting others
+ *
+ * This function tests if an RcuDoublyList read by several threads while it changes:
+ * 1. Lets every reader find each value which is always in the list, at its index, and
+ *    never a value which is not
+ * 2. Frees unlinked nodes while the readers are still searching
+ * 3. Frees every unlinked node with rcu_synchronize once the readers are gone
+ * 4. Holds the values which are always in the list in order, with every prev pointer
+ *    pointing back to the node before it, matching the size
+ *
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ *
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_rcu_concurrent() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RCU_CONCURRENT_NUM_TESTS);
+    RcuDoublyList* list_ptr = create_rcu_list();
+    for (int64_t i = 0; i < RCU_STABLE_VALUES; i++) {
+        rcu_append(list_ptr, i);
+    }
+    atomic_bool done;
+    atomic_int started;
+    atomic_init(&done, false);
+    atomic_init(&started, 0);
+    pthread_t threads[RCU_READERS];
+    RcuThread args[RCU_READERS];
+    for (int64_t i = 0; i < RCU_READERS; i++) {
+        args[i].list_ptr = list_ptr;
+        args[i].index = i;
+        args[i].done = &done;
+        args[i].started = &started;
+        args[i].failed = false;
+        pthread_create(&(threads[i]), NULL, rcu_read_values, &(args[i]));
+    }
+    while (atomic_load(&started) < RCU_READERS) {
+        sched_yield();
+    }
+
+    // the writer, which lets the readers run now and then even on a single core
+    int64_t most_waiting = 0;
+    for (int64_t i = 0; i < RCU_WRITES; i++) {
+        int64_t value = (i * 13) % RCU_STABLE_VALUES;
+        rcu_append(list_ptr, RCU_STABLE_VALUES + i);
+        rcu_replace(list_ptr, value, value);
+        rcu_delete(list_ptr, RCU_STABLE_VALUES + i);
+        most_waiting = (list_ptr->retired_count > most_waiting) ? list_ptr->retired_count : most_waiting;
+        if (i % 64 == 0) {
+            sched_yield();
+        }
+    }
+    atomic_store(&done, true);
+    bool failed = false;
+    for (int64_t i = 0; i < RCU_READERS; i++) {
+        pthread_join(threads[i], NULL);
+        failed = failed || args[i].failed;
+    }
+
+    // Test 1: answers seen by the readers
+    tests_status[0] = !failed;
+
+    // Test 2: nodes freed during the run
+    tests_status[1] = (most_waiting < 2 * RCU_WRITES);
+
+    // Test 3: nodes freed after the run
+    rcu_synchronize(list_ptr);
+    tests_status[2] = (list_ptr->retired_count == 0) && (list_ptr->retired == NULL);
+
+    // Test 4: values left
+    int64_t arr[RCU_STABLE_VALUES + 1];
+    int64_t count = rcu_values(list_ptr, arr, RCU_STABLE_VALUES + 1);
+    bool in_order = (count == RCU_STABLE_VALUES) && (rcu_size(list_ptr) == RCU_STABLE_VALUES);
+    for (int64_t i = 0; in_order && (i < count); i++) {
+        in_order = (arr[i] == i);
+    }
+    tests_status[3] = in_order;
+
+    destroy_rcu_list(list_ptr);
+    return tests_status;
+}
+
+/*** MappedDoublyList Unit Tests */
+
+/**
+ * @brief Returns true if walking the list file from its head, and from its tail,
+ *        gives exactly the values of the array in order.
+ */
+bool mapped_matches(MappedDoublyList* mapped_ptr, int64_t* arr, int64_t length) {
+    int64_t i = 0;
+    for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node), i++) {
+        if ((i == length) || (node->data != arr[i])) {
+            return false;
+        }
+    }
+    for (MappedNode* node = mapped_tail(mapped_ptr); node != NULL; node = mapped_prev(node)) {
+        if ((i == 0) || (node->data != arr[--i])) {
+            return false;
+        }
+    }
+    return (i == 0) && (mapped_size(mapped_ptr) == (uint64_t) length);
+}
+
+/**
+ * @brief Tests the list files of the DoublyLinkedList implementation
+ * 
+ * This function tests if a MappedDoublyList:
+ * 1. Is empty when created, and still empty once closed and opened again
+ * 2. Grows past its capacity on appends, keeping the values in order from both ends
+ * 3. Opens again with the same values, and takes more appends after mapped_sync
+ * 4. Holds the values of a DoublyLinkedList in order once written by save_mapped_list
+ * 5. Is not opened from missing files, files of another format and cut off files
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_mapped_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * MAPPED_LIST_NUM_TESTS);
+    int64_t arr[5000];
+    for (int64_t i = 0; i < 5000; i++) {
+        arr[i] = (i * 7919) % 1000 - 500;
+    }
+
+    // Test 1: empty file
+    MappedDoublyList* mapped_ptr = create_mapped_list(MAPPED_TEST_PATH, 0);
+    bool empty = (mapped_ptr != NULL) && (mapped_head(mapped_ptr) == NULL) && (mapped_tail(mapped_ptr) == NULL);
+    close_mapped_list(mapped_ptr);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[0] = empty && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 0);
+
+    // Test 2: growing
+    for (int64_t i = 0; i < 3000; i++) {
+        mapped_append(mapped_ptr, arr[i]);
+    }
+    tests_status[1] = mapped_matches(mapped_ptr, arr, 3000);
+    close_mapped_list(mapped_ptr);
+
+    // Test 3: reopening and appending again
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    bool reopened = (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 3000);
+    for (int64_t i = 3000; i < 5000; i++) {
+        mapped_append(mapped_ptr, arr[i]);
+    }
+    bool synced = mapped_sync(mapped_ptr);
+    close_mapped_list(mapped_ptr);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[2] = reopened && synced && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 5000);
+    close_mapped_list(mapped_ptr);
+
+    // Test 4: saving a list
+    DoublyLinkedList list = {0};
+    for (int64_t i = 0; i < 4321; i++) {
+        append_node(&list, arr[i]);
+    }
+    bool saved = save_mapped_list(&list, MAPPED_TEST_PATH);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[3] = saved && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 4321);
+    close_mapped_list(mapped_ptr);
+
+    // Test 5: files which are not list files
+    bool rejected = (open_mapped_list("build/missing.list") == NULL);
+    FILE* file = fopen(MAPPED_TEST_PATH, "r+b");
+    fwrite("SLLMAP01", 1, 8, file);
+    fclose(file);
+    rejected = rejected && (open_mapped_list(MAPPED_TEST_PATH) == NULL);
+    save_mapped_list(&list, MAPPED_TEST_PATH);
+    truncate(MAPPED_TEST_PATH, sizeof(MappedHeader) + 4320 * sizeof(MappedNode));
+    tests_status[4] = rejected && (open_mapped_list(MAPPED_TEST_PATH) == NULL);
+
+    clear(&list);
+    remove(MAPPED_TEST_PATH);
+    return tests_status;
+}
+
+/*** Stream Unit Tests */
+
+/**
+ * @brief Bytes of a stream kept in memory, written from the front and read
+ *        from read_at.
+ */
+typedef struct {
+    uint8_t* bytes;
+    uint64_t length;
+    uint64_t read_at;
+} TestStream;
+
+/**
+ * @brief Takes the bytes of a stream into the TestStream in context.
+ */
+bool test_stream_write(void* context, const uint8_t* bytes, uint64_t length) {
+    TestStream* stream = (TestStream *) context;
+    memcpy(stream->bytes + stream->length, bytes, length);
+    stream->length += length;
+    return true;
+}
+
+/**
+ * @brief Gives the bytes of the TestStream in context, at most 1000 at a time so
+ *        that chunks are split across reads.
+ */
+int64_t test_stream_read(void* context, uint8_t* bytes, uint64_t capacity) {
+    TestStream* stream = (TestStream *) context;
+    uint64_t length = stream->length - stream->read_at;
+    length = (length < capacity) ? length : capacity;
+    length = (length < 1000) ? length : 1000;
+    memcpy(bytes, stream->bytes + stream->read_at, length);
+    stream->read_at += length;
+    return length;
+}
+
+/**
+ * @brief Tests the stream functions of the DoublyLinkedList implementation
+ * 
+ * This function tests if encode_list and decode_list:
+ * 1. Write an empty list as the magic bytes and an empty chunk, and read it back as empty
+ * 2. Read extreme values and the largest differences between them back exactly
+ * 3. Read a list spanning many chunks back through a file, appending to the values already there
+ * 4. Reject streams with the wrong magic bytes, cut off streams, and failed reads
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_stream() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * STREAM_NUM_TESTS);
+    int64_t length = 100000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * (length + 8));
+    TestStream stream = {(uint8_t *) malloc(STREAM_VARINT_BYTES * length + 64), 0, 0};
+
+    // Test 1: empty list
+    DoublyLinkedList list = {0};
+    DoublyLinkedList decoded = {0};
+    bool written = encode_list(&list, test_stream_write, &stream);
+    tests_status[0] = written && (stream.length == 6) && (memcmp(stream.bytes, STREAM_MAGIC, 4) == 0)
+                      && decode_list(&decoded, test_stream_read, &stream) && is_empty(&decoded);
+
+    // Test 2: extremes
+    int64_t extremes[8] = {INT64_MIN, INT64_MAX, INT64_MIN, 0, -1, INT64_MAX, INT64_MAX, 1};
+    for (int i = 0; i < 8; i++) {
+        append_node(&list, extremes[i]);
+        arr[i] = extremes[i];
+    }
+    stream.length = 0;
+    stream.read_at = 0;
+    written = encode_list(&list, test_stream_write, &stream);
+    tests_status[1] = written && decode_list(&decoded, test_stream_read, &stream) && list_matches(&decoded, arr, 8);
+    clear(&list);
+
+    // Test 3: many chunks through a file, after the extremes
+    srand(14);
+    for (int64_t i = 8; i < length + 8; i++) {
+        arr[i] = (i % 2 == 0) ? i : (int64_t) (((uint64_t) rand() << 33) ^ (uint64_t) rand());
+        append_node(&list, arr[i]);
+    }
+    FILE* file = fopen(STREAM_TEST_PATH, "w+b");
+    written = encode_list_fd(&list, fileno(file));
+    lseek(fileno(file), 0, SEEK_SET);
+    tests_status[2] = written && decode_list_fd(&decoded, fileno(file)) && list_matches(&decoded, arr, length + 8);
+    fclose(file);
+    remove(STREAM_TEST_PATH);
+    clear(&decoded);
+
+    // Test 4: malformed streams and failed reads
+    stream.length = 0;
+    encode_list(&list, test_stream_write, &stream);
+    uint64_t full_length = stream.length;
+    stream.read_at = 0;
+    stream.length = full_length - 1;
+    bool cut_off = !decode_list(&decoded, test_stream_read, &stream);
+    clear(&decoded);
+    stream.bytes[0] = 'X';
+    stream.read_at = 0;
+    stream.length = full_length;
+    bool bad_magic = !decode_list(&decoded, test_stream_read, &stream) && is_empty(&decoded);
+    // reading from a file descriptor which is not open fails
+    tests_status[3] = cut_off && bad_magic && !decode_list_fd(&decoded, -1) && is_empty(&decoded);
+
+    clear(&list);
+    clear(&decoded);
+    free(stream.bytes);
+    free(arr);
+    return tests_status;
+}
+
+/*** XorDoublyList Unit Tests */
+
+/**
+ * @brief Returns true if walking the list with cursors from its head, and from its
+ *        tail, gives exactly the values of the array in order.
+ */
+bool xor_matches(XorDoublyList* list_ptr, int64_t* arr, int64_t length) {
+    int64_t i = 0;
+    XorCursor cursor = xor_cursor_head(list_ptr);
+    while (cursor.node != NULL) {
+        if ((i == length) || (cursor.node->data != arr[i])) {
+            return false;
+        }
+        i++;
+        xor_cursor_next(&cursor);
+    }
+    if (i != length) {
+        return false;
+    }
+    cursor = xor_cursor_tail(list_ptr);
+    while (cursor.node != NULL) {
+        if ((i == 0) || (cursor.node->data != arr[--i])) {
+            return false;
+        }
+        if (!xor_cursor_prev(&cursor)) {
+            break;
+        }
+    }
+    return (i == 0) && (xor_size(list_ptr) == length);
+}
+
+/**
+ * @brief Tests the XorDoublyList implementation
+ * 
+ * This function tests if an XorDoublyList:
+ * 1. Is empty when created, with no nodes from either end
+ * 2. Keeps the values in order from both ends after appends and prepends
+ * 3. Finds the first value from the head, the last from the tail, and misses absent values
+ * 4. Inserts between two nodes, and at both ends, with a cursor
+ * 5. Deletes the first, last and a middle node, and reuses deleted nodes
+ * 6. Reverses in place, and is empty again once cleared
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_xor_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * XOR_LIST_NUM_TESTS);
+    int64_t arr[2000];
+
+    // Test 1: empty list
+    XorDoublyList* list_ptr = create_xor_list(16);
+    XorCursor head = xor_cursor_head(list_ptr);
+    XorCursor tail = xor_cursor_tail(list_ptr);
+    tests_status[0] = (list_ptr != NULL) && (head.node == NULL) && (tail.node == NULL)
+                      && (xor_forward_find(list_ptr, 0) == -1) && xor_matches(list_ptr, arr, 0);
+
+    // Test 2: appends and prepends, over many slabs
+    for (int64_t i = 0; i < 1000; i++) {
+        xor_append(list_ptr, i);
+        xor_prepend(list_ptr, -i - 1);
+    }
+    for (int64_t i = 0; i < 2000; i++) {
+        arr[i] = i - 1000;
+    }
+    tests_status[1] = xor_matches(list_ptr, arr, 2000) && (list_ptr->num_slabs == 2000 / 16);
+
+    // Test 3: finding
+    xor_append(list_ptr, -1000);
+    arr[2000 - 1] = 999;
+    tests_status[2] = (xor_forward_find(list_ptr, -1000) == 0) && (xor_backward_find(list_ptr, -1000) == 0)
+                      && (xor_forward_find(list_ptr, 5) == 1005) && (xor_backward_find(list_ptr, 5) == 995)
+                      && (xor_forward_find(list_ptr, 4000) == -1) && (xor_backward_find(list_ptr, 4000) == -1);
+    xor_delete_last(list_ptr);
+
+    // Test 4: inserting between nodes with a cursor
+    clear_xor_list(list_ptr);
+    XorCursor cursor = xor_cursor_head(list_ptr);
+    xor_insert_between(list_ptr, &cursor, 2);
+    cursor = xor_cursor_head(list_ptr);
+    xor_insert_between(list_ptr, &cursor, 0);
+    xor_insert_between(list_ptr, &cursor, 1);
+    bool kept = (cursor.node->data == 2) && (cursor.prev->data == 1);
+    xor_cursor_next(&cursor);
+    xor_insert_between(list_ptr, &cursor, 3);
+    for (int64_t i = 0; i < 4; i++) {
+        arr[i] = i;
+    }
+    tests_status[3] = kept && xor_matches(list_ptr, arr, 4);
+
+    // Test 5: deleting
+    uint64_t slabs = list_ptr->num_slabs;
+    xor_delete_first(list_ptr);
+    xor_delete_last(list_ptr);
+    cursor = xor_cursor_head(list_ptr);
+    xor_cursor_delete(list_ptr, &cursor);
+    bool middle = (cursor.node != NULL) && (cursor.node->data == 2) && (cursor.prev == NULL);
+    arr[0] = 2;
+    bool deleted = middle && xor_matches(list_ptr, arr, 1);
+    xor_cursor_delete(list_ptr, &cursor);
+    deleted = deleted && (cursor.node == NULL) && (list_ptr->head == NULL) && (list_ptr->tail == NULL);
+    xor_delete_first(list_ptr);
+    xor_delete_last(list_ptr);
+    for (int64_t i = 0; i < 4; i++) {
+        xor_append(list_ptr, i);
+    }
+    tests_status[4] = deleted && (xor_size(list_ptr) == 4) && (list_ptr->num_slabs == slabs);
+
+    // Test 6: reversing and clearing
+    xor_reverse_list(list_ptr);
+    xor_append(list_ptr, -1);
+    int64_t reversed[5] = {3, 2, 1, 0, -1};
+    bool reverse = xor_matches(list_ptr, reversed, 5);
+    clear_xor_list(list_ptr);
+    tests_status[5] = reverse && (list_ptr->slabs == NULL) && xor_matches(list_ptr, arr, 0);
+
+    destroy_xor_list(list_ptr);
+    return tests_status;
+}
+
+/*** ArenaDoublyList Unit Tests */
+
+/**
+ * @brief Returns true if walking the ArenaDoublyList from its head, and from its tail,
+ *        gives exactly the values of the array in order.
+ */
+bool arena_matches(ArenaDoublyList* arena_ptr, int64_t* arr, int64_t length) {
+    int64_t i = 0;
+    for (uint32_t at = arena_head(arena_ptr); at != ARENA_NIL; at = arena_next(arena_ptr, at), i++) {
+        if ((i == length) || (arena_data(arena_ptr, at) != arr[i])) {
+            return false;
+        }
+    }
+    for (uint32_t at = arena_tail(arena_ptr); at != ARENA_NIL; at = arena_prev(arena_ptr, at)) {
+        if ((i == 0) || (arena_data(arena_ptr, at) != arr[--i])) {
+            return false;
+        }
+    }
+    return (i == 0) && (arena_size(arena_ptr) == (uint32_t) length);
+}
+
+/**
+ * @brief Tests the ArenaDoublyList implementation
+ * 
+ * This function tests if an ArenaDoublyList:
+ * 1. Takes 16 bytes per node, and is empty when created
+ * 2. Grows past its capacity on appends and prepends, keeping the values in order from both ends
+ * 3. Finds the first value from the head, the last from the tail, and misses absent values
+ * 4. Inserts between nodes and deletes nodes anywhere, reusing deleted slots before growing
+ * 5. Holds the same values once built from a DoublyLinkedList, and once copied with memcpy,
+ *    where the copy is not changed by the original
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_arena_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * ARENA_LIST_NUM_TESTS);
+    int64_t arr[3000];
+
+    // Test 1: empty list
+    ArenaDoublyList* arena_ptr = create_arena_list(4);
+    tests_status[0] = (sizeof(ArenaNode) == 16) && (arena_head(arena_ptr) == ARENA_NIL)
+                      && (arena_tail(arena_ptr) == ARENA_NIL) && arena_matches(arena_ptr, arr, 0);
+
+    // Test 2: growing
+    for (int64_t i = 0; i < 1000; i++) {
+        arena_append(arena_ptr, i);
+        arena_prepend(arena_ptr, -i - 1);
+    }
+    for (int64_t i = 0; i < 2000; i++) {
+        arr[i] = i - 1000;
+    }
+    tests_status[1] = arena_matches(arena_ptr, arr, 2000) && (arena_ptr->capacity == 2048);
+
+    // Test 3: finding
+    arena_append(arena_ptr, -1000);
+    tests_status[2] = (arena_forward_find(arena_ptr, -1000) == 0) && (arena_backward_find(arena_ptr, -1000) == 0)
+                      && (arena_forward_find(arena_ptr, 5) == 1005) && (arena_backward_find(arena_ptr, 5) == 995)
+                      && (arena_forward_find(arena_ptr, 4000) == -1) && (arena_backward_find(arena_ptr, 4000) == -1);
+
+    // Test 4: inserting and deleting
+    clear_arena_list(arena_ptr);
+    uint32_t ends[2];
+    ends[0] = arena_insert_between(arena_ptr, ARENA_NIL, ARENA_NIL, 0);
+    ends[1] = arena_insert_between(arena_ptr, ends[0], ARENA_NIL, 3);
+    uint32_t middle = arena_insert_between(arena_ptr, ends[0], ends[1], 1);
+    arena_insert_between(arena_ptr, middle, ends[1], 2);
+    arena_prepend(arena_ptr, -1);
+    int64_t changed[4] = {0, 1, 2, 3};
+    bool inserted = (arena_forward_find(arena_ptr, -1) == 0);
+    arena_delete_first(arena_ptr);
+    inserted = inserted && arena_matches(arena_ptr, changed, 4);
+    arena_delete(arena_ptr, middle);
+    arena_delete_last(arena_ptr);
+    arena_delete(arena_ptr, ends[0]);
+    bool deleted = (arena_head(arena_ptr) == arena_tail(arena_ptr)) && (arena_data(arena_ptr, arena_head(arena_ptr)) == 2);
+    arena_delete_first(arena_ptr);
+    deleted = deleted && arena_matches(arena_ptr, changed, 0);
+    for (int64_t i = 0; i < 4; i++) {
+        arena_append(arena_ptr, i);
+    }
+    tests_status[3] = inserted && deleted && arena_matches(arena_ptr, changed, 4) && (arena_ptr->used == 5);
+
+    // Test 5: copies
+    DoublyLinkedList list = {0};
+    for (int64_t i = 0; i < 3000; i++) {
+        arr[i] = (i * 7919) % 1000 - 500;
+        append_node(&list, arr[i]);
+    }
+    ArenaDoublyList* from_ptr = arena_from_list(&list);
+    ArenaDoublyList* copy_ptr = arena_copy(arena_ptr);
+    arena_delete_first(arena_ptr);
+    arena_append(arena_ptr, 4);
+    tests_status[4] = arena_matches(from_ptr, arr, 3000) && (from_ptr->used == 3000)
+                      && arena_matches(copy_ptr, changed, 4) && (arena_forward_find(arena_ptr, 4) == 3);
+    clear(&list);
+    destroy_arena_list(from_ptr);
+    destroy_arena_list(copy_ptr);
+
+    destroy_arena_list(arena_ptr);
+    return tests_status;
+}
+
+/*** Generic List Unit Tests */
+
+/**
+ * @struct Point
+ * @brief A 16-byte element, stored inline in the nodes of a PointList.
+ */
+typedef struct {
+    int64_t x;               /**< The first coordinate */
+    int64_t y;               /**< The second coordinate */
+} Point;
+
+/**
+ * @brief Returns true if both points have the same coordinates.
+ */
+static inline bool point_equal(const Point* a, const Point* b) {
+    return (a->x == b->x) && (a->y == b->y);
+}
+
+/**
+ * @brief Mixes both coordinates of the point into a hash.
+ */
+static inline uint64_t point_hash(const Point* point) {
+    uint64_t h = ((uint64_t) point->x * 0x9E3779B97F4A7C15ULL) ^ (uint64_t) point->y;
+    return h ^ (h >> 29);
+}
+
+// integers compared with a macro, and hashed onto 4 home slots so that most keys collide
+#define int_equal(a, b) (*(a) == *(b))
+#define int_collide(a) ((uint64_t) (*(a) & 3))
+
+DEFINE_DOUBLY_LIST(PointList, point_list, Point, point_equal, point_hash)
+DEFINE_DOUBLY_LIST(IntList, int_list, int64_t, int_equal, int_collide)
+
+/**
+ * @brief Returns true if walking the PointList from both ends gives exactly the points
+ *        (i, -i) for i from first to first + length - 1.
+ */
+bool point_list_matches(PointList* list_ptr, int64_t first, uint64_t length) {
+    int64_t i = first;
+    for (PointListNode* node = list_ptr->head; node != NULL; node = node->next) {
+        if ((node->data.x != i) || (node->data.y != -i)) {
+            return false;
+        }
+        i++;
+    }
+    for (PointListNode* node = list_ptr->tail; node != NULL; node = node->prev) {
+        i--;
+        if (node->data.x != i) {
+            return false;
+        }
+    }
+    return (i == first) && (list_ptr->size == length);
+}
+
+/**
+ * @brief Returns true if int_list_contains, with or without the hash index, agrees with
+ *        a scan of the list for every value in [0, limit).
+ */
+bool int_list_consistent(IntList* list_ptr, int64_t limit) {
+    for (int64_t i = 0; i < limit; i++) {
+        bool scanned = false;
+        for (IntListNode* node = list_ptr->head; node != NULL; node = node->next) {
+            scanned = scanned || (node->data == i);
+        }
+        if (int_list_contains(list_ptr, &i) != scanned) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tests the lists made by DEFINE_DOUBLY_LIST
+ * 
+ * This function tests if a list of 16-byte Points, and a list of integers:
+ * 1. Store the points inline in 32-byte nodes, and are empty when zeroed
+ * 2. Keep the points in order from both ends on appends and prepends
+ * 3. Find points with point_equal from the head and from the tail, and miss absent points
+ * 4. Unlink the right nodes on delete_first, delete_last and delete_node
+ * 5. Keep the hash index in agreement with a scan through appends, duplicates and deletes,
+ *    even when most values share a home slot, and free it on clear
+ * 
+ * It allocates memory for an array of test results, which should be freed by the caller.
+ * 
+ * @return An array of boolean values indicating success (true) or failure (false) for each test
+ */
+bool* test_generic_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * GENERIC_LIST_NUM_TESTS);
+    PointList points = {0};
+    Point point = {1, -1};
+
+    // Test 1: empty list
+    tests_status[0] = (sizeof(PointListNode) == 32) && point_list_is_empty(&points)
+                      && (point_list_forward_find(&points, &point) == -1) && !point_list_contains(&points, &point)
+                      && point_list_matches(&points, 0, 0);
+
+    // Test 2: appending and prepending
+    for (int64_t i = 0; i < 100; i++) {
+        point = (Point) {i, -i};
+        point_list_append(&points, &point);
+        point = (Point) {-i - 1, i + 1};
+        point_list_prepend(&points, &point);
+    }
+    tests_status[1] = point_list_matches(&points, -100, 200);
+
+    // Test 3: finding
+    point = (Point) {5, -5};
+    point_list_append(&points, &point);
+    Point other = {5, 5};
+    tests_status[2] = (point_list_forward_find(&points, &point) == 105)
+                      && (point_list_backward_find(&points, &point) == 0)
+                      && (point_list_forward_find(&points, &other) == -1)
+                      && (point_list_backward_find(&points, &other) == -1)
+                      && point_list_contains(&points, &point) && !point_list_contains(&points, &other);
+
+    // Test 4: deleting
+    point_list_delete_last(&points);
+    point_list_delete_last(&points);
+    point_list_delete_first(&points);
+    bool ends = point_list_matches(&points, -99, 198);
+    point_list_delete_node(&points, points.head->next);
+    tests_status[3] = ends && (points.head->next->data.x == -97) && (points.head->next->prev == points.head)
+                      && (points.size == 197) && (points.tail->data.x == 98);
+
+    // Test 5: hash index
+    IntList ints = {0};
+    point = (Point) {0, 0};
+    bool indexed = point_list_enable_hash_index(&points) && point_list_contains(&points, &point)
+                   && (point_list_backward_find(&points, &point) == 98)
+                   && (point_list_forward_find(&points, &other) == -1);
+    for (int64_t i = 0; i < 60; i++) {
+        int64_t value = (i * 7) % 40;
+        int_list_append(&ints, &value);
+    }
+    bool consistent = int_list_consistent(&ints, 50) && int_list_enable_hash_index(&ints)
+                      && (ints.used == 40) && int_list_consistent(&ints, 50);
+    for (int64_t i = 0; i < 30; i++) {
+        if (i % 2 == 0) {
+            int_list_delete_first(&ints);
+        } else {
+            int_list_delete_last(&ints);
+        }
+        consistent = consistent && int_list_consistent(&ints, 50);
+    }
+    point_list_clear(&points);
+    int_list_clear(&ints);
+    tests_status[4] = indexed && consistent && point_list_is_empty(&points) && (points.slots == NULL)
+                      && (ints.slots == NULL) && (ints.tail == NULL);
+
+    return tests_status;
+}
+
+/*** Helper Functions */
+
+/**
+ * @brief Displays the results of unit test functions
+ *
+ * This function processes an array of test results and displays whether tests passed or failed.
+ * It can show detailed results for each individual test when verbose mode is enabled,
+ * and always displays a summary message indicating overall test success or failure.
+ *
+ * @param tests_status Pointer to a boolean array containing test results (PASS/FAIL)
+ * @param num_tests The number of test results in the array
+ * @param verbose If true, displays detailed results for each individual test
+ */
+void display_test_results(bool* tests_status, int8_t num_tests, bool verbose) {
+    bool all_passed = true;
+    for (int8_t i = 0; i < num_tests; i++) {
+        if (tests_status[i] == PASS) {
+            if (verbose) {
+                printf("Test %d passed", i + 1);
+            }
+        } else {
+            if (verbose) {
+                printf("Test %d failed\n", i + 1);
+            }
+            all_passed = false;
+        }
+    }
+    if (all_passed) {
+        printf("All tests passed!\n");
+    } else {
+        printf("Some tests failed!\n");
+    }
+}
+
+/*** Program Starting Point */
+int main() {
+    bool* tests_status = test_dangling_node();
+    printf("Testing dangling_node function: ");
+    display_test_results(tests_status, DANGLING_NODE_NUM_TESTS, false);
+    free(tests_status);
+    
+    tests_status = test_next_node();
+    printf("Testing next_node function: ");
+    display_test_results(tests_status, NEXT_NODE_NUM_TESTS, false);
+    free(tests_status);
+    
+    tests_status = test_prev_node();
+    printf("Testing prev_node function: ");
+    display_test_results(tests_status, PREV_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_between_node();
+    printf("Testing between_node function: ");
+    display_test_results(tests_status, BETWEEN_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_node_pool();
+    printf("Testing node_pool functions: ");
+    display_test_results(tests_status, NODE_POOL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_attach_pool();
+    printf("Testing attach_pool function: ");
+    display_test_results(tests_status, ATTACH_POOL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_hash_index();
+    printf("Testing hash_index functions: ");
+    display_test_results(tests_status, HASH_INDEX_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_find();
+    printf("Testing find functions: ");
+    display_test_results(tests_status, FIND_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_radix_sort_list();
+    printf("Testing radix_sort_list function: ");
+    display_test_results(tests_status, RADIX_SORT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_compact();
+    printf("Testing compaction functions: ");
+    display_test_results(tests_status, COMPACT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_splice();
+    printf("Testing splice functions: ");
+    display_test_results(tests_status, SPLICE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_batch();
+    printf("Testing batch functions: ");
+    display_test_results(tests_status, BATCH_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_positional();
+    printf("Testing positional functions: ");
+    display_test_results(tests_status, POSITIONAL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_parallel();
+    printf("Testing parallel functions: ");
+    display_test_results(tests_status, PARALLEL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_stats();
+    printf("Testing instrumentation: ");
+    display_test_results(tests_status, STATS_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_mapped_list();
+    printf("Testing mapped_list functions: ");
+    display_test_results(tests_status, MAPPED_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_stream();
+    printf("Testing stream functions: ");
+    display_test_results(tests_status, STREAM_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_xor_list();
+    printf("Testing xor_list functions: ");
+    display_test_results(tests_status, XOR_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_arena_list();
+    printf("Testing arena_list functions: ");
+    display_test_results(tests_status, ARENA_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_generic_list();
+    printf("Testing generic_list functions: ");
+    display_test_results(tests_status, GENERIC_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_locked_list();
+    printf("Testing locked_list functions: ");
+    display_test_results(tests_status, LOCKED_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_locked_concurrent();
+    printf("Testing locked_list functions from many threads: ");
+    display_test_results(tests_status, LOCKED_CONCURRENT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_rcu_list();
+    printf("Testing rcu_list functions: ");
+    display_test_results(tests_status, RCU_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_rcu_concurrent();
+    printf("Testing rcu_list functions from many threads: ");
+    display_test_results(tests_status, RCU_CONCURRENT_NUM_TESTS, false);
     free(tests_status);
     
     return 0;
@@ -0,0 +1,145 @@
+/*
+This file is used to measure how the LockFreeList scales with the number of
+threads, against a SinglyLinkedList with one mutex around every call, for a
+mix of 80% contains, 10% append and 10% delete by value.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<pthread.h>
+#include<stdint.h>
+#include<stdio.h>
+#include"lockfree-linked.h"
+#include"../singly/singly-linked.h"
+#include"../bench/bench-harness.h"
+
+/*** Constants ***/
+#define LOCKFREE_NAME "LockFreeList"
+#define MUTEX_NAME "SinglyLinkedList+mutex"
+// the number of operations each thread runs in one sample
+#define OPS_PER_THREAD 256
+// list sizes are kept small since every operation is O(n)
+#define DEFAULT_MAX_SIZE 1000
+
+// keeps the compiler from throwing away the results of measured calls
+volatile int64_t sink;
+
+/**
+ * @brief The lists shared by the threads of a sample: a LockFreeList, or a
+ *        SinglyLinkedList with the one global mutex the service used to need,
+ *        and the size the list was built with.
+ */
+typedef struct {
+    LockFreeList* lockfree_ptr;
+    SinglyLinkedList* list_ptr;
+    pthread_mutex_t lock;
+    uint64_t length;
+} SharedList;
+
+/*** Workers ***/
+
+/**
+ * @brief Runs the mix of operations on the LockFreeList. Lookups draw values
+ *        from twice the size of the list so that half of them miss. Every
+ *        thread deletes the value it appended last, so the size stays put.
+ */
+void lockfree_worker(BenchThread* thread) {
+    SharedList* shared = (SharedList *) thread->arg;
+    uint64_t range = 2 * shared->length;
+    int64_t appended = -1;
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        uint64_t roll = bench_thread_random(thread) % 10;
+        int64_t value = bench_thread_random(thread) % range;
+        if ((roll == 0) && (appended == -1)) {
+            lockfree_append(shared->lockfree_ptr, value);
+            appended = value;
+        } else if ((roll == 1) && (appended != -1)) {
+            sink = lockfree_delete(shared->lockfree_ptr, appended);
+            appended = -1;
+        } else {
+            sink = lockfree_contains(shared->lockfree_ptr, value);
+        }
+    }
+    if (appended != -1) {
+        lockfree_delete(shared->lockfree_ptr, appended);
+    }
+    lockfree_thread_exit();
+}
+
+/**
+ * @brief Runs the same mix on the SinglyLinkedList, holding the mutex for every call.
+ */
+void mutex_worker(BenchThread* thread) {
+    SharedList* shared = (SharedList *) thread->arg;
+    uint64_t range = 2 * shared->length;
+    int64_t appended = -1;
+    for (uint64_t i = 0; i < thread->ops; i++) {
+        uint64_t roll = bench_thread_random(thread) % 10;
+        int64_t value = bench_thread_random(thread) % range;
+        pthread_mutex_lock(&(shared->lock));
+        if ((roll == 0) && (appended == -1)) {
+            append_node(shared->list_ptr, value);
+            appended = value;
+        } else if ((roll == 1) && (appended != -1)) {
+            delete_node(shared->list_ptr, find(shared->list_ptr, appended));
+            appended = -1;
+        } else {
+            sink = contains(shared->list_ptr, value);
+        }
+        pthread_mutex_unlock(&(shared->lock));
+    }
+    if (appended != -1) {
+        pthread_mutex_lock(&(shared->lock));
+        delete_node(shared->list_ptr, find(shared->list_ptr, appended));
+        pthread_mutex_unlock(&(shared->lock));
+    }
+}
+
+/*** Benchmarks ***/
+
+/**
+ * @brief Measures both lists at the given size for 1, 2, 4, ... BENCH_MAX_THREADS threads.
+ */
+void bench_scaling(uint64_t length) {
+    char operation[32];
+    for (uint64_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2) {
+        snprintf(operation, sizeof(operation), "mixed_t%lu", threads);
+
+        SharedList shared;
+        shared.length = length;
+        shared.lockfree_ptr = create_lockfree_list();
+        shared.list_ptr = create_empty_list();
+        pthread_mutex_init(&(shared.lock), NULL);
+        for (uint64_t i = 0; i < length; i++) {
+            lockfree_append(shared.lockfree_ptr, 2 * i);
+            append_node(shared.list_ptr, 2 * i);
+        }
+
+        BenchSamples* samples = bench_start();
+        while (bench_add_threaded_sample(samples, threads, OPS_PER_THREAD, lockfree_worker, &shared));
+        bench_report(samples, LOCKFREE_NAME, operation, length);
+
+        samples = bench_start();
+        while (bench_add_threaded_sample(samples, threads, OPS_PER_THREAD, mutex_worker, &shared));
+        bench_report(samples, MUTEX_NAME, operation, length);
+
+        pthread_mutex_destroy(&(shared.lock));
+        destroy_lockfree_list(shared.lockfree_ptr);
+        destroy_list(shared.list_ptr);
+    }
+}
+
+/*** Program Starting Point */
+int main(int argc, char** argv) {
+    uint64_t max_size = (argc < 2) ? DEFAULT_MAX_SIZE : bench_max_size(argc, argv);
+    if (!bench_open_csv(BENCH_CSV_PATH)) {
+        printf("Could not open %s, results are only printed.\n", BENCH_CSV_PATH);
+    }
+    bench_seed(12);
+    for (uint64_t length = 10; length <= max_size; length *= 10) {
+        bench_scaling(length);
+    }
+    bench_close_csv();
+    return 0;
+}
@@ -0,0 +1,344 @@
+/*
+This document is meant to store the implementation of the lock-free singly
+linked list. Nodes are linked with compare-and-swap on their next pointers,
+deleted nodes are marked in the lowest bit of their next pointer before they
+are unlinked (Harris' algorithm), and unlinked nodes are only freed once no
+thread holds a hazard pointer to them (Michael's hazard pointers).
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<sched.h>
+#include<stdint.h>
+#include<stdlib.h>
+#include"lockfree-linked.h"
+
+/*** Constants ***/
+#define MARK ((uintptr_t) 1)
+#define HAZARD_PREV 0
+#define HAZARD_CURR 1
+#define HAZARD_NEXT 2
+
+/*** Globals ***/
+static _Atomic(HazardRecord*) records = NULL;
+static atomic_uint_fast64_t num_records = 0;
+static atomic_uint_fast64_t num_pending = 0;
+static atomic_uint_fast64_t num_freed = 0;
+static _Thread_local HazardRecord* thread_record = NULL;
+
+/*** Helper Functions ***/
+
+static bool is_marked(uintptr_t next) {
+    return (next & MARK) != 0;
+}
+
+static LockFreeNode* unmarked(uintptr_t next) {
+    return (LockFreeNode *) (next & ~MARK);
+}
+
+static void protect(HazardRecord* record, int slot, LockFreeNode* node) {
+    atomic_store(&(record->hazards[slot]), node);
+}
+
+static void clear_hazards(HazardRecord* record) {
+    for (int slot = 0; slot < HAZARDS_PER_THREAD; slot++) {
+        atomic_store(&(record->hazards[slot]), NULL);
+    }
+}
+
+/**
+ * @brief Returns the hazard record of the calling thread, taking a record
+ *        given back by an exited thread, or adding a new one, on first use.
+ */
+static HazardRecord* hazard_record() {
+    if (thread_record != NULL) {
+        return thread_record;
+    }
+    for (HazardRecord* record = atomic_load(&records); record != NULL; record = record->next) {
+        bool expected = false;
+        if (!atomic_load(&(record->active)) && atomic_compare_exchange_strong(&(record->active), &expected, true)) {
+            thread_record = record;
+            return record;
+        }
+    }
+    HazardRecord* record = (HazardRecord *) calloc(1, sizeof(HazardRecord));
+    atomic_init(&(record->active), true);
+    HazardRecord* head = atomic_load(&records);
+    do {
+        record->next = head;
+    } while (!atomic_compare_exchange_weak(&records, &head, record));
+    atomic_fetch_add(&num_records, 1);
+    thread_record = record;
+    return record;
+}
+
+static int compare_pointers(const void* a, const void* b) {
+    uintptr_t x = (uintptr_t) *((LockFreeNode* const *) a);
+    uintptr_t y = (uintptr_t) *((LockFreeNode* const *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Frees every node retired by the record which no hazard pointer of
+ *        any thread points to, and keeps the others for a later scan.
+ */
+static void scan(HazardRecord* record) {
+    uint64_t capacity = atomic_load(&num_records) * HAZARDS_PER_THREAD;
+    LockFreeNode** hazards = (LockFreeNode **) malloc(sizeof(LockFreeNode*) * capacity);
+    uint64_t num_hazards = 0;
+    for (HazardRecord* other = atomic_load(&records); other != NULL; other = other->next) {
+        for (int slot = 0; slot < HAZARDS_PER_THREAD; slot++) {
+            LockFreeNode* hazard = atomic_load(&(other->hazards[slot]));
+            if (hazard == NULL) {
+                continue;
+            }
+            // records may have been added since num_records was read
+            if (num_hazards == capacity) {
+                capacity *= 2;
+                hazards = (LockFreeNode **) realloc(hazards, sizeof(LockFreeNode*) * capacity);
+            }
+            hazards[num_hazards++] = hazard;
+        }
+    }
+    qsort(hazards, num_hazards, sizeof(LockFreeNode*), compare_pointers);
+    uint64_t kept = 0;
+    for (uint64_t i = 0; i < record->num_retired; i++) {
+        LockFreeNode* node = record->retired[i];
+        if (bsearch(&node, hazards, num_hazards, sizeof(LockFreeNode*), compare_pointers) != NULL) {
+            record->retired[kept++] = node;
+        } else {
+            free(node);
+        }
+    }
+    atomic_fetch_sub(&num_pending, record->num_retired - kept);
+    atomic_fetch_add(&num_freed, record->num_retired - kept);
+    record->num_retired = kept;
+    free(hazards);
+}
+
+/**
+ * @brief Hands a node which was just unlinked from the list to the record,
+ *        to be freed once no thread can still be using it. If the tail hint
+ *        of the list points to the node, it is moved back to the sentinel so
+ *        no thread can find the node through it anymore.
+ */
+static void retire(LockFreeList* list_ptr, HazardRecord* record, LockFreeNode* node) {
+    LockFreeNode* expected = node;
+    atomic_compare_exchange_strong(&(list_ptr->tail), &expected, &(list_ptr->head));
+    if (record->num_retired == record->retired_capacity) {
+        record->retired_capacity = (record->retired_capacity == 0) ? RETIRE_SCAN_THRESHOLD : 2 * record->retired_capacity;
+        record->retired = (LockFreeNode **) realloc(record->retired, sizeof(LockFreeNode*) * record->retired_capacity);
+    }
+    record->retired[record->num_retired++] = node;
+    atomic_fetch_add(&num_pending, 1);
+    if (record->num_retired >= RETIRE_SCAN_THRESHOLD + 2 * HAZARDS_PER_THREAD * atomic_load(&num_records)) {
+        scan(record);
+    }
+}
+
+/**
+ * @brief Moves the tail hint from tail to node, which the caller protects with
+ *        a hazard pointer. If node was deleted meanwhile, the hint is moved back
+ *        to the sentinel, so that it never points to a retired node once the
+ *        caller drops its hazard pointer.
+ */
+static void advance_tail(LockFreeList* list_ptr, LockFreeNode* tail, LockFreeNode* node) {
+    if (atomic_compare_exchange_strong(&(list_ptr->tail), &tail, node) && is_marked(atomic_load(&(node->next)))) {
+        LockFreeNode* expected = node;
+        atomic_compare_exchange_strong(&(list_ptr->tail), &expected, &(list_ptr->head));
+    }
+}
+
+/**
+ * @brief Searches the list for the first node holding data, unlinking every
+ *        marked node on the way. Returns true if it was found, in which case
+ *        prev_out and curr_out are set to it and the node before it, both
+ *        protected by the hazard pointers of the record.
+ */
+static bool search(LockFreeList* list_ptr, HazardRecord* record, int64_t data,
+                   LockFreeNode** prev_out, LockFreeNode** curr_out) {
+    while (true) {
+        LockFreeNode* prev = &(list_ptr->head);
+        LockFreeNode* curr = unmarked(atomic_load(&(prev->next)));
+        // prev and curr take turns in the first two slots, so that moving forward
+        // only publishes one hazard pointer per node
+        int curr_slot = HAZARD_CURR;
+        bool restart = false;
+        while (curr != NULL) {
+            protect(record, curr_slot, curr);
+            // curr is only safe to read if prev still links to it
+            if (atomic_load(&(prev->next)) != (uintptr_t) curr) {
+                restart = true;
+                break;
+            }
+            uintptr_t next = atomic_load(&(curr->next));
+            if (is_marked(next)) {
+                uintptr_t expected = (uintptr_t) curr;
+                if (!atomic_compare_exchange_strong(&(prev->next), &expected, (uintptr_t) unmarked(next))) {
+                    restart = true;
+                    break;
+                }
+                retire(list_ptr, record, curr);
+            } else if (curr->data == data) {
+                *prev_out = prev;
+                *curr_out = curr;
+                return true;
+            } else {
+                prev = curr;
+                curr_slot = (curr_slot == HAZARD_CURR) ? HAZARD_PREV : HAZARD_CURR;
+            }
+            curr = unmarked(next);
+        }
+        if (!restart) {
+            return false;
+        }
+    }
+}
+
+/*** LockFreeList Functions ***/
+
+LockFreeList* create_lockfree_list() {
+    LockFreeList* list_ptr = (LockFreeList *) malloc(sizeof(LockFreeList));
+    if (list_ptr == NULL) {
+        return NULL;
+    }
+    list_ptr->head.data = 0;
+    atomic_init(&(list_ptr->head.next), 0);
+    atomic_init(&(list_ptr->tail), &(list_ptr->head));
+    atomic_init(&(list_ptr->size), 0);
+    return list_ptr;
+}
+
+void destroy_lockfree_list(LockFreeList* list_ptr) {
+    LockFreeNode* node = unmarked(atomic_load(&(list_ptr->head.next)));
+    while (node != NULL) {
+        LockFreeNode* next = unmarked(atomic_load(&(node->next)));
+        free(node);
+        node = next;
+    }
+    free(list_ptr);
+}
+
+uint64_t lockfree_size(LockFreeList* list_ptr) {
+    return atomic_load(&(list_ptr->size));
+}
+
+bool lockfree_contains(LockFreeList* list_ptr, int64_t data) {
+    HazardRecord* record = hazard_record();
+    LockFreeNode* prev;
+    LockFreeNode* curr;
+    bool found = search(list_ptr, record, data, &prev, &curr);
+    clear_hazards(record);
+    return found;
+}
+
+bool lockfree_append(LockFreeList* list_ptr, int64_t data) {
+    LockFreeNode* node = (LockFreeNode *) malloc(sizeof(LockFreeNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    atomic_init(&(node->next), 0);
+    HazardRecord* record = hazard_record();
+    // another thread may delete the new node as soon as it is linked
+    protect(record, HAZARD_NEXT, node);
+    while (true) {
+        LockFreeNode* tail = atomic_load(&(list_ptr->tail));
+        protect(record, HAZARD_PREV, tail);
+        if (atomic_load(&(list_ptr->tail)) != tail) {
+            continue;
+        }
+        uintptr_t next = atomic_load(&(tail->next));
+        if (is_marked(next)) {
+            // the hinted node was deleted, so walk from the sentinel instead
+            atomic_compare_exchange_strong(&(list_ptr->tail), &tail, &(list_ptr->head));
+        } else if (next == 0) {
+            if (atomic_compare_exchange_strong(&(tail->next), &next, (uintptr_t) node)) {
+                advance_tail(list_ptr, tail, node);
+                break;
+            }
+        } else {
+            // the hint lags behind the last node, so move it one node forward
+            LockFreeNode* succ = (LockFreeNode *) next;
+            protect(record, HAZARD_CURR, succ);
+            if (atomic_load(&(tail->next)) != next) {
+                continue;
+            }
+            uintptr_t succ_next = atomic_load(&(succ->next));
+            if (is_marked(succ_next)) {
+                if (atomic_compare_exchange_strong(&(tail->next), &next, (uintptr_t) unmarked(succ_next))) {
+                    retire(list_ptr, record, succ);
+                }
+            } else {
+                advance_tail(list_ptr, tail, succ);
+            }
+        }
+    }
+    atomic_fetch_add(&(list_ptr->size), 1);
+    clear_hazards(record);
+    return true;
+}
+
+bool lockfree_prepend(LockFreeList* list_ptr, int64_t data) {
+    LockFreeNode* node = (LockFreeNode *) malloc(sizeof(LockFreeNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    // the sentinel is never deleted, so its next pointer is never marked
+    uintptr_t first = atomic_load(&(list_ptr->head.next));
+    do {
+        atomic_init(&(node->next), first);
+    } while (!atomic_compare_exchange_weak(&(list_ptr->head.next), &first, (uintptr_t) node));
+    atomic_fetch_add(&(list_ptr->size), 1);
+    return true;
+}
+
+bool lockfree_delete(LockFreeList* list_ptr, int64_t data) {
+    HazardRecord* record = hazard_record();
+    LockFreeNode* prev;
+    LockFreeNode* curr;
+    bool deleted = false;
+    while (!deleted && search(list_ptr, record, data, &prev, &curr)) {
+        uintptr_t next = atomic_load(&(curr->next));
+        // marking the node is what deletes it, so only one thread can succeed
+        if (is_marked(next) || !atomic_compare_exchange_strong(&(curr->next), &next, next | MARK)) {
+            continue;
+        }
+        uintptr_t expected = (uintptr_t) curr;
+        if (atomic_compare_exchange_strong(&(prev->next), &expected, next)) {
+            retire(list_ptr, record, curr);
+        }
+        // otherwise the node stays linked until the next search unlinks it
+        atomic_fetch_sub(&(list_ptr->size), 1);
+        deleted = true;
+    }
+    clear_hazards(record);
+    return deleted;
+}
+
+void lockfree_thread_exit() {
+    HazardRecord* record = thread_record;
+    if (record == NULL) {
+        return;
+    }
+    clear_hazards(record);
+    scan(record);
+    // another thread may still be reading a node retired here, but only until its
+    // current operation ends, and no thread would free the node once the record is given back
+    while (record->num_retired > 0) {
+        sched_yield();
+        scan(record);
+    }
+    thread_record = NULL;
+    atomic_store(&(record->active), false);
+}
+
+LockFreeStats lockfree_stats() {
+    LockFreeStats stats;
+    stats.records = atomic_load(&num_records);
+    stats.pending = atomic_load(&num_pending);
+    stats.freed = atomic_load(&num_freed);
+    return stats;
+}
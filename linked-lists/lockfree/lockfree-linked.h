@@ -0,0 +1,152 @@
+/*
+This header file is used to declare the LockFreeNode struct, and the
+functions used to manage a lock-free singly linked list which many threads
+can search and change at the same time, without any locks.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef LOCKFREELINKEDLIST_H
+#define LOCKFREELINKEDLIST_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdatomic.h>
+
+/*** Constants ***/
+// every thread protects at most this many nodes at once: the node before
+// the current one, the current one, and the one it is linking or stepping to
+#define HAZARDS_PER_THREAD 3
+// a thread scans the hazard pointers of every thread once it has retired
+// this many nodes plus two per hazard pointer in use, so each scan frees
+// at least half of what it looks at
+#define RETIRE_SCAN_THRESHOLD 64
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief A structure representing a node of a LockFreeList.
+ * Contains the 64-bit integer data of the node and the pointer to the
+ * next node. The lowest bit of next is the deletion mark: once it is set
+ * the node is logically deleted, and next can no longer change.
+ */
+typedef struct LockFreeNode {
+    int64_t data;
+    _Atomic(uintptr_t) next;
+} LockFreeNode;
+
+/**
+ * @brief A lock-free singly linked list (Harris' algorithm, with Michael's
+ *        hazard pointers for reclaiming deleted nodes).
+ * Contains a sentinel node before the first node, which is never deleted,
+ * a hint to the last node (it may lag behind, or point back to the sentinel
+ * if the node it pointed to was deleted), and the number of nodes.
+ */
+typedef struct {
+    LockFreeNode head;
+    _Atomic(LockFreeNode*) tail;
+    atomic_uint_fast64_t size;
+} LockFreeList;
+
+/**
+ * @brief The hazard pointers and retired nodes of one thread.
+ * Records are shared by every LockFreeList, are never freed, and are reused
+ * by new threads once their thread calls lockfree_thread_exit. A retired
+ * node has been unlinked from its list and is freed once no hazard pointer
+ * points to it.
+ */
+typedef struct HazardRecord {
+    _Atomic(LockFreeNode*) hazards[HAZARDS_PER_THREAD];
+    atomic_bool active;
+    struct HazardRecord* next;
+    LockFreeNode** retired;
+    uint64_t num_retired;
+    uint64_t retired_capacity;
+} HazardRecord;
+
+/**
+ * @brief A snapshot of the reclamation counters shared by every LockFreeList.
+ * Contains the number of hazard records, the number of nodes retired but not
+ * yet freed, and the number of nodes freed since the program started.
+ */
+typedef struct {
+    uint64_t records;
+    uint64_t pending;
+    uint64_t freed;
+} LockFreeStats;
+
+
+/*** LockFreeList Functions ***/
+
+
+/**
+ * @brief Creates an empty LockFreeList on the heap. Returns NULL if the
+ *        allocation fails.
+ */
+LockFreeList* create_lockfree_list();
+
+/**
+ * @brief Frees the LockFreeList and every node still in it.
+ *        Note: No other thread may be using the list.
+ * @param list_ptr A pointer to the LockFreeList to free.
+ */
+void destroy_lockfree_list(LockFreeList* list_ptr);
+
+/**
+ * @brief Returns the number of nodes in the LockFreeList. While other threads
+ *        are changing the list, the result may already be out of date.
+ * @param list_ptr A pointer to the LockFreeList.
+ */
+uint64_t lockfree_size(LockFreeList* list_ptr);
+
+/**
+ * @brief Returns true if a node of the LockFreeList holds the data.
+ *        Safe to call from any number of threads at once.
+ * @param list_ptr A pointer to the LockFreeList to search.
+ * @param data The data to search for.
+ */
+bool lockfree_contains(LockFreeList* list_ptr, int64_t data);
+
+/**
+ * @brief Appends a node with the data to the end of the LockFreeList.
+ *        Safe to call from any number of threads at once.
+ *        Returns false if the node could not be allocated.
+ * @param list_ptr A pointer to the LockFreeList to append to.
+ * @param data The data attached to the new node.
+ */
+bool lockfree_append(LockFreeList* list_ptr, int64_t data);
+
+/**
+ * @brief Prepends a node with the data to the start of the LockFreeList.
+ *        Safe to call from any number of threads at once.
+ *        Returns false if the node could not be allocated.
+ * @param list_ptr A pointer to the LockFreeList to prepend to.
+ * @param data The data attached to the new node.
+ */
+bool lockfree_prepend(LockFreeList* list_ptr, int64_t data);
+
+/**
+ * @brief Deletes the first node of the LockFreeList holding the data.
+ *        Returns true if a node was deleted, false if no node holds the data.
+ *        Safe to call from any number of threads at once; if two threads
+ *        delete the same value, each deletes a different node.
+ * @param list_ptr A pointer to the LockFreeList to delete from.
+ * @param data The data of the node to delete.
+ */
+bool lockfree_delete(LockFreeList* list_ptr, int64_t data);
+
+/**
+ * @brief Frees every node the calling thread retired, waiting for the threads
+ *        still using some of them to finish their current operation, and gives
+ *        its hazard record back so a new thread can reuse it. A thread which
+ *        used any LockFreeList should call it before exiting.
+ */
+void lockfree_thread_exit();
+
+/**
+ * @brief Returns the reclamation counters shared by every LockFreeList.
+ */
+LockFreeStats lockfree_stats();
+#endif
@@ -0,0 +1,354 @@
+/*
+This file is used to hold and execute unit tests for the functions defined for
+the LockFreeList, both from a single thread and from several threads at once.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include"lockfree-linked.h"
+#include<pthread.h>
+#include<stdbool.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+
+/*** Constants ***/
+// for some later clarity
+#define PASS true
+#define FAIL false
+
+// the number of threads and values per thread of the concurrent tests
+#define NUM_THREADS 8
+#define VALUES_PER_THREAD 2000
+
+// for LockFreeList functions
+int8_t SINGLE_THREAD_NUM_TESTS = 6;
+int8_t CONCURRENT_APPEND_NUM_TESTS = 3;
+int8_t CONCURRENT_DELETE_NUM_TESTS = 3;
+int8_t RECLAIM_NUM_TESTS = 2;
+
+/*** Helper Functions */
+
+/**
+ * @brief Copies the values of the list into arr in order, and returns how many there are.
+ *        Must only be called while no other thread is changing the list.
+ */
+uint64_t lockfree_values(LockFreeList* list_ptr, int64_t* arr, uint64_t capacity) {
+    uint64_t count = 0;
+    uintptr_t next = atomic_load(&(list_ptr->head.next));
+    while ((next != 0) && (count < capacity)) {
+        LockFreeNode* node = (LockFreeNode *) (next & ~((uintptr_t) 1));
+        next = atomic_load(&(node->next));
+        // a node which was marked but never unlinked is not part of the list
+        if ((next & 1) == 0) {
+            arr[count++] = node->data;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief The argument of every test thread: the list, the index of the thread,
+ *        and whether it saw a wrong answer.
+ */
+typedef struct {
+    LockFreeList* list_ptr;
+    int64_t index;
+    bool failed;
+} TestThread;
+
+/**
+ * @brief Appends the values index * VALUES_PER_THREAD + i in increasing order,
+ *        prepending every tenth one instead.
+ */
+void* append_values(void* arg) {
+    TestThread* thread = (TestThread *) arg;
+    for (int64_t i = 0; i < VALUES_PER_THREAD; i++) {
+        int64_t value = thread->index * VALUES_PER_THREAD + i;
+        if (i % 10 == 0) {
+            lockfree_prepend(thread->list_ptr, value);
+        } else {
+            lockfree_append(thread->list_ptr, value);
+        }
+    }
+    lockfree_thread_exit();
+    return NULL;
+}
+
+/**
+ * @brief Deletes the even values of its own range, which must all be found,
+ *        and checks that its odd values are always found.
+ */
+void* delete_even_values(void* arg) {
+    TestThread* thread = (TestThread *) arg;
+    for (int64_t i = 0; i < VALUES_PER_THREAD; i += 2) {
+        int64_t value = thread->index * VALUES_PER_THREAD + i;
+        if (!lockfree_delete(thread->list_ptr, value) || lockfree_contains(thread->list_ptr, value)
+            || !lockfree_contains(thread->list_ptr, value + 1)) {
+            thread->failed = true;
+        }
+        // appending and deleting a value no other thread uses keeps the tail busy
+        lockfree_append(thread->list_ptr, -1 - thread->index);
+        if (!lockfree_delete(thread->list_ptr, -1 - thread->index)) {
+            thread->failed = true;
+        }
+    }
+    lockfree_thread_exit();
+    return NULL;
+}
+
+/**
+ * @brief Runs the function on NUM_THREADS threads at once and returns true if none failed.
+ */
+bool run_threads(LockFreeList* list_ptr, void* (*function)(void*)) {
+    pthread_t threads[NUM_THREADS];
+    TestThread args[NUM_THREADS];
+    for (int64_t i = 0; i < NUM_THREADS; i++) {
+        args[i].list_ptr = list_ptr;
+        args[i].index = i;
+        args[i].failed = false;
+        pthread_create(&(threads[i]), NULL, function, &(args[i]));
+    }
+    bool passed = true;
+    for (int64_t i = 0; i < NUM_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        passed = passed && !args[i].failed;
+    }
+    return passed;
+}
+
+/**
+ * @brief Displays the results of unit test functions
+ *
+ * This function processes an array of test results and displays whether tests passed or failed.
+ * It can show detailed results for each individual test when verbose mode is enabled,
+ * and always displays a summary message indicating overall test success or failure.
+ *
+ * @param tests_status Pointer to a boolean array containing test results (PASS/FAIL)
+ * @param num_tests The number of test results in the array
+ * @param verbose If true, displays detailed results for each individual test
+ */
+void display_test_results(bool* tests_status, int8_t num_tests, bool verbose) {
+    bool all_passed = true;
+    for (int8_t i = 0; i < num_tests; i++) {
+        if (tests_status[i] == PASS) {
+            if (verbose) {
+                printf("Test %d passed\n", i + 1);
+            }
+        } else {
+            if (verbose) {
+                printf("Test %d failed\n", i + 1);
+            }
+            all_passed = false;
+        }
+    }
+    if (all_passed) {
+        printf("All tests passed!\n");
+    } else {
+        printf("Some tests failed!\n");
+    }
+}
+
+/*** LockFreeList Unit Tests */
+
+/**
+ * @brief Tests the LockFreeList functions from a single thread
+ *
+ * This function performs six tests:
+ * 1. Verifies that a new list is empty and contains nothing
+ * 2. Verifies that appends and prepends keep the right order and size
+ * 3. Verifies that contains finds every value and rejects missing ones
+ * 4. Verifies that delete removes only the first node holding a value
+ * 5. Verifies that deleting the last node still lets append reach the end
+ * 6. Verifies that deleting a missing value returns false and changes nothing
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains SINGLE_THREAD_NUM_TESTS elements and must be freed
+ *         by the caller when no longer needed.
+ */
+bool* test_single_thread() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SINGLE_THREAD_NUM_TESTS);
+    LockFreeList* list_ptr = create_lockfree_list();
+    int64_t arr[16];
+
+    // Test 1: empty list
+    tests_status[0] = (lockfree_size(list_ptr) == 0) && !lockfree_contains(list_ptr, 0)
+                      && (lockfree_values(list_ptr, arr, 16) == 0);
+
+    // Test 2: order of appends and prepends
+    lockfree_append(list_ptr, 2);
+    lockfree_append(list_ptr, 3);
+    lockfree_prepend(list_ptr, 1);
+    lockfree_append(list_ptr, 2);
+    uint64_t count = lockfree_values(list_ptr, arr, 16);
+    tests_status[1] = (lockfree_size(list_ptr) == 4) && (count == 4) && (arr[0] == 1)
+                      && (arr[1] == 2) && (arr[2] == 3) && (arr[3] == 2);
+
+    // Test 3: contains
+    tests_status[2] = lockfree_contains(list_ptr, 1) && lockfree_contains(list_ptr, 3)
+                      && !lockfree_contains(list_ptr, 4);
+
+    // Test 4: delete the first of two nodes holding 2
+    bool deleted = lockfree_delete(list_ptr, 2);
+    count = lockfree_values(list_ptr, arr, 16);
+    tests_status[3] = deleted && (count == 3) && (arr[0] == 1) && (arr[1] == 3) && (arr[2] == 2)
+                      && lockfree_contains(list_ptr, 2);
+
+    // Test 5: delete the tail, then append
+    lockfree_delete(list_ptr, 2);
+    lockfree_append(list_ptr, 4);
+    count = lockfree_values(list_ptr, arr, 16);
+    tests_status[4] = (count == 3) && (arr[2] == 4) && (lockfree_size(list_ptr) == 3);
+
+    // Test 6: delete a missing value
+    tests_status[5] = !lockfree_delete(list_ptr, 7) && (lockfree_size(list_ptr) == 3);
+
+    destroy_lockfree_list(list_ptr);
+    lockfree_thread_exit();
+    return tests_status;
+}
+
+/**
+ * @brief Tests appending and prepending from NUM_THREADS threads at once
+ *
+ * This function performs three tests:
+ * 1. Verifies that no node was lost: the size and the number of linked nodes match
+ * 2. Verifies that every value appears exactly once
+ * 3. Verifies that the appended values of each thread appear in the order they were appended
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains CONCURRENT_APPEND_NUM_TESTS elements and must be
+ *         freed by the caller when no longer needed.
+ */
+bool* test_concurrent_append() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * CONCURRENT_APPEND_NUM_TESTS);
+    uint64_t total = NUM_THREADS * VALUES_PER_THREAD;
+    LockFreeList* list_ptr = create_lockfree_list();
+    run_threads(list_ptr, append_values);
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * (total + 1));
+    uint64_t count = lockfree_values(list_ptr, arr, total + 1);
+
+    // Test 1: nothing lost
+    tests_status[0] = (count == total) && (lockfree_size(list_ptr) == total);
+
+    // Test 2: every value once
+    uint8_t* seen = (uint8_t *) calloc(total, sizeof(uint8_t));
+    bool once = true;
+    for (uint64_t i = 0; i < count; i++) {
+        once = once && (arr[i] >= 0) && ((uint64_t) arr[i] < total) && (seen[arr[i]]++ == 0);
+    }
+    tests_status[1] = once;
+
+    // Test 3: per-thread order of appends
+    int64_t last[NUM_THREADS];
+    for (int64_t i = 0; i < NUM_THREADS; i++) {
+        last[i] = -1;
+    }
+    bool in_order = true;
+    for (uint64_t i = 0; i < count; i++) {
+        int64_t thread = arr[i] / VALUES_PER_THREAD;
+        if (arr[i] % 10 != 0) {
+            in_order = in_order && (arr[i] > last[thread]);
+            last[thread] = arr[i];
+        }
+    }
+    tests_status[2] = in_order;
+
+    free(seen);
+    free(arr);
+    destroy_lockfree_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests deleting and searching from NUM_THREADS threads at once
+ *
+ * This function performs three tests:
+ * 1. Verifies that every thread found its values while other threads were deleting theirs
+ * 2. Verifies that exactly the odd values are left
+ * 3. Verifies that the size matches the number of nodes left
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains CONCURRENT_DELETE_NUM_TESTS elements and must be
+ *         freed by the caller when no longer needed.
+ */
+bool* test_concurrent_delete() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * CONCURRENT_DELETE_NUM_TESTS);
+    uint64_t total = NUM_THREADS * VALUES_PER_THREAD;
+    LockFreeList* list_ptr = create_lockfree_list();
+    for (uint64_t i = 0; i < total; i++) {
+        lockfree_append(list_ptr, i);
+    }
+
+    // Test 1: answers seen by the threads
+    tests_status[0] = run_threads(list_ptr, delete_even_values);
+
+    // Test 2: odd values left
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * total);
+    uint64_t count = lockfree_values(list_ptr, arr, total);
+    bool odd = (count == total / 2);
+    for (uint64_t i = 0; (i < count) && odd; i++) {
+        odd = (arr[i] == (int64_t) (2 * i + 1));
+    }
+    tests_status[1] = odd;
+
+    // Test 3: size
+    tests_status[2] = (lockfree_size(list_ptr) == count);
+
+    free(arr);
+    destroy_lockfree_list(list_ptr);
+    lockfree_thread_exit();
+    return tests_status;
+}
+
+/**
+ * @brief Tests the reclamation of deleted nodes
+ *
+ * This function performs two tests:
+ * 1. Verifies that deleted nodes were freed once no thread was using them
+ * 2. Verifies that exited threads gave their hazard records back for reuse
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains RECLAIM_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_reclaim() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RECLAIM_NUM_TESTS);
+    LockFreeStats stats = lockfree_stats();
+
+    // Test 1: nothing is left pending once every thread exited
+    tests_status[0] = (stats.pending == 0) && (stats.freed >= NUM_THREADS * VALUES_PER_THREAD);
+
+    // Test 2: records reused
+    LockFreeList* list_ptr = create_lockfree_list();
+    run_threads(list_ptr, append_values);
+    tests_status[1] = (lockfree_stats().records == stats.records);
+    destroy_lockfree_list(list_ptr);
+    return tests_status;
+}
+
+/*** Program Starting Point */
+int main() {
+    bool* tests_status = test_single_thread();
+    printf("Testing LockFreeList from one thread: ");
+    display_test_results(tests_status, SINGLE_THREAD_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_concurrent_append();
+    printf("Testing concurrent appends: ");
+    display_test_results(tests_status, CONCURRENT_APPEND_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_concurrent_delete();
+    printf("Testing concurrent deletes: ");
+    display_test_results(tests_status, CONCURRENT_DELETE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_reclaim();
+    printf("Testing node reclamation: ");
+    display_test_results(tests_status, RECLAIM_NUM_TESTS, false);
+    free(tests_status);
+
+    return 0;
+}
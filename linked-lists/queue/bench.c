@@ -0,0 +1,196 @@
+/*
+This file is used to measure the throughput and latency of the ConcurrentQueue
+with 1, 2, 4, ... 64 producers, against a DoublyLinkedList with one mutex
+around append_node and delete_first, the way it was used as a work queue.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<pthread.h>
+#include<sched.h>
+#include<stdint.h>
+#include<stdio.h>
+#include"concurrent-queue.h"
+#include"../bench/bench-harness.h"
+
+/*** Constants ***/
+#define QUEUE_NAME "ConcurrentQueue"
+#define MUTEX_NAME "DoublyLinkedList+mutex"
+// the largest number of values a single consumer takes at once
+#define BATCH_SIZE 64
+// the number of values each producer pushes in one sample when no size is given
+#define DEFAULT_ITEMS 4096
+
+/**
+ * @brief The queues shared by the threads of a sample: a ConcurrentQueue, or a
+ *        DoublyLinkedList with one mutex, the number of threads which are
+ *        producers, and the latency samples of a single consumer.
+ */
+typedef struct {
+    ConcurrentQueue* queue_ptr;
+    DoublyLinkedList list;
+    pthread_mutex_t lock;
+    uint64_t producers;
+    BenchSamples* latency;
+} SharedQueue;
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Returns how many values a consumer thread must pop so that the
+ *        consumers pop exactly what the producers push.
+ */
+uint64_t consumer_quota(BenchThread* thread, SharedQueue* shared) {
+    return shared->producers * thread->ops / (thread->num_threads - shared->producers);
+}
+
+/**
+ * @brief Records how long ago the value, a timestamp, was pushed, if the thread
+ *        is the only consumer and the latency measurement wants more samples.
+ */
+void record_latency(BenchThread* thread, SharedQueue* shared, int64_t pushed_ns) {
+    if ((thread->num_threads - shared->producers == 1) && bench_wants_more(shared->latency)) {
+        bench_add_sample(shared->latency, bench_now_ns() - pushed_ns, 1);
+    }
+}
+
+/*** Workers ***/
+
+/**
+ * @brief Producers push their current time, so the consumer can tell how long
+ *        each value waited. A single consumer takes batches with pop_n, several
+ *        consumers take one value at a time with try_pop_front. Only pushes
+ *        are counted, so throughput is values per second through the queue.
+ */
+void queue_worker(BenchThread* thread) {
+    SharedQueue* shared = (SharedQueue *) thread->arg;
+    if (thread->index < shared->producers) {
+        for (uint64_t i = 0; i < thread->ops; i++) {
+            push_back(shared->queue_ptr, bench_now_ns());
+        }
+        queue_thread_exit();
+        return;
+    }
+    uint64_t quota = consumer_quota(thread, shared);
+    bool batched = (thread->num_threads - shared->producers == 1);
+    DoublyLinkedList batch = {0};
+    uint64_t popped = 0;
+    while (popped < quota) {
+        uint64_t count = 0;
+        int64_t data;
+        if (batched) {
+            uint64_t n = (quota - popped < BATCH_SIZE) ? quota - popped : BATCH_SIZE;
+            count = pop_n(shared->queue_ptr, &batch, n);
+            if (count > 0) {
+                record_latency(thread, shared, batch.head->data);
+                clear(&batch);
+            }
+        } else if (try_pop_front(shared->queue_ptr, &data)) {
+            count = 1;
+        }
+        if (count == 0) {
+            // on fewer cores than threads, let a producer run
+            sched_yield();
+        }
+        popped += count;
+    }
+    thread->ops = 0;
+    queue_thread_exit();
+}
+
+/**
+ * @brief Runs the same producers and consumers on the DoublyLinkedList, holding
+ *        the mutex for every append_node, and for every batch of delete_first.
+ */
+void mutex_worker(BenchThread* thread) {
+    SharedQueue* shared = (SharedQueue *) thread->arg;
+    if (thread->index < shared->producers) {
+        for (uint64_t i = 0; i < thread->ops; i++) {
+            int64_t now = bench_now_ns();
+            pthread_mutex_lock(&(shared->lock));
+            append_node(&(shared->list), now);
+            pthread_mutex_unlock(&(shared->lock));
+        }
+        return;
+    }
+    uint64_t quota = consumer_quota(thread, shared);
+    uint64_t limit = (thread->num_threads - shared->producers == 1) ? BATCH_SIZE : 1;
+    uint64_t popped = 0;
+    while (popped < quota) {
+        uint64_t count = 0;
+        int64_t first = 0;
+        pthread_mutex_lock(&(shared->lock));
+        while ((shared->list.head != NULL) && (count < limit) && (popped + count < quota)) {
+            first = (count == 0) ? shared->list.head->data : first;
+            delete_first(&(shared->list));
+            count++;
+        }
+        pthread_mutex_unlock(&(shared->lock));
+        if (count == 0) {
+            sched_yield();
+        } else {
+            record_latency(thread, shared, first);
+        }
+        popped += count;
+    }
+    thread->ops = 0;
+}
+
+/*** Benchmarks ***/
+
+/**
+ * @brief Measures both queues with the given number of producers, first with
+ *        one consumer taking batches, then with as many consumers as producers.
+ */
+void bench_producers(uint64_t producers, uint64_t items) {
+    char operation[32];
+    SharedQueue shared = {0};
+    shared.queue_ptr = create_queue();
+    shared.producers = producers;
+    pthread_mutex_init(&(shared.lock), NULL);
+
+    snprintf(operation, sizeof(operation), "mpsc_p%lu", producers);
+    BenchSamples* samples = bench_start();
+    shared.latency = bench_start();
+    while (bench_add_threaded_sample(samples, producers + 1, items, queue_worker, &shared));
+    bench_report(samples, QUEUE_NAME, operation, items);
+    snprintf(operation, sizeof(operation), "mpsc_p%lu_latency", producers);
+    bench_report(shared.latency, QUEUE_NAME, operation, items);
+
+    snprintf(operation, sizeof(operation), "mpsc_p%lu", producers);
+    samples = bench_start();
+    shared.latency = bench_start();
+    while (bench_add_threaded_sample(samples, producers + 1, items, mutex_worker, &shared));
+    bench_report(samples, MUTEX_NAME, operation, items);
+    snprintf(operation, sizeof(operation), "mpsc_p%lu_latency", producers);
+    bench_report(shared.latency, MUTEX_NAME, operation, items);
+
+    snprintf(operation, sizeof(operation), "mpmc_p%lu", producers);
+    samples = bench_start();
+    while (bench_add_threaded_sample(samples, 2 * producers, items, queue_worker, &shared));
+    bench_report(samples, QUEUE_NAME, operation, items);
+
+    samples = bench_start();
+    while (bench_add_threaded_sample(samples, 2 * producers, items, mutex_worker, &shared));
+    bench_report(samples, MUTEX_NAME, operation, items);
+
+    pthread_mutex_destroy(&(shared.lock));
+    destroy_queue(shared.queue_ptr);
+    clear(&(shared.list));
+}
+
+/*** Program Starting Point */
+int main(int argc, char** argv) {
+    uint64_t items = (argc < 2) ? DEFAULT_ITEMS : bench_max_size(argc, argv);
+    if (!bench_open_csv(BENCH_CSV_PATH)) {
+        printf("Could not open %s, results are only printed.\n", BENCH_CSV_PATH);
+    }
+    bench_seed(13);
+    for (uint64_t producers = 1; producers <= BENCH_MAX_THREADS; producers *= 2) {
+        bench_producers(producers, items);
+    }
+    bench_close_csv();
+    queue_thread_exit();
+    return 0;
+}
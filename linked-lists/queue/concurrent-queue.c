@@ -0,0 +1,373 @@
+/*
+This document is meant to store the implementation of the lock-free queue.
+Values are pushed by linking a node after the last one with compare-and-swap
+and popped by swinging the head forward past a dummy node (Michael and
+Scott's algorithm). Old dummy nodes are only freed once no thread holds a
+hazard pointer to them (Michael's hazard pointers).
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<sched.h>
+#include<stdint.h>
+#include<stdlib.h>
+#include"concurrent-queue.h"
+
+/*** Constants ***/
+#define HAZARD_FIRST 0
+#define HAZARD_NEXT 1
+
+/*** Struct Definitions ***/
+
+/**
+ * @brief The retired nodes an exited thread could not free, waiting for the
+ *        next scan of any thread.
+ */
+typedef struct QueueOrphans {
+    QueueNode** nodes;
+    uint64_t num_nodes;
+    struct QueueOrphans* next;
+} QueueOrphans;
+
+/*** Globals ***/
+static _Atomic(QueueHazardRecord*) records = NULL;
+static atomic_uint_fast64_t num_records = 0;
+static atomic_uint_fast64_t num_pending = 0;
+static atomic_uint_fast64_t num_freed = 0;
+static _Atomic(QueueOrphans*) orphaned = NULL;
+static _Thread_local QueueHazardRecord* thread_record = NULL;
+
+/*** Helper Functions ***/
+
+static void protect(QueueHazardRecord* record, int slot, QueueNode* node) {
+    atomic_store(&(record->hazards[slot]), node);
+}
+
+static void clear_hazards(QueueHazardRecord* record) {
+    for (int slot = 0; slot < QUEUE_HAZARDS_PER_THREAD; slot++) {
+        atomic_store(&(record->hazards[slot]), NULL);
+    }
+}
+
+/**
+ * @brief Returns the hazard record of the calling thread, taking a record
+ *        given back by an exited thread, or adding a new one, on first use.
+ */
+static QueueHazardRecord* hazard_record() {
+    if (thread_record != NULL) {
+        return thread_record;
+    }
+    for (QueueHazardRecord* record = atomic_load(&records); record != NULL; record = record->next) {
+        bool expected = false;
+        if (!atomic_load(&(record->active)) && atomic_compare_exchange_strong(&(record->active), &expected, true)) {
+            thread_record = record;
+            return record;
+        }
+    }
+    QueueHazardRecord* record = (QueueHazardRecord *) calloc(1, sizeof(QueueHazardRecord));
+    atomic_init(&(record->active), true);
+    QueueHazardRecord* head = atomic_load(&records);
+    do {
+        record->next = head;
+    } while (!atomic_compare_exchange_weak(&records, &head, record));
+    atomic_fetch_add(&num_records, 1);
+    thread_record = record;
+    return record;
+}
+
+static int compare_pointers(const void* a, const void* b) {
+    uintptr_t x = (uintptr_t) *((QueueNode* const *) a);
+    uintptr_t y = (uintptr_t) *((QueueNode* const *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Adds a node to the retired nodes of the record, growing them if needed.
+ */
+static void add_retired(QueueHazardRecord* record, QueueNode* node) {
+    if (record->num_retired == record->retired_capacity) {
+        record->retired_capacity = (record->retired_capacity == 0) ? QUEUE_RETIRE_SCAN_THRESHOLD : 2 * record->retired_capacity;
+        record->retired = (QueueNode **) realloc(record->retired, sizeof(QueueNode*) * record->retired_capacity);
+    }
+    record->retired[record->num_retired++] = node;
+}
+
+/**
+ * @brief Takes over the nodes exited threads could not free yet, which would
+ *        otherwise wait for a new thread to reuse their records.
+ */
+static void adopt_orphans(QueueHazardRecord* record) {
+    QueueOrphans* orphans = atomic_exchange(&orphaned, NULL);
+    while (orphans != NULL) {
+        for (uint64_t i = 0; i < orphans->num_nodes; i++) {
+            add_retired(record, orphans->nodes[i]);
+        }
+        QueueOrphans* next = orphans->next;
+        free(orphans->nodes);
+        free(orphans);
+        orphans = next;
+    }
+}
+
+/**
+ * @brief Frees every node retired by the record, or left by an exited thread,
+ *        which no hazard pointer of any thread points to, and keeps the others
+ *        for a later scan.
+ */
+static void scan(QueueHazardRecord* record) {
+    adopt_orphans(record);
+    uint64_t capacity = atomic_load(&num_records) * QUEUE_HAZARDS_PER_THREAD;
+    QueueNode** hazards = (QueueNode **) malloc(sizeof(QueueNode*) * capacity);
+    uint64_t num_hazards = 0;
+    for (QueueHazardRecord* other = atomic_load(&records); other != NULL; other = other->next) {
+        for (int slot = 0; slot < QUEUE_HAZARDS_PER_THREAD; slot++) {
+            QueueNode* hazard = atomic_load(&(other->hazards[slot]));
+            if (hazard == NULL) {
+                continue;
+            }
+            // records may have been added since num_records was read
+            if (num_hazards == capacity) {
+                capacity *= 2;
+                hazards = (QueueNode **) realloc(hazards, sizeof(QueueNode*) * capacity);
+            }
+            hazards[num_hazards++] = hazard;
+        }
+    }
+    qsort(hazards, num_hazards, sizeof(QueueNode*), compare_pointers);
+    uint64_t kept = 0;
+    for (uint64_t i = 0; i < record->num_retired; i++) {
+        QueueNode* node = record->retired[i];
+        if (bsearch(&node, hazards, num_hazards, sizeof(QueueNode*), compare_pointers) != NULL) {
+            record->retired[kept++] = node;
+        } else {
+            free(node);
+        }
+    }
+    atomic_fetch_sub(&num_pending, record->num_retired - kept);
+    atomic_fetch_add(&num_freed, record->num_retired - kept);
+    record->num_retired = kept;
+    free(hazards);
+}
+
+/**
+ * @brief Hands a dummy node which the head just moved past to the record,
+ *        to be freed once no thread can still be using it.
+ */
+static void retire(QueueHazardRecord* record, QueueNode* node) {
+    add_retired(record, node);
+    atomic_fetch_add(&num_pending, 1);
+    if (record->num_retired >= QUEUE_RETIRE_SCAN_THRESHOLD + 2 * QUEUE_HAZARDS_PER_THREAD * atomic_load(&num_records)) {
+        scan(record);
+    }
+}
+
+/**
+ * @brief Protects the dummy node of the queue with the first hazard pointer
+ *        of the record and returns it. The head never moves past the tail,
+ *        and a node is only retired once the head moved past it, so a node
+ *        is safe to read from while the head still points to it.
+ */
+static QueueNode* protect_head(ConcurrentQueue* queue_ptr, QueueHazardRecord* record) {
+    QueueNode* first = atomic_load(&(queue_ptr->head));
+    while (true) {
+        protect(record, HAZARD_FIRST, first);
+        QueueNode* current = atomic_load(&(queue_ptr->head));
+        if (current == first) {
+            return first;
+        }
+        first = current;
+    }
+}
+
+/*** ConcurrentQueue Functions ***/
+
+ConcurrentQueue* create_queue() {
+    ConcurrentQueue* queue_ptr = (ConcurrentQueue *) aligned_alloc(_Alignof(ConcurrentQueue), sizeof(ConcurrentQueue));
+    QueueNode* dummy = (QueueNode *) malloc(sizeof(QueueNode));
+    if ((queue_ptr == NULL) || (dummy == NULL)) {
+        free(queue_ptr);
+        free(dummy);
+        return NULL;
+    }
+    dummy->data = 0;
+    atomic_init(&(dummy->next), NULL);
+    atomic_init(&(queue_ptr->head), dummy);
+    atomic_init(&(queue_ptr->tail), dummy);
+    atomic_init(&(queue_ptr->size), 0);
+    return queue_ptr;
+}
+
+void destroy_queue(ConcurrentQueue* queue_ptr) {
+    QueueNode* node = atomic_load(&(queue_ptr->head));
+    while (node != NULL) {
+        QueueNode* next = atomic_load(&(node->next));
+        free(node);
+        node = next;
+    }
+    free(queue_ptr);
+}
+
+uint64_t queue_size(ConcurrentQueue* queue_ptr) {
+    // a pop may be counted before the push it took the value of
+    int64_t size = atomic_load(&(queue_ptr->size));
+    return (size < 0) ? 0 : (uint64_t) size;
+}
+
+bool push_back(ConcurrentQueue* queue_ptr, int64_t data) {
+    QueueNode* node = (QueueNode *) malloc(sizeof(QueueNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    atomic_init(&(node->next), NULL);
+    QueueHazardRecord* record = hazard_record();
+    while (true) {
+        QueueNode* tail = atomic_load(&(queue_ptr->tail));
+        protect(record, HAZARD_FIRST, tail);
+        if (atomic_load(&(queue_ptr->tail)) != tail) {
+            continue;
+        }
+        QueueNode* next = atomic_load(&(tail->next));
+        if (next != NULL) {
+            // another push linked its node but has not moved the tail yet
+            atomic_compare_exchange_strong(&(queue_ptr->tail), &tail, next);
+        } else if (atomic_compare_exchange_strong(&(tail->next), &next, node)) {
+            atomic_compare_exchange_strong(&(queue_ptr->tail), &tail, node);
+            break;
+        }
+    }
+    atomic_fetch_add(&(queue_ptr->size), 1);
+    clear_hazards(record);
+    return true;
+}
+
+bool try_pop_front(ConcurrentQueue* queue_ptr, int64_t* data_out) {
+    QueueHazardRecord* record = hazard_record();
+    bool popped = false;
+    while (true) {
+        QueueNode* first = protect_head(queue_ptr, record);
+        QueueNode* tail = atomic_load(&(queue_ptr->tail));
+        QueueNode* next = atomic_load(&(first->next));
+        protect(record, HAZARD_NEXT, next);
+        if (atomic_load(&(queue_ptr->head)) != first) {
+            continue;
+        }
+        if (next == NULL) {
+            break;
+        }
+        if (first == tail) {
+            // the head may not pass the tail, so finish the push first
+            atomic_compare_exchange_strong(&(queue_ptr->tail), &tail, next);
+            continue;
+        }
+        int64_t data = next->data;
+        if (atomic_compare_exchange_strong(&(queue_ptr->head), &first, next)) {
+            retire(record, first);
+            *data_out = data;
+            popped = true;
+            break;
+        }
+    }
+    if (popped) {
+        atomic_fetch_sub(&(queue_ptr->size), 1);
+    }
+    clear_hazards(record);
+    return popped;
+}
+
+uint64_t pop_n(ConcurrentQueue* queue_ptr, DoublyLinkedList* list_ptr, uint64_t n) {
+    QueueHazardRecord* record = hazard_record();
+    uint64_t count = 0;
+    while (n > 0) {
+        QueueNode* first = protect_head(queue_ptr, record);
+        QueueNode* tail = atomic_load(&(queue_ptr->tail));
+        // walk forward from the dummy node, but not past the tail. Every node
+        // is protected before the head is checked again: if the head has not
+        // moved, the node was not popped, so it has not been retired either.
+        // Only the node the walk stands on needs a hazard pointer, since the
+        // nodes behind it are not read again until the head moved past them.
+        QueueNode* last = first;
+        bool restart = false;
+        while ((count < n) && (last != tail)) {
+            QueueNode* next = atomic_load(&(last->next));
+            protect(record, HAZARD_NEXT, next);
+            if (atomic_load(&(queue_ptr->head)) != first) {
+                restart = true;
+                break;
+            }
+            last = next;
+            count++;
+        }
+        if (restart) {
+            count = 0;
+            continue;
+        }
+        if (count == 0) {
+            QueueNode* next = atomic_load(&(first->next));
+            if (next == NULL) {
+                break;
+            }
+            // the tail lags behind a finished push, so move it forward and retry
+            atomic_compare_exchange_strong(&(queue_ptr->tail), &tail, next);
+            continue;
+        }
+        if (!atomic_compare_exchange_strong(&(queue_ptr->head), &first, last)) {
+            count = 0;
+            continue;
+        }
+        // the popped nodes now belong to this thread: no other consumer can
+        // reach them anymore without first seeing the head move past them
+        QueueNode* node = first;
+        for (uint64_t i = 0; i < count; i++) {
+            QueueNode* next = atomic_load(&(node->next));
+            append_node(list_ptr, next->data);
+            retire(record, node);
+            node = next;
+        }
+        break;
+    }
+    if (count > 0) {
+        atomic_fetch_sub(&(queue_ptr->size), count);
+    }
+    clear_hazards(record);
+    return count;
+}
+
+void queue_thread_exit() {
+    QueueHazardRecord* record = thread_record;
+    if (record == NULL) {
+        return;
+    }
+    clear_hazards(record);
+    scan(record);
+    if (record->num_retired > 0) {
+        // hand the nodes still in use to whichever thread scans next
+        QueueOrphans* orphans = (QueueOrphans *) malloc(sizeof(QueueOrphans));
+        if (orphans == NULL) {
+            // with nowhere to hand them, wait for the operations still reading them to end
+            while (record->num_retired > 0) {
+                sched_yield();
+                scan(record);
+            }
+        } else {
+            orphans->nodes = record->retired;
+            orphans->num_nodes = record->num_retired;
+            record->retired = NULL;
+            record->num_retired = 0;
+            record->retired_capacity = 0;
+            orphans->next = atomic_load(&orphaned);
+            while (!atomic_compare_exchange_weak(&orphaned, &(orphans->next), orphans));
+        }
+    }
+    thread_record = NULL;
+    atomic_store(&(record->active), false);
+}
+
+QueueStats queue_stats() {
+    QueueStats stats;
+    stats.records = atomic_load(&num_records);
+    stats.pending = atomic_load(&num_pending);
+    stats.freed = atomic_load(&num_freed);
+    return stats;
+}
@@ -0,0 +1,146 @@
+/*
+This header file is used to declare the QueueNode struct, and the functions
+used to manage a lock-free first-in first-out queue which any number of
+producers can push to and any number of consumers can pop from, handing
+popped values over in a DoublyLinkedList.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef CONCURRENTQUEUE_H
+#define CONCURRENTQUEUE_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdatomic.h>
+#include"../doubly/doubly-linked.h"
+
+/*** Constants ***/
+// a consumer protects the dummy node it is popping and the node after it
+#define QUEUE_HAZARDS_PER_THREAD 2
+// a thread scans the hazard pointers of every thread once it has retired
+// this many nodes plus two per hazard pointer in use, so each scan frees
+// at least half of what it looks at
+#define QUEUE_RETIRE_SCAN_THRESHOLD 64
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief A structure representing a node of a ConcurrentQueue.
+ * Contains the 64-bit integer data of the node and the pointer to the
+ * next node, which only changes once: from NULL to the node pushed after it.
+ */
+typedef struct QueueNode {
+    int64_t data;
+    _Atomic(struct QueueNode*) next;
+} QueueNode;
+
+/**
+ * @brief A lock-free queue (Michael and Scott's algorithm, with Michael's
+ *        hazard pointers for reclaiming popped nodes).
+ * Contains a pointer to the dummy node, whose successor holds the first
+ * value, a pointer to the last node (it may lag one node behind while a
+ * push is finishing), and the number of values in the queue. Head and tail
+ * sit on separate cache lines, so producers and consumers do not share one.
+ */
+typedef struct {
+    _Alignas(64) _Atomic(QueueNode*) head;
+    _Alignas(64) _Atomic(QueueNode*) tail;
+    _Alignas(64) atomic_int_fast64_t size;
+} ConcurrentQueue;
+
+/**
+ * @brief The hazard pointers and retired nodes of one thread.
+ * Records are shared by every ConcurrentQueue, are never freed, and are
+ * reused by new threads once their thread calls queue_thread_exit. A retired
+ * node is an old dummy node, and is freed once no hazard pointer points to it.
+ */
+typedef struct QueueHazardRecord {
+    _Atomic(QueueNode*) hazards[QUEUE_HAZARDS_PER_THREAD];
+    atomic_bool active;
+    struct QueueHazardRecord* next;
+    QueueNode** retired;
+    uint64_t num_retired;
+    uint64_t retired_capacity;
+} QueueHazardRecord;
+
+/**
+ * @brief A snapshot of the reclamation counters shared by every ConcurrentQueue.
+ * Contains the number of hazard records, the number of nodes retired but not
+ * yet freed, and the number of nodes freed since the program started.
+ */
+typedef struct {
+    uint64_t records;
+    uint64_t pending;
+    uint64_t freed;
+} QueueStats;
+
+
+/*** ConcurrentQueue Functions ***/
+
+
+/**
+ * @brief Creates an empty ConcurrentQueue on the heap. Returns NULL if the
+ *        allocation fails.
+ */
+ConcurrentQueue* create_queue();
+
+/**
+ * @brief Frees the ConcurrentQueue and every value still in it.
+ *        Note: No other thread may be using the queue.
+ * @param queue_ptr A pointer to the ConcurrentQueue to free.
+ */
+void destroy_queue(ConcurrentQueue* queue_ptr);
+
+/**
+ * @brief Returns the number of values in the ConcurrentQueue. While other
+ *        threads are pushing and popping, the result may already be out of date.
+ * @param queue_ptr A pointer to the ConcurrentQueue.
+ */
+uint64_t queue_size(ConcurrentQueue* queue_ptr);
+
+/**
+ * @brief Pushes the data to the back of the ConcurrentQueue.
+ *        Safe to call from any number of threads at once.
+ *        Returns false if the node could not be allocated.
+ * @param queue_ptr A pointer to the ConcurrentQueue to push to.
+ * @param data The data to push.
+ */
+bool push_back(ConcurrentQueue* queue_ptr, int64_t data);
+
+/**
+ * @brief Pops the value at the front of the ConcurrentQueue into data_out.
+ *        Returns false, without waiting, if the queue is empty.
+ *        Safe to call from any number of threads at once.
+ * @param queue_ptr A pointer to the ConcurrentQueue to pop from.
+ * @param data_out Where the popped value is written.
+ */
+bool try_pop_front(ConcurrentQueue* queue_ptr, int64_t* data_out);
+
+/**
+ * @brief Pops up to n values from the front of the ConcurrentQueue with one
+ *        compare-and-swap, and appends them in order to the DoublyLinkedList.
+ *        Returns the number of values popped, which is 0 if the queue is
+ *        empty, and may be less than n even if more values are being pushed.
+ *        Safe to call from any number of threads at once, as long as each
+ *        thread appends to its own list.
+ * @param queue_ptr A pointer to the ConcurrentQueue to pop from.
+ * @param list_ptr A pointer to the DoublyLinkedList the values are appended to.
+ * @param n The largest number of values to pop.
+ */
+uint64_t pop_n(ConcurrentQueue* queue_ptr, DoublyLinkedList* list_ptr, uint64_t n);
+
+/**
+ * @brief Frees every node the calling thread retired that no thread still
+ *        uses, and gives its hazard record back so a new thread can reuse it.
+ *        A thread which used any ConcurrentQueue should call it before exiting.
+ */
+void queue_thread_exit();
+
+/**
+ * @brief Returns the reclamation counters shared by every ConcurrentQueue.
+ */
+QueueStats queue_stats();
+#endif
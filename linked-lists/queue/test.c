@@ -0,0 +1,379 @@
+/*
+This file is used to hold and execute unit tests for the functions defined for
+the ConcurrentQueue, both from a single thread and with several producers and
+consumers at once.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include"concurrent-queue.h"
+#include<pthread.h>
+#include<sched.h>
+#include<stdbool.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+
+/*** Constants ***/
+// for some later clarity
+#define PASS true
+#define FAIL false
+
+// the number of producers and consumers, and values per producer, of the concurrent tests
+#define NUM_PRODUCERS 8
+#define NUM_CONSUMERS 4
+#define VALUES_PER_PRODUCER 5000
+// the largest number of values a consumer takes with one call to pop_n
+#define BATCH_SIZE 32
+
+// for ConcurrentQueue functions
+int8_t SINGLE_THREAD_NUM_TESTS = 6;
+int8_t MPSC_NUM_TESTS = 3;
+int8_t MPMC_NUM_TESTS = 3;
+int8_t RECLAIM_NUM_TESTS = 2;
+
+/*** Helper Functions */
+
+/**
+ * @brief The argument of every test thread: the queue, the index of the thread,
+ *        the values it popped in order, and the number of values left for the
+ *        consumers to pop.
+ */
+typedef struct {
+    ConcurrentQueue* queue_ptr;
+    int64_t index;
+    int64_t* popped;
+    uint64_t num_popped;
+    atomic_int_fast64_t* remaining;
+} TestThread;
+
+/**
+ * @brief Pushes the values index * VALUES_PER_PRODUCER + i in increasing order.
+ */
+void* push_values(void* arg) {
+    TestThread* thread = (TestThread *) arg;
+    for (int64_t i = 0; i < VALUES_PER_PRODUCER; i++) {
+        push_back(thread->queue_ptr, thread->index * VALUES_PER_PRODUCER + i);
+    }
+    queue_thread_exit();
+    return NULL;
+}
+
+/**
+ * @brief Pops values until the consumers popped every pushed value, taking odd
+ *        consumers' values one at a time with try_pop_front and even consumers'
+ *        values in batches with pop_n.
+ */
+void* pop_values(void* arg) {
+    TestThread* thread = (TestThread *) arg;
+    DoublyLinkedList batch = {0};
+    while (atomic_load(thread->remaining) > 0) {
+        uint64_t count = 0;
+        if (thread->index % 2 == 1) {
+            int64_t data;
+            if (try_pop_front(thread->queue_ptr, &data)) {
+                thread->popped[thread->num_popped++] = data;
+                count = 1;
+            }
+        } else {
+            count = pop_n(thread->queue_ptr, &batch, BATCH_SIZE);
+            for (Node* node = batch.head; node != NULL; node = node->next) {
+                thread->popped[thread->num_popped++] = node->data;
+            }
+            clear(&batch);
+        }
+        if (count == 0) {
+            sched_yield();
+        }
+        atomic_fetch_sub(thread->remaining, count);
+    }
+    queue_thread_exit();
+    return NULL;
+}
+
+/**
+ * @brief Runs NUM_PRODUCERS producers and num_consumers consumers on the queue at
+ *        once, filling consumers with the values each of them popped.
+ */
+void run_threads(ConcurrentQueue* queue_ptr, TestThread* consumers, int64_t num_consumers) {
+    pthread_t threads[NUM_PRODUCERS + NUM_CONSUMERS];
+    TestThread producers[NUM_PRODUCERS];
+    atomic_int_fast64_t remaining = NUM_PRODUCERS * VALUES_PER_PRODUCER;
+    for (int64_t i = 0; i < num_consumers; i++) {
+        consumers[i].queue_ptr = queue_ptr;
+        consumers[i].index = i;
+        consumers[i].popped = (int64_t *) malloc(sizeof(int64_t) * NUM_PRODUCERS * VALUES_PER_PRODUCER);
+        consumers[i].num_popped = 0;
+        consumers[i].remaining = &remaining;
+        pthread_create(&(threads[i]), NULL, pop_values, &(consumers[i]));
+    }
+    for (int64_t i = 0; i < NUM_PRODUCERS; i++) {
+        producers[i].queue_ptr = queue_ptr;
+        producers[i].index = i;
+        pthread_create(&(threads[num_consumers + i]), NULL, push_values, &(producers[i]));
+    }
+    for (int64_t i = 0; i < num_consumers + NUM_PRODUCERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+ * @brief Returns true if every pushed value was popped by exactly one consumer.
+ */
+bool popped_once(TestThread* consumers, int64_t num_consumers) {
+    uint64_t total = NUM_PRODUCERS * VALUES_PER_PRODUCER;
+    uint8_t* seen = (uint8_t *) calloc(total, sizeof(uint8_t));
+    uint64_t count = 0;
+    bool once = true;
+    for (int64_t i = 0; i < num_consumers; i++) {
+        for (uint64_t j = 0; j < consumers[i].num_popped; j++) {
+            int64_t value = consumers[i].popped[j];
+            once = once && (value >= 0) && ((uint64_t) value < total) && (seen[value]++ == 0);
+        }
+        count += consumers[i].num_popped;
+    }
+    free(seen);
+    return once && (count == total);
+}
+
+/**
+ * @brief Returns true if every consumer saw the values of each producer in the
+ *        order they were pushed.
+ */
+bool popped_in_order(TestThread* consumers, int64_t num_consumers) {
+    bool in_order = true;
+    for (int64_t i = 0; i < num_consumers; i++) {
+        int64_t last[NUM_PRODUCERS];
+        for (int64_t p = 0; p < NUM_PRODUCERS; p++) {
+            last[p] = -1;
+        }
+        for (uint64_t j = 0; j < consumers[i].num_popped; j++) {
+            int64_t value = consumers[i].popped[j];
+            int64_t producer = value / VALUES_PER_PRODUCER;
+            in_order = in_order && (value > last[producer]);
+            last[producer] = value;
+        }
+    }
+    return in_order;
+}
+
+/**
+ * @brief Displays the results of unit test functions
+ *
+ * This function processes an array of test results and displays whether tests passed or failed.
+ * It can show detailed results for each individual test when verbose mode is enabled,
+ * and always displays a summary message indicating overall test success or failure.
+ *
+ * @param tests_status Pointer to a boolean array containing test results (PASS/FAIL)
+ * @param num_tests The number of test results in the array
+ * @param verbose If true, displays detailed results for each individual test
+ */
+void display_test_results(bool* tests_status, int8_t num_tests, bool verbose) {
+    bool all_passed = true;
+    for (int8_t i = 0; i < num_tests; i++) {
+        if (tests_status[i] == PASS) {
+            if (verbose) {
+                printf("Test %d passed\n", i + 1);
+            }
+        } else {
+            if (verbose) {
+                printf("Test %d failed\n", i + 1);
+            }
+            all_passed = false;
+        }
+    }
+    if (all_passed) {
+        printf("All tests passed!\n");
+    } else {
+        printf("Some tests failed!\n");
+    }
+}
+
+/*** ConcurrentQueue Unit Tests */
+
+/**
+ * @brief Tests the ConcurrentQueue functions from a single thread
+ *
+ * This function performs six tests:
+ * 1. Verifies that popping from a new queue fails and pop_n returns 0
+ * 2. Verifies that try_pop_front returns values in the order they were pushed
+ * 3. Verifies that pop_n appends the first n values to the list in order
+ * 4. Verifies that pop_n stops at the last value when n is larger than the size
+ * 5. Verifies that the queue can be pushed to again once it was emptied
+ * 6. Verifies that the size follows pushes and pops
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains SINGLE_THREAD_NUM_TESTS elements and must be freed
+ *         by the caller when no longer needed.
+ */
+bool* test_single_thread() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SINGLE_THREAD_NUM_TESTS);
+    ConcurrentQueue* queue_ptr = create_queue();
+    DoublyLinkedList list = {0};
+    int64_t data = -1;
+
+    // Test 1: empty queue
+    tests_status[0] = !try_pop_front(queue_ptr, &data) && (data == -1)
+                      && (pop_n(queue_ptr, &list, 4) == 0) && is_empty(&list);
+
+    // Test 2: first in, first out
+    push_back(queue_ptr, 1);
+    push_back(queue_ptr, 2);
+    push_back(queue_ptr, 3);
+    bool popped = try_pop_front(queue_ptr, &data) && (data == 1);
+    tests_status[1] = popped && try_pop_front(queue_ptr, &data) && (data == 2);
+
+    // Test 3: pop_n takes the first n values
+    for (int64_t i = 4; i <= 10; i++) {
+        push_back(queue_ptr, i);
+    }
+    uint64_t count = pop_n(queue_ptr, &list, 3);
+    tests_status[2] = (count == 3) && (list.size == 3) && (list.head->data == 3)
+                      && (list.head->next->data == 4) && (list.tail->data == 5);
+
+    // Test 4: pop_n stops at the end of the queue
+    count = pop_n(queue_ptr, &list, 100);
+    tests_status[3] = (count == 5) && (list.size == 8) && (list.tail->data == 10)
+                      && !try_pop_front(queue_ptr, &data);
+
+    // Test 5: push after emptying
+    push_back(queue_ptr, 11);
+    tests_status[4] = try_pop_front(queue_ptr, &data) && (data == 11) && (pop_n(queue_ptr, &list, 1) == 0);
+
+    // Test 6: size
+    push_back(queue_ptr, 12);
+    push_back(queue_ptr, 13);
+    uint64_t size = queue_size(queue_ptr);
+    try_pop_front(queue_ptr, &data);
+    tests_status[5] = (size == 2) && (queue_size(queue_ptr) == 1);
+
+    clear(&list);
+    destroy_queue(queue_ptr);
+    queue_thread_exit();
+    return tests_status;
+}
+
+/**
+ * @brief Tests NUM_PRODUCERS producers pushing to a single consumer using pop_n
+ *
+ * This function performs three tests:
+ * 1. Verifies that every value was popped exactly once
+ * 2. Verifies that the values of each producer were popped in the order they were pushed
+ * 3. Verifies that the queue is empty afterwards
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains MPSC_NUM_TESTS elements and must be freed by the
+ *         caller when no longer needed.
+ */
+bool* test_mpsc() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * MPSC_NUM_TESTS);
+    ConcurrentQueue* queue_ptr = create_queue();
+    TestThread consumer;
+    run_threads(queue_ptr, &consumer, 1);
+
+    // Test 1: every value once
+    tests_status[0] = popped_once(&consumer, 1);
+
+    // Test 2: per-producer order
+    tests_status[1] = popped_in_order(&consumer, 1);
+
+    // Test 3: empty afterwards
+    int64_t data;
+    tests_status[2] = (queue_size(queue_ptr) == 0) && !try_pop_front(queue_ptr, &data);
+
+    free(consumer.popped);
+    destroy_queue(queue_ptr);
+    queue_thread_exit();
+    return tests_status;
+}
+
+/**
+ * @brief Tests NUM_PRODUCERS producers pushing to NUM_CONSUMERS consumers, half of
+ *        them using try_pop_front and half using pop_n
+ *
+ * This function performs three tests:
+ * 1. Verifies that every value was popped by exactly one consumer
+ * 2. Verifies that each consumer saw the values of each producer in the order they were pushed
+ * 3. Verifies that the queue is empty afterwards
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains MPMC_NUM_TESTS elements and must be freed by the
+ *         caller when no longer needed.
+ */
+bool* test_mpmc() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * MPMC_NUM_TESTS);
+    ConcurrentQueue* queue_ptr = create_queue();
+    TestThread consumers[NUM_CONSUMERS];
+    run_threads(queue_ptr, consumers, NUM_CONSUMERS);
+
+    // Test 1: every value once
+    tests_status[0] = popped_once(consumers, NUM_CONSUMERS);
+
+    // Test 2: per-producer order within each consumer
+    tests_status[1] = popped_in_order(consumers, NUM_CONSUMERS);
+
+    // Test 3: empty afterwards
+    int64_t data;
+    tests_status[2] = (queue_size(queue_ptr) == 0) && !try_pop_front(queue_ptr, &data);
+
+    for (int64_t i = 0; i < NUM_CONSUMERS; i++) {
+        free(consumers[i].popped);
+    }
+    destroy_queue(queue_ptr);
+    queue_thread_exit();
+    return tests_status;
+}
+
+/**
+ * @brief Tests the reclamation of popped nodes
+ *
+ * This function performs two tests:
+ * 1. Verifies that popped nodes were freed once no thread was using them
+ * 2. Verifies that exited threads gave their hazard records back for reuse
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains RECLAIM_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_reclaim() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RECLAIM_NUM_TESTS);
+    QueueStats stats = queue_stats();
+
+    // Test 1: nothing is left pending once every thread exited
+    tests_status[0] = (stats.pending == 0) && (stats.freed >= 2 * NUM_PRODUCERS * VALUES_PER_PRODUCER);
+
+    // Test 2: records reused
+    ConcurrentQueue* queue_ptr = create_queue();
+    TestThread consumer;
+    run_threads(queue_ptr, &consumer, 1);
+    tests_status[1] = (queue_stats().records == stats.records);
+    free(consumer.popped);
+    destroy_queue(queue_ptr);
+    return tests_status;
+}
+
+/*** Program Starting Point */
+int main() {
+    bool* tests_status = test_single_thread();
+    printf("Testing ConcurrentQueue from one thread: ");
+    display_test_results(tests_status, SINGLE_THREAD_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_mpsc();
+    printf("Testing many producers, one consumer: ");
+    display_test_results(tests_status, MPSC_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_mpmc();
+    printf("Testing many producers, many consumers: ");
+    display_test_results(tests_status, MPMC_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_reclaim();
+    printf("Testing node reclamation: ");
+    display_test_results(tests_status, RECLAIM_NUM_TESTS, false);
+    free(tests_status);
+
+    return 0;
+}
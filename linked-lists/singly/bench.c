@@ -0,0 +1,1363 @@
+/*
+This file is used to benchmark the SinglyLinkedList implementation against a plain
+dynamic array. Every public operation is measured at sizes from 10 up to the size
+given on the command line (10,000,000 by default). Results are printed and written
+to logs/bench.csv so that runs can be compared with diff.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<malloc.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include"singly-linked.h"
+#include"singly-mapped.h"
+#include"singly-stream.h"
+#include"singly-arena.h"
+#include"singly-generic.h"
+#include"singly-parallel.h"
+#include"../bench/bench-harness.h"
+#include"../stats/list-stats.h"
+
+/*** Constants ***/
+#define LIST_NAME "SinglyLinkedList"
+#define ARRAY_NAME "DynamicArray"
+#define SKIP_NAME "SinglyLinkedList+skip"
+#define HASH_NAME "SinglyLinkedList+hash"
+#define REBUILD_NAME "SinglyLinkedList+qsort"
+#define MAPPED_NAME "MappedSinglyList"
+// sorting is only measured on lists at least this long
+#define SORT_MIN_SIZE 1000000
+// starting up from a list file is only measured on lists at least this long
+#define MAPPED_MIN_SIZE 1000000
+// the list file written by the benchmark, deleted once it is done
+#define MAPPED_BENCH_PATH "logs/bench-mapped.list"
+#define STREAM_NAME "SinglyLinkedList+stream"
+// streams are only measured on lists at least this long
+#define STREAM_MIN_SIZE 1000000
+#define ARENA_NAME "ArenaSinglyList"
+#define POOLED_NAME "SinglyLinkedList+pool"
+// node layouts are only compared on lists at least this long
+#define ARENA_MIN_SIZE 1000000
+#define BOXED_NAME "SinglyLinkedList+boxed"
+#define GENERIC_NAME "PointList"
+// boxed and inline elements are only compared on lists at least this long
+#define GENERIC_MIN_SIZE 1000000
+// searches of lists laid out at random in memory are only measured on lists at least this long
+#define PREFETCH_MIN_SIZE 1000000
+// compaction is only measured on lists at least this long
+#define COMPACT_MIN_SIZE 1000000
+// the most nodes moved by each compact_step call measured
+#define COMPACT_STEP_NODES 4096
+// the number of per-worker lists merged by bench_concat
+#define CONCAT_WORKERS 8
+// bench_batch changes one node in this many
+#define BATCH_SPACING 10
+#define PARALLEL_NAME "SinglyLinkedList+parallel"
+// parallel searches are only measured on lists at least this long
+#define PARALLEL_SEARCH_MIN_SIZE 1000000
+// the most threads a parallel search is measured with
+#define PARALLEL_BENCH_THREADS 8
+
+// keeps the compiler from throwing away the results of measured calls
+volatile int64_t sink;
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Builds a list holding the values 0 to length - 1 with append_node,
+ *        so nodes are allocated one at a time like in regular use.
+ */
+SinglyLinkedList* build_list(uint64_t length) {
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, i);
+    }
+    return list_ptr;
+}
+
+/**
+ * @brief Builds a dynamic array holding the values 0 to length - 1.
+ */
+DynamicArray build_array(uint64_t length) {
+    DynamicArray array = {NULL, 0, 0};
+    for (uint64_t i = 0; i < length; i++) {
+        array_append(&array, i);
+    }
+    return array;
+}
+
+/**
+ * @brief Stores a fresh random value in every node of the list, in place.
+ */
+void shuffle_values(SinglyLinkedList* list_ptr) {
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        node->data = (int64_t) bench_random();
+    }
+}
+
+/**
+ * @brief Compares two 64-bit integers for qsort.
+ */
+int compare_values(const void* a, const void* b) {
+    int64_t x = *((const int64_t *) a);
+    int64_t y = *((const int64_t *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Bytes of a stream kept in memory, large enough for any stream of the
+ *        lists measured, written from the front and read from read_at.
+ */
+typedef struct {
+    uint8_t* bytes;
+    uint64_t length;
+    uint64_t read_at;
+} MemoryStream;
+
+/**
+ * @brief Takes the bytes of a stream into the MemoryStream in context.
+ */
+bool memory_write(void* context, const uint8_t* bytes, uint64_t length) {
+    MemoryStream* stream = (MemoryStream *) context;
+    memcpy(stream->bytes + stream->length, bytes, length);
+    stream->length += length;
+    return true;
+}
+
+/**
+ * @brief Gives the bytes of the MemoryStream in context.
+ */
+int64_t memory_read(void* context, uint8_t* bytes, uint64_t capacity) {
+    MemoryStream* stream = (MemoryStream *) context;
+    uint64_t length = stream->length - stream->read_at;
+    length = (length < capacity) ? length : capacity;
+    memcpy(bytes, stream->bytes + stream->read_at, length);
+    stream->read_at += length;
+    return length;
+}
+
+/**
+ * @brief Returns the heap bytes in use, counting blocks malloc took with mmap.
+ */
+uint64_t heap_bytes() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+/**
+ * @brief Prints the heap bytes in use and the resident bytes a list added per node,
+ *        from the counts taken before it was built.
+ */
+void print_node_memory(const char* structure, uint64_t length, uint64_t heap_before, uint64_t resident_before) {
+    uint64_t heap = heap_bytes() - heap_before;
+    uint64_t resident = bench_resident_bytes() - resident_before;
+    printf("%s at %lu nodes: %.2f heap bytes per node, %.2f resident bytes per node\n",
+           structure, length, (double) heap / length, (double) resident / length);
+}
+
+/**
+ * @brief Relinks the nodes of the list in a random order, without moving any
+ *        of them, so that walking the list jumps around memory.
+ */
+void shuffle_links(SinglyLinkedList* list_ptr) {
+    Node** nodes = (Node **) malloc(sizeof(Node *) * list_ptr->size);
+    uint64_t count = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        nodes[count++] = node;
+    }
+    for (uint64_t i = count - 1; i > 0; i--) {
+        uint64_t j = bench_random() % (i + 1);
+        Node* swap = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = swap;
+    }
+    for (uint64_t i = 0; i + 1 < count; i++) {
+        nodes[i]->next = nodes[i + 1];
+    }
+    nodes[count - 1]->next = NULL;
+    list_ptr->head = nodes[0];
+    list_ptr->tail = nodes[count - 1];
+    list_ptr->finger = NULL;
+    free(nodes);
+}
+
+/**
+ * @brief Relinks the nodes of the ArenaSinglyList in a random order, without
+ *        moving any of them in the arena.
+ */
+void shuffle_arena_links(ArenaSinglyList* arena_ptr) {
+    uint32_t* order = (uint32_t *) malloc(sizeof(uint32_t) * arena_ptr->size);
+    uint64_t count = 0;
+    for (uint32_t at = arena_ptr->head; at != ARENA_NIL; at = arena_ptr->nodes[at].next) {
+        order[count++] = at;
+    }
+    for (uint64_t i = count - 1; i > 0; i--) {
+        uint64_t j = bench_random() % (i + 1);
+        uint32_t swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+    for (uint64_t i = 0; i + 1 < count; i++) {
+        arena_ptr->nodes[order[i]].next = order[i + 1];
+    }
+    arena_ptr->nodes[order[count - 1]].next = ARENA_NIL;
+    arena_ptr->head = order[0];
+    arena_ptr->tail = order[count - 1];
+    free(order);
+}
+
+/**
+ * @brief Returns the sum of the values of the SinglyLinkedList in list_ptr.
+ */
+int64_t walk_list(void* list_ptr) {
+    int64_t sum = 0;
+    for (Node* node = ((SinglyLinkedList *) list_ptr)->head; node != NULL; node = node->next) {
+        sum += node->data;
+    }
+    return sum;
+}
+
+/**
+ * @brief Returns the sum of the values of the ArenaSinglyList in arena_ptr.
+ */
+int64_t walk_arena(void* arena_ptr) {
+    const ArenaNode* nodes = ((ArenaSinglyList *) arena_ptr)->nodes;
+    int64_t sum = 0;
+    for (uint32_t at = ((ArenaSinglyList *) arena_ptr)->head; at != ARENA_NIL; at = nodes[at].next) {
+        sum += nodes[at].data;
+    }
+    return sum;
+}
+
+/**
+ * @brief Measures walking every node of a list with walk, where ops/s counts nodes
+ *        visited per second, then prints the cache misses per node of one more walk
+ *        when the machine lets them be counted.
+ */
+void bench_walk(int64_t (*walk)(void*), void* list_ptr, const char* structure, const char* operation,
+                uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = walk(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+    } while (bench_wants_more(samples));
+    bench_report(samples, structure, operation, length);
+
+    int counter = bench_open_cache_misses();
+    uint64_t misses = bench_read_counter(counter);
+    sink = walk(list_ptr);
+    misses = bench_read_counter(counter) - misses;
+    if (counter >= 0) {
+        printf("%s %s at %lu nodes: %.2f cache misses per node\n", structure, operation, length,
+               (double) misses / length);
+    }
+    bench_close_counter(counter);
+}
+
+/**
+ * @brief A 16-byte element, stored behind a pointer in a SinglyLinkedList, or inline
+ *        in a PointList.
+ */
+typedef struct {
+    int64_t x;
+    int64_t y;
+} Point;
+
+/**
+ * @brief Returns true if both points have the same coordinates.
+ */
+static inline bool point_equal(const Point* a, const Point* b) {
+    return (a->x == b->x) && (a->y == b->y);
+}
+
+/**
+ * @brief Mixes both coordinates of the point into a hash.
+ */
+static inline uint64_t point_hash(const Point* point) {
+    uint64_t h = ((uint64_t) point->x * 0x9E3779B97F4A7C15ULL) ^ (uint64_t) point->y;
+    return h ^ (h >> 29);
+}
+
+DEFINE_SINGLY_LIST(PointList, point_list, Point, point_equal, point_hash)
+
+/**
+ * @brief Returns the index of the first node of a list of boxed Points pointing to
+ *        a point equal to the one given, the way find would with a callback.
+ */
+uint64_t boxed_find(SinglyLinkedList* list_ptr, const Point* point) {
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        if (point_equal((const Point *) (intptr_t) node->data, point)) {
+            return index;
+        }
+        index++;
+    }
+    return UINT64_MAX;
+}
+
+/**
+ * @brief Relinks the nodes of the PointList in a random order, without moving any
+ *        of them, like shuffle_links.
+ */
+void shuffle_point_links(PointList* list_ptr) {
+    PointListNode** nodes = (PointListNode **) malloc(sizeof(PointListNode *) * list_ptr->size);
+    uint64_t count = 0;
+    for (PointListNode* node = list_ptr->head; node != NULL; node = node->next) {
+        nodes[count++] = node;
+    }
+    for (uint64_t i = count - 1; i > 0; i--) {
+        uint64_t j = bench_random() % (i + 1);
+        PointListNode* swap = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = swap;
+    }
+    for (uint64_t i = 0; i + 1 < count; i++) {
+        nodes[i]->next = nodes[i + 1];
+    }
+    nodes[count - 1]->next = NULL;
+    list_ptr->head = nodes[0];
+    list_ptr->tail = nodes[count - 1];
+    free(nodes);
+}
+
+/*** Benchmarks ***/
+
+/**
+ * @brief Measures appending to, and prepending to, a structure which already
+ *        holds length values. The list is brought back to length values between
+ *        samples with delete_first, and the array with an untimed shift.
+ */
+void bench_append_prepend(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            append_node(list_ptr, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "append_node", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            array_append(&array, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "append", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            prepend_node(list_ptr, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_first(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "prepend_node", length);
+
+    array.size = length;
+    uint64_t batch = bench_batch(length);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            array_prepend(&array, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            array_delete_first(&array);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "prepend", length);
+
+    destroy_list(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Measures get, find and contains at random positions and for random
+ *        values that are in the structure.
+ */
+void bench_lookups(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+    uint64_t batch = bench_batch(length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = *get(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "get", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = *array_get(&array, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "get", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = array_find(&array, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = contains(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "contains", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = array_contains(&array, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "contains", length);
+
+    destroy_list(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Measures walking the structure in order, with get at increasing indices
+ *        (which starts from the finger of the list) and with a ListCursor.
+ */
+void bench_sequential(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+    uint64_t index = 0;
+    BenchSamples* samples;
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = *get(list_ptr, index);
+            index = (index + 1 == length) ? 0 : index + 1;
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "get_sequential", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = *array_get(&array, index);
+            index = (index + 1 == length) ? 0 : index + 1;
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "get_sequential", length);
+
+    ListCursor cursor = cursor_start(list_ptr);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = *cursor_get(&cursor);
+            if (!cursor_next(&cursor)) {
+                cursor = cursor_start(list_ptr);
+            }
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "cursor_next", length);
+
+    destroy_list(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Prints the memory used by a hash index, then measures find and contains
+ *        with it, for values that are in the list and for values that are not, and
+ *        what the index adds to prepending.
+ */
+void bench_hash_index(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    enable_hash_index(list_ptr);
+    HashIndexStats stats = hash_index_stats(list_ptr);
+    printf("%s index at %lu nodes: %lu slots, %lu bytes, %.2f bytes per node\n",
+           HASH_NAME, length, stats.capacity, stats.bytes, stats.bytes_per_node);
+    BenchSamples* samples;
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = find(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "find", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = contains(list_ptr, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "contains", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            sink = contains(list_ptr, length + bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "contains_missing", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            prepend_node(list_ptr, length + i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_first(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, HASH_NAME, "prepend", length);
+
+    destroy_list(list_ptr);
+}
+
+/**
+ * @brief Measures the positional functions get, replace_node, insert_node and
+ *        delete_node at random indices, on the given list. Every timed insert is
+ *        undone by an untimed delete, and the other way around.
+ */
+void bench_positional_list(SinglyLinkedList* list_ptr, const char* name, uint64_t length, bool with_get) {
+    uint64_t batch = bench_batch(length);
+    uint64_t indices[BENCH_MIN_SAMPLE_WORK];
+    BenchSamples* samples;
+
+    if (with_get) {
+        samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            for (uint64_t i = 0; i < batch; i++) {
+                sink = *get(list_ptr, bench_random() % length);
+            }
+            bench_add_sample(samples, bench_now_ns() - start, batch);
+        } while (bench_wants_more(samples));
+        bench_report(samples, name, "get", length);
+    }
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            sink = replace_node(list_ptr, i, bench_random() % length);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, name, "replace_node", length);
+
+    samples = bench_start();
+    do {
+        for (uint64_t i = 0; i < batch; i++) {
+            indices[i] = bench_random() % length;
+        }
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            insert_node(list_ptr, i, indices[i]);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = batch; i-- > 0;) {
+            delete_node(list_ptr, indices[i]);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, name, "insert_node", length);
+
+    // deletes take at most length values out before putting them back
+    batch = (batch < length) ? batch : length;
+    samples = bench_start();
+    do {
+        for (uint64_t i = 0; i < batch; i++) {
+            indices[i] = bench_random() % (length - i);
+        }
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            delete_node(list_ptr, indices[i]);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = batch; i-- > 0;) {
+            lazy_insert_node(list_ptr, i, indices[i]);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, name, "delete_node", length);
+}
+
+/**
+ * @brief Measures the positional functions on a plain list, and then on the same
+ *        list with a skip index.
+ */
+void bench_positional(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    bench_positional_list(list_ptr, LIST_NAME, length, false);
+    enable_skip_index(list_ptr);
+    bench_positional_list(list_ptr, SKIP_NAME, length, true);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            append_node(list_ptr, i);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            delete_last(list_ptr);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, SKIP_NAME, "append_node", length);
+    destroy_list(list_ptr);
+}
+
+/**
+ * @brief Measures the whole-structure operations: reverse_list, list_to_array
+ *        and copy. Results of list_to_array and copy are freed outside the timer.
+ */
+void bench_whole_list(uint64_t length) {
+    SinglyLinkedList* list_ptr = build_list(length);
+    DynamicArray array = build_array(length);
+    uint64_t batch = bench_batch(length);
+    int64_t* arrays[BENCH_MIN_SAMPLE_WORK];
+    SinglyLinkedList* lists[BENCH_MIN_SAMPLE_WORK];
+    DynamicArray copies[BENCH_MIN_SAMPLE_WORK];
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            reverse_list(list_ptr);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "reverse_list", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            array_reverse(&array);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "reverse", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            arrays[i] = list_to_array(list_ptr);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            free(arrays[i]);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "list_to_array", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            arrays[i] = array_to_array(&array);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            free(arrays[i]);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "to_array", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            lists[i] = copy(list_ptr);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            destroy_list(lists[i]);
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "copy", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < batch; i++) {
+            copies[i] = array_copy(&array);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, batch);
+        for (uint64_t i = 0; i < batch; i++) {
+            array_clear(&(copies[i]));
+        }
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "copy", length);
+
+    destroy_list(list_ptr);
+    array_clear(&array);
+}
+
+/**
+ * @brief Measures clear on a list built with append_node, and on an array.
+ *        Every sample needs a freshly built structure, which is not timed.
+ */
+void bench_clear(uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        SinglyLinkedList* list_ptr = build_list(length);
+        uint64_t start = bench_now_ns();
+        clear(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        free(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "clear", length);
+
+    samples = bench_start();
+    do {
+        DynamicArray array = build_array(length);
+        uint64_t start = bench_now_ns();
+        array_clear(&array);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "clear", length);
+}
+
+/**
+ * @brief Measures sort_list on one thread and on every core, and radix_sort_list,
+ *        against copying the values out with list_to_array, sorting them with
+ *        qsort and building a new list with list_from_array. Every sample sorts a freshly built list of
+ *        random values, since a sorted list has its nodes scattered in memory,
+ *        and the building is not timed. ops/s counts values sorted per second.
+ */
+void bench_sort(uint64_t length) {
+    if (length < SORT_MIN_SIZE) {
+        return;
+    }
+    const char* operations[2] = {"sort_list_t1", "sort_list"};
+    uint64_t num_threads[2] = {1, 0};
+    for (int i = 0; i < 2; i++) {
+        BenchSamples* samples = bench_start();
+        do {
+            SinglyLinkedList* list_ptr = build_list(length);
+            shuffle_values(list_ptr);
+            uint64_t start = bench_now_ns();
+            sort_list(list_ptr, num_threads[i]);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+            destroy_list(list_ptr);
+        } while (bench_wants_more(samples));
+        bench_report(samples, LIST_NAME, operations[i], length);
+    }
+
+    BenchSamples* samples = bench_start();
+    do {
+        SinglyLinkedList* list_ptr = build_list(length);
+        shuffle_values(list_ptr);
+        uint64_t start = bench_now_ns();
+        radix_sort_list(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_list(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "radix_sort_list", length);
+
+    samples = bench_start();
+    do {
+        SinglyLinkedList* list_ptr = build_list(length);
+        shuffle_values(list_ptr);
+        uint64_t start = bench_now_ns();
+        int64_t* values = list_to_array(list_ptr);
+        qsort(values, length, sizeof(int64_t), compare_values);
+        destroy_list(list_ptr);
+        list_ptr = list_from_array(values, length);
+        free(values);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_list(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, REBUILD_NAME, "sort_list", length);
+}
+
+/**
+ * @brief Measures starting up from a list file: mapping it with open_mapped_list,
+ *        and mapping it and walking every node, against building the list again
+ *        with append_node for every value, the way it is done without a list
+ *        file. Every operation is one start-up of the whole list, and the file
+ *        is already in the page cache.
+ */
+void bench_mapped(uint64_t length) {
+    if (length < MAPPED_MIN_SIZE) {
+        return;
+    }
+    SinglyLinkedList* list_ptr = build_list(length);
+    save_mapped_list(list_ptr, MAPPED_BENCH_PATH);
+    destroy_list(list_ptr);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        MappedSinglyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        close_mapped_list(mapped_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, MAPPED_NAME, "open_mapped_list", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        MappedSinglyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+        int64_t sum = 0;
+        for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node)) {
+            sum += node->data;
+        }
+        sink = sum;
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        close_mapped_list(mapped_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, MAPPED_NAME, "open_and_walk", length);
+
+    MappedSinglyList* mapped_ptr = open_mapped_list(MAPPED_BENCH_PATH);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        list_ptr = create_empty_list();
+        for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node)) {
+            append_node(list_ptr, node->data);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+        destroy_list(list_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "rebuild", length);
+    close_mapped_list(mapped_ptr);
+    remove(MAPPED_BENCH_PATH);
+}
+
+/**
+ * @brief Measures writing a list to a stream in memory with encode_list, and
+ *        reading it back into a new list with decode_list, against shipping the
+ *        raw array: list_to_array and a copy of its 8 bytes per value, then
+ *        list_from_array. Lists of consecutive values, of values a small random
+ *        step apart, and of random 64-bit values are measured, and the bytes per
+ *        value of each stream are printed. ops/s counts values per second.
+ */
+void bench_stream(uint64_t length) {
+    if (length < STREAM_MIN_SIZE) {
+        return;
+    }
+    const char* kinds[3] = {"consecutive", "close", "random"};
+    MemoryStream stream = {(uint8_t *) malloc(STREAM_VARINT_BYTES * length + 64), 0, 0};
+    char operation[32];
+    for (int kind = 0; kind < 3; kind++) {
+        SinglyLinkedList* list_ptr = build_list(length);
+        int64_t value = 0;
+        for (Node* node = list_ptr->head; (node != NULL) && (kind > 0); node = node->next) {
+            value += (int64_t) (bench_random() % 201) - 100;
+            node->data = (kind == 1) ? value : (int64_t) bench_random();
+        }
+
+        BenchSamples* samples = bench_start();
+        do {
+            stream.length = 0;
+            uint64_t start = bench_now_ns();
+            encode_list(list_ptr, memory_write, &stream);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+        } while (bench_wants_more(samples));
+        snprintf(operation, sizeof(operation), "encode_%s", kinds[kind]);
+        bench_report(samples, STREAM_NAME, operation, length);
+        printf("Stream of %s values at %lu values: %lu bytes, %.2f bytes per value\n",
+               kinds[kind], length, stream.length, (double) stream.length / length);
+
+        samples = bench_start();
+        do {
+            stream.read_at = 0;
+            SinglyLinkedList* decoded = create_empty_list();
+            uint64_t start = bench_now_ns();
+            decode_list(decoded, memory_read, &stream);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+            destroy_list(decoded);
+        } while (bench_wants_more(samples));
+        snprintf(operation, sizeof(operation), "decode_%s", kinds[kind]);
+        bench_report(samples, STREAM_NAME, operation, length);
+        destroy_list(list_ptr);
+    }
+
+    SinglyLinkedList* list_ptr = build_list(length);
+    BenchSamples* samples = bench_start();
+    do {
+        stream.length = 0;
+        uint64_t start = bench_now_ns();
+        int64_t* values = list_to_array(list_ptr);
+        memory_write(&stream, (const uint8_t *) values, sizeof(int64_t) * length);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        free(values);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "raw_export", length);
+
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        SinglyLinkedList* decoded = list_from_array((int64_t *) stream.bytes, length);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_list(decoded);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "raw_import", length);
+    destroy_list(list_ptr);
+    free(stream.bytes);
+}
+
+/**
+ * @brief Compares the ArenaSinglyList, with 12 byte nodes linked by 32-bit indices,
+ *        against the SinglyLinkedList with a malloc call per node and with a NodePool.
+ *        The heap bytes in use and the resident bytes each list adds are printed per
+ *        node. Every list is walked with its nodes linked in the order they lie in
+ *        memory, and again once they are relinked in a random order, when nearly
+ *        every step is a cache miss. Last, copy is measured against arena_copy.
+ */
+void bench_arena(uint64_t length) {
+    if (length < ARENA_MIN_SIZE) {
+        return;
+    }
+    malloc_trim(0);
+    uint64_t heap_before = heap_bytes();
+    uint64_t resident_before = bench_resident_bytes();
+    SinglyLinkedList* list_ptr = build_list(length);
+    print_node_memory(LIST_NAME, length, heap_before, resident_before);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_in_order", length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    NodePool* pool = create_node_pool(0);
+    list_ptr = create_empty_list();
+    attach_pool(list_ptr, pool);
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, i);
+    }
+    print_node_memory(POOLED_NAME, length, heap_before, resident_before);
+    bench_walk(walk_list, list_ptr, POOLED_NAME, "walk_in_order", length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, POOLED_NAME, "walk_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+    destroy_node_pool(pool);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    ArenaSinglyList* arena_ptr = create_arena_list(length);
+    for (uint64_t i = 0; i < length; i++) {
+        arena_append(arena_ptr, i);
+    }
+    print_node_memory(ARENA_NAME, length, heap_before, resident_before);
+    bench_walk(walk_arena, arena_ptr, ARENA_NAME, "walk_in_order", length);
+    shuffle_arena_links(arena_ptr);
+    bench_walk(walk_arena, arena_ptr, ARENA_NAME, "walk_shuffled", length);
+
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        ArenaSinglyList* copy_ptr = arena_copy(arena_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_arena_list(copy_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARENA_NAME, "arena_copy", length);
+    destroy_arena_list(arena_ptr);
+
+    list_ptr = build_list(length);
+    samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        SinglyLinkedList* copy_ptr = copy(list_ptr);
+        bench_add_sample(samples, bench_now_ns() - start, length);
+        destroy_list(copy_ptr);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, "copy", length);
+    clear(list_ptr);
+    free(list_ptr);
+}
+
+/**
+ * @brief Compares searching a list of 16-byte Points stored behind pointers, in a
+ *        SinglyLinkedList holding their addresses, against a PointList made by
+ *        DEFINE_SINGLY_LIST, which stores them in the nodes. Each find looks for a
+ *        point which is not in the list, so it compares every element. Both lists are
+ *        searched with their nodes linked in the order they lie in memory, and again
+ *        once they are relinked in a random order. Last, the PointList is searched
+ *        with its hash index.
+ */
+void bench_generic(uint64_t length) {
+    if (length < GENERIC_MIN_SIZE) {
+        return;
+    }
+    Point missing = {-1, -1};
+    malloc_trim(0);
+    uint64_t heap_before = heap_bytes();
+    uint64_t resident_before = bench_resident_bytes();
+    // the points are allocated before the nodes, as if the list was built from elements
+    // which already existed
+    Point** boxes = (Point **) malloc(sizeof(Point *) * length);
+    for (uint64_t i = 0; i < length; i++) {
+        boxes[i] = (Point *) malloc(sizeof(Point));
+        *boxes[i] = (Point) {i, 2 * i};
+    }
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, (int64_t) (intptr_t) boxes[i]);
+    }
+    print_node_memory(BOXED_NAME, length, heap_before + sizeof(Point *) * length, resident_before);
+    const char* operations[2] = {"find_in_order", "find_shuffled"};
+    for (int shuffled = 0; shuffled < 2; shuffled++) {
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            sink = (int64_t) boxed_find(list_ptr, &missing);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+        } while (bench_wants_more(samples));
+        bench_report(samples, BOXED_NAME, operations[shuffled], length);
+        shuffle_links(list_ptr);
+    }
+    clear(list_ptr);
+    free(list_ptr);
+    for (uint64_t i = 0; i < length; i++) {
+        free(boxes[i]);
+    }
+    free(boxes);
+
+    malloc_trim(0);
+    heap_before = heap_bytes();
+    resident_before = bench_resident_bytes();
+    PointList points = {0};
+    for (uint64_t i = 0; i < length; i++) {
+        Point point = {i, 2 * i};
+        point_list_append(&points, &point);
+    }
+    print_node_memory(GENERIC_NAME, length, heap_before, resident_before);
+    for (int shuffled = 0; shuffled < 2; shuffled++) {
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            sink = (int64_t) point_list_find(&points, &missing);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+        } while (bench_wants_more(samples));
+        bench_report(samples, GENERIC_NAME, operations[shuffled], length);
+        shuffle_point_links(&points);
+    }
+
+    point_list_enable_hash_index(&points);
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < BENCH_MIN_SAMPLE_WORK; i++) {
+            int64_t x = bench_random() % (2 * length);
+            Point point = {x, 2 * x};
+            sink = point_list_contains(&points, &point);
+        }
+        bench_add_sample(samples, bench_now_ns() - start, BENCH_MIN_SAMPLE_WORK);
+    } while (bench_wants_more(samples));
+    bench_report(samples, GENERIC_NAME, "contains_hashed", length);
+    point_list_clear(&points);
+}
+
+/**
+ * @brief Compares find (of a value the list does not hold, so every node is compared)
+ *        and list_to_array on a list walked as one chain, against the same list with a
+ *        skip index, whose runs are walked WALK_LANES at a time. The nodes are relinked
+ *        in a random order first, so that nearly every step is a cache miss once the
+ *        list is larger than the cache. ops/s counts the nodes visited per second.
+ */
+void bench_prefetch(uint64_t length) {
+    if (length < PREFETCH_MIN_SIZE) {
+        return;
+    }
+    SinglyLinkedList* list_ptr = build_list(length);
+    shuffle_links(list_ptr);
+    const char* names[2] = {LIST_NAME, SKIP_NAME};
+    for (int indexed = 0; indexed < 2; indexed++) {
+        if (indexed) {
+            enable_skip_index(list_ptr);
+        }
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            sink = (int64_t) find(list_ptr, -1);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+        } while (bench_wants_more(samples));
+        bench_report(samples, names[indexed], "find_shuffled", length);
+
+        samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            int64_t* arr = list_to_array(list_ptr);
+            bench_add_sample(samples, bench_now_ns() - start, length);
+            free(arr);
+        } while (bench_wants_more(samples));
+        bench_report(samples, names[indexed], "list_to_array_shuffled", length);
+    }
+    destroy_list(list_ptr);
+}
+
+/*** Program Starting Point */
+
+/**
+ * @brief Walks a list of malloc'd nodes relinked in a random order, moves it into one
+ *        block with compact_list, and walks it again. The same list is then shuffled
+ *        once more and compacted by compact_step calls of COMPACT_STEP_NODES nodes,
+ *        each measured as one sample, to show the pause a single step costs.
+ */
+void bench_compact(uint64_t length) {
+    if (length < COMPACT_MIN_SIZE) {
+        return;
+    }
+    SinglyLinkedList* list_ptr = build_list(length);
+    shuffle_links(list_ptr);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_shuffled", length);
+
+    uint64_t start = bench_now_ns();
+    compact_list(list_ptr, NULL, NULL);
+    uint64_t elapsed = bench_now_ns() - start;
+    printf("%s compact_list at %lu nodes: %.1f ms, %.1f ns per node\n", LIST_NAME, length,
+           elapsed / 1e6, (double) elapsed / length);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_compacted", length);
+
+    shuffle_links(list_ptr);
+    BenchSamples* samples = bench_start();
+    bool more = true;
+    while (more) {
+        start = bench_now_ns();
+        more = compact_step(list_ptr, COMPACT_STEP_NODES, NULL, NULL);
+        bench_add_sample(samples, bench_now_ns() - start, COMPACT_STEP_NODES);
+    }
+    bench_report(samples, LIST_NAME, "compact_step", length);
+    bench_walk(walk_list, list_ptr, LIST_NAME, "walk_stepped", length);
+    destroy_list(list_ptr);
+}
+
+/**
+ * @brief Merges CONCAT_WORKERS lists of length / CONCAT_WORKERS malloc'd nodes each
+ *        into one list, by appending a copy of every node and clearing the worker
+ *        list, and with concat. Only the merge is timed; ops/s counts the nodes
+ *        merged per second.
+ */
+void bench_concat(uint64_t length) {
+    if (length < CONCAT_WORKERS) {
+        return;
+    }
+    uint64_t per_worker = length / CONCAT_WORKERS;
+    SinglyLinkedList* workers[CONCAT_WORKERS];
+    for (int merged = 0; merged < 2; merged++) {
+        BenchSamples* samples = bench_start();
+        do {
+            for (int w = 0; w < CONCAT_WORKERS; w++) {
+                workers[w] = build_list(per_worker);
+            }
+            SinglyLinkedList* result = create_empty_list();
+            uint64_t start = bench_now_ns();
+            for (int w = 0; w < CONCAT_WORKERS; w++) {
+                if (merged) {
+                    concat(workers[w], result);
+                } else {
+                    for (Node* node = workers[w]->head; node != NULL; node = node->next) {
+                        append_node(result, node->data);
+                    }
+                    clear(workers[w]);
+                }
+            }
+            bench_add_sample(samples, bench_now_ns() - start, per_worker * CONCAT_WORKERS);
+            sink = (int64_t) size(result);
+            for (int w = 0; w < CONCAT_WORKERS; w++) {
+                destroy_list(workers[w]);
+            }
+            destroy_list(result);
+        } while (bench_wants_more(samples));
+        bench_report(samples, LIST_NAME, merged ? "concat" : "merge_by_copy", length);
+    }
+}
+
+/**
+ * @brief Compares inserting and deleting one node in every BATCH_SPACING, at random
+ *        spots, with one insert_node or delete_node call per node (in increasing
+ *        order, so the finger saves most of each walk) and with one insert_nodes or
+ *        delete_nodes call for the whole batch. Each timed batch is undone untimed, so
+ *        the list keeps its length. ops/s counts the nodes inserted or deleted.
+ */
+void bench_batches(uint64_t length) {
+    if (length < BATCH_SPACING) {
+        return;
+    }
+    uint64_t count = length / BATCH_SPACING;
+    SinglyLinkedList* list_ptr = build_list(length);
+    IndexedValue* inserts = (IndexedValue *) malloc(sizeof(IndexedValue) * count);
+    uint64_t* indices = (uint64_t *) malloc(sizeof(uint64_t) * count);
+    for (uint64_t i = 0; i < count; i++) {
+        inserts[i].index = i * BATCH_SPACING + bench_random() % BATCH_SPACING;
+        inserts[i].data = -1;
+        // where the insert ended up, after the ones before it
+        indices[i] = inserts[i].index + i;
+    }
+    for (int batched = 0; batched < 2; batched++) {
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            if (batched) {
+                insert_nodes(list_ptr, inserts, count);
+            } else {
+                for (uint64_t i = 0; i < count; i++) {
+                    insert_node(list_ptr, inserts[i].data, indices[i]);
+                }
+            }
+            bench_add_sample(samples, bench_now_ns() - start, count);
+            delete_nodes(list_ptr, indices, count);
+        } while (bench_wants_more(samples));
+        bench_report(samples, LIST_NAME, batched ? "insert_nodes" : "insert_node_each", length);
+
+        samples = bench_start();
+        do {
+            insert_nodes(list_ptr, inserts, count);
+            uint64_t start = bench_now_ns();
+            if (batched) {
+                delete_nodes(list_ptr, indices, count);
+            } else {
+                for (uint64_t i = 0; i < count; i++) {
+                    delete_node(list_ptr, (int64_t) inserts[i].index);
+                }
+            }
+            bench_add_sample(samples, bench_now_ns() - start, count);
+        } while (bench_wants_more(samples));
+        bench_report(samples, LIST_NAME, batched ? "delete_nodes" : "delete_node_each", length);
+    }
+    free(indices);
+    free(inserts);
+    destroy_list(list_ptr);
+}
+
+/**
+ * @brief Measures find against parallel_find with 2 up to PARALLEL_BENCH_THREADS
+ *        threads on a list with a skip index, for values at random places in the
+ *        list and for missing values, which make every segment be scanned.
+ */
+void bench_parallel(uint64_t length) {
+    if (length < PARALLEL_SEARCH_MIN_SIZE) {
+        return;
+    }
+    SinglyLinkedList* list_ptr = build_list(length);
+    enable_skip_index(list_ptr);
+    uint64_t batch = bench_batch(length);
+
+    for (int missing = 0; missing < 2; missing++) {
+        const char* operation = missing ? "find_missing" : "find";
+        BenchSamples* samples = bench_start();
+        do {
+            uint64_t start = bench_now_ns();
+            for (uint64_t i = 0; i < batch; i++) {
+                sink = find(list_ptr, missing ? -1 : (int64_t) (bench_random() % length));
+            }
+            bench_add_sample(samples, bench_now_ns() - start, batch);
+        } while (bench_wants_more(samples));
+        bench_report(samples, SKIP_NAME, operation, length);
+
+        for (uint64_t threads = 2; threads <= PARALLEL_BENCH_THREADS; threads *= 2) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%lu", PARALLEL_NAME, threads);
+            samples = bench_start();
+            do {
+                uint64_t start = bench_now_ns();
+                for (uint64_t i = 0; i < batch; i++) {
+                    sink = parallel_find(list_ptr, missing ? -1 : (int64_t) (bench_random() % length), threads);
+                }
+                bench_add_sample(samples, bench_now_ns() - start, batch);
+            } while (bench_wants_more(samples));
+            bench_report(samples, name, operation, length);
+        }
+    }
+
+    destroy_list(list_ptr);
+}
+
+int main(int argc, char** argv) {
+    uint64_t max_size = bench_max_size(argc, argv);
+    if (!bench_open_csv(BENCH_CSV_PATH)) {
+        printf("Could not open %s, results are only printed.\n", BENCH_CSV_PATH);
+    }
+    bench_seed(12);
+    for (uint64_t length = 10; length <= max_size; length *= 10) {
+        bench_append_prepend(length);
+        bench_lookups(length);
+        bench_sequential(length);
+        bench_hash_index(length);
+        bench_positional(length);
+        bench_whole_list(length);
+        bench_clear(length);
+        bench_sort(length);
+        bench_mapped(length);
+        bench_stream(length);
+        bench_arena(length);
+        bench_generic(length);
+        bench_prefetch(length);
+        bench_compact(length);
+        bench_concat(length);
+        bench_batches(length);
+        bench_parallel(length);
+    }
+    // only built with make bench STATS=1, in which case every time above includes the counting
+    ListStats stats = list_stats_snapshot();
+    if (stats.enabled) {
+        printf("Instrumentation of the main thread:\n");
+        list_stats_print(&stats);
+    }
+    bench_close_csv();
+    return 0;
+}
@@ -0,0 +1,303 @@
+/*
+This document is meant to store the implementation of the arena mode of the
+singly linked list. Nodes are stored in one array which is grown with realloc,
+and are linked by their indices in it, so the list stays valid wherever the
+array is moved or copied.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdlib.h>
+#include<string.h>
+#include"singly-arena.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Doubles the number of nodes the arena has room for, up to
+ *        ARENA_MAX_NODES. Returns false if it is full or realloc failed.
+ */
+static bool grow_arena(ArenaSinglyList* arena_ptr) {
+    if (arena_ptr->capacity == ARENA_MAX_NODES) {
+        return false;
+    }
+    uint64_t capacity = 2 * (uint64_t) arena_ptr->capacity;
+    if (capacity > ARENA_MAX_NODES) {
+        capacity = ARENA_MAX_NODES;
+    }
+    ArenaNode* nodes = (ArenaNode *) realloc(arena_ptr->nodes, capacity * sizeof(ArenaNode));
+    if (nodes == NULL) {
+        return false;
+    }
+    arena_ptr->nodes = nodes;
+    arena_ptr->capacity = (uint32_t) capacity;
+    return true;
+}
+
+/**
+ * @brief Takes a slot for a new node holding data, from the deleted nodes
+ *        first, and returns its index, or ARENA_NIL if the arena could not grow.
+ */
+static uint32_t arena_slot(ArenaSinglyList* arena_ptr, int64_t data) {
+    uint32_t at = arena_ptr->free_list;
+    if (at != ARENA_NIL) {
+        arena_ptr->free_list = arena_ptr->nodes[at].next;
+    } else {
+        if ((arena_ptr->used == arena_ptr->capacity) && !grow_arena(arena_ptr)) {
+            return ARENA_NIL;
+        }
+        at = arena_ptr->used++;
+    }
+    arena_ptr->nodes[at].data = data;
+    arena_ptr->nodes[at].next = ARENA_NIL;
+    return at;
+}
+
+/**
+ * @brief Puts the slot of a node which is no longer linked into the list
+ *        on the free list.
+ */
+static void release_slot(ArenaSinglyList* arena_ptr, uint32_t at) {
+    arena_ptr->nodes[at].next = arena_ptr->free_list;
+    arena_ptr->free_list = at;
+}
+
+/**
+ * @brief Returns the arena index of the node at the given index of the list,
+ *        which must be less than its size.
+ */
+static uint32_t arena_walk(ArenaSinglyList* arena_ptr, uint64_t index) {
+    uint32_t at = arena_ptr->head;
+    for (uint64_t i = 0; i < index; i++) {
+        at = arena_ptr->nodes[at].next;
+    }
+    return at;
+}
+
+/*** ArenaSinglyList Functions ***/
+
+ArenaSinglyList* create_arena_list(uint32_t capacity) {
+    if (capacity == 0) {
+        capacity = ARENA_DEFAULT_CAPACITY;
+    } else if (capacity > ARENA_MAX_NODES) {
+        capacity = ARENA_MAX_NODES;
+    }
+    ArenaSinglyList* arena_ptr = (ArenaSinglyList *) malloc(sizeof(ArenaSinglyList));
+    ArenaNode* nodes = (ArenaNode *) malloc((uint64_t) capacity * sizeof(ArenaNode));
+    if ((arena_ptr == NULL) || (nodes == NULL)) {
+        free(arena_ptr);
+        free(nodes);
+        return NULL;
+    }
+    arena_ptr->nodes = nodes;
+    arena_ptr->capacity = capacity;
+    clear_arena_list(arena_ptr);
+    return arena_ptr;
+}
+
+ArenaSinglyList* arena_from_list(SinglyLinkedList* list_ptr) {
+    if (list_ptr->size > ARENA_MAX_NODES) {
+        return NULL;
+    }
+    ArenaSinglyList* arena_ptr = create_arena_list((uint32_t) list_ptr->size);
+    if (arena_ptr == NULL) {
+        return NULL;
+    }
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        arena_append(arena_ptr, node->data);
+    }
+    return arena_ptr;
+}
+
+ArenaSinglyList* arena_copy(ArenaSinglyList* arena_ptr) {
+    ArenaSinglyList* copy_ptr = create_arena_list(arena_ptr->capacity);
+    if (copy_ptr == NULL) {
+        return NULL;
+    }
+    ArenaNode* nodes = copy_ptr->nodes;
+    *copy_ptr = *arena_ptr;
+    copy_ptr->nodes = nodes;
+    memcpy(nodes, arena_ptr->nodes, (uint64_t) arena_ptr->used * sizeof(ArenaNode));
+    return copy_ptr;
+}
+
+void destroy_arena_list(ArenaSinglyList* arena_ptr) {
+    free(arena_ptr->nodes);
+    free(arena_ptr);
+}
+
+void clear_arena_list(ArenaSinglyList* arena_ptr) {
+    arena_ptr->used = 0;
+    arena_ptr->head = ARENA_NIL;
+    arena_ptr->tail = ARENA_NIL;
+    arena_ptr->free_list = ARENA_NIL;
+    arena_ptr->size = 0;
+}
+
+uint32_t arena_size(ArenaSinglyList* arena_ptr) {
+    return arena_ptr->size;
+}
+
+uint32_t arena_head(ArenaSinglyList* arena_ptr) {
+    return arena_ptr->head;
+}
+
+uint32_t arena_next(ArenaSinglyList* arena_ptr, uint32_t at) {
+    return arena_ptr->nodes[at].next;
+}
+
+int64_t arena_data(ArenaSinglyList* arena_ptr, uint32_t at) {
+    return arena_ptr->nodes[at].data;
+}
+
+bool arena_get(ArenaSinglyList* arena_ptr, uint64_t index, int64_t* data) {
+    if (index >= arena_ptr->size) {
+        return false;
+    }
+    *data = arena_ptr->nodes[arena_walk(arena_ptr, index)].data;
+    return true;
+}
+
+bool arena_contains(ArenaSinglyList* arena_ptr, int64_t data) {
+    return arena_find(arena_ptr, data) != UINT64_MAX;
+}
+
+uint64_t arena_find(ArenaSinglyList* arena_ptr, int64_t data) {
+    const ArenaNode* nodes = arena_ptr->nodes;
+    uint64_t index = 0;
+    for (uint32_t at = arena_ptr->head; at != ARENA_NIL; at = nodes[at].next) {
+        if (nodes[at].data == data) {
+            return index;
+        }
+        index++;
+    }
+    return UINT64_MAX;
+}
+
+bool arena_append(ArenaSinglyList* arena_ptr, int64_t data) {
+    uint32_t at = arena_slot(arena_ptr, data);
+    if (at == ARENA_NIL) {
+        return false;
+    }
+    if (arena_ptr->size == 0) {
+        arena_ptr->head = at;
+    } else {
+        arena_ptr->nodes[arena_ptr->tail].next = at;
+    }
+    arena_ptr->tail = at;
+    arena_ptr->size++;
+    return true;
+}
+
+bool arena_prepend(ArenaSinglyList* arena_ptr, int64_t data) {
+    uint32_t at = arena_slot(arena_ptr, data);
+    if (at == ARENA_NIL) {
+        return false;
+    }
+    arena_ptr->nodes[at].next = arena_ptr->head;
+    if (arena_ptr->size == 0) {
+        arena_ptr->tail = at;
+    }
+    arena_ptr->head = at;
+    arena_ptr->size++;
+    return true;
+}
+
+bool arena_insert_node(ArenaSinglyList* arena_ptr, int64_t data, uint64_t index) {
+    if (index > arena_ptr->size) {
+        return false;
+    } else if (index == 0) {
+        return arena_prepend(arena_ptr, data);
+    } else if (index == arena_ptr->size) {
+        return arena_append(arena_ptr, data);
+    }
+    // the slot is taken first, since growing the arena may move every node
+    uint32_t at = arena_slot(arena_ptr, data);
+    if (at == ARENA_NIL) {
+        return false;
+    }
+    uint32_t prev = arena_walk(arena_ptr, index - 1);
+    arena_ptr->nodes[at].next = arena_ptr->nodes[prev].next;
+    arena_ptr->nodes[prev].next = at;
+    arena_ptr->size++;
+    return true;
+}
+
+bool arena_replace_node(ArenaSinglyList* arena_ptr, int64_t data, uint64_t index) {
+    if (index >= arena_ptr->size) {
+        return false;
+    }
+    arena_ptr->nodes[arena_walk(arena_ptr, index)].data = data;
+    return true;
+}
+
+void arena_delete_first(ArenaSinglyList* arena_ptr) {
+    if (arena_ptr->size == 0) {
+        return;
+    }
+    uint32_t head = arena_ptr->head;
+    arena_ptr->head = arena_ptr->nodes[head].next;
+    arena_ptr->size--;
+    if (arena_ptr->size == 0) {
+        arena_ptr->tail = ARENA_NIL;
+    }
+    release_slot(arena_ptr, head);
+}
+
+void arena_delete_last(ArenaSinglyList* arena_ptr) {
+    if (arena_ptr->size <= 1) {
+        arena_delete_first(arena_ptr);
+        return;
+    }
+    uint32_t prev = arena_walk(arena_ptr, arena_ptr->size - 2);
+    release_slot(arena_ptr, arena_ptr->tail);
+    arena_ptr->nodes[prev].next = ARENA_NIL;
+    arena_ptr->tail = prev;
+    arena_ptr->size--;
+}
+
+void arena_delete_node(ArenaSinglyList* arena_ptr, uint64_t index) {
+    if (index >= arena_ptr->size) {
+        return;
+    } else if (index == 0) {
+        arena_delete_first(arena_ptr);
+        return;
+    }
+    uint32_t prev = arena_walk(arena_ptr, index - 1);
+    uint32_t at = arena_ptr->nodes[prev].next;
+    arena_ptr->nodes[prev].next = arena_ptr->nodes[at].next;
+    if (at == arena_ptr->tail) {
+        arena_ptr->tail = prev;
+    }
+    arena_ptr->size--;
+    release_slot(arena_ptr, at);
+}
+
+void arena_reverse_list(ArenaSinglyList* arena_ptr) {
+    uint32_t prev = ARENA_NIL;
+    uint32_t at = arena_ptr->head;
+    arena_ptr->tail = at;
+    while (at != ARENA_NIL) {
+        uint32_t next = arena_ptr->nodes[at].next;
+        arena_ptr->nodes[at].next = prev;
+        prev = at;
+        at = next;
+    }
+    arena_ptr->head = prev;
+}
+
+int64_t* arena_to_array(ArenaSinglyList* arena_ptr) {
+    if (arena_ptr->size == 0) {
+        return NULL;
+    }
+    int64_t* arr = (int64_t *) malloc((uint64_t) arena_ptr->size * sizeof(int64_t));
+    if (arr == NULL) {
+        return NULL;
+    }
+    uint64_t i = 0;
+    for (uint32_t at = arena_ptr->head; at != ARENA_NIL; at = arena_ptr->nodes[at].next) {
+        arr[i++] = arena_ptr->nodes[at].data;
+    }
+    return arr;
+}
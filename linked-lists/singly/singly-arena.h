@@ -0,0 +1,233 @@
+/*
+This header file is used to declare the ArenaNode struct, and the functions
+used to manage the arena mode of the singly linked list, where every node
+lives in one contiguous array and links to the next one by its 32-bit index
+in the array instead of by its address.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef SINGLYARENA_H
+#define SINGLYARENA_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"singly-linked.h"
+
+/*** Constants ***/
+// the index which stands for no node, like NULL does for a pointer
+#define ARENA_NIL UINT32_MAX
+// the most nodes an arena can hold, since ARENA_NIL is not a node
+#define ARENA_MAX_NODES (ARENA_NIL - 1)
+// the number of nodes a new arena has room for when no capacity is given
+#define ARENA_DEFAULT_CAPACITY 1024
+
+
+/*** Struct Definitions ***/
+
+/**
+ * @brief A node of an ArenaSinglyList.
+ * Contains the 64-bit signed integer data of the node, and the index
+ * of the next node in the arena, or ARENA_NIL for the last node. The
+ * struct is packed, so a node takes 12 bytes instead of the 16 bytes
+ * of a Node, and data is read unaligned on every other node.
+ */
+typedef struct __attribute__((packed)) {
+    int64_t data;
+    uint32_t next;
+} ArenaNode;
+
+/**
+ * @brief A singly linked list whose nodes all live in one array.
+ * Contains the array of nodes, the number of nodes it has room for,
+ * the number of nodes of the array ever used, the indices of the head
+ * and tail nodes, the index of the first deleted node waiting to be
+ * reused (deleted nodes are linked through next), and the number of
+ * nodes in the list. Since no node holds an address, the array can be
+ * moved by realloc or copied with memcpy and still be the same list.
+ */
+typedef struct {
+    ArenaNode* nodes;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t free_list;
+    uint32_t size;
+} ArenaSinglyList;
+
+
+/*** ArenaSinglyList Functions ***/
+
+/**
+ * @brief Creates an empty ArenaSinglyList.
+ *        Note: The user must call destroy_arena_list when the list is no
+ *        longer needed.
+ * @param capacity The number of nodes the arena has room for before it has
+ *        to grow, or 0 to use ARENA_DEFAULT_CAPACITY.
+ * @return A pointer to the new ArenaSinglyList, or NULL if memory
+ *         allocation failed.
+ */
+ArenaSinglyList* create_arena_list(uint32_t capacity);
+
+/**
+ * @brief Creates an ArenaSinglyList holding the values of a
+ *        SinglyLinkedList in order, with the nodes one after the other in
+ *        the arena.
+ * @param list_ptr A pointer to the SinglyLinkedList to copy.
+ * @return A pointer to the new ArenaSinglyList, or NULL if memory
+ *         allocation failed or the list is longer than ARENA_MAX_NODES.
+ */
+ArenaSinglyList* arena_from_list(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Copies the ArenaSinglyList with a single memcpy of its arena,
+ *        without walking a single node.
+ * @param arena_ptr A pointer to the ArenaSinglyList to copy.
+ * @return A pointer to the new ArenaSinglyList, or NULL if memory
+ *         allocation failed.
+ */
+ArenaSinglyList* arena_copy(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Frees the arena of the ArenaSinglyList, and then the list itself.
+ * @param arena_ptr A pointer to the ArenaSinglyList to destroy.
+ */
+void destroy_arena_list(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Deletes every node of the ArenaSinglyList, keeping the arena so
+ *        that new nodes are stored in it again from the start.
+ * @param arena_ptr A pointer to the ArenaSinglyList to clear.
+ */
+void clear_arena_list(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Returns the number of nodes in the ArenaSinglyList.
+ * @param arena_ptr A pointer to the ArenaSinglyList.
+ */
+uint32_t arena_size(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Returns the index of the first node of the ArenaSinglyList in
+ *        its arena, or ARENA_NIL if the list is empty. With arena_next
+ *        and arena_data, the list is walked as
+ *        for (uint32_t at = arena_head(arena_ptr); at != ARENA_NIL; at = arena_next(arena_ptr, at)).
+ * @param arena_ptr A pointer to the ArenaSinglyList.
+ */
+uint32_t arena_head(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Returns the index of the node after the node at index at in the
+ *        arena, or ARENA_NIL if it is the last node.
+ * @param arena_ptr A pointer to the ArenaSinglyList.
+ * @param at The index in the arena of a node of the list.
+ */
+uint32_t arena_next(ArenaSinglyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Returns the data of the node at index at in the arena.
+ * @param arena_ptr A pointer to the ArenaSinglyList.
+ * @param at The index in the arena of a node of the list.
+ */
+int64_t arena_data(ArenaSinglyList* arena_ptr, uint32_t at);
+
+/**
+ * @brief Stores the data of the node at the specified index of the list,
+ *        counted from the head, in data. Returns false, leaving data as it
+ *        is, if the index is out of bounds.
+ * @param arena_ptr A pointer to the ArenaSinglyList to get from.
+ * @param index The index in the list of the node to get the data from.
+ * @param data Where the data of the node is stored.
+ */
+bool arena_get(ArenaSinglyList* arena_ptr, uint64_t index, int64_t* data);
+
+/**
+ * @brief Searches the whole ArenaSinglyList to see if it contains the data.
+ * @param arena_ptr A pointer to the ArenaSinglyList to be searched.
+ * @param data The data to search for.
+ */
+bool arena_contains(ArenaSinglyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Returns the index in the list of the first node containing the
+ *        data, or UINT64_MAX if no node does.
+ * @param arena_ptr A pointer to the ArenaSinglyList to be searched.
+ * @param data The data to search for.
+ */
+uint64_t arena_find(ArenaSinglyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Appends a node with the data to the end of the ArenaSinglyList.
+ *        The arena doubles in size whenever it is full, which may move it.
+ * @param arena_ptr A pointer to the ArenaSinglyList to append to.
+ * @param data The data attached to the new node.
+ * @return true if the node was appended, false if the arena could not grow.
+ */
+bool arena_append(ArenaSinglyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Prepends a node with the data to the start of the ArenaSinglyList.
+ * @param arena_ptr A pointer to the ArenaSinglyList to prepend to.
+ * @param data The data attached to the new node.
+ * @return true if the node was prepended, false if the arena could not grow.
+ */
+bool arena_prepend(ArenaSinglyList* arena_ptr, int64_t data);
+
+/**
+ * @brief Inserts a node with the data at the given index of the list.
+ * @param arena_ptr A pointer to the ArenaSinglyList to modify.
+ * @param data The data to attach to the new node.
+ * @param index The index at which to insert the new node. An index equal to
+ *        the size of the list appends the new node.
+ * @return true if the node was inserted, false if the index is out of
+ *         bounds or the arena could not grow.
+ */
+bool arena_insert_node(ArenaSinglyList* arena_ptr, int64_t data, uint64_t index);
+
+/**
+ * @brief Replaces the data of the node at the given index of the list.
+ * @param arena_ptr A pointer to the ArenaSinglyList to modify.
+ * @param data The new data of the node.
+ * @param index The index of the node to change.
+ * @return true if the data was replaced, false if the index is out of bounds.
+ */
+bool arena_replace_node(ArenaSinglyList* arena_ptr, int64_t data, uint64_t index);
+
+/**
+ * @brief Deletes the first node of the ArenaSinglyList, if there is one.
+ * @param arena_ptr A pointer to the ArenaSinglyList to modify.
+ */
+void arena_delete_first(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Deletes the last node of the ArenaSinglyList, if there is one.
+ * @param arena_ptr A pointer to the ArenaSinglyList to modify.
+ */
+void arena_delete_last(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Deletes the node at the given index of the list. If the index is
+ *        out of bounds, no action is performed. The slot of a deleted node
+ *        is reused by the next node added.
+ * @param arena_ptr A pointer to the ArenaSinglyList to modify.
+ * @param index The index of the node to delete.
+ */
+void arena_delete_node(ArenaSinglyList* arena_ptr, uint64_t index);
+
+/**
+ * @brief Reverses the order of the nodes of the ArenaSinglyList by
+ *        relinking them, without moving any node in the arena.
+ * @param arena_ptr A pointer to the ArenaSinglyList to reverse.
+ */
+void arena_reverse_list(ArenaSinglyList* arena_ptr);
+
+/**
+ * @brief Copies the values of the ArenaSinglyList, in order, to a new
+ *        array allocated on the heap, which must be freed by the user.
+ *        Returns NULL if the list is empty.
+ * @param arena_ptr A pointer to the ArenaSinglyList to convert.
+ */
+int64_t* arena_to_array(ArenaSinglyList* arena_ptr);
+
+#endif
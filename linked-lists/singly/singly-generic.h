@@ -0,0 +1,303 @@
+/*
+This header file is used to generate singly linked lists specialized for any
+type of element. DEFINE_SINGLY_LIST stamps out a node struct which stores the
+element inline, a list struct, and the functions of the list, all calling the
+equality and hash functions given for the type directly, so that the compiler
+can inline them and no call goes through a function pointer.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef SINGLYGENERIC_H
+#define SINGLYGENERIC_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include<stdlib.h>
+
+/*** Constants ***/
+// the number of slots the hash index of a generated list starts with, always a power of two
+#define GENERIC_HASH_MIN_CAPACITY 16
+
+
+/*** List Generator ***/
+
+/**
+ * @brief Defines a singly linked list of elements of type Type, named Name, whose
+ *        functions are named prefix_function. Every function is static inline,
+ *        so the macro may be used in any number of files, and functions which
+ *        are not called are not compiled in.
+ *
+ *        The macro defines:
+ *        - Name##Node, holding a Type in data and a pointer to the next node.
+ *        - Name, holding the head, tail and size of the list, and its hash index.
+ *          A Name is empty when it is zeroed, e.g. Name list = {0}.
+ *        - prefix_size, prefix_append, prefix_prepend, prefix_get, prefix_find,
+ *          prefix_contains, prefix_delete_first, prefix_delete_value and
+ *          prefix_clear, which behave like the functions of the same name of the
+ *          SinglyLinkedList, but take elements by pointer.
+ *        - prefix_enable_hash_index and prefix_disable_hash_index, which keep an
+ *          open-addressing table counting the nodes holding every element, so that
+ *          prefix_contains takes O(1) time, and prefix_find returns at once for
+ *          elements which are not in the list.
+ *
+ * @param Name The name of the list type, e.g. PointList.
+ * @param prefix The prefix of the function names, e.g. point_list.
+ * @param Type The type of the elements, stored by value in every node.
+ * @param equal A function or macro taking two const Type* and returning true if
+ *        the elements are equal.
+ * @param hash A function or macro taking a const Type* and returning a uint64_t,
+ *        the same for every pair of elements which are equal. It is only called
+ *        while the hash index is enabled.
+ */
+#define DEFINE_SINGLY_LIST(Name, prefix, Type, equal, hash)                                   \
+                                                                                              \
+typedef struct Name##Node {                                                                   \
+    Type data;                                                                                \
+    struct Name##Node* next;                                                                  \
+} Name##Node;                                                                                 \
+                                                                                              \
+typedef struct {                                                                              \
+    Type data;                                                                                \
+    uint64_t count;                                                                           \
+} Name##HashSlot;                                                                             \
+                                                                                              \
+typedef struct {                                                                              \
+    Name##Node* head;                                                                         \
+    Name##Node* tail;                                                                         \
+    uint64_t size;                                                                            \
+    Name##HashSlot* slots;                                                                    \
+    uint64_t capacity;                                                                        \
+    uint64_t used;                                                                            \
+} Name;                                                                                       \
+                                                                                              \
+/* returns the slot holding the element, or the empty slot it would be stored in */          \
+static inline Name##HashSlot* prefix##_hash_slot(Name* list_ptr, const Type* data) {          \
+    uint64_t mask = list_ptr->capacity - 1;                                                   \
+    uint64_t i = (hash(data)) & mask;                                                         \
+    while ((list_ptr->slots[i].count != 0) && !(equal(&(list_ptr->slots[i].data), data))) {   \
+        i = (i + 1) & mask;                                                                   \
+    }                                                                                         \
+    return &(list_ptr->slots[i]);                                                             \
+}                                                                                             \
+                                                                                              \
+/* moves every used slot into a new table of the given capacity */                           \
+static inline bool prefix##_hash_resize(Name* list_ptr, uint64_t capacity) {                  \
+    Name##HashSlot* old_slots = list_ptr->slots;                                              \
+    uint64_t old_capacity = list_ptr->capacity;                                               \
+    Name##HashSlot* slots = (Name##HashSlot *) calloc(capacity, sizeof(Name##HashSlot));      \
+    if (slots == NULL) {                                                                      \
+        return false;                                                                         \
+    }                                                                                         \
+    list_ptr->slots = slots;                                                                  \
+    list_ptr->capacity = capacity;                                                            \
+    for (uint64_t i = 0; i < old_capacity; i++) {                                             \
+        if (old_slots[i].count != 0) {                                                        \
+            *prefix##_hash_slot(list_ptr, &(old_slots[i].data)) = old_slots[i];               \
+        }                                                                                     \
+    }                                                                                         \
+    free(old_slots);                                                                          \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline void prefix##_disable_hash_index(Name* list_ptr) {                              \
+    free(list_ptr->slots);                                                                    \
+    list_ptr->slots = NULL;                                                                   \
+    list_ptr->capacity = 0;                                                                   \
+    list_ptr->used = 0;                                                                       \
+}                                                                                             \
+                                                                                              \
+/* counts one more node holding the element, keeping the table at most half full,   */      \
+/* and drops the index if it can not grow, since it would no longer be complete      */      \
+static inline void prefix##_hash_add(Name* list_ptr, const Type* data) {                      \
+    if ((2 * (list_ptr->used + 1) > list_ptr->capacity)                                       \
+        && !prefix##_hash_resize(list_ptr, 2 * list_ptr->capacity)) {                         \
+        prefix##_disable_hash_index(list_ptr);                                                \
+        return;                                                                               \
+    }                                                                                         \
+    Name##HashSlot* slot = prefix##_hash_slot(list_ptr, data);                                \
+    if (slot->count == 0) {                                                                   \
+        slot->data = *data;                                                                   \
+        list_ptr->used++;                                                                     \
+    }                                                                                         \
+    slot->count++;                                                                            \
+}                                                                                             \
+                                                                                              \
+/* counts one node less holding the element, emptying its slot at 0 by moving back  */      \
+/* the slots after it which would otherwise no longer be found                       */      \
+static inline void prefix##_hash_remove(Name* list_ptr, const Type* data) {                   \
+    Name##HashSlot* slot = prefix##_hash_slot(list_ptr, data);                                \
+    slot->count--;                                                                            \
+    if (slot->count != 0) {                                                                   \
+        return;                                                                               \
+    }                                                                                         \
+    uint64_t mask = list_ptr->capacity - 1;                                                   \
+    uint64_t empty = (uint64_t) (slot - list_ptr->slots);                                     \
+    uint64_t i = empty;                                                                       \
+    while (true) {                                                                            \
+        i = (i + 1) & mask;                                                                   \
+        if (list_ptr->slots[i].count == 0) {                                                  \
+            break;                                                                            \
+        }                                                                                     \
+        uint64_t home = (hash(&(list_ptr->slots[i].data))) & mask;                            \
+        /* the slot stays if its home lies cyclically after the empty slot, up to i */        \
+        if (((i - home) & mask) >= ((i - empty) & mask)) {                                    \
+            list_ptr->slots[empty] = list_ptr->slots[i];                                      \
+            list_ptr->slots[i].count = 0;                                                     \
+            empty = i;                                                                        \
+        }                                                                                     \
+    }                                                                                         \
+    list_ptr->used--;                                                                         \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_enable_hash_index(Name* list_ptr) {                               \
+    if (list_ptr->slots != NULL) {                                                            \
+        return true;                                                                          \
+    }                                                                                         \
+    uint64_t capacity = GENERIC_HASH_MIN_CAPACITY;                                            \
+    while (capacity < 2 * list_ptr->size) {                                                   \
+        capacity *= 2;                                                                        \
+    }                                                                                         \
+    if (!prefix##_hash_resize(list_ptr, capacity)) {                                          \
+        return false;                                                                         \
+    }                                                                                         \
+    for (Name##Node* node = list_ptr->head; node != NULL; node = node->next) {                \
+        prefix##_hash_add(list_ptr, &(node->data));                                           \
+        if (list_ptr->slots == NULL) {                                                        \
+            return false;                                                                     \
+        }                                                                                     \
+    }                                                                                         \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline uint64_t prefix##_size(Name* list_ptr) {                                        \
+    return list_ptr->size;                                                                    \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_append(Name* list_ptr, const Type* data) {                        \
+    Name##Node* node = (Name##Node *) malloc(sizeof(Name##Node));                             \
+    if (node == NULL) {                                                                       \
+        return false;                                                                         \
+    }                                                                                         \
+    node->data = *data;                                                                       \
+    node->next = NULL;                                                                        \
+    if (list_ptr->size == 0) {                                                                \
+        list_ptr->head = node;                                                                \
+    } else {                                                                                  \
+        list_ptr->tail->next = node;                                                          \
+    }                                                                                         \
+    list_ptr->tail = node;                                                                    \
+    list_ptr->size++;                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_add(list_ptr, data);                                                    \
+    }                                                                                         \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_prepend(Name* list_ptr, const Type* data) {                       \
+    Name##Node* node = (Name##Node *) malloc(sizeof(Name##Node));                             \
+    if (node == NULL) {                                                                       \
+        return false;                                                                         \
+    }                                                                                         \
+    node->data = *data;                                                                       \
+    node->next = list_ptr->head;                                                              \
+    if (list_ptr->size == 0) {                                                                \
+        list_ptr->tail = node;                                                                \
+    }                                                                                         \
+    list_ptr->head = node;                                                                    \
+    list_ptr->size++;                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_add(list_ptr, data);                                                    \
+    }                                                                                         \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+static inline Type* prefix##_get(Name* list_ptr, uint64_t index) {                            \
+    if (index >= list_ptr->size) {                                                            \
+        return NULL;                                                                          \
+    }                                                                                         \
+    Name##Node* node = list_ptr->head;                                                        \
+    for (uint64_t i = 0; i < index; i++) {                                                    \
+        node = node->next;                                                                    \
+    }                                                                                         \
+    return &(node->data);                                                                     \
+}                                                                                             \
+                                                                                              \
+static inline uint64_t prefix##_find(Name* list_ptr, const Type* data) {                      \
+    if ((list_ptr->slots != NULL) && (prefix##_hash_slot(list_ptr, data)->count == 0)) {      \
+        return UINT64_MAX;                                                                    \
+    }                                                                                         \
+    uint64_t index = 0;                                                                       \
+    for (Name##Node* node = list_ptr->head; node != NULL; node = node->next) {                \
+        if (equal(&(node->data), data)) {                                                     \
+            return index;                                                                     \
+        }                                                                                     \
+        index++;                                                                              \
+    }                                                                                         \
+    return UINT64_MAX;                                                                        \
+}                                                                                             \
+                                                                                              \
+static inline bool prefix##_contains(Name* list_ptr, const Type* data) {                      \
+    if (list_ptr->slots != NULL) {                                                            \
+        return prefix##_hash_slot(list_ptr, data)->count != 0;                                \
+    }                                                                                         \
+    return prefix##_find(list_ptr, data) != UINT64_MAX;                                       \
+}                                                                                             \
+                                                                                              \
+static inline void prefix##_delete_first(Name* list_ptr) {                                    \
+    Name##Node* head = list_ptr->head;                                                        \
+    if (head == NULL) {                                                                       \
+        return;                                                                               \
+    }                                                                                         \
+    list_ptr->head = head->next;                                                              \
+    list_ptr->size--;                                                                         \
+    if (list_ptr->size == 0) {                                                                \
+        list_ptr->tail = NULL;                                                                \
+    }                                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_remove(list_ptr, &(head->data));                                        \
+    }                                                                                         \
+    free(head);                                                                               \
+}                                                                                             \
+                                                                                              \
+/* deletes the first node holding the element, and returns false if there is none */        \
+static inline bool prefix##_delete_value(Name* list_ptr, const Type* data) {                  \
+    Name##Node* prev = NULL;                                                                  \
+    Name##Node* node = list_ptr->head;                                                        \
+    while ((node != NULL) && !(equal(&(node->data), data))) {                                 \
+        prev = node;                                                                          \
+        node = node->next;                                                                    \
+    }                                                                                         \
+    if (node == NULL) {                                                                       \
+        return false;                                                                         \
+    } else if (prev == NULL) {                                                                \
+        prefix##_delete_first(list_ptr);                                                      \
+        return true;                                                                          \
+    }                                                                                         \
+    prev->next = node->next;                                                                  \
+    if (node == list_ptr->tail) {                                                             \
+        list_ptr->tail = prev;                                                                \
+    }                                                                                         \
+    list_ptr->size--;                                                                         \
+    if (list_ptr->slots != NULL) {                                                            \
+        prefix##_hash_remove(list_ptr, &(node->data));                                        \
+    }                                                                                         \
+    free(node);                                                                               \
+    return true;                                                                              \
+}                                                                                             \
+                                                                                              \
+/* frees every node and the hash index, leaving the list empty */                            \
+static inline void prefix##_clear(Name* list_ptr) {                                           \
+    Name##Node* node = list_ptr->head;                                                        \
+    while (node != NULL) {                                                                    \
+        Name##Node* next = node->next;                                                        \
+        free(node);                                                                           \
+        node = next;                                                                          \
+    }                                                                                         \
+    list_ptr->head = NULL;                                                                    \
+    list_ptr->tail = NULL;                                                                    \
+    list_ptr->size = 0;                                                                       \
+    prefix##_disable_hash_index(list_ptr);                                                    \
+}
+
+#endif
@@ -7,27 +7,27 @@ Creation Date: March 29, 2025.
 */
 
 /*** Dependencies ***/
+#include<pthread.h>
 #include<stdint.h>
 #include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
 #include"singly-linked.h"
+#include"../stats/list-stats.h"
 
 /*** Node Function Implementations ***/
 Node* dangling_node(int64_t data) {
-    Node* new = (Node *) malloc(sizeof(Node));
-    new->data = data;
-    return new;
+    return pool_node(NULL, data);
 }
 
 Node* next_node(int64_t data, Node* prev) {
-    Node* new = (Node *) malloc(sizeof(Node));
-    new->data = data;
+    Node* new = pool_node(NULL, data);
     prev->next = new;
     return new;
 }
 
 Node* prev_node(int64_t data, Node* next) {
-    Node* new = (Node *) malloc(sizeof(Node));
-    new->data = data;
+    Node* new = pool_node(NULL, data);
     new->next = next;
     return new;
 }
@@ -45,6 +45,7 @@ bool search_forward(Node* start, int64_t data) {
     }
     while(node->next != NULL) {
         node = node->next;
+        STATS_HOPS(1);
         if (node->data == data) {
             return true;
         }
@@ -52,10 +53,1097 @@ bool search_forward(Node* start, int64_t data) {
     return false;
 }
 
+/*** NodePool Function Implementations ***/
+
+NodePool* create_node_pool(uint64_t nodes_per_slab) {
+    NodePool* pool = (NodePool *) calloc(1, sizeof(NodePool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->nodes_per_slab = (nodes_per_slab == 0) ? DEFAULT_NODES_PER_SLAB : nodes_per_slab;
+    return pool;
+}
+
+void destroy_node_pool(NodePool* pool) {
+    NodeSlab* slab = pool->slabs;
+    while (slab != NULL) {
+        NodeSlab* next = slab->next;
+        STATS_FREE(sizeof(NodeSlab) + sizeof(Node) * slab->capacity);
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+Node* pool_node(NodePool* pool, int64_t data) {
+    Node* new;
+    if (pool == NULL) {
+        new = (Node *) malloc(sizeof(Node));
+    } else if (pool->free_list != NULL) {
+        new = pool->free_list;
+        pool->free_list = new->next;
+        pool->free_nodes--;
+        pool->live_nodes++;
+    } else {
+        new = pool_block(pool, 1);
+    }
+    if (new == NULL) {
+        return NULL;
+    } else if (pool == NULL) {
+        STATS_MALLOC(sizeof(Node));
+    }
+    new->data = data;
+    new->next = NULL;
+    return new;
+}
+
+void release_node(NodePool* pool, Node* node) {
+    if (pool == NULL) {
+        STATS_FREE(sizeof(Node));
+        free(node);
+    } else {
+        node->next = pool->free_list;
+        pool->free_list = node;
+        pool->live_nodes--;
+        pool->free_nodes++;
+    }
+}
+
+Node* pool_block(NodePool* pool, uint64_t count) {
+    // only go to the allocator once the newest slab is used up
+    if ((pool->slabs == NULL) || (pool->slabs->capacity - pool->slab_used < count)) {
+        uint64_t capacity = (count > pool->nodes_per_slab) ? count : pool->nodes_per_slab;
+        NodeSlab* slab = (NodeSlab *) malloc(sizeof(NodeSlab) + sizeof(Node) * capacity);
+        if (slab == NULL) {
+            return NULL;
+        }
+        STATS_MALLOC(sizeof(NodeSlab) + sizeof(Node) * capacity);
+        slab->next = pool->slabs;
+        slab->capacity = capacity;
+        pool->slabs = slab;
+        pool->slab_used = 0;
+        pool->num_slabs++;
+        pool->capacity += capacity;
+    }
+    Node* block = &(pool->slabs->nodes[pool->slab_used]);
+    pool->slab_used += count;
+    pool->live_nodes += count;
+    return block;
+}
+
+NodePoolStats pool_stats(NodePool* pool) {
+    NodePoolStats stats;
+    stats.mallocs = pool->num_slabs;
+    stats.live_nodes = pool->live_nodes;
+    stats.free_nodes = pool->free_nodes;
+    stats.capacity = pool->capacity;
+    uint64_t reserved = pool->num_slabs * sizeof(NodeSlab) + pool->capacity * sizeof(Node);
+    stats.bytes_per_node = (pool->live_nodes == 0) ? 0.0 : ((double) reserved / pool->live_nodes);
+    return stats;
+}
+
+/*** HashIndex Helper Functions ***/
+
+/**
+ * @brief Mixes the bits of a value so that nearby values land in distant
+ *        slots (the finalizer of splitmix64).
+ */
+static uint64_t hash_value(int64_t data) {
+    uint64_t x = (uint64_t) data;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Returns the slot holding data, or NULL if no node holds data.
+ */
+static HashSlot* hash_lookup(HashIndex* hash, int64_t data) {
+    uint64_t mask = hash->capacity - 1;
+    uint64_t i = hash_value(data) & mask;
+    while (hash->slots[i].count != 0) {
+        if (hash->slots[i].data == data) {
+            return &(hash->slots[i]);
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Moves every slot into a new table of the given capacity.
+ */
+static bool hash_resize(HashIndex* hash, uint64_t capacity) {
+    HashSlot* slots = (HashSlot *) calloc(capacity, sizeof(HashSlot));
+    if (slots == NULL) {
+        return false;
+    }
+    uint64_t mask = capacity - 1;
+    for (uint64_t j = 0; j < hash->capacity; j++) {
+        if (hash->slots[j].count != 0) {
+            uint64_t i = hash_value(hash->slots[j].data) & mask;
+            while (slots[i].count != 0) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = hash->slots[j];
+        }
+    }
+    free(hash->slots);
+    hash->slots = slots;
+    hash->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Returns the slot holding data, claiming an empty slot (with a count
+ *        of 0) if no node holds data yet. The table is doubled first if it
+ *        would become more than half full. Returns NULL, leaving the table
+ *        unchanged, if it has to grow and memory allocation failed.
+ */
+static HashSlot* hash_claim(HashIndex* hash, int64_t data) {
+    HashSlot* slot = hash_lookup(hash, data);
+    if (slot != NULL) {
+        return slot;
+    }
+    if ((2 * (hash->used + 1) > hash->capacity) && !hash_resize(hash, 2 * hash->capacity)) {
+        // claiming a slot anyway would fill the table, and probing it would never end
+        return NULL;
+    }
+    uint64_t mask = hash->capacity - 1;
+    uint64_t i = hash_value(data) & mask;
+    while (hash->slots[i].count != 0) {
+        i = (i + 1) & mask;
+    }
+    hash->slots[i].data = data;
+    hash->slots[i].first = NULL;
+    hash->used++;
+    return &(hash->slots[i]);
+}
+
+/**
+ * @brief Empties a slot, shifting back any later slot of the same probe run
+ *        which would otherwise no longer be reachable from its home slot.
+ */
+static void hash_remove(HashIndex* hash, HashSlot* slot) {
+    uint64_t mask = hash->capacity - 1;
+    uint64_t hole = slot - hash->slots;
+    uint64_t i = hole;
+    while (true) {
+        i = (i + 1) & mask;
+        if (hash->slots[i].count == 0) {
+            break;
+        }
+        uint64_t home = hash_value(hash->slots[i].data) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            hash->slots[hole] = hash->slots[i];
+            hole = i;
+        }
+    }
+    hash->slots[hole].count = 0;
+    hash->used--;
+}
+
+/**
+ * @brief Records a node which was just linked into the list at the given index.
+ *        The size of the list already includes the node.
+ */
+static void hash_link(SinglyLinkedList* list_ptr, Node* node, uint64_t index) {
+    HashIndex* hash = list_ptr->hash;
+    if (index == 0) {
+        // every other node moved back by one
+        hash->offset--;
+    } else if (index < list_ptr->size - 1) {
+        hash->stale = true;
+    }
+    HashSlot* slot = hash_claim(hash, node->data);
+    if (slot == NULL) {
+        disable_hash_index(list_ptr);
+        return;
+    }
+    if ((slot->count == 0) || (index == 0)) {
+        slot->first = node;
+        slot->position = index + hash->offset;
+    }
+    slot->count++;
+}
+
+/**
+ * @brief Forgets a node which is about to be unlinked from the given index of
+ *        the list. The size of the list still includes the node.
+ */
+static void hash_unlink(SinglyLinkedList* list_ptr, Node* node, uint64_t index) {
+    HashIndex* hash = list_ptr->hash;
+    HashSlot* slot = hash_lookup(hash, node->data);
+    slot->count--;
+    if (slot->count == 0) {
+        hash_remove(hash, slot);
+    } else if (slot->first == node) {
+        // the next occurrence is somewhere further down the list
+        hash->stale = true;
+    }
+    if (index == 0) {
+        hash->offset++;
+    } else if (index < list_ptr->size - 1) {
+        hash->stale = true;
+    }
+}
+
+/**
+ * @brief Recomputes the first occurrence and its position for every slot
+ *        with one pass over the list.
+ */
+static void hash_refresh(SinglyLinkedList* list_ptr) {
+    HashIndex* hash = list_ptr->hash;
+    for (uint64_t i = 0; i < hash->capacity; i++) {
+        hash->slots[i].first = NULL;
+    }
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, index++) {
+        HashSlot* slot = hash_lookup(hash, node->data);
+        if (slot->first == NULL) {
+            slot->first = node;
+            slot->position = index + hash->offset;
+        }
+    }
+    hash->stale = false;
+}
+
+/**
+ * @brief Moves the node at the given index from the slot of its old value to
+ *        the slot of data, just before its value is replaced by data.
+ */
+static void hash_replace(SinglyLinkedList* list_ptr, Node* node, int64_t data, uint64_t index) {
+    HashIndex* hash = list_ptr->hash;
+    HashSlot* slot = hash_lookup(hash, node->data);
+    slot->count--;
+    if (slot->count == 0) {
+        hash_remove(hash, slot);
+    } else if (slot->first == node) {
+        hash->stale = true;
+    }
+    slot = hash_claim(hash, data);
+    if (slot == NULL) {
+        disable_hash_index(list_ptr);
+        return;
+    }
+    if (slot->count == 0) {
+        slot->first = node;
+        slot->position = index + hash->offset;
+    } else if (!hash->stale && (index < slot->position - hash->offset)) {
+        // a stale index recomputes every first occurrence on the next find anyway
+        slot->first = node;
+        slot->position = index + hash->offset;
+    }
+    slot->count++;
+}
+
+/*** Linking Helper Functions ***/
+
+/**
+ * @brief Links node into the list right after prev, or as the new head if prev
+ *        is NULL, where it becomes the node at the given index. Updates the tail,
+ *        size, hash index, finger and compaction pass of the list. Every function adding a node
+ *        goes through here.
+ */
+static void link_node(SinglyLinkedList* list_ptr, Node* prev, Node* node, uint64_t index) {
+    if (prev == NULL) {
+        node->next = list_ptr->head;
+        list_ptr->head = node;
+    } else {
+        node->next = prev->next;
+        prev->next = node;
+    }
+    if (node->next == NULL) {
+        list_ptr->tail = node;
+    }
+    list_ptr->size++;
+    if (list_ptr->hash != NULL) {
+        hash_link(list_ptr, node, index);
+    }
+    if ((list_ptr->finger != NULL) && (index <= list_ptr->finger_index)) {
+        list_ptr->finger_index++;
+    }
+    if ((list_ptr->compact != NULL) && (index < list_ptr->compact->next_index)) {
+        list_ptr->compact->next_index++;
+    }
+}
+
+/**
+ * @brief Unlinks the node after prev, or the head if prev is NULL, which is the
+ *        node at the given index, and releases it. Updates the tail, size, hash
+ *        index, finger and compaction pass of the list. Every function deleting a node goes
+ *        through here.
+ */
+static void unlink_node(SinglyLinkedList* list_ptr, Node* prev, uint64_t index) {
+    Node* node = (prev == NULL) ? list_ptr->head : prev->next;
+    if (list_ptr->hash != NULL) {
+        hash_unlink(list_ptr, node, index);
+    }
+    if (list_ptr->finger == node) {
+        list_ptr->finger = NULL;
+    } else if ((list_ptr->finger != NULL) && (index < list_ptr->finger_index)) {
+        list_ptr->finger_index--;
+    }
+    if (list_ptr->compact != NULL) {
+        CompactPass* pass = list_ptr->compact;
+        if (pass->prev == node) {
+            pass->prev = prev;
+        }
+        if (index < pass->next_index) {
+            pass->next_index--;
+        }
+    }
+    if (prev == NULL) {
+        list_ptr->head = node->next;
+    } else {
+        prev->next = node->next;
+    }
+    if (list_ptr->tail == node) {
+        list_ptr->tail = prev;
+    }
+    // make sure to release the node to prevent memory leaks
+    release_node(list_ptr->pool, node);
+    list_ptr->size--;
+}
+
+/*** SkipIndex Helper Functions ***/
+
+/**
+ * @brief Allocates a tower of the given height standing on node, with every
+ *        level pointing to NULL.
+ */
+static SkipTower* skip_tower(Node* node, uint64_t height) {
+    SkipTower* tower = (SkipTower *) malloc(sizeof(SkipTower) + sizeof(SkipLevel) * height);
+    if (tower == NULL) {
+        return NULL;
+    }
+    tower->node = node;
+    tower->height = height;
+    for (uint64_t level = 0; level < height; level++) {
+        tower->levels[level].next = NULL;
+        tower->levels[level].width = 0;
+    }
+    return tower;
+}
+
+/**
+ * @brief Picks the height of the tower for a new node: 0 (no tower) with
+ *        probability 1 - 1/SKIP_FANOUT, and one more level with probability
+ *        1/SKIP_FANOUT each time after that.
+ */
+static uint64_t skip_random_height(SkipIndex* skip) {
+    // xorshift64, two bits are used per level
+    skip->random_state ^= skip->random_state << 13;
+    skip->random_state ^= skip->random_state >> 7;
+    skip->random_state ^= skip->random_state << 17;
+    uint64_t bits = skip->random_state;
+    uint64_t height = 0;
+    while ((height < SKIP_MAX_LEVEL) && ((bits % SKIP_FANOUT) == 0)) {
+        height++;
+        bits /= SKIP_FANOUT;
+    }
+    return height;
+}
+
+/**
+ * @brief Frees every tower of the index except the head tower, and points
+ *        every level of the head tower to NULL.
+ */
+static void skip_reset(SkipIndex* skip) {
+    SkipTower* tower = skip->head->levels[0].next;
+    while (tower != NULL) {
+        SkipTower* next = tower->levels[0].next;
+        free(tower);
+        tower = next;
+    }
+    for (uint64_t level = 0; level < SKIP_MAX_LEVEL; level++) {
+        skip->head->levels[level].next = NULL;
+        skip->head->levels[level].width = 0;
+    }
+    skip->levels = 0;
+    skip->stale = false;
+}
+
+/**
+ * @brief Rebuilds the whole index from the nodes of the list in O(n).
+ */
+static void skip_rebuild(SinglyLinkedList* list_ptr) {
+    SkipIndex* skip = list_ptr->skip;
+    skip_reset(skip);
+    // the last tower seen on each level, and its position
+    SkipTower* last[SKIP_MAX_LEVEL];
+    uint64_t last_position[SKIP_MAX_LEVEL];
+    for (uint64_t level = 0; level < SKIP_MAX_LEVEL; level++) {
+        last[level] = skip->head;
+        last_position[level] = 0;
+    }
+    uint64_t position = 1;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, position++) {
+        uint64_t height = skip_random_height(skip);
+        if (height == 0) {
+            continue;
+        }
+        SkipTower* tower = skip_tower(node, height);
+        for (uint64_t level = 0; level < height; level++) {
+            last[level]->levels[level].next = tower;
+            last[level]->levels[level].width = position - last_position[level];
+            last[level] = tower;
+            last_position[level] = position;
+        }
+        if (height > skip->levels) {
+            skip->levels = height;
+        }
+    }
+}
+
+/**
+ * @brief Finds the node just before the given position (positions start at 1
+ *        for the head node), or NULL if position is 1. On every level, update
+ *        is set to the last tower before position, and update_position to the
+ *        position of that tower (0 for the head tower).
+ */
+static Node* skip_seek(SinglyLinkedList* list_ptr, uint64_t position,
+                       SkipTower** update, uint64_t* update_position) {
+    SkipIndex* skip = list_ptr->skip;
+    if (skip->stale) {
+        skip_rebuild(list_ptr);
+    }
+    SkipTower* tower = skip->head;
+    uint64_t tower_position = 0;
+    for (uint64_t level = SKIP_MAX_LEVEL; level-- > 0;) {
+        if (level < skip->levels) {
+            SkipLevel* link = &(tower->levels[level]);
+            while ((link->next != NULL) && (tower_position + link->width < position)) {
+                tower_position += link->width;
+                tower = link->next;
+                STATS_HOPS(1);
+                link = &(tower->levels[level]);
+            }
+        }
+        update[level] = tower;
+        update_position[level] = tower_position;
+    }
+    // finish on the list itself, which is at most a few nodes on average
+    Node* node = tower->node;
+    STATS_HOPS(position - 1 - tower_position);
+    while (tower_position < position - 1) {
+        node = (node == NULL) ? list_ptr->head : node->next;
+        tower_position++;
+    }
+    return node;
+}
+
+/**
+ * @brief Inserts a new node at the given position (1 to size + 1) of a list
+ *        with a skip index, and gives it a tower of random height.
+ */
+static void skip_insert(SinglyLinkedList* list_ptr, int64_t data, uint64_t position) {
+    SkipTower* update[SKIP_MAX_LEVEL];
+    uint64_t update_position[SKIP_MAX_LEVEL];
+    Node* prev = skip_seek(list_ptr, position, update, update_position);
+    Node* node = pool_node(list_ptr->pool, data);
+    link_node(list_ptr, prev, node, position - 1);
+
+    SkipIndex* skip = list_ptr->skip;
+    uint64_t height = skip_random_height(skip);
+    SkipTower* tower = (height == 0) ? NULL : skip_tower(node, height);
+    if (tower == NULL) {
+        height = 0;
+    }
+    for (uint64_t level = 0; level < SKIP_MAX_LEVEL; level++) {
+        SkipLevel* link = &(update[level]->levels[level]);
+        if (level < height) {
+            // the new tower takes over the part of the link after it
+            tower->levels[level].next = link->next;
+            if (link->next != NULL) {
+                tower->levels[level].width = update_position[level] + link->width + 1 - position;
+            }
+            link->next = tower;
+            link->width = position - update_position[level];
+        } else if (link->next != NULL) {
+            // the link jumps over the new node
+            link->width++;
+        }
+    }
+    if (height > skip->levels) {
+        skip->levels = height;
+    }
+}
+
+/**
+ * @brief Deletes the node at the given position (1 to size) of a list with a
+ *        skip index, along with its tower if it has one.
+ */
+static void skip_delete(SinglyLinkedList* list_ptr, uint64_t position) {
+    SkipTower* update[SKIP_MAX_LEVEL];
+    uint64_t update_position[SKIP_MAX_LEVEL];
+    Node* prev = skip_seek(list_ptr, position, update, update_position);
+    Node* node = (prev == NULL) ? list_ptr->head : prev->next;
+
+    SkipIndex* skip = list_ptr->skip;
+    SkipTower* tower = update[0]->levels[0].next;
+    if ((tower == NULL) || (tower->node != node)) {
+        tower = NULL;
+    }
+    for (uint64_t level = 0; level < skip->levels; level++) {
+        SkipLevel* link = &(update[level]->levels[level]);
+        if ((tower != NULL) && (level < tower->height)) {
+            // skip over the removed tower
+            link->next = tower->levels[level].next;
+            link->width = (link->next == NULL) ? 0 : link->width + tower->levels[level].width - 1;
+        } else if (link->next != NULL) {
+            link->width--;
+        }
+    }
+    while ((skip->levels > 0) && (skip->head->levels[skip->levels - 1].next == NULL)) {
+        skip->levels--;
+    }
+    free(tower);
+    unlink_node(list_ptr, prev, position - 1);
+}
+
+/**
+ * @brief Returns the node at the given index of a list with a skip index.
+ *        The index must be less than the size of the list.
+ */
+static Node* skip_node_at(SinglyLinkedList* list_ptr, uint64_t index) {
+    SkipTower* update[SKIP_MAX_LEVEL];
+    uint64_t update_position[SKIP_MAX_LEVEL];
+    Node* prev = skip_seek(list_ptr, index + 1, update, update_position);
+    return (prev == NULL) ? list_ptr->head : prev->next;
+}
+
+/**
+ * @brief Returns the node at the given index, which must be in bounds, and
+ *        remembers it as the finger of the list. Without a skip index, the walk
+ *        starts from the finger when it is not past the index, so a run of
+ *        increasing indices costs O(1) per call.
+ */
+static Node* node_at(SinglyLinkedList* list_ptr, uint64_t index) {
+    Node* node;
+    if (list_ptr->skip != NULL) {
+        node = skip_node_at(list_ptr, index);
+    } else if (index == list_ptr->size - 1) {
+        node = list_ptr->tail;
+    } else {
+        uint64_t counter = 0;
+        node = list_ptr->head;
+        if ((list_ptr->finger != NULL) && (list_ptr->finger_index <= index)) {
+            counter = list_ptr->finger_index;
+            node = list_ptr->finger;
+        }
+        STATS_HOPS(index - counter);
+        for (; counter < index; counter++) {
+            node = node->next;
+        }
+    }
+    list_ptr->finger = node;
+    list_ptr->finger_index = index;
+    return node;
+}
+
+/*** Traversal Helper Functions ***/
+
+/**
+ * @brief The runs of the list walked at once by the traversal kernels. Each lane
+ *        holds the node its run is on, the index of that node, and the number of
+ *        nodes left in the run. Lanes are filled in list order from the towers of
+ *        one level of the skip index, starting at tower, which is at position.
+ */
+typedef struct {
+    Node* node[WALK_LANES];
+    uint64_t index[WALK_LANES];
+    uint64_t remaining[WALK_LANES];
+    uint64_t lanes;
+    uint64_t level;
+    SkipTower* tower;
+    uint64_t position;
+} Lookahead;
+
+/**
+ * @brief Picks the highest level of the skip index with at least WALK_LANES
+ *        towers (counting the head tower), so that the runs are as long as
+ *        possible. Returns false if the list should be walked as one chain.
+ */
+static bool lookahead_start(SinglyLinkedList* list_ptr, Lookahead* ahead) {
+    SkipIndex* skip = list_ptr->skip;
+    if ((skip == NULL) || skip->stale || (list_ptr->size < WALK_MIN_NODES)) {
+        return false;
+    }
+    for (uint64_t level = skip->levels; level-- > 0;) {
+        uint64_t towers = 1;
+        for (SkipTower* tower = skip->head->levels[level].next; (tower != NULL) && (towers < WALK_LANES);
+             tower = tower->levels[level].next) {
+            towers++;
+        }
+        if (towers == WALK_LANES) {
+            ahead->level = level;
+            ahead->tower = skip->head;
+            ahead->position = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Fills the lanes with the next runs of the list, up to WALK_LANES of them.
+ *        Returns false once every run has been walked.
+ */
+static bool lookahead_fill(SinglyLinkedList* list_ptr, Lookahead* ahead) {
+    ahead->lanes = 0;
+    while ((ahead->tower != NULL) && (ahead->lanes < WALK_LANES)) {
+        SkipTower* tower = ahead->tower;
+        SkipLevel* link = &(tower->levels[ahead->level]);
+        // the head tower stands before the first node, every other tower on its node
+        uint64_t start = (tower->node == NULL) ? 0 : ahead->position - 1;
+        uint64_t end = (link->next == NULL) ? list_ptr->size : ahead->position + link->width - 1;
+        uint64_t lane = ahead->lanes++;
+        ahead->node[lane] = (tower->node == NULL) ? list_ptr->head : tower->node;
+        ahead->index[lane] = start;
+        ahead->remaining[lane] = end - start;
+        __builtin_prefetch(ahead->node[lane]);
+        ahead->position += link->width;
+        ahead->tower = link->next;
+    }
+    return ahead->lanes > 0;
+}
+
+/**
+ * @brief Returns the index of the first node holding data, walking the runs of
+ *        the lookahead one node each per step. Runs are in list order, so a match
+ *        in one lane stops the lanes after it, while the lanes before it go on in
+ *        case they hold an earlier match.
+ */
+static uint64_t lookahead_find(SinglyLinkedList* list_ptr, Lookahead* ahead, int64_t data) {
+    while (lookahead_fill(list_ptr, ahead)) {
+        uint64_t found = UINT64_MAX;
+        uint64_t lanes = ahead->lanes;
+        bool walking = true;
+        while (walking) {
+            walking = false;
+            for (uint64_t lane = 0; lane < lanes; lane++) {
+                if (ahead->remaining[lane] == 0) {
+                    continue;
+                }
+                Node* node = ahead->node[lane];
+                if (node->data == data) {
+                    found = ahead->index[lane];
+                    lanes = lane;
+                    break;
+                }
+                ahead->node[lane] = node->next;
+                __builtin_prefetch(node->next);
+                STATS_HOPS(1);
+                ahead->index[lane]++;
+                ahead->remaining[lane]--;
+                walking = true;
+            }
+        }
+        if (found != UINT64_MAX) {
+            return found;
+        }
+    }
+    return UINT64_MAX;
+}
+
+/**
+ * @brief Copies the data of every node into arr at its index, walking the runs
+ *        of the lookahead one node each per step.
+ */
+static void lookahead_copy(SinglyLinkedList* list_ptr, Lookahead* ahead, int64_t* arr) {
+    while (lookahead_fill(list_ptr, ahead)) {
+        bool walking = true;
+        while (walking) {
+            walking = false;
+            for (uint64_t lane = 0; lane < ahead->lanes; lane++) {
+                if (ahead->remaining[lane] == 0) {
+                    continue;
+                }
+                Node* node = ahead->node[lane];
+                arr[ahead->index[lane]++] = node->data;
+                ahead->node[lane] = node->next;
+                __builtin_prefetch(node->next);
+                ahead->remaining[lane]--;
+                walking = true;
+            }
+        }
+    }
+}
+
+/*** Compaction Helper Functions ***/
+
+/**
+ * @brief Ends the incremental compaction running on the list, if there is one,
+ *        returning the nodes of its block which were never used to the pool.
+ */
+static void compact_finish(SinglyLinkedList* list_ptr) {
+    CompactPass* pass = list_ptr->compact;
+    if (pass == NULL) {
+        return;
+    }
+    for (uint64_t i = pass->used; i < pass->capacity; i++) {
+        release_node(list_ptr->pool, &(pass->block[i]));
+    }
+    free(pass);
+    list_ptr->compact = NULL;
+}
+
+/**
+ * @brief Moves the next node of the incremental compaction into its block, and
+ *        returns the tower of the skip index which may stand on the node after it.
+ *        tower is the first tower at or after the node, or NULL.
+ */
+static SkipTower* compact_move(SinglyLinkedList* list_ptr, Node* old, SkipTower* tower,
+                               NodeRemap remap, void* context) {
+    CompactPass* pass = list_ptr->compact;
+    Node* node = &(pass->block[pass->used++]);
+    node->data = old->data;
+    node->next = old->next;
+    if (pass->prev == NULL) {
+        list_ptr->head = node;
+    } else {
+        pass->prev->next = node;
+    }
+    if (list_ptr->tail == old) {
+        list_ptr->tail = node;
+    }
+    if (list_ptr->finger == old) {
+        list_ptr->finger = node;
+    }
+    if ((tower != NULL) && (tower->node == old)) {
+        tower->node = node;
+        tower = tower->levels[0].next;
+    }
+    if ((list_ptr->hash != NULL) && !list_ptr->hash->stale) {
+        HashSlot* slot = hash_lookup(list_ptr->hash, old->data);
+        if ((slot != NULL) && (slot->first == old)) {
+            slot->first = node;
+        }
+    }
+    if (remap != NULL) {
+        remap(old, node, context);
+    }
+    release_node(list_ptr->pool, old);
+    pass->prev = node;
+    pass->next_index++;
+    return tower;
+}
+
+/*** Sort Helper Functions ***/
+
+/**
+ * @brief A sorted run of nodes: its first and last node. The next pointer
+ *        of the last node is NULL.
+ */
+typedef struct {
+    Node* head;
+    Node* tail;
+} SortRun;
+
+/**
+ * @brief The state of one thread of sort_list: the run it sorts and then
+ *        merges into, every run of the sort, and the barrier the threads
+ *        meet at between merge rounds.
+ */
+typedef struct {
+    SortRun* runs;
+    uint64_t index;
+    uint64_t num_threads;
+    pthread_barrier_t* barrier;
+} SortThread;
+
+/**
+ * @brief Merges two sorted runs by relinking their nodes. Nodes of first come
+ *        before equal nodes of second, so merging neighbouring runs in list
+ *        order keeps the sort stable.
+ */
+static SortRun merge_runs(SortRun first, SortRun second) {
+    if (first.head == NULL) {
+        return second;
+    } else if (second.head == NULL) {
+        return first;
+    }
+    Node dummy;
+    Node* last = &dummy;
+    Node* a = first.head;
+    Node* b = second.head;
+    while ((a != NULL) && (b != NULL)) {
+        if (b->data < a->data) {
+            last->next = b;
+            last = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            last = a;
+            a = a->next;
+        }
+    }
+    SortRun merged = {dummy.next, NULL};
+    if (a != NULL) {
+        last->next = a;
+        merged.tail = first.tail;
+    } else {
+        last->next = b;
+        merged.tail = second.tail;
+    }
+    return merged;
+}
+
+/**
+ * @brief Sorts the nodes from head to the end of their chain with a bottom-up
+ *        merge sort. bins[i] holds a sorted run of 2^i nodes, and every node
+ *        is carried into the bins like a binary counter, so at most 64 runs
+ *        are kept and no memory is allocated. Higher bins hold earlier nodes.
+ */
+static SortRun sort_run(Node* head) {
+    SortRun bins[64];
+    uint64_t used = 0;
+    while (head != NULL) {
+        SortRun carry = {head, head};
+        head = head->next;
+        carry.head->next = NULL;
+        uint64_t i = 0;
+        for (; (i < used) && (bins[i].head != NULL); i++) {
+            carry = merge_runs(bins[i], carry);
+            bins[i].head = NULL;
+        }
+        if (i == used) {
+            used++;
+        }
+        bins[i] = carry;
+    }
+    SortRun sorted = {NULL, NULL};
+    for (uint64_t i = 0; i < used; i++) {
+        if (bins[i].head != NULL) {
+            sorted = merge_runs(bins[i], sorted);
+        }
+    }
+    return sorted;
+}
+
+/**
+ * @brief Sorts the run of the thread, then merges runs pairwise with the other
+ *        threads: in the round with step s, every thread whose index is a
+ *        multiple of 2s merges in the run s places to its right.
+ */
+static void* sort_thread(void* arg) {
+    SortThread* thread = (SortThread *) arg;
+    SortRun* runs = thread->runs;
+    runs[thread->index] = sort_run(runs[thread->index].head);
+    for (uint64_t step = 1; step < thread->num_threads; step *= 2) {
+        pthread_barrier_wait(thread->barrier);
+        if ((thread->index % (2 * step) == 0) && (thread->index + step < thread->num_threads)) {
+            runs[thread->index] = merge_runs(runs[thread->index], runs[thread->index + step]);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns data as an unsigned key which sorts in the same order, by flipping
+ *        the sign bit so that negative values come before the others.
+ */
+static uint64_t radix_key(int64_t data) {
+    return ((uint64_t) data) ^ (UINT64_C(1) << 63);
+}
+
+/**
+ * @brief Moves the nodes of the chain from head, in order, to the end of the chain
+ *        of the digit of their key at shift, counting the nodes of every chain in
+ *        lengths if it is not NULL. Each chain starts at a dummy node so that
+ *        appending to it needs no branch.
+ */
+static void radix_scatter(Node* head, unsigned shift, Node* dummies, Node** tails, uint64_t* lengths) {
+    uint64_t mask = (UINT64_C(1) << RADIX_BITS) - 1;
+    for (uint64_t d = 0; d <= mask; d++) {
+        tails[d] = &(dummies[d]);
+    }
+    for (Node* node = head; node != NULL; node = node->next) {
+        uint64_t d = (radix_key(node->data) >> shift) & mask;
+        tails[d]->next = node;
+        tails[d] = node;
+        if (lengths != NULL) {
+            lengths[d]++;
+        }
+    }
+}
+
+/**
+ * @brief Sorts the chain from head on its lowest digits, least significant digit
+ *        first, skipping the digits which are the same in every node.
+ */
+static SortRun radix_lsd(Node* head, unsigned digits) {
+    Node dummies[1 << RADIX_BITS];
+    Node* tails[1 << RADIX_BITS];
+    uint64_t first = radix_key(head->data);
+    uint64_t differ = 0;
+    SortRun sorted = {head, head};
+    for (; sorted.tail->next != NULL; sorted.tail = sorted.tail->next) {
+        differ |= radix_key(sorted.tail->next->data) ^ first;
+    }
+    uint64_t mask = (UINT64_C(1) << RADIX_BITS) - 1;
+    for (unsigned digit = 0; digit < digits; digit++) {
+        if (((differ >> (digit * RADIX_BITS)) & mask) == 0) {
+            continue;
+        }
+        radix_scatter(sorted.head, digit * RADIX_BITS, dummies, tails, NULL);
+        Node start;
+        sorted.tail = &start;
+        for (uint64_t d = 0; d <= mask; d++) {
+            if (tails[d] != &(dummies[d])) {
+                sorted.tail->next = dummies[d].next;
+                sorted.tail = tails[d];
+            }
+        }
+        sorted.tail->next = NULL;
+        sorted.head = start.next;
+    }
+    return sorted;
+}
+
+/**
+ * @brief Sorts the chain of length nodes from head on its lowest digits. Chains
+ *        which do not fit in the cache are first split on their highest digit,
+ *        most significant digit first, and every part is sorted on the digits
+ *        below it, so that the many passes of radix_lsd are made over nodes
+ *        which are already in the cache.
+ */
+static SortRun radix_msd(Node* head, uint64_t length, unsigned digits) {
+    if ((length <= RADIX_CACHE_NODES) || (digits == 1)) {
+        return radix_lsd(head, digits);
+    }
+    Node dummies[1 << RADIX_BITS];
+    Node* tails[1 << RADIX_BITS];
+    uint64_t lengths[1 << RADIX_BITS] = {0};
+    radix_scatter(head, (digits - 1) * RADIX_BITS, dummies, tails, lengths);
+    Node start;
+    SortRun sorted = {NULL, &start};
+    for (uint64_t d = 0; d < (UINT64_C(1) << RADIX_BITS); d++) {
+        if (lengths[d] > 0) {
+            tails[d]->next = NULL;
+            SortRun part = radix_msd(dummies[d].next, lengths[d], digits - 1);
+            sorted.tail->next = part.head;
+            sorted.tail = part.tail;
+        }
+    }
+    sorted.head = start.next;
+    return sorted;
+}
+
 /*** SinglyLinkedList Function Implementations */
 
+/**
+ * @brief Gives an empty list its own NodePool holding length nodes in a
+ *        single slab, links the nodes in order and makes them the list's
+ *        nodes. The caller fills in the data of each node.
+ */
+static Node* own_block(SinglyLinkedList* list_ptr, uint64_t length) {
+    NodePool* pool = create_node_pool(0);
+    Node* nodes = pool_block(pool, length);
+    for (uint64_t i = 0; i + 1 < length; i++) {
+        nodes[i].next = &(nodes[i + 1]);
+    }
+    nodes[length - 1].next = NULL;
+    list_ptr->pool = pool;
+    list_ptr->owns_pool = true;
+    list_ptr->head = nodes;
+    list_ptr->tail = &(nodes[length - 1]);
+    list_ptr->size = length;
+    return nodes;
+}
+
+/**
+ * @brief Forgets every node of the list without releasing them, leaving it empty
+ *        with its pool and empty indices.
+ */
+static void forget_nodes(SinglyLinkedList* list_ptr) {
+    list_ptr->head = NULL;
+    list_ptr->tail = NULL;
+    list_ptr->size = 0;
+    list_ptr->finger = NULL;
+    if (list_ptr->skip != NULL) {
+        skip_reset(list_ptr->skip);
+    }
+    if (list_ptr->hash != NULL) {
+        HashIndex* hash = list_ptr->hash;
+        memset(hash->slots, 0, hash->capacity * sizeof(HashSlot));
+        hash->used = 0;
+        hash->offset = 0;
+        hash->stale = false;
+    }
+}
+
+/**
+ * @brief Moves every slab and free node of other into pool, and frees other.
+ *        The nodes other handed out are then nodes of pool.
+ */
+static void pool_absorb(NodePool* pool, NodePool* other) {
+    if (other->slabs != NULL) {
+        // the unused end of the newest slab of other is only reachable from the free list
+        for (uint64_t i = other->slab_used; i < other->slabs->capacity; i++) {
+            other->slabs->nodes[i].next = other->free_list;
+            other->free_list = &(other->slabs->nodes[i]);
+            other->free_nodes++;
+        }
+        NodeSlab* last = other->slabs;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        if (pool->slabs == NULL) {
+            pool->slabs = other->slabs;
+            pool->slab_used = other->slabs->capacity;
+        } else {
+            // the newest slab of pool stays first, so that it keeps handing out nodes
+            last->next = pool->slabs->next;
+            pool->slabs->next = other->slabs;
+        }
+    }
+    if (other->free_list != NULL) {
+        Node* last = other->free_list;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        last->next = pool->free_list;
+        pool->free_list = other->free_list;
+    }
+    pool->num_slabs += other->num_slabs;
+    pool->capacity += other->capacity;
+    pool->live_nodes += other->live_nodes;
+    pool->free_nodes += other->free_nodes;
+    free(other);
+}
+
+/**
+ * @brief Makes sure the nodes of src can be released by dest once they are linked
+ *        into it. Lists on the same allocator need nothing, an empty dest takes on
+ *        the allocator of src, and a pool owned by src is merged into the pool of
+ *        dest. Returns false if the nodes would have to be copied instead.
+ */
+static bool share_allocator(SinglyLinkedList* src, SinglyLinkedList* dest) {
+    if ((src->pool == dest->pool) && !src->owns_pool) {
+        return true;
+    } else if (is_empty(dest)) {
+        compact_finish(dest);
+        if (dest->owns_pool) {
+            destroy_node_pool(dest->pool);
+        }
+        dest->pool = src->pool;
+        dest->owns_pool = src->owns_pool;
+    } else if (src->owns_pool && (dest->pool != NULL)) {
+        pool_absorb(dest->pool, src->pool);
+    } else {
+        return false;
+    }
+    if (src->owns_pool) {
+        src->pool = NULL;
+        src->owns_pool = false;
+    }
+    return true;
+}
+
 SinglyLinkedList* create_empty_list() {
-    return (SinglyLinkedList *) malloc(sizeof(SinglyLinkedList));
+    return (SinglyLinkedList *) calloc(1, sizeof(SinglyLinkedList));
 }
 
 SinglyLinkedList* list_from_array(int64_t* arr, uint64_t arr_length) {
@@ -63,26 +1151,155 @@ SinglyLinkedList* list_from_array(int64_t* arr, uint64_t arr_length) {
     if (arr_length == 0) {
         return list_ptr;
     }
-    for (int i = 0; i < arr_length; i++) {
-        append_node(list_ptr, arr[i]);
+    Node* nodes = own_block(list_ptr, arr_length);
+    for (uint64_t i = 0; i < arr_length; i++) {
+        nodes[i].data = arr[i];
     }
     return list_ptr;
 }
 
 SinglyLinkedList* copy(SinglyLinkedList* list_ptr) {
     SinglyLinkedList* new_list = create_empty_list();
+    if (is_empty(list_ptr)) {
+        return new_list;
+    }
+    Node* nodes = own_block(new_list, list_ptr->size);
     Node* curr_node = list_ptr->head;
-    while(curr_node != NULL) {
-        append_node(new_list, curr_node->data);
+    for (uint64_t i = 0; i < list_ptr->size; i++) {
+        nodes[i].data = curr_node->data;
         curr_node = curr_node->next;
     }
     return new_list;
 }
 
+void destroy_list(SinglyLinkedList* list_ptr) {
+    compact_finish(list_ptr);
+    disable_skip_index(list_ptr);
+    disable_hash_index(list_ptr);
+    if (list_ptr->owns_pool) {
+        // every node lives in the pool's slabs, so there is no need to walk them
+        destroy_node_pool(list_ptr->pool);
+    } else {
+        clear(list_ptr);
+    }
+    free(list_ptr);
+}
+
 bool is_empty(SinglyLinkedList* list_ptr) {
     return (list_ptr->head == NULL);
 }
 
+bool attach_pool(SinglyLinkedList* list_ptr, NodePool* pool) {
+    if (!is_empty(list_ptr)) {
+        return false;
+    }
+    compact_finish(list_ptr);
+    if (list_ptr->owns_pool) {
+        destroy_node_pool(list_ptr->pool);
+        list_ptr->owns_pool = false;
+    }
+    list_ptr->pool = pool;
+    return true;
+}
+
+bool enable_skip_index(SinglyLinkedList* list_ptr) {
+    if (list_ptr->skip != NULL) {
+        return true;
+    }
+    SkipIndex* skip = (SkipIndex *) malloc(sizeof(SkipIndex));
+    if (skip == NULL) {
+        return false;
+    }
+    skip->head = skip_tower(NULL, SKIP_MAX_LEVEL);
+    if (skip->head == NULL) {
+        free(skip);
+        return false;
+    }
+    skip->random_state = 88172645463325252ULL;
+    list_ptr->skip = skip;
+    skip_rebuild(list_ptr);
+    return true;
+}
+
+void disable_skip_index(SinglyLinkedList* list_ptr) {
+    SkipIndex* skip = list_ptr->skip;
+    if (skip == NULL) {
+        return;
+    }
+    skip_reset(skip);
+    free(skip->head);
+    free(skip);
+    list_ptr->skip = NULL;
+}
+
+bool refresh_skip_index(SinglyLinkedList* list_ptr) {
+    if (list_ptr->skip == NULL) {
+        return false;
+    } else if (list_ptr->skip->stale) {
+        skip_rebuild(list_ptr);
+    }
+    return true;
+}
+
+bool enable_hash_index(SinglyLinkedList* list_ptr) {
+    if (list_ptr->hash != NULL) {
+        return true;
+    }
+    HashIndex* hash = (HashIndex *) calloc(1, sizeof(HashIndex));
+    if (hash == NULL) {
+        return false;
+    }
+    // keep the table at most half full so that probe runs stay short
+    hash->capacity = HASH_MIN_CAPACITY;
+    while (hash->capacity < 2 * list_ptr->size) {
+        hash->capacity *= 2;
+    }
+    hash->slots = (HashSlot *) calloc(hash->capacity, sizeof(HashSlot));
+    if (hash->slots == NULL) {
+        free(hash);
+        return false;
+    }
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, index++) {
+        HashSlot* slot = hash_claim(hash, node->data);
+        if (slot == NULL) {
+            free(hash->slots);
+            free(hash);
+            return false;
+        }
+        if (slot->count == 0) {
+            slot->first = node;
+            slot->position = index;
+        }
+        slot->count++;
+    }
+    list_ptr->hash = hash;
+    return true;
+}
+void disable_hash_index(SinglyLinkedList* list_ptr) {
+    HashIndex* hash = list_ptr->hash;
+    if (hash == NULL) {
+        return;
+    }
+    free(hash->slots);
+    free(hash);
+    list_ptr->hash = NULL;
+}
+HashIndexStats hash_index_stats(SinglyLinkedList* list_ptr) {
+    HashIndexStats stats = {0};
+    HashIndex* hash = list_ptr->hash;
+    if (hash == NULL) {
+        return stats;
+    }
+    stats.distinct_values = hash->used;
+    stats.capacity = hash->capacity;
+    stats.bytes = sizeof(HashIndex) + hash->capacity * sizeof(HashSlot);
+    if (list_ptr->size > 0) {
+        stats.bytes_per_node = (double) stats.bytes / (double) list_ptr->size;
+    }
+    return stats;
+}
+
 uint64_t size(SinglyLinkedList* list_ptr) {
     return list_ptr->size;
 }
@@ -95,188 +1312,284 @@ int64_t* list_to_array(SinglyLinkedList* list_ptr) {
     // needs to be heap-allocated so it doesn't get freed when
     // the function is popped off the stack
     int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * list_ptr->size);
+    if (arr == NULL) {
+        return NULL;
+    }
+    Lookahead ahead;
+    if (lookahead_start(list_ptr, &ahead)) {
+        lookahead_copy(list_ptr, &ahead, arr);
+        return arr;
+    }
     Node* node = list_ptr->head;
-    for (int i = 0; i < size; i++) {
+    for (uint64_t i = 0; i < size; i++) {
         arr[i] = node->data;
         node = node->next;
     }
     return arr;
 }
 
-// TODO: finish this
-void concat(SinglyLinkedList* src, SinglyLinkedList* dest) {
-    
+bool concat(SinglyLinkedList* src, SinglyLinkedList* dest) {
+    STATS_OP(LIST_OP_SPLICE);
+    if (src == dest) {
+        return false;
+    } else if (is_empty(src)) {
+        return true;
+    }
+    compact_finish(src);
+    if (!share_allocator(src, dest)) {
+        return false;
+    }
+    if (dest->hash != NULL) {
+        // the nodes land after every node of dest, so first occurrences stay exact
+        HashIndex* hash = dest->hash;
+        uint64_t index = dest->size;
+        for (Node* node = src->head; node != NULL; node = node->next, index++) {
+            HashSlot* slot = hash_claim(hash, node->data);
+            if (slot == NULL) {
+                disable_hash_index(dest);
+                break;
+            }
+            if (slot->count == 0) {
+                slot->first = node;
+                slot->position = index + hash->offset;
+            }
+            slot->count++;
+        }
+    }
+    if (dest->skip != NULL) {
+        dest->skip->stale = true;
+    }
+    if (is_empty(dest)) {
+        dest->head = src->head;
+    } else {
+        dest->tail->next = src->head;
+    }
+    dest->tail = src->tail;
+    dest->size += src->size;
+    forget_nodes(src);
+    return true;
 }
 
 bool contains(SinglyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_FIND);
+    if (is_empty(list_ptr)) {
+        return false;
+    } else if (list_ptr->hash != NULL) {
+        return hash_lookup(list_ptr->hash, data) != NULL;
+    } else if ((list_ptr->skip != NULL) && !list_ptr->skip->stale) {
+        return find(list_ptr, data) != UINT64_MAX;
+    }
     return search_forward(list_ptr->head, data);
 }
 
 uint64_t find(SinglyLinkedList* list_ptr, int64_t data) {
+    STATS_OP(LIST_OP_FIND);
     if(is_empty(list_ptr)) {
         return UINT64_MAX;
-    } else {
-        uint64_t index = 0;
-        Node* node = list_ptr->head;
-        while(node != NULL) {
-            if(node->data == data) {
-                break;
-            }
-            node = node->next;
-            index++;
+    } else if (list_ptr->hash != NULL) {
+        HashIndex* hash = list_ptr->hash;
+        HashSlot* slot = hash_lookup(hash, data);
+        if (slot == NULL) {
+            return UINT64_MAX;
+        }
+        if (hash->stale) {
+            hash_refresh(list_ptr);
+        }
+        return slot->position - hash->offset;
+    }
+    Lookahead ahead;
+    if (lookahead_start(list_ptr, &ahead)) {
+        return lookahead_find(list_ptr, &ahead, data);
+    }
+    uint64_t index = 0;
+    Node* node = list_ptr->head;
+    while(node != NULL) {
+        if(node->data == data) {
+            break;
         }
-        return index;
+        node = node->next;
+        index++;
+        STATS_HOPS(1);
     }
+    return (node == NULL) ? UINT64_MAX : index;
 }
 
 int64_t* get(SinglyLinkedList* list_ptr, uint64_t index) {
-    if (is_empty(list_ptr)) {
+    STATS_OP(LIST_OP_GET);
+    if (is_empty(list_ptr) || (index >= list_ptr->size)) {
         return NULL;
     } else {
-        int64_t counter = 0;
-        Node* node = list_ptr->head;
-        while(node != NULL) {
-            if (counter == index) {
-                return &(node->data);
-            }
-            node = node->next;
-            counter++;
-        }
-        return NULL;
+        return &(node_at(list_ptr, index)->data);
     }
 }
 
 void append_node(SinglyLinkedList* list_ptr, int64_t data) {
-    if (is_empty(list_ptr)) {
-        list_ptr->head = dangling_node(data);
-    } else {
-        Node* node = list_ptr->head;
-        while(node->next != NULL) {
-            node = node->next;
-        }
-        next_node(data, node);
+    STATS_OP(LIST_OP_APPEND);
+    if (list_ptr->skip != NULL) {
+        skip_insert(list_ptr, data, list_ptr->size + 1);
+        return;
     }
+    Node* node = pool_node(list_ptr->pool, data);
+    link_node(list_ptr, list_ptr->tail, node, list_ptr->size);
 }
 
 void prepend_node(SinglyLinkedList* list_ptr, int64_t data) {
-    if (is_empty(list_ptr)) {
-        list_ptr->head = (Node *) dangling_node(data);
-    } else {
-        Node* head = prev_node(data, list_ptr->head);
-        list_ptr->head = head;
+    STATS_OP(LIST_OP_PREPEND);
+    if (list_ptr->skip != NULL) {
+        skip_insert(list_ptr, data, 1);
+        return;
     }
-    list_ptr->size++;
+    Node* node = pool_node(list_ptr->pool, data);
+    link_node(list_ptr, NULL, node, 0);
 }
 
 bool insert_node(SinglyLinkedList* list_ptr, int64_t data, uint64_t index) {
-    if (is_empty(list_ptr)) {
+    STATS_OP(LIST_OP_INSERT);
+    if (is_empty(list_ptr) || (index > list_ptr->size)) {
         return false;
     } else if (index == 0) {
-        list_ptr->head = (Node *) dangling_node(data);
+        prepend_node(list_ptr, data);
+        return true;
+    } else if (index == list_ptr->size) {
+        append_node(list_ptr, data);
+        return true;
+    } else if (list_ptr->skip != NULL) {
+        skip_insert(list_ptr, data, index + 1);
         return true;
     } else {
-        int64_t counter = 0;
-        Node* prev_node = list_ptr->head;
-        Node* node = list_ptr->head;
-        while(node->next != NULL) {
-            node = node->next;
-            if (counter == index) {
-                between_node(data, prev_node, node);
-                list_ptr->size++;
-                return true;
-            }
-            prev_node = prev_node->next;
-        }
-        return false;
+        Node* prev_node = node_at(list_ptr, index - 1);
+        Node* node = pool_node(list_ptr->pool, data);
+        link_node(list_ptr, prev_node, node, index);
+        return true;
     }
 }
 
 void lazy_insert_node(SinglyLinkedList *list_ptr, int64_t data, uint64_t index) {
+    STATS_OP(LIST_OP_INSERT);
     if (is_empty(list_ptr) || (index == 0)) {
-        list_ptr->head = dangling_node(data);
+        prepend_node(list_ptr, data);
+    } else if (index >= list_ptr->size) {
+        append_node(list_ptr, data);
     } else {
-        int64_t counter = 0;
-        Node* prev_node = list_ptr->head;
-        Node* node = list_ptr->head;
-        while(node->next != NULL) {
-            node = node->next;
-            if (counter == index) {
-                between_node(data, prev_node, node);
-            } else {
-                prev_node = prev_node->next;
-            }
-        }
-        node->next = dangling_node(data);
-        list_ptr->size++;
+        insert_node(list_ptr, data, index);
     }
 }
 
 bool replace_node(SinglyLinkedList* list_ptr, int64_t data, uint64_t index) {
-    if (is_empty(list_ptr)) {
+    STATS_OP(LIST_OP_GET);
+    if (is_empty(list_ptr) || (index >= list_ptr->size)) {
         return false;
-    } else if (index == 0) {
-        list_ptr->head = (Node *) dangling_node(data);
-        return true;
     } else {
-        int64_t counter = 0;
-        Node* node = list_ptr->head;
-        while(node->next != NULL) {
-            if (counter == index) {
-                node->data = data;
-                return true;
-            }
-            node = node->next;
-            counter++;
+        Node* node = node_at(list_ptr, index);
+        if (list_ptr->hash != NULL) {
+            hash_replace(list_ptr, node, data, index);
         }
-        return false;
+        node->data = data;
+        return true;
     }
 }
 
 void delete_first(SinglyLinkedList* list_ptr) {
-    if (list_ptr->size == 1) {
-        free(list_ptr->head);
-        list_ptr->head = NULL;
-        list_ptr->size = 0;
-    } else {
-        Node* node = list_ptr->head;
-        list_ptr->head = node->next;
-        free(node); // make sure to free the node
-        // to prevent memory leaks
-        list_ptr->size--;
+    STATS_OP(LIST_OP_DELETE);
+    if (is_empty(list_ptr)) {
+        return;
+    } else if (list_ptr->skip != NULL) {
+        skip_delete(list_ptr, 1);
+        return;
     }
+    unlink_node(list_ptr, NULL, 0);
 }
 
 void delete_last(SinglyLinkedList* list_ptr) {
-    if(list_ptr->size == 1) {
-        free(list_ptr->head);
-        list_ptr->head = NULL;
-        list_ptr->size = 0;
+    STATS_OP(LIST_OP_DELETE);
+    if (is_empty(list_ptr)) {
+        return;
+    } else if ((list_ptr->head == list_ptr->tail) || (list_ptr->skip != NULL)) {
+        delete_node(list_ptr, list_ptr->size - 1);
     } else {
-        Node* prev_node = list_ptr->head;
-        Node* node = prev_node->next;
-        while(node != NULL) {
-            if (node->next == NULL) {
-                prev_node->next = NULL;
-                break;
-            }
-            prev_node = node;
-            node = node->next;
-        }
-        free(node);
-        list_ptr->size--;
+        Node* prev_node = node_at(list_ptr, list_ptr->size - 2);
+        unlink_node(list_ptr, prev_node, list_ptr->size - 1);
     }
 }
 
 void delete_node(SinglyLinkedList *list_ptr, int64_t index) {
-    // needs to be rewritten, it was NOT GOOD before
+    STATS_OP(LIST_OP_DELETE);
+    if ((index < 0) || ((uint64_t) index >= list_ptr->size)) {
+        return;
+    } else if (list_ptr->skip != NULL) {
+        skip_delete(list_ptr, index + 1);
+    } else if (index == 0) {
+        delete_first(list_ptr);
+    } else {
+        Node* prev_node = node_at(list_ptr, index - 1);
+        unlink_node(list_ptr, prev_node, index);
+    }
 }
 
-void clear(SinglyLinkedList* list_ptr) {
-    if (!(is_empty(list_ptr))) {
-        while(list_ptr->head!= NULL) {
-            delete_first(list_ptr);
+bool insert_nodes(SinglyLinkedList* list_ptr, const IndexedValue* inserts, uint64_t count) {
+    STATS_OP(LIST_OP_BATCH);
+    for (uint64_t i = 0; i < count; i++) {
+        if ((inserts[i].index > list_ptr->size) || ((i > 0) && (inserts[i].index < inserts[i - 1].index))) {
+            return false;
+        }
+    }
+    // position is the index of the node after prev, as the list grows
+    Node* prev = NULL;
+    uint64_t position = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        // every earlier insert landed before this one
+        uint64_t target = inserts[i].index + i;
+        STATS_HOPS(target - position);
+        while (position < target) {
+            prev = (prev == NULL) ? list_ptr->head : prev->next;
+            position++;
+        }
+        Node* node = pool_node(list_ptr->pool, inserts[i].data);
+        link_node(list_ptr, prev, node, target);
+        prev = node;
+        position++;
+    }
+    if ((count > 0) && (list_ptr->skip != NULL)) {
+        list_ptr->skip->stale = true;
+    }
+    return true;
+}
+
+bool delete_nodes(SinglyLinkedList* list_ptr, const uint64_t* indices, uint64_t count) {
+    STATS_OP(LIST_OP_BATCH);
+    for (uint64_t i = 0; i < count; i++) {
+        if ((indices[i] >= list_ptr->size) || ((i > 0) && (indices[i] <= indices[i - 1]))) {
+            return false;
+        }
+    }
+    Node* prev = NULL;
+    uint64_t position = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        // every earlier delete was before this one
+        uint64_t target = indices[i] - i;
+        STATS_HOPS(target - position);
+        while (position < target) {
+            prev = (prev == NULL) ? list_ptr->head : prev->next;
+            position++;
         }
+        unlink_node(list_ptr, prev, target);
+    }
+    if ((count > 0) && (list_ptr->skip != NULL)) {
+        list_ptr->skip->stale = true;
     }
+    return true;
+}
+
+void clear(SinglyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_CLEAR);
+    compact_finish(list_ptr);
+    Node* node = list_ptr->head;
+    while (node != NULL) {
+        Node* next = node->next;
+        release_node(list_ptr->pool, node);
+        node = next;
+    }
+    forget_nodes(list_ptr);
 }
 
 void reverse_list(SinglyLinkedList* list_ptr) {
@@ -291,8 +1604,223 @@ void reverse_list(SinglyLinkedList* list_ptr) {
             position = position->next;
         }
         curr->next = prev;
+        list_ptr->tail = list_ptr->head;
         list_ptr->head = curr;
+        list_ptr->finger = NULL;
+        compact_finish(list_ptr);
+        if (list_ptr->skip != NULL) {
+            // every position changed, so rebuild on the next positional access
+            list_ptr->skip->stale = true;
+        }
+        if (list_ptr->hash != NULL) {
+            list_ptr->hash->stale = true;
+        }
+    }
+}
+
+void sort_list(SinglyLinkedList* list_ptr, uint64_t num_threads) {
+    STATS_OP(LIST_OP_SORT);
+    if (list_ptr->size < 2) {
+        return;
+    }
+    if (num_threads == 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (cores < 1) ? 1 : (uint64_t) cores;
+    }
+    // every thread gets at least SORT_MIN_NODES_PER_THREAD nodes to be worth starting
+    uint64_t most_threads = list_ptr->size / SORT_MIN_NODES_PER_THREAD;
+    num_threads = (num_threads > most_threads) ? most_threads : num_threads;
+    SortRun sorted;
+    if (num_threads <= 1) {
+        sorted = sort_run(list_ptr->head);
+    } else {
+        // cut the list into one run per thread, in list order
+        SortRun* runs = (SortRun *) malloc(sizeof(SortRun) * num_threads);
+        Node* node = list_ptr->head;
+        for (uint64_t i = 0; i < num_threads; i++) {
+            uint64_t length = list_ptr->size / num_threads + (i < list_ptr->size % num_threads);
+            runs[i].head = node;
+            for (uint64_t j = 1; j < length; j++) {
+                node = node->next;
+            }
+            runs[i].tail = node;
+            node = node->next;
+            runs[i].tail->next = NULL;
+        }
+        pthread_t* threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+        SortThread* args = (SortThread *) malloc(sizeof(SortThread) * num_threads);
+        pthread_barrier_t barrier;
+        pthread_barrier_init(&barrier, NULL, num_threads);
+        for (uint64_t i = 0; i < num_threads; i++) {
+            args[i].runs = runs;
+            args[i].index = i;
+            args[i].num_threads = num_threads;
+            args[i].barrier = &barrier;
+            // the calling thread works as thread 0 instead of waiting
+            if (i > 0) {
+                pthread_create(&(threads[i]), NULL, sort_thread, &(args[i]));
+            }
+        }
+        sort_thread(&(args[0]));
+        for (uint64_t i = 1; i < num_threads; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        pthread_barrier_destroy(&barrier);
+        sorted = runs[0];
+        free(args);
+        free(threads);
+        free(runs);
+    }
+    list_ptr->head = sorted.head;
+    list_ptr->tail = sorted.tail;
+    list_ptr->finger = NULL;
+    compact_finish(list_ptr);
+    if (list_ptr->skip != NULL) {
+        list_ptr->skip->stale = true;
+    }
+    if (list_ptr->hash != NULL) {
+        list_ptr->hash->stale = true;
+    }
+}
+
+void radix_sort_list(SinglyLinkedList* list_ptr) {
+    STATS_OP(LIST_OP_SORT);
+    if (list_ptr->size < 2) {
+        return;
     }
+    SortRun sorted = radix_msd(list_ptr->head, list_ptr->size, RADIX_DIGITS);
+    list_ptr->head = sorted.head;
+    list_ptr->tail = sorted.tail;
+    list_ptr->finger = NULL;
+    compact_finish(list_ptr);
+    if (list_ptr->skip != NULL) {
+        list_ptr->skip->stale = true;
+    }
+    if (list_ptr->hash != NULL) {
+        list_ptr->hash->stale = true;
+    }
+}
+
+bool compact_list(SinglyLinkedList* list_ptr, NodeRemap remap, void* context) {
+    STATS_OP(LIST_OP_COMPACT);
+    compact_finish(list_ptr);
+    uint64_t length = list_ptr->size;
+    if (length == 0) {
+        return true;
+    }
+    NodePool* pool = list_ptr->pool;
+    // a shared pool keeps the list, anything else is swapped for a new pool
+    bool owned = (pool == NULL) || list_ptr->owns_pool;
+    NodePool* target = owned ? create_node_pool(0) : pool;
+    Node* block = (target == NULL) ? NULL : pool_block(target, length);
+    if (block == NULL) {
+        if (owned && (target != NULL)) {
+            destroy_node_pool(target);
+        }
+        return false;
+    }
+    // copy every node, and point the old node and its copy at each other
+    Node* node = list_ptr->head;
+    for (uint64_t i = 0; i < length; i++) {
+        Node* next = node->next;
+        block[i].data = node->data;
+        block[i].next = node;
+        node->next = &(block[i]);
+        node = next;
+    }
+    if (list_ptr->finger != NULL) {
+        list_ptr->finger = list_ptr->finger->next;
+    }
+    if ((list_ptr->skip != NULL) && !list_ptr->skip->stale) {
+        for (SkipTower* tower = list_ptr->skip->head->levels[0].next; tower != NULL;
+             tower = tower->levels[0].next) {
+            tower->node = tower->node->next;
+        }
+    }
+    if ((list_ptr->hash != NULL) && !list_ptr->hash->stale) {
+        HashIndex* hash = list_ptr->hash;
+        for (uint64_t i = 0; i < hash->capacity; i++) {
+            if (hash->slots[i].count > 0) {
+                hash->slots[i].first = hash->slots[i].first->next;
+            }
+        }
+    }
+    for (uint64_t i = 0; i < length; i++) {
+        Node* old = block[i].next;
+        if (remap != NULL) {
+            remap(old, &(block[i]), context);
+        }
+        if (pool == NULL) {
+            STATS_FREE(sizeof(Node));
+            free(old);
+        } else if (!owned) {
+            release_node(pool, old);
+        }
+        block[i].next = (i + 1 < length) ? &(block[i + 1]) : NULL;
+    }
+    if (owned && (pool != NULL)) {
+        destroy_node_pool(pool);
+    }
+    list_ptr->pool = target;
+    list_ptr->owns_pool = owned;
+    list_ptr->head = block;
+    list_ptr->tail = &(block[length - 1]);
+    return true;
+}
+
+bool compact_step(SinglyLinkedList* list_ptr, uint64_t max_nodes, NodeRemap remap, void* context) {
+    STATS_OP(LIST_OP_COMPACT);
+    NodePool* pool = list_ptr->pool;
+    if (pool == NULL) {
+        return false;
+    }
+    CompactPass* pass = list_ptr->compact;
+    if (pass == NULL) {
+        if (list_ptr->size == 0) {
+            return false;
+        }
+        pass = (CompactPass *) malloc(sizeof(CompactPass));
+        Node* block = (pass == NULL) ? NULL : pool_block(pool, list_ptr->size);
+        if (block == NULL) {
+            free(pass);
+            return false;
+        }
+        pass->block = block;
+        pass->capacity = list_ptr->size;
+        pass->used = 0;
+        pass->prev = NULL;
+        pass->next_index = 0;
+        list_ptr->compact = pass;
+    }
+    // the first tower at or after the next node to move, found once per slice
+    SkipTower* tower = NULL;
+    if ((list_ptr->skip != NULL) && !list_ptr->skip->stale) {
+        SkipTower* update[SKIP_MAX_LEVEL];
+        uint64_t update_position[SKIP_MAX_LEVEL];
+        skip_seek(list_ptr, pass->next_index + 1, update, update_position);
+        tower = update[0]->levels[0].next;
+    }
+    Node* old = (pass->prev == NULL) ? list_ptr->head : pass->prev->next;
+    for (uint64_t moved = 0; (moved < max_nodes) && (old != NULL); moved++) {
+        if (pass->used == pass->capacity) {
+            // nodes were added since the pass started, so take another block
+            Node* block = pool_block(pool, pool->nodes_per_slab);
+            if (block == NULL) {
+                compact_finish(list_ptr);
+                return false;
+            }
+            pass->block = block;
+            pass->capacity = pool->nodes_per_slab;
+            pass->used = 0;
+        }
+        tower = compact_move(list_ptr, old, tower, remap, context);
+        old = pass->prev->next;
+    }
+    if (old == NULL) {
+        compact_finish(list_ptr);
+        return false;
+    }
+    return true;
 }
 
 bool check_circular(SinglyLinkedList* list_ptr) {
@@ -311,3 +1839,59 @@ bool check_circular(SinglyLinkedList* list_ptr) {
         return false;
     }
 }
+
+ListCursor cursor_start(SinglyLinkedList* list_ptr) {
+    ListCursor cursor = {list_ptr, list_ptr->head, 0};
+    return cursor;
+}
+
+bool cursor_seek(ListCursor* cursor, uint64_t index) {
+    if (index >= cursor->list->size) {
+        return false;
+    } else if ((cursor->node != NULL) && (cursor->index <= index)) {
+        for (; cursor->index < index; cursor->index++) {
+            cursor->node = cursor->node->next;
+        }
+    } else {
+        // the list keeps its own finger and skip index for jumps backwards
+        cursor->node = node_at(cursor->list, index);
+        cursor->index = index;
+    }
+    return true;
+}
+
+bool cursor_next(ListCursor* cursor) {
+    if (cursor->node == NULL) {
+        return false;
+    }
+    cursor->node = cursor->node->next;
+    cursor->index++;
+    return (cursor->node != NULL);
+}
+
+int64_t* cursor_get(ListCursor* cursor) {
+    return (cursor->node == NULL) ? NULL : &(cursor->node->data);
+}
+
+bool cursor_insert_after(ListCursor* cursor, int64_t data) {
+    if (cursor->node == NULL) {
+        return false;
+    } else if (cursor->list->skip != NULL) {
+        skip_insert(cursor->list, data, cursor->index + 2);
+    } else {
+        Node* node = pool_node(cursor->list->pool, data);
+        link_node(cursor->list, cursor->node, node, cursor->index + 1);
+    }
+    return true;
+}
+
+bool cursor_delete_after(ListCursor* cursor) {
+    if ((cursor->node == NULL) || (cursor->node->next == NULL)) {
+        return false;
+    } else if (cursor->list->skip != NULL) {
+        skip_delete(cursor->list, cursor->index + 2);
+    } else {
+        unlink_node(cursor->list, cursor->node, cursor->index + 1);
+    }
+    return true;
+}
@@ -11,6 +11,31 @@ Creation Date: March 30, 2025.
 #include<stdint.h>
 #include<stdbool.h>
 
+/*** Constants ***/
+#define DEFAULT_NODES_PER_SLAB 1024
+// the most express levels a SkipIndex can have
+#define SKIP_MAX_LEVEL 32
+// one in SKIP_FANOUT towers on a level also reaches the next level up
+#define SKIP_FANOUT 4
+// the number of slots a HashIndex starts with, always a power of two
+#define HASH_MIN_CAPACITY 16
+// sort_list only starts another thread for every this many nodes
+#define SORT_MIN_NODES_PER_THREAD 65536
+// radix_sort_list sorts on digits of this many bits, one pass per digit of a 64-bit value
+#define RADIX_BITS 8
+#define RADIX_DIGITS ((64 + RADIX_BITS - 1) / RADIX_BITS)
+// radix_sort_list splits lists longer than this on their highest digit first, so that
+// the passes over the lower digits run on parts which fit in the cache
+#define RADIX_CACHE_NODES 16384
+// find, contains and list_to_array walk this many runs of the list at once when
+// it has a skip index (see enable_skip_index), so that the cache misses of the runs
+// overlap. Without one, every walk is a single chain and is not sped up. More lanes
+// overlap more misses, but a match near the start of a run costs up to this many
+// times the nodes it would as one chain
+#define WALK_LANES 16
+// lists shorter than this are walked as one chain, since the runs would be too short
+#define WALK_MIN_NODES 4096
+
 
 /*** Struct Definitions ***/
 
@@ -24,18 +49,208 @@ typedef struct Node {
     struct Node* next;
 } Node;
 
+/**
+ * @brief A block of Nodes allocated with a single malloc call.
+ *        Slabs are chained together so the pool can free them all
+ *        when it is destroyed.
+ */
+typedef struct NodeSlab {
+    struct NodeSlab* next;
+    uint64_t capacity;
+    Node nodes[];
+} NodeSlab;
+
+/**
+ * @brief A structure representing a pool of Nodes. Nodes are carved
+ *        out of large slabs instead of being allocated one at a time,
+ *        and deleted nodes are pushed onto a free list so the next
+ *        allocation can reuse them.
+ * Contains the chain of slabs, the free list (linked through each
+ * node's next pointer) and counters used to report on the pool.
+ */
+typedef struct {
+    NodeSlab* slabs;
+    Node* free_list;
+    uint64_t nodes_per_slab;
+    uint64_t slab_used;
+    uint64_t num_slabs;
+    uint64_t capacity;
+    uint64_t live_nodes;
+    uint64_t free_nodes;
+} NodePool;
+
+/**
+ * @brief A snapshot of the allocation counters of a NodePool.
+ * Contains the number of mallocs the pool has made, the number of
+ * nodes in use and on the free list, and the number of heap bytes
+ * reserved by the pool per node in use.
+ */
+typedef struct {
+    uint64_t mallocs;
+    uint64_t live_nodes;
+    uint64_t free_nodes;
+    uint64_t capacity;
+    double bytes_per_node;
+} NodePoolStats;
+
+/**
+ * @brief One level of a SkipTower: the next tower on the same level,
+ *        and the number of list nodes the link moves forward by.
+ *        The width of a link to NULL is not used and is left at 0.
+ */
+typedef struct {
+    struct SkipTower* next;
+    uint64_t width;
+} SkipLevel;
+
+/**
+ * @brief A tower of express links standing on one node of the list.
+ * Contains the node it stands on (NULL for the head tower, which stands
+ * just before the first node), its height, and one SkipLevel per level.
+ */
+typedef struct SkipTower {
+    Node* node;
+    uint64_t height;
+    SkipLevel levels[];
+} SkipTower;
+
+/**
+ * @brief An indexable skip list kept on top of a SinglyLinkedList. Only
+ *        about one node in SKIP_FANOUT gets a tower, and the widths stored
+ *        on the express links let positional lookups skip whole runs of
+ *        nodes, so they take O(log n) expected steps instead of O(n).
+ * Contains the head tower, the number of levels in use, the state of the
+ * random generator used to pick tower heights, and a stale flag which is
+ * set when the whole list is reordered, so the index is rebuilt on the
+ * next positional access.
+ */
+typedef struct {
+    SkipTower* head;
+    uint64_t levels;
+    uint64_t random_state;
+    bool stale;
+} SkipIndex;
+
+/**
+ * @brief One slot of a HashIndex. A slot with a count of 0 is empty.
+ * Contains the value, the number of nodes holding it, the first of those
+ * nodes, and the position of that node (its index is position minus
+ * the offset of the HashIndex).
+ */
+typedef struct {
+    int64_t data;
+    uint64_t count;
+    Node* first;
+    uint64_t position;
+} HashSlot;
+
+/**
+ * @brief An open-addressing (linear probing) hash table kept next to a
+ *        list, mapping every value in the list to the number of nodes
+ *        holding it and to its first occurrence.
+ * Contains the slots, the number of slots (a power of two), the number
+ * of slots in use, and an offset subtracted from every stored position
+ * so that prepends and delete_first only need to change the offset.
+ * stale is set when a change in the middle of the list moves positions,
+ * in which case first occurrences are recomputed on the next find.
+ */
+typedef struct {
+    HashSlot* slots;
+    uint64_t capacity;
+    uint64_t used;
+    uint64_t offset;
+    bool stale;
+} HashIndex;
+
+/**
+ * @brief A snapshot of the memory used by a HashIndex.
+ * Contains the number of distinct values, the number of slots, the total
+ * heap bytes used by the index and those bytes divided by the list size.
+ */
+typedef struct {
+    uint64_t distinct_values;
+    uint64_t capacity;
+    uint64_t bytes;
+    double bytes_per_node;
+} HashIndexStats;
+
+/**
+ * @brief Called by compact_list and compact_step for every node they move,
+ *        with the old address of the node, the new one, and the context
+ *        given by the caller, so that pointers to nodes held outside of the
+ *        list can be updated. The old node is released right after the call.
+ */
+typedef void (*NodeRemap)(Node* old_node, Node* new_node, void* context);
+
+/**
+ * @brief The state of an incremental compaction of a list (see compact_step).
+ * Contains the block of the list's pool the nodes are moved into, its
+ * capacity and the number of its nodes already used, the last node moved
+ * (NULL until the head has been moved), and the index of the next node
+ * to move, kept up to date as nodes are linked and unlinked in between
+ * steps.
+ */
+typedef struct {
+    Node* block;
+    uint64_t capacity;
+    uint64_t used;
+    Node* prev;
+    uint64_t next_index;
+} CompactPass;
+
+/**
+ * @brief One insert of a batch given to insert_nodes.
+ * Contains the index the value is inserted at, counted in the list as it
+ * was before the batch, and the value.
+ */
+typedef struct {
+    uint64_t index;
+    int64_t data;
+} IndexedValue;
+
 /**
  * @brief A structure representing a singly linked list. It only
  *        stores the head node of the list since it can only
  *        traverses from head to tail.
- * Contains a pointer to the head node and a 64-bit unsigned 
- * integer representing the size of the list.
+ * Contains a pointer to the head and tail nodes, a 64-bit unsigned
+ * integer representing the size of the list, and the NodePool the
+ * nodes are allocated from (NULL if nodes are allocated with malloc).
+ * owns_pool is set when the list created the pool itself (see
+ * list_from_array), in which case destroy_list also destroys the pool.
+ * skip is the optional positional index (see enable_skip_index), and
+ * hash is the optional value index (see enable_hash_index). finger is
+ * the node at finger_index which was accessed last, or NULL, so that
+ * positional functions called with increasing indices can start there
+ * instead of at the head. compact is the incremental compaction running
+ * on the list (see compact_step), or NULL.
  */
 typedef struct {
     Node* head;
     Node* tail;
+    uint64_t size;
+    NodePool* pool;
+    bool owns_pool;
+    SkipIndex* skip;
+    HashIndex* hash;
+    Node* finger;
+    uint64_t finger_index;
+    CompactPass* compact;
 } SinglyLinkedList;
 
+/**
+ * @brief A position in a SinglyLinkedList, used to walk and change the
+ *        list without searching from the head for every step.
+ * Contains the list, the current node (NULL once the cursor has moved
+ * past the tail) and its index. A cursor stays valid while the list is
+ * only changed through the cursor itself; any other change to the list
+ * requires a new cursor.
+ */
+typedef struct {
+    SinglyLinkedList* list;
+    Node* node;
+    uint64_t index;
+} ListCursor;
+
 
 /*** Node Functions ***/
 
@@ -78,12 +293,73 @@ Node* between_node(int64_t data, Node* prev, Node* next);
  * @brief Searches a chain of nodes, starting with the given head node
  *        and returns true if the provided data is equal to the data
  *        in one of the nodes in the link, returns false otherwise.
+ *        Only a node to start from is known, so the chain is walked one node
+ *        at a time, without the prefetching of find.
  * @param start The node to start the search.
  * @param data The data to search for.
  */
 bool search_forward(Node* start, int64_t data);
 
 
+/*** NodePool Functions ***/
+
+/**
+ * @brief Creates an empty NodePool. No memory for nodes is allocated
+ *        until the first node is requested from the pool.
+ *        Note: The user must call destroy_node_pool when the pool is
+ *        no longer needed to prevent memory leaks.
+ * @param nodes_per_slab The number of nodes allocated by each malloc call.
+ *        If 0, DEFAULT_NODES_PER_SLAB is used.
+ * @return A pointer to the new NodePool, or NULL if allocation fails.
+ */
+NodePool* create_node_pool(uint64_t nodes_per_slab);
+
+/**
+ * @brief Frees every slab owned by the pool, and then the pool itself.
+ *        Any node that came from the pool is invalid afterwards, so
+ *        every list attached to the pool must be cleared or discarded first.
+ * @param pool A pointer to the NodePool to destroy.
+ */
+void destroy_node_pool(NodePool* pool);
+
+/**
+ * @brief Creates a new dangling node from the given pool. Nodes on the
+ *        free list are reused first, then the current slab is used, and a
+ *        new slab is allocated only when both are exhausted.
+ *        If pool is NULL, the node is allocated with malloc instead.
+ * @param pool The NodePool to allocate from, or NULL.
+ * @param data The data attached to the new node.
+ * @return A pointer to the new node, or NULL if allocation fails.
+ */
+Node* pool_node(NodePool* pool, int64_t data);
+
+/**
+ * @brief Returns a node to the pool it was allocated from by pushing it
+ *        onto the free list. If pool is NULL, the node is freed instead.
+ * @param pool The NodePool the node was allocated from, or NULL.
+ * @param node The node to release.
+ */
+void release_node(NodePool* pool, Node* node);
+
+/**
+ * @brief Takes count adjacent nodes out of the pool's newest slab and
+ *        returns a pointer to the first one. If the slab does not have
+ *        count unused nodes left, a new slab holding at least count nodes
+ *        is allocated. The nodes are counted as in use, but their data
+ *        and next pointers are left for the caller to set.
+ * @param pool The NodePool to allocate from.
+ * @param count The number of nodes to take, must be greater than 0.
+ * @return A pointer to the first of the nodes, or NULL if allocation fails.
+ */
+Node* pool_block(NodePool* pool, uint64_t count);
+
+/**
+ * @brief Returns a snapshot of the allocation counters of the pool.
+ * @param pool A pointer to the NodePool to report on.
+ */
+NodePoolStats pool_stats(NodePool* pool);
+
+
 /*** SinglyLinkedList Functions ***/
 
 /**
@@ -96,11 +372,13 @@ bool search_forward(Node* start, int64_t data);
 SinglyLinkedList* create_empty_list();
 
 /**
- * @brief Creates a SinglyLinkedList from the provided array.
+ * @brief Creates a SinglyLinkedList from the provided array in linear time.
+ *        All nodes are allocated with a single malloc call and linked in
+ *        array order, inside a NodePool owned by the new list.
  *        Returns a pointer to the newly created SinglyLinkedList.
  *        Returns an empty list if the array length is 0.
- *        Note: The user must manually free this list pointer when
- *        it is no longer needed to prevent memory leaks.
+ *        Note: The user must call destroy_list when the list is no longer
+ *        needed to prevent memory leaks.
  * @param arr A pointer to the array of 64-bit integers.
  * @param arr_length The length of the array.
  * @return A pointer to a new SinglyLinkedList containing the array elements.
@@ -108,23 +386,98 @@ SinglyLinkedList* create_empty_list();
 SinglyLinkedList* list_from_array(int64_t* arr, uint64_t arr_length);
 
 /**
- * @brief Creates a deep copy of the provided SinglyLinkedList.
+ * @brief Creates a deep copy of the provided SinglyLinkedList in linear time.
  *        Returns a pointer to a new SinglyLinkedList with identical data
- *        but completely separate memory allocations.
+ *        but completely separate memory allocations. Like list_from_array,
+ *        all nodes of the copy are allocated with a single malloc call.
  *        Returns an empty list if the source list is empty.
- *        Note: The user must manually free this list pointer when
- *        it is no longer needed to prevent memory leaks.
+ *        Note: The user must call destroy_list when the list is no longer
+ *        needed to prevent memory leaks.
  * @param list_ptr A pointer to the SinglyLinkedList to be copied.
  * @return A pointer to a new SinglyLinkedList containing copies of all nodes.
  */
 SinglyLinkedList* copy(SinglyLinkedList* list_ptr);
 
+/**
+ * @brief Frees the SinglyLinkedList and all of its nodes. If the list owns
+ *        its NodePool (lists made by list_from_array or copy), the whole pool
+ *        is freed with one free call per slab instead of walking the nodes.
+ *        The list pointer is invalid afterwards.
+ * @param list_ptr A pointer to the SinglyLinkedList to free.
+ */
+void destroy_list(SinglyLinkedList* list_ptr);
+
 /**
  * @brief Returns true if linked is empty and false otherwise.
  * @param list_ptr A pointer to a SinglyLinkedList.
 */
 bool is_empty(SinglyLinkedList* list_ptr);
 
+/**
+ * @brief Attaches a NodePool to the SinglyLinkedList. Every node the list
+ *        creates afterwards is taken from the pool, and every node the list
+ *        deletes is returned to it. The pool can be shared between lists.
+ *        Returns false and leaves the list unchanged if the list is not empty,
+ *        since its existing nodes were not allocated from the pool.
+ * @param list_ptr A pointer to the SinglyLinkedList to attach the pool to.
+ * @param pool A pointer to the NodePool, or NULL to go back to malloc.
+ */
+bool attach_pool(SinglyLinkedList* list_ptr, NodePool* pool);
+
+/**
+ * @brief Builds an indexable skip list over the nodes of the SinglyLinkedList.
+ *        While it is enabled, get, insert_node, replace_node and delete_node
+ *        (and delete_last) take O(log n) expected time instead of O(n), at
+ *        the cost of O(log n) work on append_node and prepend_node. The index
+ *        is kept up to date by every list function, and is rebuilt lazily
+ *        after reverse_list. Returns false if the index could not be allocated.
+ *        Calling it on a list which already has an index does nothing.
+ * @param list_ptr A pointer to the SinglyLinkedList to index.
+ */
+bool enable_skip_index(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Frees the skip index of the SinglyLinkedList, if it has one.
+ *        The list itself is left unchanged.
+ * @param list_ptr A pointer to the SinglyLinkedList.
+ */
+void disable_skip_index(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Rebuilds the skip index of the SinglyLinkedList if it is stale,
+ *        so that every tower stands at the position its widths give it.
+ *        Returns true if the list has a skip index, and false otherwise.
+ * @param list_ptr A pointer to the SinglyLinkedList.
+ */
+bool refresh_skip_index(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Builds a HashIndex over the values of the SinglyLinkedList. While
+ *        it is enabled, contains takes O(1) average time, and so does find
+ *        as long as the list is only changed at its ends. Changes in the
+ *        middle of the list (insert_node, delete_node, reverse_list) make the
+ *        next find for a value that is present rebuild the first occurrences
+ *        in one O(n) pass. Every list function keeps the index up to date,
+ *        and frees it, as disable_hash_index does, if it has to grow and
+ *        can not. Returns false if the index could not be allocated.
+ *        Calling it on a list which already has an index does nothing.
+ * @param list_ptr A pointer to the SinglyLinkedList to index.
+ */
+bool enable_hash_index(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Frees the HashIndex of the SinglyLinkedList, if it has one.
+ * @param list_ptr A pointer to the SinglyLinkedList.
+ */
+void disable_hash_index(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Returns the memory used by the HashIndex of the list, or all
+ *        zeroes if the list has no HashIndex.
+ * @param list_ptr A pointer to the SinglyLinkedList.
+ */
+HashIndexStats hash_index_stats(SinglyLinkedList* list_ptr);
+
 /**
  * @brief Returns the size of the given list.
  * @param list_ptr A pointer to a SinglyLinkedList.
@@ -135,18 +488,42 @@ uint64_t size(SinglyLinkedList* list_ptr);
  * @brief Converts the SinglyLinkedList to an array of 64-bit integers.
  *        Returns a pointer to the array of integers, allocated on the heap.
  *        This must be freed by the user to prevent memory leaks.
- *        Returns NULL if the list is empty.
+ *        Returns NULL if the list is empty, or if the array cannot be allocated.
+ *        Only with a skip index is the list copied WALK_LANES runs at a time, like
+ *        find searches it; without one it is copied as a single chain.
  * @param list_ptr A pointer to the SinglyLinkedList to convert.
 */
 int64_t* list_to_array(SinglyLinkedList* list_ptr); 
 
-void concat(SinglyLinkedList* src, SinglyLinkedList* dest);
+/**
+ * @brief Moves every node of src to the end of dest, leaving src empty, in
+ *        O(1) time by linking the tail of dest to the head of src. No node
+ *        is copied or allocated. The nodes must end up released by the
+ *        allocator of dest: lists on the same allocator (both malloc, or
+ *        the same attached pool) are linked directly, an empty dest takes
+ *        on the allocator of src, and a pool owned by src (see
+ *        list_from_array) is merged into the pool of dest in time linear
+ *        in its slabs and free nodes. The skip index of dest is rebuilt
+ *        on the next positional access, and a hash index of dest counts
+ *        the new values in O(m) time for the m nodes of src.
+ * @param src A pointer to the SinglyLinkedList whose nodes are moved.
+ * @param dest A pointer to the SinglyLinkedList the nodes are appended to.
+ * @return true if the nodes were moved, false if src and dest are the same
+ *         list, or if dest mallocs its nodes and src has a pool (or dest
+ *         has a pool and src mallocs its nodes), in which case both lists
+ *         are unchanged.
+ */
+bool concat(SinglyLinkedList* src, SinglyLinkedList* dest);
 
 /**
  * @brief Returns a pointer to the data at the specified index of the SinglyLinkedList.
  *        The data is returns as a pointer, and the user must handle dereferencing 
  *        the pointer and prevent unwanted modifications to the data.
  *        Returns NULL if the list is empty or the index is out of bounds.
+ *        The search starts from the node accessed last if it is not past the
+ *        index, so calling get with increasing indices is O(1) per call.
+ *        get does not use the prefetching walk of find: with a skip index it
+ *        takes O(log n) steps, and without one it walks a single chain.
  * @param list_ptr A pointer to the SinglyLinkedList to get from.
  * @param index The index of the node to get the data from.
  */
@@ -155,6 +532,8 @@ int64_t* get(SinglyLinkedList* list_ptr, uint64_t index);
 /**
  * @brief Searches the whole SinglyLinkedList to see if it contains the data.
  *        Returns true if the data is found, returns false otherwise.
+ *        Answered by the hash index if there is one, and otherwise searched
+ *        like find, so only a skip index makes the walk prefetch.
  * @param list_ptr A pointer to the SinglyLinkedList to be searched.
  * @param data The data to search for.
 */
@@ -164,6 +543,13 @@ bool contains(SinglyLinkedList* list_ptr, int64_t data);
  * @brief Searches the whole SinglyLinkedList to find the index of the node
  *        containing the data passed as a parameter. Returns the index of the
  *        node if the data is found, returns UINT64_MAX otherwise.
+ *        Only with a skip index which is not stale, and at least WALK_MIN_NODES
+ *        nodes, the towers of one level split the list into runs, which are
+ *        searched WALK_LANES at a time, one node of each run per step, with
+ *        the next node of every run prefetched. A chain of nodes can only be
+ *        walked one miss at a time, but the runs do not depend on each other,
+ *        so their misses overlap. Otherwise the list is walked as a single
+ *        chain, one miss at a time, and is not sped up.
  * @param list_ptr A pointer to the SinglyLinkedList to be searched.
  * @param data The data to search for.
 */
@@ -192,7 +578,8 @@ void prepend_node(SinglyLinkedList* list_ptr, int64_t data);
  *        returns true. If unseccessful or list is empty, returns false.
  * @param list_ptr A pointer to the SinglyLinkedList to modify.
  * @param data The data to attach to the new node.
- * @param Where to insert the 
+ * @param index The index at which to insert the new node. An index equal to
+ *        the size of the list appends the new node.
  */
 bool insert_node(SinglyLinkedList* list_ptr, int64_t data, uint64_t index);
 
@@ -238,6 +625,37 @@ void delete_last(SinglyLinkedList* list_ptr);
  */
 void delete_node(SinglyLinkedList* list_ptr, int64_t index);
 
+/**
+ * @brief Inserts a batch of values in one pass over the SinglyLinkedList,
+ *        in O(n + k) time for k inserts instead of the O(n * k) of k calls
+ *        to insert_node. Every index is counted in the list as it was before
+ *        the batch: a value goes right before the node which was at its
+ *        index, or at the end for an index equal to the size. Values with
+ *        the same index keep the order of the array. A skip index is rebuilt
+ *        on the next positional access.
+ * @param list_ptr A pointer to the SinglyLinkedList to modify.
+ * @param inserts The inserts, sorted by index.
+ * @param count The number of inserts.
+ * @return true if every value was inserted, false if the inserts are not
+ *         sorted or an index is larger than the size of the list, in which
+ *         case the list is unchanged.
+ */
+bool insert_nodes(SinglyLinkedList* list_ptr, const IndexedValue* inserts, uint64_t count);
+
+/**
+ * @brief Deletes a batch of nodes in one pass over the SinglyLinkedList, in
+ *        O(n + k) time for k indices instead of the O(n * k) of k calls to
+ *        delete_node. Every index is counted in the list as it was before
+ *        the batch. A skip index is rebuilt on the next positional access.
+ * @param list_ptr A pointer to the SinglyLinkedList to modify.
+ * @param indices The indices of the nodes to delete, in increasing order.
+ * @param count The number of indices.
+ * @return true if every node was deleted, false if the indices are not in
+ *         increasing order, repeat, or one is out of bounds, in which case
+ *         the list is unchanged.
+ */
+bool delete_nodes(SinglyLinkedList* list_ptr, const uint64_t* indices, uint64_t count);
+
 /**
  * @brief Clears the SinglyLinkedList by freeing all nodes and setting the
  *        head node to NULL.
@@ -254,6 +672,118 @@ void clear(SinglyLinkedList* list_ptr);
  */
 void reverse_list(SinglyLinkedList* list_ptr);
 
+/**
+ * @brief Sorts the SinglyLinkedList in ascending order by relinking its nodes,
+ *        in O(n log n) time and without allocating any nodes or copying any
+ *        data. The sort is stable: nodes holding equal data keep their order.
+ *        Lists of at least 2 * SORT_MIN_NODES_PER_THREAD nodes are cut into one
+ *        part per thread, each part is sorted by its own thread, and the parts
+ *        are merged pairwise by the threads in rounds.
+ * @param list_ptr A pointer to the SinglyLinkedList to sort.
+ * @param num_threads The largest number of threads to use, counting the calling
+ *        thread, or 0 to use one per online core.
+ */
+void sort_list(SinglyLinkedList* list_ptr, uint64_t num_threads);
+
+/**
+ * @brief Sorts the SinglyLinkedList in ascending order with a radix sort which
+ *        relinks the nodes, RADIX_BITS bits at a time. Every pass moves the nodes
+ *        into one chain per digit, keeping their order, and links the chains back
+ *        together, so the sort is stable and allocates nothing. Lists longer than
+ *        RADIX_CACHE_NODES are first split on their highest digit, and every part
+ *        is then sorted on its lower digits least significant digit first, while
+ *        its nodes are in the cache. Digits which are the same in every node of a
+ *        part are skipped.
+ * @param list_ptr A pointer to the SinglyLinkedList to sort.
+ */
+void radix_sort_list(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Moves every node of the SinglyLinkedList into one contiguous block,
+ *        in list order, so that walking the list reads memory front to back
+ *        again after inserts and deletes have scattered its nodes. If the
+ *        list owns its pool, or has none, the nodes move to a new pool owned
+ *        by the list and the old pool (or every malloc'd node) is freed. A
+ *        pool attached with attach_pool is kept: the block is taken from it,
+ *        and the old nodes go back to its free list. The finger, skip index
+ *        and hash index follow the nodes; any other pointer to a node of the
+ *        list, such as a ListCursor, must be updated through remap. Any
+ *        incremental compaction running on the list is finished first.
+ * @param list_ptr A pointer to the SinglyLinkedList to compact.
+ * @param remap Called for every node moved, or NULL.
+ * @param context Passed to remap.
+ * @return true if the list was compacted, false if memory allocation failed,
+ *         in which case the list is unchanged.
+ */
+bool compact_list(SinglyLinkedList* list_ptr, NodeRemap remap, void* context);
+
+/**
+ * @brief Runs an incremental compaction of the SinglyLinkedList for at most
+ *        max_nodes nodes, so that a large list can be compacted in steps of
+ *        bounded time while it is in use. The first call takes one block
+ *        for every node from the pool of the list, and every call moves the
+ *        next nodes, from the head on, into it. The list may be changed in
+ *        between steps: nodes linked behind the pass are left where they are,
+ *        and reverse_list and the sorts end the pass. Lists without a pool
+ *        are not compacted by steps, since their nodes are freed one by one;
+ *        compact_list gives them a pool of their own.
+ * @param list_ptr A pointer to the SinglyLinkedList to compact.
+ * @param max_nodes The most nodes this step moves.
+ * @param remap Called for every node moved, or NULL.
+ * @param context Passed to remap.
+ * @return true while the pass has nodes left to move, false once it is over,
+ *         or if it could not run.
+ */
+bool compact_step(SinglyLinkedList* list_ptr, uint64_t max_nodes, NodeRemap remap, void* context);
+
+/**
+ * @brief Returns a cursor at the head of the SinglyLinkedList. If the list
+ *        is empty, the cursor is already past the end.
+ * @param list_ptr A pointer to the SinglyLinkedList to walk.
+ */
+ListCursor cursor_start(SinglyLinkedList* list_ptr);
+
+/**
+ * @brief Moves the cursor to the node at the given index, walking from the
+ *        cursor itself if the index is not behind it. Returns false and
+ *        leaves the cursor unchanged if the index is out of bounds.
+ * @param cursor A pointer to the ListCursor to move.
+ * @param index The index of the node to move to.
+ */
+bool cursor_seek(ListCursor* cursor, uint64_t index);
+
+/**
+ * @brief Moves the cursor to the next node. Returns false if there is no
+ *        next node, in which case the cursor is past the end.
+ * @param cursor A pointer to the ListCursor to move.
+ */
+bool cursor_next(ListCursor* cursor);
+
+/**
+ * @brief Returns a pointer to the data of the node under the cursor, or NULL
+ *        if the cursor is past the end. As with get, the data must not be
+ *        changed through the pointer while the list has a HashIndex.
+ * @param cursor A pointer to the ListCursor to read.
+ */
+int64_t* cursor_get(ListCursor* cursor);
+
+/**
+ * @brief Inserts a node with the data right after the node under the cursor,
+ *        in O(1) time (O(log n) with a skip index). The cursor stays on its
+ *        node. Returns false if the cursor is past the end.
+ * @param cursor A pointer to the ListCursor to insert after.
+ * @param data The data to attach to the new node.
+ */
+bool cursor_insert_after(ListCursor* cursor, int64_t data);
+
+/**
+ * @brief Deletes the node right after the node under the cursor, in O(1) time
+ *        (O(log n) with a skip index). The cursor stays on its node. Returns
+ *        false if there is no node after the cursor.
+ * @param cursor A pointer to the ListCursor to delete after.
+ */
+bool cursor_delete_after(ListCursor* cursor);
+
 /**
  * @brief Checks if the SinglyLinkedList is circular.
  *        A circular list has at least one node whose next pointer points to a previous node
@@ -0,0 +1,200 @@
+/*
+This document is meant to store the implementation of the list files of the
+singly linked list. A list file starts with a MappedHeader and holds its nodes
+one after the other in the order they were appended, with the link of every
+node stored as a distance from the node itself, so that the file is walked
+right where it is mapped.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<fcntl.h>
+#include<stdlib.h>
+#include<string.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#include"singly-mapped.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Maps the first capacity bytes of the file into memory, and wraps it in a
+ *        new MappedSinglyList. Closes the file and returns NULL on failure.
+ */
+static MappedSinglyList* map_list_file(int fd, uint64_t capacity) {
+    MappedSinglyList* mapped_ptr = (MappedSinglyList *) malloc(sizeof(MappedSinglyList));
+    void* base = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ((mapped_ptr == NULL) || (base == MAP_FAILED)) {
+        if (base != MAP_FAILED) {
+            munmap(base, capacity);
+        }
+        free(mapped_ptr);
+        close(fd);
+        return NULL;
+    }
+    mapped_ptr->fd = fd;
+    mapped_ptr->header = (MappedHeader *) base;
+    mapped_ptr->capacity = capacity;
+    return mapped_ptr;
+}
+
+/**
+ * @brief Returns true if the header describes a list file of this layout whose
+ *        nodes all lie inside the first length bytes of the file.
+ */
+static bool valid_header(MappedHeader* header, uint64_t length) {
+    uint64_t first = sizeof(MappedHeader);
+    if ((memcmp(header->magic, MAPPED_MAGIC, sizeof(header->magic)) != 0)
+        || (header->node_size != sizeof(MappedNode))
+        || (header->used < first) || (header->used > length)
+        || ((header->used - first) % sizeof(MappedNode) != 0)
+        || (header->size > (header->used - first) / sizeof(MappedNode))) {
+        return false;
+    }
+    if (header->size == 0) {
+        return (header->head == 0) && (header->tail == 0);
+    }
+    return (header->head >= first) && (header->head < header->used)
+           && (header->tail >= first) && (header->tail < header->used);
+}
+
+/**
+ * @brief Doubles the length of the file, and maps it again in full.
+ */
+static bool grow_list_file(MappedSinglyList* mapped_ptr) {
+    uint64_t capacity = 2 * mapped_ptr->capacity;
+    if (capacity < sizeof(MappedHeader) + MAPPED_DEFAULT_CAPACITY * sizeof(MappedNode)) {
+        capacity = sizeof(MappedHeader) + MAPPED_DEFAULT_CAPACITY * sizeof(MappedNode);
+    }
+    if (ftruncate(mapped_ptr->fd, capacity) != 0) {
+        return false;
+    }
+    void* base = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, mapped_ptr->fd, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    munmap(mapped_ptr->header, mapped_ptr->capacity);
+    mapped_ptr->header = (MappedHeader *) base;
+    mapped_ptr->capacity = capacity;
+    return true;
+}
+
+/*** MappedSinglyList Functions ***/
+
+MappedSinglyList* create_mapped_list(const char* path, uint64_t capacity) {
+    if (capacity == 0) {
+        capacity = MAPPED_DEFAULT_CAPACITY;
+    }
+    uint64_t length = sizeof(MappedHeader) + capacity * sizeof(MappedNode);
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (ftruncate(fd, length) != 0) {
+        close(fd);
+        return NULL;
+    }
+    MappedSinglyList* mapped_ptr = map_list_file(fd, length);
+    if (mapped_ptr == NULL) {
+        return NULL;
+    }
+    MappedHeader* header = mapped_ptr->header;
+    memcpy(header->magic, MAPPED_MAGIC, sizeof(header->magic));
+    header->node_size = sizeof(MappedNode);
+    header->size = 0;
+    header->head = 0;
+    header->tail = 0;
+    header->used = sizeof(MappedHeader);
+    return mapped_ptr;
+}
+
+MappedSinglyList* open_mapped_list(const char* path) {
+    int fd = open(path, O_RDWR);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat info;
+    if ((fstat(fd, &info) != 0) || ((uint64_t) info.st_size < sizeof(MappedHeader))) {
+        close(fd);
+        return NULL;
+    }
+    MappedSinglyList* mapped_ptr = map_list_file(fd, info.st_size);
+    if ((mapped_ptr != NULL) && !valid_header(mapped_ptr->header, mapped_ptr->capacity)) {
+        munmap(mapped_ptr->header, mapped_ptr->capacity);
+        close(fd);
+        free(mapped_ptr);
+        return NULL;
+    }
+    return mapped_ptr;
+}
+
+void close_mapped_list(MappedSinglyList* mapped_ptr) {
+    uint64_t used = mapped_ptr->header->used;
+    msync(mapped_ptr->header, mapped_ptr->capacity, MS_SYNC);
+    munmap(mapped_ptr->header, mapped_ptr->capacity);
+    if (ftruncate(mapped_ptr->fd, used) == 0) {
+        fsync(mapped_ptr->fd);
+    }
+    close(mapped_ptr->fd);
+    free(mapped_ptr);
+}
+
+bool mapped_sync(MappedSinglyList* mapped_ptr) {
+    return msync(mapped_ptr->header, mapped_ptr->header->used, MS_SYNC) == 0;
+}
+
+bool mapped_append(MappedSinglyList* mapped_ptr, int64_t data) {
+    if ((mapped_ptr->header->used + sizeof(MappedNode) > mapped_ptr->capacity) && !grow_list_file(mapped_ptr)) {
+        return false;
+    }
+    MappedHeader* header = mapped_ptr->header;
+    char* base = (char *) header;
+    uint64_t offset = header->used;
+    MappedNode* node = (MappedNode *) (base + offset);
+    node->data = data;
+    node->next = 0;
+    // the node is written before anything links to it, and the size is changed last
+    if (header->size == 0) {
+        header->head = offset;
+    } else {
+        MappedNode* tail = (MappedNode *) (base + header->tail);
+        tail->next = (int64_t) (offset - header->tail);
+    }
+    header->tail = offset;
+    header->used = offset + sizeof(MappedNode);
+    header->size++;
+    return true;
+}
+
+uint64_t mapped_size(MappedSinglyList* mapped_ptr) {
+    return mapped_ptr->header->size;
+}
+
+MappedNode* mapped_head(MappedSinglyList* mapped_ptr) {
+    if (mapped_ptr->header->size == 0) {
+        return NULL;
+    }
+    return (MappedNode *) ((char *) mapped_ptr->header + mapped_ptr->header->head);
+}
+
+MappedNode* mapped_next(MappedNode* node) {
+    if (node->next == 0) {
+        return NULL;
+    }
+    return (MappedNode *) ((char *) node + node->next);
+}
+
+bool save_mapped_list(SinglyLinkedList* list_ptr, const char* path) {
+    MappedSinglyList* mapped_ptr = create_mapped_list(path, list_ptr->size);
+    if (mapped_ptr == NULL) {
+        return false;
+    }
+    bool saved = true;
+    for (Node* node = list_ptr->head; (node != NULL) && saved; node = node->next) {
+        saved = mapped_append(mapped_ptr, node->data);
+    }
+    close_mapped_list(mapped_ptr);
+    return saved;
+}
@@ -0,0 +1,152 @@
+/*
+This header file is used to declare the MappedNode struct, and the functions
+used to keep a singly linked list in a file which is mapped into memory, so
+that a list written by one run of a program can be walked by the next one
+without reading it in node by node.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef SINGLYMAPPED_H
+#define SINGLYMAPPED_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"singly-linked.h"
+
+/*** Constants ***/
+// the first bytes of every list file, which also change with the layout of a MappedNode
+#define MAPPED_MAGIC "SLLMAP01"
+// the number of nodes a new list file has room for when no capacity is given
+#define MAPPED_DEFAULT_CAPACITY 1024
+
+
+/*** Struct Definitions ***/
+
+/**
+ * @brief A node as it is stored in a list file.
+ * Contains the 64-bit signed integer data of the node, and next, the
+ * distance in bytes from this node to the next one, or 0 for the last
+ * node. Since next is relative to the node itself, the file can be
+ * mapped at any address and walked without changing a single byte.
+ */
+typedef struct {
+    int64_t data;
+    int64_t next;
+} MappedNode;
+
+/**
+ * @brief The header at the start of every list file.
+ * Contains the magic bytes MAPPED_MAGIC, the size of a MappedNode when
+ * the file was written, the number of nodes, the offsets in the file of
+ * the head and tail nodes (0 when the list is empty, since the header
+ * is at offset 0), and the number of bytes in use, after which the
+ * next node is written.
+ */
+typedef struct {
+    char magic[8];
+    uint64_t node_size;
+    uint64_t size;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t used;
+} MappedHeader;
+
+/**
+ * @brief A list file which is open and mapped into memory.
+ * Contains the file descriptor of the file, the address the file is
+ * mapped at, which starts with the MappedHeader, and the number of
+ * bytes mapped, which is also the length of the file while it is open.
+ */
+typedef struct {
+    int fd;
+    MappedHeader* header;
+    uint64_t capacity;
+} MappedSinglyList;
+
+
+/*** MappedSinglyList Functions ***/
+
+/**
+ * @brief Creates a list file holding an empty list, replacing any file
+ *        already at path, and maps it into memory.
+ *        Note: The user must call close_mapped_list when the list is no
+ *        longer needed.
+ * @param path The path of the file to create.
+ * @param capacity The number of nodes the file has room for before it has
+ *        to grow, or 0 to use MAPPED_DEFAULT_CAPACITY.
+ * @return A pointer to the open MappedSinglyList, or NULL if the file
+ *         could not be created or mapped.
+ */
+MappedSinglyList* create_mapped_list(const char* path, uint64_t capacity);
+
+/**
+ * @brief Maps an existing list file into memory, without reading or
+ *        changing any of its nodes, so it takes the same time for any
+ *        length of list. The header is checked before the list is used.
+ *        Note: The user must call close_mapped_list when the list is no
+ *        longer needed.
+ * @param path The path of the file to open.
+ * @return A pointer to the open MappedSinglyList, or NULL if the file does
+ *         not exist, could not be mapped, or is not a valid list file.
+ */
+MappedSinglyList* open_mapped_list(const char* path);
+
+/**
+ * @brief Writes every change to the file with msync, trims the space kept
+ *        for more nodes off the end of the file, and closes it.
+ * @param mapped_ptr A pointer to the MappedSinglyList to close, which is freed.
+ */
+void close_mapped_list(MappedSinglyList* mapped_ptr);
+
+/**
+ * @brief Writes every change made to the list so far to the file with
+ *        msync, and waits until it is written.
+ * @param mapped_ptr A pointer to the MappedSinglyList to write.
+ * @return true if the changes were written, false if msync failed.
+ */
+bool mapped_sync(MappedSinglyList* mapped_ptr);
+
+/**
+ * @brief Writes a new node holding data after the last node of the file.
+ *        The file doubles in length whenever it is full, which maps it
+ *        again, possibly at another address, so MappedNode pointers taken
+ *        before an append must not be used after it. The node is in the
+ *        file once mapped_sync or close_mapped_list is called.
+ * @param mapped_ptr A pointer to the MappedSinglyList to append to.
+ * @param data The value to store in the new node.
+ * @return true if the node was appended, false if the file could not grow.
+ */
+bool mapped_append(MappedSinglyList* mapped_ptr, int64_t data);
+
+/**
+ * @brief Returns the number of nodes in the list file.
+ * @param mapped_ptr A pointer to the MappedSinglyList.
+ * @return The number of nodes.
+ */
+uint64_t mapped_size(MappedSinglyList* mapped_ptr);
+
+/**
+ * @brief Returns the first node of the list file.
+ * @param mapped_ptr A pointer to the MappedSinglyList.
+ * @return A pointer to the first node, or NULL if the list is empty.
+ */
+MappedNode* mapped_head(MappedSinglyList* mapped_ptr);
+
+/**
+ * @brief Returns the node after node in its list file.
+ * @param node A pointer to a node of an open MappedSinglyList.
+ * @return A pointer to the next node, or NULL if node is the last one.
+ */
+MappedNode* mapped_next(MappedNode* node);
+
+/**
+ * @brief Writes the values of a SinglyLinkedList, in order, to a new list
+ *        file at path, replacing any file already there.
+ * @param list_ptr A pointer to the SinglyLinkedList to write.
+ * @param path The path of the file to write.
+ * @return true if the file was written, false if it could not be created.
+ */
+bool save_mapped_list(SinglyLinkedList* list_ptr, const char* path);
+
+#endif
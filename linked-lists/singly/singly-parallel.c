@@ -0,0 +1,187 @@
+/*
+This document is meant to store the implementation of the parallel search of
+the singly linked list. The towers of one level of the skip index mark where
+the segments start, threads take the segments in list order from a shared
+counter, and the lowest match found so far is kept in an atomic, which every
+thread checks to stop early.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<pthread.h>
+#include<stdatomic.h>
+#include<stdlib.h>
+#include"singly-parallel.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Where a segment of the search starts: its first node, and the
+ *        index of that node.
+ */
+typedef struct {
+    Node* node;
+    uint64_t index;
+} SegmentStart;
+
+/**
+ * @brief The state shared by the threads of one search. The segment i starts at
+ *        starts[i] and ends where the next one starts, or at the tail.
+ */
+typedef struct {
+    SegmentStart* starts;
+    uint64_t count;
+    uint64_t size;
+    int64_t data;
+    bool any;                        // stop at a match anywhere, not only before the node
+    atomic_uint_fast64_t next;       // the next segment to take
+    atomic_uint_fast64_t found;      // the lowest match so far, or UINT64_MAX
+} ParallelSearch;
+
+/**
+ * @brief Lowers the match found by the search to index, unless a lower one was
+ *        found in the meantime.
+ */
+static void record_match(ParallelSearch* search, uint64_t index) {
+    uint_fast64_t found = atomic_load_explicit(&(search->found), memory_order_relaxed);
+    while ((index < found)
+           && !atomic_compare_exchange_weak_explicit(&(search->found), &found, index,
+                                                     memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Returns true once a match was found which makes scanning from index
+ *        pointless: any match for a contains, or one before index for a find.
+ */
+static bool search_over(ParallelSearch* search, uint64_t index) {
+    uint_fast64_t found = atomic_load_explicit(&(search->found), memory_order_relaxed);
+    return search->any ? (found != UINT64_MAX) : (found < index);
+}
+
+/**
+ * @brief Takes segments until there are none left or the search is over, and
+ *        scans each one. Segments are taken in list order, so after a match a
+ *        thread has nothing lower left to scan.
+ */
+static void* search_segments(void* arg) {
+    ParallelSearch* search = (ParallelSearch *) arg;
+    while (true) {
+        uint64_t segment = atomic_fetch_add_explicit(&(search->next), 1, memory_order_relaxed);
+        if ((segment >= search->count) || search_over(search, search->starts[segment].index)) {
+            return NULL;
+        }
+        uint64_t index = search->starts[segment].index;
+        uint64_t end = (segment + 1 < search->count) ? search->starts[segment + 1].index : search->size;
+        Node* node = search->starts[segment].node;
+        while (index < end) {
+            uint64_t stop = (end - index > PARALLEL_CANCEL_NODES) ? index + PARALLEL_CANCEL_NODES : end;
+            for (; index < stop; index++) {
+                if (node->data == search->data) {
+                    record_match(search, index);
+                    return NULL;
+                }
+                node = node->next;
+            }
+            if (search_over(search, index)) {
+                return NULL;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Picks the highest level of the skip index with at least towers towers
+ *        (counting the head tower), and stores where each of its towers starts a
+ *        segment in search. Returns false if no level has that many towers, or
+ *        memory allocation failed.
+ */
+static bool segments_from_towers(SinglyLinkedList* list_ptr, ParallelSearch* search, uint64_t towers) {
+    SkipIndex* skip = list_ptr->skip;
+    for (uint64_t level = skip->levels; level-- > 0;) {
+        uint64_t count = 1;
+        for (SkipTower* tower = skip->head->levels[level].next; tower != NULL; tower = tower->levels[level].next) {
+            count++;
+        }
+        if (count < towers) {
+            continue;
+        }
+        search->starts = (SegmentStart *) malloc(sizeof(SegmentStart) * count);
+        if (search->starts == NULL) {
+            return false;
+        }
+        // the head tower stands before the first node, every other tower on its node
+        search->starts[0].node = list_ptr->head;
+        search->starts[0].index = 0;
+        search->count = 1;
+        uint64_t position = 0;
+        for (SkipTower* tower = skip->head; tower->levels[level].next != NULL; tower = tower->levels[level].next) {
+            position += tower->levels[level].width;
+            search->starts[search->count].node = tower->levels[level].next->node;
+            search->starts[search->count].index = position - 1;
+            search->count++;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Runs a search on the calling thread and threads - 1 new ones, and
+ *        stores the lowest match, or UINT64_MAX, in found. Returns false if the
+ *        list has to be searched by find instead.
+ */
+static bool search_in_parallel(SinglyLinkedList* list_ptr, int64_t data, uint64_t threads, bool any,
+                               uint64_t* found) {
+    if ((threads < 2) || (list_ptr->size < PARALLEL_MIN_NODES) || (list_ptr->hash != NULL)
+        || !refresh_skip_index(list_ptr)) {
+        return false;
+    }
+    if (threads > PARALLEL_MAX_THREADS) {
+        threads = PARALLEL_MAX_THREADS;
+    }
+    ParallelSearch search;
+    if (!segments_from_towers(list_ptr, &search, threads * PARALLEL_SEGMENTS_PER_THREAD)) {
+        return false;
+    }
+    search.size = list_ptr->size;
+    search.data = data;
+    search.any = any;
+    atomic_init(&(search.next), 0);
+    atomic_init(&(search.found), UINT64_MAX);
+
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    uint64_t started = 0;
+    for (; started < threads - 1; started++) {
+        // the threads which did start, and this one, still scan every segment
+        if (pthread_create(&(workers[started]), NULL, search_segments, &search) != 0) {
+            break;
+        }
+    }
+    search_segments(&search);
+    for (uint64_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(search.starts);
+    *found = (uint64_t) atomic_load(&(search.found));
+    return true;
+}
+
+/*** Parallel Search Functions ***/
+
+uint64_t parallel_find(SinglyLinkedList* list_ptr, int64_t data, uint64_t threads) {
+    uint64_t found;
+    if (!search_in_parallel(list_ptr, data, threads, false, &found)) {
+        return find(list_ptr, data);
+    }
+    return found;
+}
+
+bool parallel_contains(SinglyLinkedList* list_ptr, int64_t data, uint64_t threads) {
+    uint64_t found;
+    if (!search_in_parallel(list_ptr, data, threads, true, &found)) {
+        return contains(list_ptr, data);
+    }
+    return found != UINT64_MAX;
+}
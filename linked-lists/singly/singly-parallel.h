@@ -0,0 +1,65 @@
+/*
+This header file is used to declare the functions which search a singly linked
+list with several threads at once. The list is cut into segments at the towers
+of one level of its skip index, and every thread scans whole segments, stopping
+as soon as a match is found earlier in the list than the segment it is on.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef SINGLYPARALLEL_H
+#define SINGLYPARALLEL_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"singly-linked.h"
+
+/*** Constants ***/
+// lists shorter than this are searched by the calling thread alone, since starting
+// threads would take longer than the search
+#define PARALLEL_MIN_NODES 65536
+// the most threads a search starts
+#define PARALLEL_MAX_THREADS 64
+// a thread checks whether the search is over every this many nodes
+#define PARALLEL_CANCEL_NODES 1024
+// the level of the skip index cutting the list has at least this many towers per thread
+#define PARALLEL_SEGMENTS_PER_THREAD 4
+
+
+/*** Parallel Search Functions ***/
+
+/**
+ * @brief Searches the SinglyLinkedList for data with several threads, and
+ *        returns the index of its first occurrence, like find.
+ *        The segments are the runs between the towers of the highest level
+ *        of the skip index (see enable_skip_index) with at least
+ *        PARALLEL_SEGMENTS_PER_THREAD towers per thread. Every list function
+ *        keeps the towers up to date, so no walk is needed to split the list,
+ *        and a stale index is rebuilt first. The calling thread and threads - 1
+ *        new ones take the segments in list order, one at a time, so a thread
+ *        which finishes early takes the next one. A thread stops at the first
+ *        match in its segment, and every thread stops once a match was found
+ *        before the node it is on, so the lowest matching index is returned.
+ *        With fewer than 2 threads, and for lists with a hash index, without
+ *        a skip index, or with fewer than PARALLEL_MIN_NODES nodes, find runs
+ *        on the calling thread. No other thread may change the list during
+ *        the search.
+ * @param list_ptr A pointer to the SinglyLinkedList to be searched.
+ * @param data The data to search for.
+ * @param threads The number of threads to search with, at most PARALLEL_MAX_THREADS.
+ * @return The index of the first node holding data, or UINT64_MAX if no node does.
+ */
+uint64_t parallel_find(SinglyLinkedList* list_ptr, int64_t data, uint64_t threads);
+
+/**
+ * @brief Searches the SinglyLinkedList for data with several threads, and
+ *        returns true if any node holds it, false otherwise. The same as
+ *        parallel_find, except that every thread stops once a match was found
+ *        anywhere in the list.
+ * @param list_ptr A pointer to the SinglyLinkedList to be searched.
+ * @param data The data to search for.
+ * @param threads The number of threads to search with, at most PARALLEL_MAX_THREADS.
+ */
+bool parallel_contains(SinglyLinkedList* list_ptr, int64_t data, uint64_t threads);
+
+#endif
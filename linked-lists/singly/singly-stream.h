@@ -0,0 +1,96 @@
+/*
+This header file is used to declare the functions used to write a singly
+linked list to a stream of bytes, and to append the values of such a stream
+to a list, in a compact format which takes a fixed amount of memory whatever
+the length of the list.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef SINGLYSTREAM_H
+#define SINGLYSTREAM_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+#include"singly-linked.h"
+
+/*** Constants ***/
+// the first bytes of every stream
+#define STREAM_MAGIC "LLS1"
+// the most bytes of encoded values in one chunk of a stream
+#define STREAM_CHUNK_BYTES 65536
+// the most bytes a value takes once encoded as a varint
+#define STREAM_VARINT_BYTES 10
+
+
+/*** Stream Types ***/
+
+/**
+ * @brief A function which takes the next bytes of a stream being written.
+ *        context is the pointer given to encode_list. Returns true if
+ *        all length bytes were taken, false to stop encoding.
+ */
+typedef bool (*StreamWriter)(void* context, const uint8_t* bytes, uint64_t length);
+
+/**
+ * @brief A function which gives the next bytes of a stream being read.
+ *        context is the pointer given to decode_list. Stores at most
+ *        capacity bytes in bytes, and returns how many it stored, 0 at
+ *        the end of the stream, or -1 to stop decoding with an error.
+ */
+typedef int64_t (*StreamReader)(void* context, uint8_t* bytes, uint64_t capacity);
+
+
+/*** Stream Functions ***/
+
+/**
+ * @brief Writes the values of the SinglyLinkedList, in order, to a stream.
+ *        The stream starts with STREAM_MAGIC, and is followed by chunks
+ *        of at most STREAM_CHUNK_BYTES bytes. Every chunk starts with the
+ *        number of values in it and its length in bytes, and holds the
+ *        difference of every value from the one before it (the first
+ *        value of a chunk is taken from 0), zigzag encoded so that small
+ *        negative differences stay small, as a varint of 7 bits per byte.
+ *        A chunk of no values ends the stream. Lists of close values take
+ *        one or two bytes per value, and no value takes more than
+ *        STREAM_VARINT_BYTES. Only one chunk is held in memory at a time.
+ * @param list_ptr A pointer to the SinglyLinkedList to write.
+ * @param write The function which takes the bytes of the stream.
+ * @param context The pointer passed to every call of write.
+ * @return true if the whole stream was written, false if write failed.
+ */
+bool encode_list(SinglyLinkedList* list_ptr, StreamWriter write, void* context);
+
+/**
+ * @brief Writes the values of the SinglyLinkedList to a file descriptor
+ *        in the format of encode_list.
+ * @param list_ptr A pointer to the SinglyLinkedList to write.
+ * @param fd The file descriptor to write to, such as a file, pipe or socket.
+ * @return true if the whole stream was written, false if a write failed.
+ */
+bool encode_list_fd(SinglyLinkedList* list_ptr, int fd);
+
+/**
+ * @brief Reads a stream written by encode_list and appends its values, in
+ *        order, to the end of the SinglyLinkedList as every chunk is read,
+ *        without collecting them in an array first.
+ * @param list_ptr A pointer to the SinglyLinkedList to append to.
+ * @param read The function which gives the bytes of the stream.
+ * @param context The pointer passed to every call of read.
+ * @return true if the whole stream was read, false if read failed or the
+ *         stream is not in the format of encode_list, in which case the
+ *         values decoded before the error are kept in the list.
+ */
+bool decode_list(SinglyLinkedList* list_ptr, StreamReader read, void* context);
+
+/**
+ * @brief Reads a stream written by encode_list from a file descriptor and
+ *        appends its values to the end of the SinglyLinkedList.
+ * @param list_ptr A pointer to the SinglyLinkedList to append to.
+ * @param fd The file descriptor to read from, such as a file, pipe or socket.
+ * @return true if the whole stream was read, false if a read failed or the
+ *         stream is not in the format of encode_list.
+ */
+bool decode_list_fd(SinglyLinkedList* list_ptr, int fd);
+
+#endif
@@ -13,7 +13,15 @@ by me personally.
 #include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
+#include<unistd.h>
 #include"singly-linked.h"
+#include"singly-mapped.h"
+#include"singly-stream.h"
+#include"singly-arena.h"
+#include"singly-parallel.h"
+#include"singly-generic.h"
+#include"../stats/list-stats.h"
 
 /*** Constants ***/
 // for clarity in code
@@ -27,10 +35,52 @@ uint8_t PREV_NODE_NUM_TESTS = 6;
 uint8_t BETWEEN_NODE_NUM_TESTS = 3;
 uint8_t SEARCH_FORWARD_NUM_TESTS = 4;
 
+// for NodePool functions
+uint8_t NODE_POOL_NUM_TESTS = 5;
+uint8_t ATTACH_POOL_NUM_TESTS = 5;
+
 // for SinglyLinkedList functions
-uint8_t CREATE_EMPTY_NUM_TESTS = 1;
+uint8_t CREATE_EMPTY_NUM_TESTS = 2;
 uint8_t IS_EMPTY_NUM_TESTS = 3;
 uint8_t SIZE_NUM_TESTS = 3;
+uint8_t LIST_FROM_ARRAY_NUM_TESTS = 5;
+uint8_t COPY_NUM_TESTS = 4;
+uint8_t DELETE_NODE_NUM_TESTS = 5;
+uint8_t SKIP_INDEX_NUM_TESTS = 6;
+uint8_t HASH_INDEX_NUM_TESTS = 6;
+uint8_t FINGER_NUM_TESTS = 4;
+uint8_t LOOKAHEAD_NUM_TESTS = 5;
+uint8_t CURSOR_NUM_TESTS = 6;
+uint8_t SORT_LIST_NUM_TESTS = 6;
+uint8_t RADIX_SORT_NUM_TESTS = 5;
+uint8_t COMPACT_NUM_TESTS = 6;
+uint8_t CONCAT_NUM_TESTS = 5;
+uint8_t BATCH_NUM_TESTS = 5;
+uint8_t PARALLEL_NUM_TESTS = 5;
+
+// for the instrumentation, whose counters are all 0 when it is compiled out
+uint8_t STATS_NUM_TESTS = 4;
+#ifdef LIST_STATS
+#define STATS_EXPECT(n) (n)
+#else
+#define STATS_EXPECT(n) 0
+#endif
+
+// for MappedSinglyList functions
+uint8_t MAPPED_LIST_NUM_TESTS = 6;
+// the list file written by the tests
+#define MAPPED_TEST_PATH "build/test-mapped.list"
+
+// for stream functions
+uint8_t STREAM_NUM_TESTS = 6;
+// the stream file written by the tests
+#define STREAM_TEST_PATH "build/test-stream.bin"
+
+// for ArenaSinglyList functions
+uint8_t ARENA_LIST_NUM_TESTS = 6;
+
+// for lists made by DEFINE_SINGLY_LIST
+uint8_t GENERIC_LIST_NUM_TESTS = 6;
 
 /*** Node Unit Tests ***/
 
@@ -253,13 +303,113 @@ bool* test_search_forward() {
     return tests_status;
 }
 
+/*** NodePool Unit Tests ***/
+
+/**
+ * @brief Tests the pool_node and release_node functions of the NodePool
+ *
+ * This function performs five tests on the NodePool functionality:
+ * 1. Verifies that a node from the pool has its data set and its next pointer set to NULL
+ * 2. Verifies that nodes handed out of one slab are adjacent in memory
+ * 3. Verifies that a released node is the next node handed out by the pool
+ * 4. Verifies that a new slab is only allocated once the first slab is used up
+ * 5. Verifies that the pool counts live nodes and nodes on the free list
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains NODE_POOL_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_node_pool() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * NODE_POOL_NUM_TESTS);
+    NodePool* pool = create_node_pool(4);
+
+    // Test 1: data is set and next pointer is NULL
+    Node* first = pool_node(pool, 7);
+    tests_status[0] = (first->data == 7) && (first->next == NULL);
+
+    // Test 2: the second node comes right after the first one in the slab
+    Node* second = pool_node(pool, 8);
+    tests_status[1] = (second == first + 1);
+
+    // Test 3: a released node is reused before the slab
+    release_node(pool, first);
+    Node* reused = pool_node(pool, 9);
+    tests_status[2] = (reused == first) && (reused->data == 9);
+
+    // Test 4: 4 nodes fit in one slab, the 5th node needs a second slab
+    pool_node(pool, 10);
+    pool_node(pool, 11);
+    bool one_slab = (pool_stats(pool).mallocs == 1);
+    pool_node(pool, 12);
+    tests_status[3] = one_slab && (pool_stats(pool).mallocs == 2);
+
+    // Test 5: live and free nodes are counted
+    release_node(pool, second);
+    NodePoolStats stats = pool_stats(pool);
+    tests_status[4] = (stats.live_nodes == 4) && (stats.free_nodes == 1) && (stats.capacity == 8);
+
+    destroy_node_pool(pool);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the attach_pool function of the SinglyLinkedList implementation
+ *
+ * This function performs five tests on the attach_pool functionality:
+ * 1. Verifies that a pool can be attached to an empty list
+ * 2. Verifies that appended and prepended nodes are taken from the pool
+ * 3. Verifies that delete_first and delete_last return their nodes to the free list
+ * 4. Verifies that new nodes reuse the nodes on the free list
+ * 5. Verifies that a pool cannot be attached to a list that is not empty
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains ATTACH_POOL_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_attach_pool() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * ATTACH_POOL_NUM_TESTS);
+    NodePool* pool = create_node_pool(0);
+    SinglyLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: the pool is attached to an empty list
+    tests_status[0] = attach_pool(list_ptr, pool) && (list_ptr->pool == pool);
+
+    // Test 2: nodes come from the pool
+    append_node(list_ptr, 2);
+    append_node(list_ptr, 3);
+    prepend_node(list_ptr, 1);
+    tests_status[1] = (pool_stats(pool).live_nodes == 3) && (size(list_ptr) == 3);
+
+    // Test 3: deleted nodes go back to the pool
+    Node* old_head = list_ptr->head;
+    delete_first(list_ptr);
+    delete_last(list_ptr);
+    NodePoolStats stats = pool_stats(pool);
+    tests_status[2] = (stats.live_nodes == 1) && (stats.free_nodes == 2) && (list_ptr->head == list_ptr->tail);
+
+    // Test 4: the free list is used before the slab (last released node first)
+    append_node(list_ptr, 4);
+    prepend_node(list_ptr, 0);
+    stats = pool_stats(pool);
+    tests_status[3] = (stats.free_nodes == 0) && (stats.mallocs == 1) && (list_ptr->head == old_head);
+
+    // Test 5: a list with nodes cannot switch pools
+    tests_status[4] = !attach_pool(list_ptr, NULL) && (list_ptr->pool == pool);
+
+    clear(list_ptr);
+    free(list_ptr);
+    destroy_node_pool(pool);
+    return tests_status;
+}
+
 /*** SinglyLinkedList Unit Tests ***/
 
 /**
  * @brief Tests the create_empty function of the SinglyLinkedList implementation
  *
- * This function performs a test on the create_empty functionality:
+ * This function performs two tests on the create_empty functionality:
  * 1. Verifies that a newly created linked list has its head node correctly set to NULL
+ * 2. Verifies that searching a newly created linked list finds nothing
  *
  * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
  *         status of a test. The array contains CREATE_EMPTY_NUM_TESTS elements and must be freed by
@@ -267,11 +417,14 @@ bool* test_search_forward() {
  */
 bool* test_create_empty() {
     bool* tests_status = (bool *) malloc(sizeof(bool) * CREATE_EMPTY_NUM_TESTS);
-    SinglyLinkedList* list_ptr = (SinglyLinkedList *) malloc(sizeof(SinglyLinkedList));
+    SinglyLinkedList* list_ptr = create_empty_list();
 
     // Test 1: head node is set to null
     tests_status[0] = (list_ptr->head == NULL);
 
+    // Test 2: searching an empty list
+    tests_status[1] = !contains(list_ptr, 1) && (find(list_ptr, 1) == UINT64_MAX);
+
     free(list_ptr);
 
     return tests_status;
@@ -292,7 +445,7 @@ bool* test_create_empty() {
  bool* test_is_empty() {
      // need heap allocated array to return each test fail (0) or pass (1)
      bool* tests_status = (bool *) malloc(sizeof(bool) * IS_EMPTY_NUM_TESTS);
-     SinglyLinkedList* list_ptr = (SinglyLinkedList *) malloc(sizeof(SinglyLinkedList));
+     SinglyLinkedList* list_ptr = create_empty_list();
      // Test 1: a new singly linked list is empty
      tests_status[0] = is_empty(list_ptr);
 
@@ -305,6 +458,7 @@ bool* test_create_empty() {
      append_node(list_ptr, 14);
      tests_status[2] = !is_empty(list_ptr);
 
+     clear(list_ptr);
      free(list_ptr);
      return tests_status;
  }
@@ -337,6 +491,1894 @@ bool* test_size() {
     append_node(list_ptr, 14);
     tests_status[2] = (size(list_ptr) == 2);
 
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the list_from_array function of the SinglyLinkedList implementation
+ *
+ * This function performs five tests on the list_from_array functionality:
+ * 1. Verifies that an empty array creates an empty list
+ * 2. Verifies that the list holds the array values in order, with the right size
+ * 3. Verifies that the head and tail pointers are set, and the tail's next pointer is NULL
+ * 4. Verifies that all nodes were allocated with a single malloc call, next to each other
+ * 5. Verifies that nodes appended afterwards do not allocate another array-sized slab
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains LIST_FROM_ARRAY_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_list_from_array() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * LIST_FROM_ARRAY_NUM_TESTS);
+    int64_t arr[5000];
+    for (int64_t i = 0; i < 5000; i++) {
+        arr[i] = 2 * i - 5000;
+    }
+
+    // Test 1: empty array
+    SinglyLinkedList* list_ptr = list_from_array(arr, 0);
+    tests_status[0] = is_empty(list_ptr) && (size(list_ptr) == 0);
+    destroy_list(list_ptr);
+
+    // Test 2: values are in order
+    list_ptr = list_from_array(arr, 5000);
+    bool in_order = (size(list_ptr) == 5000);
+    Node* node = list_ptr->head;
+    for (int64_t i = 0; (i < 5000) && in_order; i++) {
+        in_order = (node != NULL) && (node->data == arr[i]);
+        node = node->next;
+    }
+    tests_status[1] = in_order && (node == NULL);
+
+    // Test 3: head and tail are set
+    tests_status[2] = (list_ptr->head->data == arr[0]) && (list_ptr->tail->data == arr[4999])
+                      && (list_ptr->tail->next == NULL);
+
+    // Test 4: one allocation, nodes are adjacent
+    tests_status[3] = (pool_stats(list_ptr->pool).mallocs == 1) && (list_ptr->tail == list_ptr->head + 4999);
+
+    // Test 5: appending afterwards only adds a regular slab
+    append_node(list_ptr, 1);
+    NodePoolStats stats = pool_stats(list_ptr->pool);
+    tests_status[4] = (stats.mallocs == 2) && (stats.capacity == 5000 + DEFAULT_NODES_PER_SLAB)
+                      && (list_ptr->tail->data == 1) && (size(list_ptr) == 5001);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the copy function of the SinglyLinkedList implementation
+ *
+ * This function performs four tests on the copy functionality:
+ * 1. Verifies that copying an empty list creates an empty list
+ * 2. Verifies that the copy holds the same values in the same order, with the right size and tail
+ * 3. Verifies that the copy does not share any nodes with the source list
+ * 4. Verifies that the nodes of the copy were allocated with a single malloc call
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains COPY_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_copy() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * COPY_NUM_TESTS);
+    SinglyLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: empty list
+    SinglyLinkedList* copy_ptr = copy(list_ptr);
+    tests_status[0] = is_empty(copy_ptr);
+    destroy_list(copy_ptr);
+
+    // Test 2: same values
+    for (int64_t i = 0; i < 100; i++) {
+        prepend_node(list_ptr, i);
+    }
+    copy_ptr = copy(list_ptr);
+    bool same = (size(copy_ptr) == 100) && (copy_ptr->tail->data == 0) && (copy_ptr->tail->next == NULL);
+    bool shared = false;
+    Node* node = list_ptr->head;
+    Node* copy_node = copy_ptr->head;
+    while ((node != NULL) && (copy_node != NULL)) {
+        same = same && (node->data == copy_node->data);
+        shared = shared || (node == copy_node);
+        node = node->next;
+        copy_node = copy_node->next;
+    }
+    tests_status[1] = same && (node == NULL) && (copy_node == NULL);
+
+    // Test 3: no shared nodes
+    tests_status[2] = !shared;
+
+    // Test 4: one allocation
+    tests_status[3] = (pool_stats(copy_ptr->pool).mallocs == 1);
+
+    destroy_list(copy_ptr);
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the delete_node function of the SinglyLinkedList implementation
+ *
+ * This function performs five tests on the delete_node functionality:
+ * 1. Verifies that deleting from an empty list or out of bounds does nothing
+ * 2. Verifies that deleting index 0 moves the head to the next node
+ * 3. Verifies that deleting a middle node links its neighbours together
+ * 4. Verifies that deleting the last index moves the tail back
+ * 5. Verifies that deleting the only node empties the list
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains DELETE_NODE_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_delete_node() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * DELETE_NODE_NUM_TESTS);
+    SinglyLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: nothing to delete
+    delete_node(list_ptr, 0);
+    int64_t arr[] = {1, 2, 3, 4};
+    destroy_list(list_ptr);
+    list_ptr = list_from_array(arr, 4);
+    delete_node(list_ptr, 4);
+    delete_node(list_ptr, -1);
+    tests_status[0] = (size(list_ptr) == 4);
+
+    // Test 2: delete the head
+    delete_node(list_ptr, 0);
+    tests_status[1] = (list_ptr->head->data == 2) && (size(list_ptr) == 3);
+
+    // Test 3: delete the middle
+    delete_node(list_ptr, 1);
+    tests_status[2] = (list_ptr->head->next->data == 4) && (size(list_ptr) == 2);
+
+    // Test 4: delete the tail
+    delete_node(list_ptr, 1);
+    tests_status[3] = (list_ptr->tail == list_ptr->head) && (list_ptr->tail->next == NULL);
+
+    // Test 5: delete the last node
+    delete_node(list_ptr, 0);
+    tests_status[4] = is_empty(list_ptr) && (list_ptr->tail == NULL) && (size(list_ptr) == 0);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Returns true if every express link of the skip index has the width it should,
+ *        by walking each level and comparing with the positions of the nodes.
+ */
+bool skip_index_consistent(SinglyLinkedList* list_ptr) {
+    SkipIndex* skip = list_ptr->skip;
+    for (uint64_t level = 0; level < skip->levels; level++) {
+        SkipTower* tower = skip->head;
+        uint64_t tower_position = 0;
+        while (tower->levels[level].next != NULL) {
+            SkipTower* next = tower->levels[level].next;
+            uint64_t position = 1;
+            Node* node = list_ptr->head;
+            while ((node != NULL) && (node != next->node)) {
+                node = node->next;
+                position++;
+            }
+            if ((node == NULL) || (position - tower_position != tower->levels[level].width)) {
+                return false;
+            }
+            tower = next;
+            tower_position = position;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tests the enable_skip_index function of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on the skip index functionality:
+ * 1. Verifies that an index built over an existing list answers get at every index
+ * 2. Verifies that the widths stay correct through random inserts, deletes and replaces
+ * 3. Verifies that the list matches an array after the same random operations
+ * 4. Verifies that the index is still correct after reverse_list
+ * 5. Verifies that clear leaves an empty, usable index
+ * 6. Verifies that disable_skip_index leaves the list unchanged
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains SKIP_INDEX_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_skip_index() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SKIP_INDEX_NUM_TESTS);
+    int64_t arr[1200];
+    uint64_t length = 500;
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = i;
+    }
+    SinglyLinkedList* list_ptr = list_from_array(arr, length);
+
+    // Test 1: index over an existing list
+    bool all_found = enable_skip_index(list_ptr) && (list_ptr->skip->levels > 0);
+    for (uint64_t i = 0; i < length; i++) {
+        all_found = all_found && (*get(list_ptr, i) == arr[i]);
+    }
+    tests_status[0] = all_found && (get(list_ptr, length) == NULL);
+
+    // Test 2 and 3: random operations against an array
+    srand(5);
+    bool consistent = true;
+    for (int i = 0; i < 2000; i++) {
+        int op = rand() % 6;
+        int64_t value = rand();
+        if ((op == 0) && (length < 1200)) {
+            uint64_t index = rand() % (length + 1);
+            insert_node(list_ptr, value, index);
+            memmove(arr + index + 1, arr + index, sizeof(int64_t) * (length++ - index));
+            arr[index] = value;
+        } else if ((op == 1) && (length < 1200)) {
+            append_node(list_ptr, value);
+            arr[length++] = value;
+        } else if ((op == 2) && (length < 1200)) {
+            prepend_node(list_ptr, value);
+            memmove(arr + 1, arr, sizeof(int64_t) * length++);
+            arr[0] = value;
+        } else if ((op == 3) && (length > 0)) {
+            uint64_t index = rand() % length;
+            replace_node(list_ptr, value, index);
+            arr[index] = value;
+        } else if ((op == 4) && (length > 0)) {
+            delete_last(list_ptr);
+            length--;
+        } else if (length > 0) {
+            uint64_t index = rand() % length;
+            delete_node(list_ptr, index);
+            memmove(arr + index, arr + index + 1, sizeof(int64_t) * (--length - index));
+        }
+        if (i % 100 == 0) {
+            consistent = consistent && skip_index_consistent(list_ptr);
+        }
+    }
+    tests_status[1] = consistent && skip_index_consistent(list_ptr);
+    bool equal = (size(list_ptr) == length);
+    for (uint64_t i = 0; (i < length) && equal; i++) {
+        equal = (*get(list_ptr, i) == arr[i]);
+    }
+    tests_status[2] = equal && (list_ptr->tail->data == arr[length - 1]);
+
+    // Test 4: reverse
+    reverse_list(list_ptr);
+    equal = true;
+    for (uint64_t i = 0; i < length; i++) {
+        equal = equal && (*get(list_ptr, i) == arr[length - 1 - i]);
+    }
+    tests_status[3] = equal && skip_index_consistent(list_ptr);
+
+    // Test 5: clear
+    clear(list_ptr);
+    append_node(list_ptr, 7);
+    prepend_node(list_ptr, 6);
+    tests_status[4] = (*get(list_ptr, 0) == 6) && (*get(list_ptr, 1) == 7) && skip_index_consistent(list_ptr);
+
+    // Test 6: disable
+    disable_skip_index(list_ptr);
+    tests_status[5] = (list_ptr->skip == NULL) && (size(list_ptr) == 2) && (*get(list_ptr, 1) == 7);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Returns true if find and contains give the same answers as a linear search
+ *        of the array for every value in [0, range).
+ */
+bool hash_index_matches(SinglyLinkedList* list_ptr, int64_t* arr, uint64_t length, int64_t range) {
+    for (int64_t value = 0; value < range; value++) {
+        uint64_t expected = UINT64_MAX;
+        for (uint64_t i = 0; i < length; i++) {
+            if (arr[i] == value) {
+                expected = i;
+                break;
+            }
+        }
+        if ((find(list_ptr, value) != expected) || (contains(list_ptr, value) != (expected != UINT64_MAX))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tests the enable_hash_index function of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on the hash index functionality:
+ * 1. Verifies that an index built over an existing list with duplicates answers find and contains
+ * 2. Verifies that find and contains stay correct through random inserts, deletes and replaces
+ * 3. Verifies that find is still correct after reverse_list
+ * 4. Verifies that hash_index_stats counts the distinct values and stays at most half full
+ * 5. Verifies that clear leaves an empty, usable index
+ * 6. Verifies that disable_hash_index leaves the list unchanged
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains HASH_INDEX_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_hash_index() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * HASH_INDEX_NUM_TESTS);
+    int64_t arr[600];
+    int64_t range = 64;
+    uint64_t length = 300;
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (i * 7) % range;
+    }
+    SinglyLinkedList* list_ptr = list_from_array(arr, length);
+
+    // Test 1: index over an existing list
+    tests_status[0] = enable_hash_index(list_ptr) && hash_index_matches(list_ptr, arr, length, range + 8);
+
+    // Test 2: random operations against an array, with a small range of values to get duplicates
+    srand(6);
+    bool matches = true;
+    for (int i = 0; i < 3000; i++) {
+        int op = rand() % 7;
+        int64_t value = rand() % range;
+        if ((op == 0) && (length < 600)) {
+            uint64_t index = rand() % (length + 1);
+            insert_node(list_ptr, value, index);
+            memmove(arr + index + 1, arr + index, sizeof(int64_t) * (length++ - index));
+            arr[index] = value;
+        } else if ((op == 1) && (length < 600)) {
+            append_node(list_ptr, value);
+            arr[length++] = value;
+        } else if ((op == 2) && (length < 600)) {
+            prepend_node(list_ptr, value);
+            memmove(arr + 1, arr, sizeof(int64_t) * length++);
+            arr[0] = value;
+        } else if ((op == 3) && (length > 0)) {
+            uint64_t index = rand() % length;
+            replace_node(list_ptr, value, index);
+            arr[index] = value;
+        } else if ((op == 4) && (length > 0)) {
+            delete_first(list_ptr);
+            memmove(arr, arr + 1, sizeof(int64_t) * --length);
+        } else if ((op == 5) && (length > 0)) {
+            delete_last(list_ptr);
+            length--;
+        } else if (length > 0) {
+            uint64_t index = rand() % length;
+            delete_node(list_ptr, index);
+            memmove(arr + index, arr + index + 1, sizeof(int64_t) * (--length - index));
+        }
+        if (i % 10 == 0) {
+            matches = matches && hash_index_matches(list_ptr, arr, length, range);
+        }
+    }
+    tests_status[1] = matches && hash_index_matches(list_ptr, arr, length, range);
+
+    // Test 3: reverse
+    reverse_list(list_ptr);
+    for (uint64_t i = 0; i < length / 2; i++) {
+        int64_t temp = arr[i];
+        arr[i] = arr[length - 1 - i];
+        arr[length - 1 - i] = temp;
+    }
+    tests_status[2] = hash_index_matches(list_ptr, arr, length, range);
+
+    // Test 4: stats
+    uint64_t distinct = 0;
+    for (int64_t value = 0; value < range; value++) {
+        distinct += contains(list_ptr, value);
+    }
+    HashIndexStats stats = hash_index_stats(list_ptr);
+    tests_status[3] = (stats.distinct_values == distinct) && (stats.capacity >= 2 * distinct)
+                      && ((stats.capacity & (stats.capacity - 1)) == 0)
+                      && (stats.bytes == sizeof(HashIndex) + stats.capacity * sizeof(HashSlot));
+
+    // Test 5: clear
+    clear(list_ptr);
+    append_node(list_ptr, 7);
+    prepend_node(list_ptr, 6);
+    append_node(list_ptr, 6);
+    tests_status[4] = (hash_index_stats(list_ptr).distinct_values == 2) && (find(list_ptr, 6) == 0)
+                      && (find(list_ptr, 7) == 1) && !contains(list_ptr, 5);
+
+    // Test 6: disable
+    disable_hash_index(list_ptr);
+    tests_status[5] = (list_ptr->hash == NULL) && (hash_index_stats(list_ptr).bytes == 0)
+                      && (find(list_ptr, 7) == 1) && (find(list_ptr, 5) == UINT64_MAX);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the finger the SinglyLinkedList keeps for get and replace_node
+ *
+ * This function performs four tests on the cached last accessed position:
+ * 1. Verifies that get with increasing indices returns every value and moves the finger
+ * 2. Verifies that get still returns the right values for decreasing indices
+ * 3. Verifies that prepending and deleting before the finger keeps it on the same node
+ * 4. Verifies that deleting the node under the finger, reverse_list and clear drop it
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains FINGER_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_finger() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * FINGER_NUM_TESTS);
+    int64_t arr[100];
+    for (int64_t i = 0; i < 100; i++) {
+        arr[i] = i * 3;
+    }
+    SinglyLinkedList* list_ptr = list_from_array(arr, 100);
+
+    // Test 1: increasing indices
+    bool all_found = true;
+    for (uint64_t i = 0; i < 99; i++) {
+        all_found = all_found && (*get(list_ptr, i) == arr[i]) && (list_ptr->finger_index == i);
+    }
+    tests_status[0] = all_found && (list_ptr->finger->data == arr[98]);
+
+    // Test 2: decreasing indices
+    all_found = true;
+    for (uint64_t i = 100; i > 0; i--) {
+        all_found = all_found && (*get(list_ptr, i - 1) == arr[i - 1]);
+    }
+    tests_status[1] = all_found;
+
+    // Test 3: changes before the finger
+    get(list_ptr, 50);
+    prepend_node(list_ptr, -1);
+    prepend_node(list_ptr, -2);
+    delete_first(list_ptr);
+    tests_status[2] = (list_ptr->finger->data == arr[50]) && (list_ptr->finger_index == 51)
+                      && (*get(list_ptr, 52) == arr[51]);
+
+    // Test 4: dropping the finger
+    get(list_ptr, 0);
+    delete_first(list_ptr);
+    bool dropped = (list_ptr->finger == NULL) && (*get(list_ptr, 30) == arr[30]);
+    reverse_list(list_ptr);
+    dropped = dropped && (list_ptr->finger == NULL) && (*get(list_ptr, 0) == arr[99]);
+    clear(list_ptr);
+    tests_status[3] = dropped && (list_ptr->finger == NULL);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Returns the index of the first element of arr equal to data, or UINT64_MAX.
+ */
+uint64_t array_find(int64_t* arr, uint64_t length, int64_t data) {
+    for (uint64_t i = 0; i < length; i++) {
+        if (arr[i] == data) {
+            return i;
+        }
+    }
+    return UINT64_MAX;
+}
+
+/**
+ * @brief Returns true if find and contains agree with the array for every value
+ *        in [0, limit), which includes values that are not in the list.
+ */
+bool finds_match(SinglyLinkedList* list_ptr, int64_t* arr, uint64_t length, int64_t limit) {
+    for (int64_t value = 0; value < limit; value++) {
+        uint64_t expected = array_find(arr, length, value);
+        if ((find(list_ptr, value) != expected) || (contains(list_ptr, value) != (expected != UINT64_MAX))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tests the walks of find, contains and list_to_array over the runs of a skip index
+ *
+ * This function performs five tests on a list long enough to be walked in WALK_LANES runs:
+ * 1. Verifies that find returns the first occurrence of every value, held by up to four nodes
+ *    in different runs, and UINT64_MAX for missing values
+ * 2. Verifies that contains agrees with find, and list_to_array copies every node in order
+ * 3. Verifies that find and list_to_array stay right while the runs change with inserts and deletes
+ * 4. Verifies that a stale skip index, after reverse_list, is walked as one chain
+ * 5. Verifies that a list shorter than WALK_MIN_NODES is walked as one chain
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains LOOKAHEAD_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_lookahead() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * LOOKAHEAD_NUM_TESTS);
+    uint64_t length = 20000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * (length + 100));
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (i * 37) % 6000;
+    }
+    SinglyLinkedList* list_ptr = list_from_array(arr, length);
+    enable_skip_index(list_ptr);
+
+    // Test 1: find
+    tests_status[0] = finds_match(list_ptr, arr, length, 6100);
+
+    // Test 2: contains and list_to_array
+    int64_t* copied = list_to_array(list_ptr);
+    tests_status[1] = contains(list_ptr, 5999) && !contains(list_ptr, 6000) && (copied != NULL)
+                      && (memcmp(copied, arr, sizeof(int64_t) * length) == 0);
+    free(copied);
+
+    // Test 3: changing the runs
+    for (uint64_t i = 0; i < 100; i++) {
+        uint64_t index = (i * 7919) % length;
+        delete_node(list_ptr, index);
+        memmove(arr + index, arr + index + 1, sizeof(int64_t) * (length - index - 1));
+        index = (i * 104729) % length;
+        insert_node(list_ptr, 6000 + i, index);
+        memmove(arr + index + 1, arr + index, sizeof(int64_t) * (length - index - 1));
+        arr[index] = 6000 + i;
+    }
+    copied = list_to_array(list_ptr);
+    tests_status[2] = finds_match(list_ptr, arr, length, 6200) && (copied != NULL)
+                      && (memcmp(copied, arr, sizeof(int64_t) * length) == 0);
+    free(copied);
+
+    // Test 4: stale skip index
+    reverse_list(list_ptr);
+    for (uint64_t i = 0; i < length / 2; i++) {
+        int64_t swap = arr[i];
+        arr[i] = arr[length - 1 - i];
+        arr[length - 1 - i] = swap;
+    }
+    tests_status[3] = list_ptr->skip->stale && finds_match(list_ptr, arr, length, 6200);
+
+    // Test 5: short list
+    clear(list_ptr);
+    for (uint64_t i = 0; i < 100; i++) {
+        append_node(list_ptr, arr[i]);
+    }
+    copied = list_to_array(list_ptr);
+    tests_status[4] = finds_match(list_ptr, arr, 100, 6200) && (memcmp(copied, arr, sizeof(int64_t) * 100) == 0);
+    free(copied);
+
+    destroy_list(list_ptr);
+    free(arr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the ListCursor functions of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on the cursor functions:
+ * 1. Verifies that cursor_next visits every node in order and stops past the end
+ * 2. Verifies that cursor_seek moves forwards and backwards and rejects bad indices
+ * 3. Verifies that cursor_insert_after inserts right after the cursor, including at the tail
+ * 4. Verifies that cursor_delete_after deletes right after the cursor, including the tail
+ * 5. Verifies that a cursor on an empty list is past the end and cannot change the list
+ * 6. Verifies that cursor changes keep the skip and hash indices of the list correct
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains CURSOR_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_cursor() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * CURSOR_NUM_TESTS);
+    int64_t arr[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    SinglyLinkedList* list_ptr = list_from_array(arr, 10);
+
+    // Test 1: walking the list
+    ListCursor cursor = cursor_start(list_ptr);
+    bool in_order = (*cursor_get(&cursor) == 0);
+    for (int64_t i = 1; i < 10; i++) {
+        in_order = in_order && cursor_next(&cursor) && (*cursor_get(&cursor) == i) && (cursor.index == (uint64_t) i);
+    }
+    tests_status[0] = in_order && !cursor_next(&cursor) && (cursor_get(&cursor) == NULL) && !cursor_next(&cursor);
+
+    // Test 2: seeking
+    tests_status[1] = cursor_seek(&cursor, 4) && (*cursor_get(&cursor) == 4) && cursor_seek(&cursor, 7)
+                      && (*cursor_get(&cursor) == 7) && cursor_seek(&cursor, 2) && (*cursor_get(&cursor) == 2)
+                      && !cursor_seek(&cursor, 10) && (cursor.index == 2);
+
+    // Test 3: inserting after the cursor
+    bool inserted = cursor_insert_after(&cursor, 20) && (*cursor_get(&cursor) == 2) && (*get(list_ptr, 3) == 20);
+    cursor_seek(&cursor, 10);
+    inserted = inserted && cursor_insert_after(&cursor, 90) && (list_ptr->tail->data == 90) && (size(list_ptr) == 12);
+    tests_status[2] = inserted && cursor_next(&cursor) && (*cursor_get(&cursor) == 90);
+
+    // Test 4: deleting after the cursor
+    cursor_seek(&cursor, 2);
+    bool deleted = cursor_delete_after(&cursor) && (*get(list_ptr, 3) == 3) && (size(list_ptr) == 11);
+    cursor_seek(&cursor, 9);
+    deleted = deleted && cursor_delete_after(&cursor) && (list_ptr->tail->data == 9) && !cursor_delete_after(&cursor);
+    tests_status[3] = deleted && (size(list_ptr) == 10);
+
+    // Test 5: empty list
+    SinglyLinkedList* empty_ptr = create_empty_list();
+    ListCursor empty = cursor_start(empty_ptr);
+    tests_status[4] = (cursor_get(&empty) == NULL) && !cursor_next(&empty) && !cursor_seek(&empty, 0)
+                      && !cursor_insert_after(&empty, 1) && !cursor_delete_after(&empty) && is_empty(empty_ptr);
+    destroy_list(empty_ptr);
+
+    // Test 6: indices
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    cursor = cursor_start(list_ptr);
+    cursor_seek(&cursor, 4);
+    cursor_insert_after(&cursor, 40);
+    cursor_delete_after(&cursor);
+    cursor_delete_after(&cursor);
+    cursor_insert_after(&cursor, 50);
+    tests_status[5] = (*get(list_ptr, 5) == 50) && (*get(list_ptr, 6) == 6) && (find(list_ptr, 50) == 5)
+                      && !contains(list_ptr, 5) && (find(list_ptr, 9) == 9) && (size(list_ptr) == 10)
+                      && skip_index_consistent(list_ptr);
+
+    destroy_list(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Compares two 64-bit integers for qsort.
+ */
+int compare_values(const void* a, const void* b) {
+    int64_t x = *((const int64_t *) a);
+    int64_t y = *((const int64_t *) b);
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Returns true if the list holds the values of sorted (which must be sorted)
+ *        in order, ends at its tail, and keeps nodes holding equal values in the
+ *        order of their addresses. Lists made by list_from_array start with their
+ *        nodes in address order, so this checks that the sort was stable.
+ */
+bool sorted_stable(SinglyLinkedList* list_ptr, int64_t* sorted, uint64_t length) {
+    uint64_t i = 0;
+    Node* prev = NULL;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, i++) {
+        if ((i == length) || (node->data != sorted[i])) {
+            return false;
+        }
+        if ((prev != NULL) && (prev->data == node->data) && (prev > node)) {
+            return false;
+        }
+        prev = node;
+    }
+    return (i == length) && (list_ptr->tail == prev) && (size(list_ptr) == length);
+}
+
+/**
+ * @brief Tests the sort_list function of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on sort_list:
+ * 1. Verifies that empty and single node lists are left unchanged
+ * 2. Verifies that a list with many repeated values is sorted stably by one thread, with the right tail
+ * 3. Verifies that negative values and the extreme values of int64_t are ordered correctly
+ * 4. Verifies that a list split across an odd number of threads is sorted stably
+ * 5. Verifies that asking for more threads than the list has parts for still sorts it
+ * 6. Verifies that the skip and hash indices, the finger and appends are correct after sorting
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains SORT_LIST_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_sort_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SORT_LIST_NUM_TESTS);
+    uint64_t length = 3 * SORT_MIN_NODES_PER_THREAD + 7;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * length);
+
+    // Test 1: empty and single node lists
+    SinglyLinkedList* list_ptr = create_empty_list();
+    sort_list(list_ptr, 1);
+    bool unchanged = is_empty(list_ptr) && (list_ptr->head == NULL) && (list_ptr->tail == NULL);
+    append_node(list_ptr, 5);
+    sort_list(list_ptr, 4);
+    tests_status[0] = unchanged && (list_ptr->head == list_ptr->tail) && (list_ptr->head->data == 5);
+    destroy_list(list_ptr);
+
+    // Test 2: repeated values on one thread
+    srand(11);
+    for (uint64_t i = 0; i < 1000; i++) {
+        arr[i] = rand() % 50;
+    }
+    list_ptr = list_from_array(arr, 1000);
+    qsort(arr, 1000, sizeof(int64_t), compare_values);
+    sort_list(list_ptr, 1);
+    tests_status[1] = sorted_stable(list_ptr, arr, 1000);
+    destroy_list(list_ptr);
+
+    // Test 3: signs and extremes
+    int64_t signs[7] = {3, INT64_MIN, -1, INT64_MAX, 0, -3, INT64_MIN};
+    int64_t signs_sorted[7] = {INT64_MIN, INT64_MIN, -3, -1, 0, 3, INT64_MAX};
+    list_ptr = list_from_array(signs, 7);
+    sort_list(list_ptr, 1);
+    tests_status[2] = sorted_stable(list_ptr, signs_sorted, 7);
+    destroy_list(list_ptr);
+
+    // Test 4: three threads
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (rand() % 2000) - 1000;
+    }
+    list_ptr = list_from_array(arr, length);
+    qsort(arr, length, sizeof(int64_t), compare_values);
+    sort_list(list_ptr, 3);
+    tests_status[3] = sorted_stable(list_ptr, arr, length);
+    destroy_list(list_ptr);
+
+    // Test 5: more threads than parts
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = length - i;
+    }
+    list_ptr = list_from_array(arr, length);
+    qsort(arr, length, sizeof(int64_t), compare_values);
+    sort_list(list_ptr, 64);
+    tests_status[4] = sorted_stable(list_ptr, arr, length);
+    destroy_list(list_ptr);
+
+    // Test 6: indices after sorting
+    int64_t small[8] = {7, 3, 9, 3, 1, 8, 2, 6};
+    list_ptr = list_from_array(small, 8);
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    get(list_ptr, 5);
+    sort_list(list_ptr, 0);
+    bool indexed = (list_ptr->finger == NULL) && (*get(list_ptr, 0) == 1) && (*get(list_ptr, 7) == 9)
+                   && (find(list_ptr, 3) == 2) && (find(list_ptr, 9) == 7) && skip_index_consistent(list_ptr);
+    append_node(list_ptr, 10);
+    tests_status[5] = indexed && (list_ptr->tail->data == 10) && (*get(list_ptr, 8) == 10);
+    destroy_list(list_ptr);
+
+    free(arr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the radix_sort_list function of the SinglyLinkedList implementation
+ *
+ * This function performs five tests on radix_sort_list:
+ * 1. Verifies that empty and single node lists are left unchanged
+ * 2. Verifies that random values spread over the whole range of int64_t are sorted stably, with the right tail
+ * 3. Verifies that negative values and the extreme values of int64_t are ordered correctly
+ * 4. Verifies that values differing in a single digit, and values which are all equal, keep their order
+ * 5. Verifies that the skip and hash indices, the finger and appends are correct after sorting
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains RADIX_SORT_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_radix_sort_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RADIX_SORT_NUM_TESTS);
+    uint64_t length = 100000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * length);
+
+    // Test 1: empty and single node lists
+    SinglyLinkedList* list_ptr = create_empty_list();
+    radix_sort_list(list_ptr);
+    bool unchanged = is_empty(list_ptr) && (list_ptr->head == NULL) && (list_ptr->tail == NULL);
+    append_node(list_ptr, -5);
+    radix_sort_list(list_ptr);
+    tests_status[0] = unchanged && (list_ptr->head == list_ptr->tail) && (list_ptr->head->data == -5);
+    destroy_list(list_ptr);
+
+    // Test 2: the whole range, with repeats
+    srand(12);
+    for (uint64_t i = 0; i < length; i++) {
+        uint64_t bits = ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand();
+        arr[i] = (i % 3 == 0) ? arr[i / 2] : (int64_t) bits;
+    }
+    list_ptr = list_from_array(arr, length);
+    qsort(arr, length, sizeof(int64_t), compare_values);
+    radix_sort_list(list_ptr);
+    tests_status[1] = sorted_stable(list_ptr, arr, length);
+    destroy_list(list_ptr);
+
+    // Test 3: signs and extremes
+    int64_t signs[9] = {3, INT64_MIN, -1, INT64_MAX, 0, -256, INT64_MIN + 1, 256, INT64_MIN};
+    int64_t signs_sorted[9] = {INT64_MIN, INT64_MIN, INT64_MIN + 1, -256, -1, 0, 3, 256, INT64_MAX};
+    list_ptr = list_from_array(signs, 9);
+    radix_sort_list(list_ptr);
+    tests_status[2] = sorted_stable(list_ptr, signs_sorted, 9);
+    destroy_list(list_ptr);
+
+    // Test 4: a single differing digit, then all equal
+    for (uint64_t i = 0; i < 1000; i++) {
+        arr[i] = -1000000 + ((int64_t) (rand() % 4) << 16);
+    }
+    list_ptr = list_from_array(arr, 1000);
+    qsort(arr, 1000, sizeof(int64_t), compare_values);
+    radix_sort_list(list_ptr);
+    bool one_digit = sorted_stable(list_ptr, arr, 1000);
+    destroy_list(list_ptr);
+    for (uint64_t i = 0; i < 1000; i++) {
+        arr[i] = 7;
+    }
+    list_ptr = list_from_array(arr, 1000);
+    Node* head = list_ptr->head;
+    radix_sort_list(list_ptr);
+    tests_status[3] = one_digit && (list_ptr->head == head) && sorted_stable(list_ptr, arr, 1000);
+    destroy_list(list_ptr);
+
+    // Test 5: indices after sorting
+    int64_t small[8] = {7, -3, 9, -3, 1, 8, 2, 6};
+    list_ptr = list_from_array(small, 8);
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    get(list_ptr, 5);
+    radix_sort_list(list_ptr);
+    bool indexed = (list_ptr->finger == NULL) && (*get(list_ptr, 0) == -3) && (*get(list_ptr, 7) == 9)
+                   && (find(list_ptr, 1) == 2) && (find(list_ptr, 9) == 7) && skip_index_consistent(list_ptr);
+    append_node(list_ptr, 10);
+    tests_status[4] = indexed && (list_ptr->tail->data == 10) && (*get(list_ptr, 8) == 10);
+    destroy_list(list_ptr);
+
+    free(arr);
+    return tests_status;
+}
+
+/**
+ * @brief What the remap callback of the compaction tests saw: the number of
+ *        calls, and a node held outside of the list which must follow it.
+ */
+typedef struct {
+    uint64_t calls;
+    Node* held;
+} RemapLog;
+
+void log_remap(Node* old_node, Node* new_node, void* context) {
+    RemapLog* log = (RemapLog *) context;
+    log->calls++;
+    if (log->held == old_node) {
+        log->held = new_node;
+    }
+}
+
+/**
+ * @brief Checks that the nodes of the list sit next to each other in memory, in
+ *        list order, and hold the values of arr.
+ */
+bool is_compact(SinglyLinkedList* list_ptr, int64_t* arr, uint64_t length) {
+    Node* node = list_ptr->head;
+    for (uint64_t i = 0; i < length; i++) {
+        if ((node == NULL) || (node->data != arr[i]) || (node != &(list_ptr->head[i]))) {
+            return false;
+        }
+        node = node->next;
+    }
+    return (node == NULL) && (list_ptr->tail == &(list_ptr->head[length - 1]));
+}
+
+/**
+ * @brief Tests compact_list and compact_step.
+ *
+ * This function performs six tests on compaction:
+ * 1. Verifies that a list of malloc'd nodes is moved into one block of its own pool, in list order
+ * 2. Verifies that remap is called for every node and lets a held node follow the list
+ * 3. Verifies that the skip and hash indices and the finger are correct after compacting
+ * 4. Verifies that a list on a shared pool keeps the pool, and returns its old nodes to it
+ * 5. Verifies that steps of bounded size compact the list while nodes are inserted and deleted in between
+ * 6. Verifies that compact_step does not run on a list without a pool, and that an empty list compacts
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains COMPACT_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_compact() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * COMPACT_NUM_TESTS);
+    uint64_t length = 5000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * (length + 100));
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (i * 37) % 1000;
+        append_node(list_ptr, arr[i]);
+    }
+
+    // Test 1: malloc'd nodes
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    get(list_ptr, 1234);
+    RemapLog log = {0, list_ptr->head->next->next};
+    tests_status[0] = compact_list(list_ptr, log_remap, &log) && list_ptr->owns_pool
+                      && (list_ptr->pool->live_nodes == length) && is_compact(list_ptr, arr, length);
+
+    // Test 2: remap
+    tests_status[1] = (log.calls == length) && (log.held == &(list_ptr->head[2]));
+
+    // Test 3: indices and finger
+    tests_status[2] = !list_ptr->skip->stale && (list_ptr->finger == &(list_ptr->head[1234]))
+                      && (*get(list_ptr, 4321) == arr[4321]) && finds_match(list_ptr, arr, length, 1100);
+    destroy_list(list_ptr);
+
+    // Test 4: shared pool
+    NodePool* pool = create_node_pool(64);
+    list_ptr = create_empty_list();
+    attach_pool(list_ptr, pool);
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, arr[i]);
+    }
+    for (uint64_t i = 0; i < length; i += 3) {
+        delete_first(list_ptr);
+        append_node(list_ptr, arr[i % length]);
+    }
+    int64_t* expected = list_to_array(list_ptr);
+    tests_status[3] = compact_list(list_ptr, NULL, NULL) && (list_ptr->pool == pool) && !list_ptr->owns_pool
+                      && (pool->live_nodes == length) && (pool->free_nodes >= length)
+                      && is_compact(list_ptr, expected, length);
+    free(expected);
+
+    // Test 5: steps
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (int64_t) i;
+        replace_node(list_ptr, arr[i], i);
+    }
+    uint64_t steps = 0;
+    while (compact_step(list_ptr, 100, NULL, NULL)) {
+        steps++;
+        uint64_t index = (steps * 7919) % length;
+        delete_node(list_ptr, index);
+        memmove(arr + index, arr + index + 1, sizeof(int64_t) * (length - index - 1));
+        index = (steps * 104729) % length;
+        insert_node(list_ptr, 6000 + steps, index);
+        memmove(arr + index + 1, arr + index, sizeof(int64_t) * (length - index - 1));
+        arr[index] = 6000 + steps;
+    }
+    expected = list_to_array(list_ptr);
+    tests_status[4] = (steps >= length / 100) && (list_ptr->compact == NULL)
+                      && (memcmp(expected, arr, sizeof(int64_t) * length) == 0)
+                      && (*get(list_ptr, length - 1) == arr[length - 1]) && finds_match(list_ptr, arr, length, 6100);
+    free(expected);
+    destroy_list(list_ptr);
+    destroy_node_pool(pool);
+
+    // Test 6: no pool, and empty lists
+    list_ptr = create_empty_list();
+    bool empty_compacts = compact_list(list_ptr, NULL, NULL) && is_empty(list_ptr);
+    append_node(list_ptr, 1);
+    tests_status[5] = empty_compacts && !compact_step(list_ptr, 10, NULL, NULL) && (list_ptr->compact == NULL);
+    destroy_list(list_ptr);
+
+    free(arr);
+    return tests_status;
+}
+
+/**
+ * @brief Checks that the list holds the values from first to first + length - 1, in order.
+ */
+bool holds_range(SinglyLinkedList* list_ptr, int64_t first, uint64_t length) {
+    Node* node = list_ptr->head;
+    for (uint64_t i = 0; i < length; i++) {
+        if ((node == NULL) || (node->data != first + (int64_t) i)) {
+            return false;
+        }
+        if ((node->next == NULL) && (node != list_ptr->tail)) {
+            return false;
+        }
+        node = node->next;
+    }
+    return (node == NULL) && (list_ptr->size == length);
+}
+
+/**
+ * @brief Tests the concat function.
+ *
+ * This function performs five tests on concat:
+ * 1. Verifies that two lists of malloc'd nodes are linked without copying, leaving src empty and usable
+ * 2. Verifies that an empty src, and a list given as both src and dest, are handled
+ * 3. Verifies that an empty dest takes over the pool owned by src
+ * 4. Verifies that a pool owned by src is merged into the pool of dest, and that mismatched allocators are refused
+ * 5. Verifies that the skip and hash indices of dest are correct afterwards, and those of src empty
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains CONCAT_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_concat() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * CONCAT_NUM_TESTS);
+    int64_t arr[100];
+    for (int64_t i = 0; i < 100; i++) {
+        arr[i] = i;
+    }
+
+    // Test 1: malloc'd nodes
+    SinglyLinkedList* src = create_empty_list();
+    SinglyLinkedList* dest = create_empty_list();
+    for (int64_t i = 0; i < 50; i++) {
+        append_node(dest, i);
+        append_node(src, 50 + i);
+    }
+    Node* src_head = src->head;
+    bool linked = concat(src, dest) && (dest->head->data == 0) && holds_range(dest, 0, 100);
+    for (Node* node = dest->head; node != NULL; node = node->next) {
+        linked = linked && ((node->data != 50) || (node == src_head));
+    }
+    append_node(src, 7);
+    tests_status[0] = linked && (size(src) == 1) && (src->head == src->tail) && (src->head->data == 7);
+
+    // Test 2: empty and same lists
+    delete_first(src);
+    tests_status[1] = concat(src, dest) && !concat(dest, dest) && holds_range(dest, 0, 100) && is_empty(src);
+    destroy_list(src);
+    destroy_list(dest);
+
+    // Test 3: empty dest
+    src = list_from_array(arr, 100);
+    dest = create_empty_list();
+    NodePool* pool = src->pool;
+    tests_status[2] = concat(src, dest) && (dest->pool == pool) && dest->owns_pool && !src->owns_pool
+                      && (src->pool == NULL) && holds_range(dest, 0, 100);
+    destroy_list(src);
+
+    // Test 4: merged pools
+    src = list_from_array(arr, 100);
+    SinglyLinkedList* unpooled = create_empty_list();
+    append_node(unpooled, 0);
+    bool refused = !concat(src, unpooled) && (size(src) == 100) && (size(unpooled) == 1);
+    delete_first(dest);
+    delete_first(dest);
+    bool merged = concat(src, dest) && (dest->pool == pool) && (pool->live_nodes == 198) && (src->pool == NULL)
+                  && (dest->tail->data == 99) && (size(dest) == 198);
+    for (int64_t i = 0; i < 500; i++) {
+        append_node(dest, i);
+    }
+    tests_status[3] = refused && merged && (pool->live_nodes == 698) && !concat(dest, unpooled);
+    destroy_list(src);
+    destroy_list(unpooled);
+    destroy_list(dest);
+
+    // Test 5: indices
+    src = create_empty_list();
+    dest = create_empty_list();
+    for (int64_t i = 0; i < 50; i++) {
+        append_node(dest, i);
+        append_node(src, 50 + i);
+    }
+    append_node(src, 3);
+    enable_skip_index(dest);
+    enable_hash_index(dest);
+    enable_skip_index(src);
+    enable_hash_index(src);
+    get(src, 20);
+    bool indexed = concat(src, dest) && (find(dest, 3) == 3) && (find(dest, 77) == 77) && (*get(dest, 99) == 99)
+                   && (*get(dest, 100) == 3) && !contains(src, 60) && (find(src, 3) == UINT64_MAX);
+    append_node(src, 5);
+    tests_status[4] = indexed && (*get(src, 0) == 5) && (find(src, 5) == 0) && (src->finger != NULL);
+    destroy_list(src);
+    destroy_list(dest);
+
+    return tests_status;
+}
+
+/**
+ * @brief Applies a batch of sorted inserts to an array of length values, the way
+ *        insert_nodes applies them to a list. Returns the new length.
+ */
+uint64_t array_insert_batch(int64_t* arr, uint64_t length, IndexedValue* inserts, uint64_t count) {
+    int64_t* old = (int64_t *) malloc(sizeof(int64_t) * (length + 1));
+    memcpy(old, arr, sizeof(int64_t) * length);
+    uint64_t out = 0;
+    uint64_t next = 0;
+    for (uint64_t i = 0; i <= length; i++) {
+        while ((next < count) && (inserts[next].index == i)) {
+            arr[out++] = inserts[next++].data;
+        }
+        if (i < length) {
+            arr[out++] = old[i];
+        }
+    }
+    free(old);
+    return out;
+}
+
+/**
+ * @brief Applies a batch of increasing delete indices to an array of length values.
+ *        Returns the new length.
+ */
+uint64_t array_delete_batch(int64_t* arr, uint64_t length, uint64_t* indices, uint64_t count) {
+    uint64_t out = 0;
+    uint64_t next = 0;
+    for (uint64_t i = 0; i < length; i++) {
+        if ((next < count) && (indices[next] == i)) {
+            next++;
+        } else {
+            arr[out++] = arr[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Checks that the list holds the length values of arr, and that its tail is its last node.
+ */
+bool batch_matches(SinglyLinkedList* list_ptr, int64_t* arr, uint64_t length) {
+    if (length == 0) {
+        return is_empty(list_ptr) && (list_ptr->tail == NULL) && (size(list_ptr) == 0);
+    }
+    int64_t* copied = list_to_array(list_ptr);
+    bool matches = (size(list_ptr) == length) && (memcmp(copied, arr, sizeof(int64_t) * length) == 0)
+                   && (list_ptr->tail->next == NULL) && (list_ptr->tail->data == arr[length - 1]);
+    free(copied);
+    return matches;
+}
+
+/**
+ * @brief Tests the insert_nodes and delete_nodes functions.
+ *
+ * This function performs five tests on batches:
+ * 1. Verifies that inserts at the head, in the middle, at the tail and at repeated indices land where expected
+ * 2. Verifies that an empty list takes inserts, and that unsorted or out of range batches change nothing
+ * 3. Verifies that deletes of the head, the middle and the tail keep the head and tail right
+ * 4. Verifies that the skip and hash indices and the finger are correct after batches
+ * 5. Verifies that large random batches give the same list as the same changes applied to an array
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains BATCH_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_batch() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * BATCH_NUM_TESTS);
+    int64_t arr[30000];
+    uint64_t length = 10;
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (int64_t) i;
+    }
+    SinglyLinkedList* list_ptr = list_from_array(arr, length);
+
+    // Test 1: inserts
+    IndexedValue inserts[6] = {{0, 100}, {0, 101}, {4, 102}, {4, 103}, {9, 104}, {10, 105}};
+    tests_status[0] = insert_nodes(list_ptr, inserts, 6) && (list_ptr->head->data == 100);
+    length = array_insert_batch(arr, length, inserts, 6);
+    tests_status[0] = tests_status[0] && batch_matches(list_ptr, arr, length) && (length == 16);
+
+    // Test 2: empty lists and bad batches
+    IndexedValue unsorted[2] = {{3, 0}, {2, 0}};
+    IndexedValue too_far[1] = {{17, 0}};
+    bool refused = !insert_nodes(list_ptr, unsorted, 2) && !insert_nodes(list_ptr, too_far, 1)
+                   && insert_nodes(list_ptr, inserts, 0) && batch_matches(list_ptr, arr, length);
+    SinglyLinkedList* empty = create_empty_list();
+    IndexedValue first[2] = {{0, 1}, {0, 2}};
+    int64_t expected[2] = {1, 2};
+    tests_status[1] = refused && insert_nodes(empty, first, 2) && batch_matches(empty, expected, 2);
+    destroy_list(empty);
+
+    // Test 3: deletes
+    uint64_t deletes[4] = {0, 5, 6, 15};
+    uint64_t repeated[2] = {3, 3};
+    uint64_t out_of_range[1] = {16};
+    refused = !delete_nodes(list_ptr, repeated, 2) && !delete_nodes(list_ptr, out_of_range, 1);
+    bool deleted = delete_nodes(list_ptr, deletes, 4);
+    length = array_delete_batch(arr, length, deletes, 4);
+    tests_status[2] = refused && deleted && batch_matches(list_ptr, arr, length);
+    destroy_list(list_ptr);
+
+    // Test 4: indices and finger
+    length = 5000;
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = (int64_t) i;
+    }
+    list_ptr = list_from_array(arr, length);
+    enable_skip_index(list_ptr);
+    enable_hash_index(list_ptr);
+    get(list_ptr, 2500);
+    IndexedValue middle[3] = {{0, 6000}, {2500, 6001}, {4000, 6002}};
+    uint64_t gone[3] = {1, 2501, 5002};
+    insert_nodes(list_ptr, middle, 3);
+    length = array_insert_batch(arr, length, middle, 3);
+    delete_nodes(list_ptr, gone, 3);
+    length = array_delete_batch(arr, length, gone, 3);
+    tests_status[3] = batch_matches(list_ptr, arr, length) && (*get(list_ptr, 2501) == arr[2501])
+                      && (*get(list_ptr, 4999) == arr[4999]) && finds_match(list_ptr, arr, length, 6100);
+    destroy_list(list_ptr);
+
+    // Test 5: random batches
+    srand(21);
+    list_ptr = create_empty_list();
+    length = 0;
+    bool matches = true;
+    for (int round = 0; round < 20; round++) {
+        uint64_t count = 1 + rand() % 1000;
+        IndexedValue* batch = (IndexedValue *) malloc(sizeof(IndexedValue) * count);
+        for (uint64_t i = 0; i < count; i++) {
+            batch[i].index = rand() % (length + 1);
+            batch[i].data = rand();
+        }
+        for (uint64_t i = 1; i < count; i++) {
+            for (uint64_t j = i; (j > 0) && (batch[j].index < batch[j - 1].index); j--) {
+                IndexedValue swap = batch[j];
+                batch[j] = batch[j - 1];
+                batch[j - 1] = swap;
+            }
+        }
+        matches = matches && insert_nodes(list_ptr, batch, count);
+        length = array_insert_batch(arr, length, batch, count);
+        uint64_t* indices = (uint64_t *) malloc(sizeof(uint64_t) * length);
+        uint64_t num_deletes = 0;
+        for (uint64_t i = 0; i < length; i++) {
+            if (rand() % 4 == 0) {
+                indices[num_deletes++] = i;
+            }
+        }
+        matches = matches && delete_nodes(list_ptr, indices, num_deletes);
+        length = array_delete_batch(arr, length, indices, num_deletes);
+        matches = matches && batch_matches(list_ptr, arr, length);
+        free(indices);
+        free(batch);
+    }
+    tests_status[4] = matches;
+    destroy_list(list_ptr);
+
+    return tests_status;
+}
+
+/**
+ * @brief Tests the parallel_find and parallel_contains functions.
+ *
+ * This function performs five tests on parallel searches:
+ * 1. Verifies that short lists, and lists without a skip index, give the same results as find
+ * 2. Verifies that the first occurrence is found with many threads, at the head, the tail and in between
+ * 3. Verifies that a value held in every segment is found at its lowest index, with 1 to 16 threads
+ * 4. Verifies that the results stay right after inserts, deletes, prepends and a reverse move the towers
+ * 5. Verifies that parallel_contains finds values which are held and not the others, with 1 to 100 threads
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains PARALLEL_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_parallel() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * PARALLEL_NUM_TESTS);
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (uint64_t i = 0; i < 1000; i++) {
+        append_node(list_ptr, (int64_t) (i % 300));
+    }
+
+    // Test 1: lists searched by the calling thread
+    bool same = enable_skip_index(list_ptr) && (parallel_find(list_ptr, 299, 4) == 299)
+                && (parallel_find(list_ptr, 1000, 4) == UINT64_MAX);
+    disable_skip_index(list_ptr);
+    for (uint64_t i = 0; i < PARALLEL_MIN_NODES; i++) {
+        append_node(list_ptr, (int64_t) i);
+    }
+    tests_status[0] = same && (parallel_find(list_ptr, 5000, 4) == 6000)
+                      && (parallel_find(list_ptr, -1, 4) == UINT64_MAX) && (list_ptr->skip == NULL);
+    clear(list_ptr);
+
+    // Test 2: first occurrences with a skip index
+    uint64_t length = 4 * PARALLEL_MIN_NODES;
+    for (uint64_t i = 0; i < length; i++) {
+        append_node(list_ptr, (int64_t) i);
+    }
+    append_node(list_ptr, 0);
+    append_node(list_ptr, (int64_t) length - 1);
+    length += 2;
+    bool found = enable_skip_index(list_ptr) && (parallel_find(list_ptr, 0, 8) == 0)
+                 && (parallel_find(list_ptr, (int64_t) length - 3, 8) == length - 3)
+                 && (parallel_find(list_ptr, 12345, 8) == 12345)
+                 && (parallel_find(list_ptr, (int64_t) length, 8) == UINT64_MAX);
+    for (uint64_t i = 1; i < 20; i++) {
+        uint64_t value = (i * 104729) % (length - 2);
+        found = found && (parallel_find(list_ptr, (int64_t) value, 4) == value);
+    }
+    tests_status[1] = found;
+
+    // Test 3: a value in every segment
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        if (node->data % 997 == 77) {
+            node->data = -7;
+        }
+    }
+    bool lowest = true;
+    for (uint64_t threads = 1; threads <= 16; threads *= 2) {
+        lowest = lowest && (parallel_find(list_ptr, -7, threads) == 77);
+    }
+    tests_status[2] = lowest;
+
+    // Test 4: moved towers
+    bool moved = insert_node(list_ptr, -9, length / 2);
+    delete_node(list_ptr, 10);
+    moved = moved && (parallel_find(list_ptr, -9, 8) == length / 2 - 1) && (parallel_find(list_ptr, 11, 8) == 10);
+    for (int64_t i = 0; i < 100; i++) {
+        prepend_node(list_ptr, -100 - i);
+    }
+    moved = moved && (parallel_find(list_ptr, -150, 8) == 49) && (parallel_find(list_ptr, -7, 8) == 176)
+            && (parallel_find(list_ptr, 11, 8) == 110);
+    reverse_list(list_ptr);
+    tests_status[3] = moved && list_ptr->skip->stale && (parallel_find(list_ptr, -7, 8) == find(list_ptr, -7))
+                      && (parallel_find(list_ptr, 500, 8) == find(list_ptr, 500)) && !list_ptr->skip->stale;
+
+    // Test 5: contains
+    bool contains_all = true;
+    for (uint64_t threads = 1; threads <= 100; threads *= 10) {
+        contains_all = contains_all && parallel_contains(list_ptr, -9, threads)
+                       && parallel_contains(list_ptr, (int64_t) length - 3, threads)
+                       && !parallel_contains(list_ptr, 77, threads) && !parallel_contains(list_ptr, -8, threads);
+    }
+    tests_status[4] = contains_all;
+    destroy_list(list_ptr);
+
+    return tests_status;
+}
+
+/**
+ * @brief Tests the instrumentation of the SinglyLinkedList functions.
+ *
+ * This function performs four tests on the counters, which must all stay at 0 when the
+ * instrumentation is compiled out:
+ * 1. Verifies that list_stats_reset sets every counter to 0, except the bytes still held
+ * 2. Verifies that appends are counted, with one node malloc each and the bytes they hold
+ * 3. Verifies that get, find and contains count the nodes they hop over
+ * 4. Verifies that calls made inside another function count only for it, and that clear frees every byte
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains STATS_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_stats() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * STATS_NUM_TESTS);
+    list_stats_reset();
+    ListStats stats = list_stats_snapshot();
+
+    // Test 1: reset counters
+    bool zero = (stats.enabled == (STATS_EXPECT(1) == 1)) && (stats.mallocs == 0) && (stats.frees == 0);
+    for (int op = 0; op < LIST_OP_COUNT; op++) {
+        zero = zero && (stats.ops[op].calls == 0) && (stats.ops[op].hops == 0);
+    }
+    tests_status[0] = zero;
+    // bytes still held by the nodes of earlier tests
+    uint64_t held = stats.live_bytes;
+
+    // Test 2: appends
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (int64_t i = 0; i < 100; i++) {
+        append_node(list_ptr, i);
+    }
+    stats = list_stats_snapshot();
+    tests_status[1] = (stats.ops[LIST_OP_APPEND].calls == STATS_EXPECT(100)) && (stats.mallocs == STATS_EXPECT(100))
+                      && (stats.live_bytes == held + STATS_EXPECT(100 * sizeof(Node)))
+                      && (stats.peak_bytes == stats.live_bytes);
+
+    // Test 3: hops
+    bool found = (*get(list_ptr, 50) == 50) && (*get(list_ptr, 60) == 60) && (find(list_ptr, 30) == 30)
+                 && contains(list_ptr, 40);
+    stats = list_stats_snapshot();
+    tests_status[2] = found && (stats.ops[LIST_OP_GET].calls == STATS_EXPECT(2))
+                      && (stats.ops[LIST_OP_GET].hops == STATS_EXPECT(60))
+                      && (stats.ops[LIST_OP_FIND].calls == STATS_EXPECT(2))
+                      && (stats.ops[LIST_OP_FIND].hops == STATS_EXPECT(70));
+
+    // Test 4: nested calls and frees
+    insert_node(list_ptr, -1, 0);
+    clear(list_ptr);
+    stats = list_stats_snapshot();
+    bool counted = (stats.ops[LIST_OP_INSERT].calls == STATS_EXPECT(1)) && (stats.ops[LIST_OP_PREPEND].calls == 0)
+                   && (stats.ops[LIST_OP_CLEAR].calls == STATS_EXPECT(1)) && (stats.frees == STATS_EXPECT(101))
+                   && (stats.live_bytes == held) && (stats.peak_bytes == held + STATS_EXPECT(101 * sizeof(Node)));
+    for (int op = 0; op < LIST_OP_COUNT; op++) {
+        uint64_t calls = 0;
+        for (int bucket = 0; bucket < STATS_BUCKETS; bucket++) {
+            calls += stats.ops[op].latency[bucket];
+        }
+        counted = counted && (calls == stats.ops[op].calls)
+                  && (list_stats_percentile(&(stats.ops[op]), 50) <= list_stats_percentile(&(stats.ops[op]), 99));
+    }
+    tests_status[3] = counted;
+    destroy_list(list_ptr);
+
+    return tests_status;
+}
+
+/*** MappedSinglyList Unit Tests */
+
+/**
+ * @brief Returns true if walking the list file from its head gives exactly the
+ *        values of the array, in order.
+ */
+bool mapped_matches(MappedSinglyList* mapped_ptr, int64_t* arr, uint64_t length) {
+    uint64_t i = 0;
+    for (MappedNode* node = mapped_head(mapped_ptr); node != NULL; node = mapped_next(node), i++) {
+        if ((i == length) || (node->data != arr[i])) {
+            return false;
+        }
+    }
+    return (i == length) && (mapped_size(mapped_ptr) == length);
+}
+
+/**
+ * @brief Tests the list files of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on the MappedSinglyList functions:
+ * 1. Verifies that a new list file is empty, and is still empty once closed and opened again
+ * 2. Verifies that appends past the capacity of the file grow it and keep every value in order
+ * 3. Verifies that a closed file opens with the same values, and takes more appends after mapped_sync
+ * 4. Verifies that save_mapped_list writes the values of a SinglyLinkedList in order
+ * 5. Verifies that missing files, files of another format and cut off files are not opened
+ * 6. Verifies that the same file mapped at two addresses at once is walked the same way from both
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains MAPPED_LIST_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_mapped_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * MAPPED_LIST_NUM_TESTS);
+    int64_t arr[5000];
+    for (int64_t i = 0; i < 5000; i++) {
+        arr[i] = (i * 7919) % 1000 - 500;
+    }
+
+    // Test 1: empty file
+    MappedSinglyList* mapped_ptr = create_mapped_list(MAPPED_TEST_PATH, 0);
+    bool empty = (mapped_ptr != NULL) && (mapped_size(mapped_ptr) == 0) && (mapped_head(mapped_ptr) == NULL);
+    close_mapped_list(mapped_ptr);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[0] = empty && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 0);
+
+    // Test 2: growing
+    for (int64_t i = 0; i < 3000; i++) {
+        mapped_append(mapped_ptr, arr[i]);
+    }
+    tests_status[1] = mapped_matches(mapped_ptr, arr, 3000) && (mapped_ptr->capacity >= mapped_ptr->header->used);
+    close_mapped_list(mapped_ptr);
+
+    // Test 3: reopening and appending again
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    bool reopened = (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 3000);
+    for (int64_t i = 3000; i < 5000; i++) {
+        mapped_append(mapped_ptr, arr[i]);
+    }
+    bool synced = mapped_sync(mapped_ptr);
+    close_mapped_list(mapped_ptr);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[2] = reopened && synced && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 5000);
+    close_mapped_list(mapped_ptr);
+
+    // Test 4: saving a list
+    SinglyLinkedList* list_ptr = list_from_array(arr, 4321);
+    bool saved = save_mapped_list(list_ptr, MAPPED_TEST_PATH);
+    destroy_list(list_ptr);
+    mapped_ptr = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[3] = saved && (mapped_ptr != NULL) && mapped_matches(mapped_ptr, arr, 4321);
+    close_mapped_list(mapped_ptr);
+
+    // Test 5: files which are not list files
+    bool rejected = (open_mapped_list("build/missing.list") == NULL);
+    FILE* file = fopen(MAPPED_TEST_PATH, "r+b");
+    fwrite("DLLMAP01", 1, 8, file);
+    fclose(file);
+    rejected = rejected && (open_mapped_list(MAPPED_TEST_PATH) == NULL);
+    list_ptr = list_from_array(arr, 10);
+    save_mapped_list(list_ptr, MAPPED_TEST_PATH);
+    destroy_list(list_ptr);
+    truncate(MAPPED_TEST_PATH, sizeof(MappedHeader) + 9 * sizeof(MappedNode));
+    tests_status[4] = rejected && (open_mapped_list(MAPPED_TEST_PATH) == NULL);
+
+    // Test 6: two mappings at once
+    list_ptr = list_from_array(arr, 100);
+    save_mapped_list(list_ptr, MAPPED_TEST_PATH);
+    destroy_list(list_ptr);
+    MappedSinglyList* first = open_mapped_list(MAPPED_TEST_PATH);
+    MappedSinglyList* second = open_mapped_list(MAPPED_TEST_PATH);
+    tests_status[5] = (first != NULL) && (second != NULL) && (first->header != second->header)
+                      && mapped_matches(first, arr, 100) && mapped_matches(second, arr, 100);
+    close_mapped_list(first);
+    close_mapped_list(second);
+
+    remove(MAPPED_TEST_PATH);
+    return tests_status;
+}
+
+/*** Stream Unit Tests */
+
+/**
+ * @brief Bytes of a stream kept in memory, written from the front and read
+ *        from read_at. Writing fails once limit bytes were written.
+ */
+typedef struct {
+    uint8_t* bytes;
+    uint64_t length;
+    uint64_t limit;
+    uint64_t read_at;
+} TestStream;
+
+/**
+ * @brief Takes the bytes of a stream into the TestStream in context.
+ */
+bool test_stream_write(void* context, const uint8_t* bytes, uint64_t length) {
+    TestStream* stream = (TestStream *) context;
+    if (stream->length + length > stream->limit) {
+        return false;
+    }
+    memcpy(stream->bytes + stream->length, bytes, length);
+    stream->length += length;
+    return true;
+}
+
+/**
+ * @brief Gives the bytes of the TestStream in context, at most 1000 at a time so
+ *        that chunks are split across reads.
+ */
+int64_t test_stream_read(void* context, uint8_t* bytes, uint64_t capacity) {
+    TestStream* stream = (TestStream *) context;
+    uint64_t length = stream->length - stream->read_at;
+    length = (length < capacity) ? length : capacity;
+    length = (length < 1000) ? length : 1000;
+    memcpy(bytes, stream->bytes + stream->read_at, length);
+    stream->read_at += length;
+    return length;
+}
+
+/**
+ * @brief Returns true if the list holds exactly the values of the array, in order.
+ */
+bool list_matches(SinglyLinkedList* list_ptr, int64_t* arr, uint64_t length) {
+    uint64_t i = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next, i++) {
+        if ((i == length) || (node->data != arr[i])) {
+            return false;
+        }
+    }
+    return (i == length) && (size(list_ptr) == length);
+}
+
+/**
+ * @brief Tests the stream functions of the SinglyLinkedList implementation
+ *
+ * This function performs six tests on encode_list and decode_list:
+ * 1. Verifies that an empty list is written as the magic bytes and an empty chunk, and read back as empty
+ * 2. Verifies that extreme values and the largest differences between them are read back exactly
+ * 3. Verifies that a list spanning many chunks is read back through a file, with close values taking one byte each
+ * 4. Verifies that decoding appends to the values already in a list
+ * 5. Verifies that a failed write stops encoding, and a failed read stops decoding
+ * 6. Verifies that streams with the wrong magic bytes, cut off streams, and bad chunks are rejected
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains STREAM_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_stream() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * STREAM_NUM_TESTS);
+    uint64_t length = 200000;
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * 2 * length);
+    TestStream stream = {(uint8_t *) malloc(12 * length), 0, 12 * length, 0};
+
+    // Test 1: empty list
+    SinglyLinkedList* list_ptr = create_empty_list();
+    bool written = encode_list(list_ptr, test_stream_write, &stream);
+    SinglyLinkedList* decoded = create_empty_list();
+    tests_status[0] = written && (stream.length == 6) && (memcmp(stream.bytes, STREAM_MAGIC, 4) == 0)
+                      && decode_list(decoded, test_stream_read, &stream) && is_empty(decoded);
+    destroy_list(decoded);
+    destroy_list(list_ptr);
+
+    // Test 2: extremes
+    int64_t extremes[8] = {INT64_MIN, INT64_MAX, INT64_MIN, 0, -1, INT64_MAX, INT64_MAX, 1};
+    list_ptr = list_from_array(extremes, 8);
+    stream.length = 0;
+    stream.read_at = 0;
+    written = encode_list(list_ptr, test_stream_write, &stream);
+    decoded = create_empty_list();
+    tests_status[1] = written && decode_list(decoded, test_stream_read, &stream) && list_matches(decoded, extremes, 8);
+    destroy_list(decoded);
+    destroy_list(list_ptr);
+
+    // Test 3: many chunks through a file
+    for (uint64_t i = 0; i < length; i++) {
+        arr[i] = 1000000 + i + (i % 7);
+    }
+    list_ptr = list_from_array(arr, length);
+    FILE* file = fopen(STREAM_TEST_PATH, "w+b");
+    written = encode_list_fd(list_ptr, fileno(file));
+    off_t bytes = lseek(fileno(file), 0, SEEK_END);
+    lseek(fileno(file), 0, SEEK_SET);
+    decoded = create_empty_list();
+    tests_status[2] = written && (bytes < (off_t) (length + length / 100)) && decode_list_fd(decoded, fileno(file))
+                      && list_matches(decoded, arr, length);
+    fclose(file);
+    remove(STREAM_TEST_PATH);
+    destroy_list(list_ptr);
+
+    // Test 4: appending to a list, with random values
+    srand(14);
+    for (uint64_t i = length; i < 2 * length; i++) {
+        arr[i] = (int64_t) (((uint64_t) rand() << 33) ^ ((uint64_t) rand() << 2) ^ (rand() % 4));
+    }
+    list_ptr = list_from_array(arr + length, length);
+    stream.length = 0;
+    stream.read_at = 0;
+    written = encode_list(list_ptr, test_stream_write, &stream);
+    tests_status[3] = written && decode_list(decoded, test_stream_read, &stream) && list_matches(decoded, arr, 2 * length);
+    destroy_list(decoded);
+
+    // Test 5: failed writes and reads
+    uint64_t full_length = stream.length;
+    stream.length = 0;
+    stream.limit = full_length / 2;
+    bool stopped = !encode_list(list_ptr, test_stream_write, &stream);
+    stream.limit = 12 * length;
+    stream.length = 0;
+    encode_list(list_ptr, test_stream_write, &stream);
+    // reading from a file descriptor which is not open fails
+    decoded = create_empty_list();
+    tests_status[4] = stopped && (stream.length == full_length) && !decode_list_fd(decoded, -1)
+                      && is_empty(decoded);
+    destroy_list(list_ptr);
+
+    // Test 6: malformed streams
+    stream.read_at = 0;
+    stream.length = full_length - 1;
+    bool cut_off = !decode_list(decoded, test_stream_read, &stream);
+    clear(decoded);
+    stream.bytes[0] = 'X';
+    stream.read_at = 0;
+    stream.length = full_length;
+    bool bad_magic = !decode_list(decoded, test_stream_read, &stream) && is_empty(decoded);
+    // a chunk claiming more values than it has bytes
+    uint8_t bad_chunk[9] = {'L', 'L', 'S', '1', 5, 2, 1, 1, 0};
+    memcpy(stream.bytes, bad_chunk, 9);
+    stream.read_at = 0;
+    stream.length = 9;
+    tests_status[5] = cut_off && bad_magic && !decode_list(decoded, test_stream_read, &stream);
+    destroy_list(decoded);
+
+    free(stream.bytes);
+    free(arr);
+    return tests_status;
+}
+
+/*** ArenaSinglyList Unit Tests */
+
+/**
+ * @brief Returns true if walking the ArenaSinglyList from its head gives exactly
+ *        the values of the array in order, and the tail is the last node.
+ */
+bool arena_matches(ArenaSinglyList* arena_ptr, int64_t* arr, uint64_t length) {
+    uint64_t i = 0;
+    uint32_t last = ARENA_NIL;
+    for (uint32_t at = arena_head(arena_ptr); at != ARENA_NIL; at = arena_next(arena_ptr, at)) {
+        if ((i == length) || (arena_data(arena_ptr, at) != arr[i])) {
+            return false;
+        }
+        last = at;
+        i++;
+    }
+    return (i == length) && (arena_size(arena_ptr) == length) && (arena_ptr->tail == last);
+}
+
+/**
+ * @brief Tests the ArenaSinglyList implementation
+ *
+ * This function performs six tests on the arena mode of the list:
+ * 1. Verifies that an ArenaNode takes 12 bytes, and a new list is empty
+ * 2. Verifies that appends and prepends past the capacity grow the arena and keep the values in order
+ * 3. Verifies that get, find and contains agree with the values, and reject indices out of bounds
+ * 4. Verifies that inserting, replacing and deleting at the ends and in the middle keep the list whole,
+ *    and that deleted nodes are reused before the arena grows
+ * 5. Verifies that arena_from_list, arena_copy and arena_to_array hold the same values, and that a copy
+ *    made with memcpy is not changed by the original
+ * 6. Verifies that reversing relinks the list, and clearing empties it
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains ARENA_LIST_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_arena_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * ARENA_LIST_NUM_TESTS);
+    int64_t arr[3000];
+    int64_t data = 0;
+
+    // Test 1: empty list
+    ArenaSinglyList* arena_ptr = create_arena_list(4);
+    tests_status[0] = (sizeof(ArenaNode) == 12) && (arena_head(arena_ptr) == ARENA_NIL)
+                      && !arena_get(arena_ptr, 0, &data) && arena_matches(arena_ptr, arr, 0);
+
+    // Test 2: growing
+    for (int64_t i = 0; i < 1000; i++) {
+        arena_append(arena_ptr, i);
+        arena_prepend(arena_ptr, -i - 1);
+    }
+    for (int64_t i = 0; i < 2000; i++) {
+        arr[i] = i - 1000;
+    }
+    tests_status[1] = arena_matches(arena_ptr, arr, 2000) && (arena_ptr->capacity == 2048);
+
+    // Test 3: lookups
+    bool found = arena_get(arena_ptr, 1999, &data) && (data == 999) && arena_get(arena_ptr, 0, &data)
+                 && (data == -1000) && !arena_get(arena_ptr, 2000, &data) && (data == -1000);
+    tests_status[2] = found && (arena_find(arena_ptr, 0) == 1000) && (arena_find(arena_ptr, 1000) == UINT64_MAX)
+                      && arena_contains(arena_ptr, -1000) && !arena_contains(arena_ptr, 5000);
+
+    // Test 4: changing the list
+    clear_arena_list(arena_ptr);
+    for (int64_t i = 0; i < 10; i++) {
+        arena_append(arena_ptr, i);
+    }
+    arena_delete_first(arena_ptr);
+    arena_delete_last(arena_ptr);
+    arena_delete_node(arena_ptr, 3);
+    arena_delete_node(arena_ptr, 6);
+    arena_delete_node(arena_ptr, 50);
+    arena_insert_node(arena_ptr, 40, 0);
+    arena_insert_node(arena_ptr, 41, 3);
+    arena_insert_node(arena_ptr, 42, 8);
+    bool out_of_bounds = !arena_insert_node(arena_ptr, 43, 10) && !arena_replace_node(arena_ptr, 43, 9);
+    arena_replace_node(arena_ptr, 44, 1);
+    int64_t changed[9] = {40, 44, 2, 41, 3, 5, 6, 7, 42};
+    bool middle = out_of_bounds && arena_matches(arena_ptr, changed, 9);
+    arena_delete_node(arena_ptr, 8);
+    arena_delete_last(arena_ptr);
+    arena_append(arena_ptr, 42);
+    changed[7] = 42;
+    tests_status[3] = middle && arena_matches(arena_ptr, changed, 8) && (arena_ptr->used == 10);
+
+    // Test 5: copies
+    SinglyLinkedList* list_ptr = create_empty_list();
+    for (int64_t i = 0; i < 3000; i++) {
+        arr[i] = (i * 7919) % 1000 - 500;
+        append_node(list_ptr, arr[i]);
+    }
+    ArenaSinglyList* from_ptr = arena_from_list(list_ptr);
+    ArenaSinglyList* copy_ptr = arena_copy(arena_ptr);
+    int64_t* values = arena_to_array(from_ptr);
+    bool same = (values != NULL) && (memcmp(values, arr, sizeof(arr)) == 0);
+    free(values);
+    arena_replace_node(arena_ptr, 0, 0);
+    arena_delete_first(copy_ptr);
+    tests_status[4] = same && arena_matches(from_ptr, arr, 3000) && (from_ptr->used == 3000)
+                      && arena_matches(copy_ptr, changed + 1, 7) && (arena_find(arena_ptr, 0) == 0);
+    clear(list_ptr);
+    free(list_ptr);
+    destroy_arena_list(from_ptr);
+    destroy_arena_list(copy_ptr);
+
+    // Test 6: reversing and clearing
+    arena_replace_node(arena_ptr, 40, 0);
+    arena_reverse_list(arena_ptr);
+    int64_t reversed[8];
+    for (int64_t i = 0; i < 8; i++) {
+        reversed[i] = changed[7 - i];
+    }
+    bool reverse = arena_matches(arena_ptr, reversed, 8) && arena_append(arena_ptr, 1);
+    clear_arena_list(arena_ptr);
+    tests_status[5] = reverse && arena_matches(arena_ptr, arr, 0) && (arena_ptr->used == 0);
+
+    destroy_arena_list(arena_ptr);
+    return tests_status;
+}
+
+/*** Generic List Unit Tests */
+
+/**
+ * @brief A 16-byte element, stored inline in the nodes of a PointList.
+ */
+typedef struct {
+    int64_t x;
+    int64_t y;
+} Point;
+
+/**
+ * @brief Returns true if both points have the same coordinates.
+ */
+static inline bool point_equal(const Point* a, const Point* b) {
+    return (a->x == b->x) && (a->y == b->y);
+}
+
+/**
+ * @brief Mixes both coordinates of the point into a hash.
+ */
+static inline uint64_t point_hash(const Point* point) {
+    uint64_t h = ((uint64_t) point->x * 0x9E3779B97F4A7C15ULL) ^ (uint64_t) point->y;
+    return h ^ (h >> 29);
+}
+
+// integers compared with a macro, and hashed onto 4 home slots so that most keys collide
+#define int_equal(a, b) (*(a) == *(b))
+#define int_collide(a) ((uint64_t) (*(a) & 3))
+
+DEFINE_SINGLY_LIST(PointList, point_list, Point, point_equal, point_hash)
+DEFINE_SINGLY_LIST(IntList, int_list, int64_t, int_equal, int_collide)
+
+/**
+ * @brief Returns true if int_contains, with or without the hash index, agrees with
+ *        a scan of the list for every value in [0, limit).
+ */
+bool int_list_consistent(IntList* list_ptr, int64_t limit) {
+    for (int64_t i = 0; i < limit; i++) {
+        bool scanned = false;
+        for (IntListNode* node = list_ptr->head; node != NULL; node = node->next) {
+            scanned = scanned || (node->data == i);
+        }
+        if (int_list_contains(list_ptr, &i) != scanned) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tests the lists made by DEFINE_SINGLY_LIST
+ *
+ * This function performs six tests on a list of 16-byte Points and a list of integers:
+ * 1. Verifies that a zeroed list is empty, and the points are stored inline in 24-byte nodes
+ * 2. Verifies that appends and prepends keep the points in order
+ * 3. Verifies that find and contains compare points with point_equal
+ * 4. Verifies that delete_first and delete_value unlink the right nodes and keep the tail
+ * 5. Verifies that the hash index agrees with a scan through appends, duplicates and deletes,
+ *    even when most values share a home slot
+ * 6. Verifies that clear empties the list and frees the hash index
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains GENERIC_LIST_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_generic_list() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * GENERIC_LIST_NUM_TESTS);
+    PointList points = {0};
+    Point point = {1, 2};
+
+    // Test 1: empty list
+    tests_status[0] = (sizeof(PointListNode) == 24) && (point_list_size(&points) == 0)
+                      && (point_list_get(&points, 0) == NULL) && !point_list_contains(&points, &point)
+                      && (point_list_find(&points, &point) == UINT64_MAX);
+
+    // Test 2: appending and prepending
+    for (int64_t i = 0; i < 100; i++) {
+        point = (Point) {i, -i};
+        point_list_append(&points, &point);
+        point = (Point) {-i - 1, i + 1};
+        point_list_prepend(&points, &point);
+    }
+    bool in_order = point_list_size(&points) == 200;
+    for (int64_t i = 0; i < 200; i++) {
+        Point* got = point_list_get(&points, (uint64_t) i);
+        in_order = in_order && (got != NULL) && (got->x == i - 100) && (got->y == 100 - i);
+    }
+    tests_status[1] = in_order && (point_list_get(&points, 200) == NULL)
+                      && (points.tail->data.x == 99);
+
+    // Test 3: finding
+    point = (Point) {5, -5};
+    Point other = {5, 5};
+    tests_status[2] = (point_list_find(&points, &point) == 105) && point_list_contains(&points, &point)
+                      && (point_list_find(&points, &other) == UINT64_MAX)
+                      && !point_list_contains(&points, &other);
+
+    // Test 4: deleting
+    point_list_delete_first(&points);
+    point = (Point) {99, -99};
+    bool deleted = point_list_delete_value(&points, &point) && !point_list_delete_value(&points, &other);
+    point = (Point) {-99, 99};
+    deleted = deleted && point_list_delete_value(&points, &point);
+    tests_status[3] = deleted && (point_list_size(&points) == 197) && (points.head->data.x == -98)
+                      && (points.tail->data.x == 98) && (points.tail->next == NULL);
+
+    // Test 5: hash index
+    IntList ints = {0};
+    bool indexed = point_list_enable_hash_index(&points);
+    point = (Point) {0, 0};
+    indexed = indexed && point_list_contains(&points, &point) && !point_list_contains(&points, &other)
+              && (point_list_find(&points, &point) == 98);
+    for (int64_t i = 0; i < 60; i++) {
+        int64_t value = (i * 7) % 40;
+        int_list_append(&ints, &value);
+    }
+    bool consistent = int_list_consistent(&ints, 50) && int_list_enable_hash_index(&ints)
+                      && (ints.used == 40) && int_list_consistent(&ints, 50);
+    for (int64_t i = 0; i < 40; i += 3) {
+        int_list_delete_value(&ints, &i);
+        consistent = consistent && int_list_consistent(&ints, 50);
+    }
+    for (int64_t i = 0; i < 10; i++) {
+        int_list_delete_first(&ints);
+        int64_t value = 100 + i;
+        int_list_prepend(&ints, &value);
+    }
+    tests_status[4] = indexed && consistent && int_list_consistent(&ints, 120);
+
+    // Test 6: clearing
+    point_list_clear(&points);
+    int_list_clear(&ints);
+    int64_t value = 100;
+    tests_status[5] = (points.head == NULL) && (points.tail == NULL) && (points.slots == NULL)
+                      && (point_list_size(&points) == 0) && (ints.slots == NULL)
+                      && !int_list_contains(&ints, &value) && int_list_append(&ints, &value)
+                      && (int_list_find(&ints, &value) == 0);
+    int_list_clear(&ints);
+
     return tests_status;
 }
 
@@ -402,6 +2444,16 @@ int main() {
     display_test_results(tests_status, SEARCH_FORWARD_NUM_TESTS, false);
     free(tests_status);
 
+    tests_status = test_node_pool();
+    printf("Testing node_pool functions: ");
+    display_test_results(tests_status, NODE_POOL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_attach_pool();
+    printf("Testing attach_pool function: ");
+    display_test_results(tests_status, ATTACH_POOL_NUM_TESTS, false);
+    free(tests_status);
+
     tests_status = test_create_empty();
     printf("Testing create_empty function: ");
     display_test_results(tests_status, CREATE_EMPTY_NUM_TESTS, false);
@@ -417,5 +2469,100 @@ int main() {
     display_test_results(tests_status, SIZE_NUM_TESTS, false);
     free(tests_status);
 
+    tests_status = test_list_from_array();
+    printf("Testing list_from_array function: ");
+    display_test_results(tests_status, LIST_FROM_ARRAY_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_copy();
+    printf("Testing copy function: ");
+    display_test_results(tests_status, COPY_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_delete_node();
+    printf("Testing delete_node function: ");
+    display_test_results(tests_status, DELETE_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_skip_index();
+    printf("Testing skip_index functions: ");
+    display_test_results(tests_status, SKIP_INDEX_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_hash_index();
+    printf("Testing hash_index functions: ");
+    display_test_results(tests_status, HASH_INDEX_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_finger();
+    printf("Testing finger of get: ");
+    display_test_results(tests_status, FINGER_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_lookahead();
+    printf("Testing walks over skip index runs: ");
+    display_test_results(tests_status, LOOKAHEAD_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_cursor();
+    printf("Testing cursor functions: ");
+    display_test_results(tests_status, CURSOR_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_sort_list();
+    printf("Testing sort_list function: ");
+    display_test_results(tests_status, SORT_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_radix_sort_list();
+    printf("Testing radix_sort_list function: ");
+    display_test_results(tests_status, RADIX_SORT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_compact();
+    printf("Testing compaction functions: ");
+    display_test_results(tests_status, COMPACT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_concat();
+    printf("Testing concat function: ");
+    display_test_results(tests_status, CONCAT_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_batch();
+    printf("Testing batch functions: ");
+    display_test_results(tests_status, BATCH_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_parallel();
+    printf("Testing parallel functions: ");
+    display_test_results(tests_status, PARALLEL_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_stats();
+    printf("Testing instrumentation: ");
+    display_test_results(tests_status, STATS_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_mapped_list();
+    printf("Testing mapped_list functions: ");
+    display_test_results(tests_status, MAPPED_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_stream();
+    printf("Testing stream functions: ");
+    display_test_results(tests_status, STREAM_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_arena_list();
+    printf("Testing arena_list functions: ");
+    display_test_results(tests_status, ARENA_LIST_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_generic_list();
+    printf("Testing generic_list functions: ");
+    display_test_results(tests_status, GENERIC_LIST_NUM_TESTS, false);
+    free(tests_status);
+
     return 0;
 }
@@ -0,0 +1,137 @@
+/*
+This document is meant to store the implementation of the instrumentation
+shared by the linked lists. The counters are thread local, calls nested in
+another operation are counted as part of it, and latencies are sorted into
+power of two buckets so that recording one takes no more than a few adds.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdio.h>
+#include<string.h>
+#include<time.h>
+#include"list-stats.h"
+
+/*** Helper Functions ***/
+
+static const char* OP_NAMES[LIST_OP_COUNT] = {
+    "append", "prepend", "insert", "delete", "get", "find",
+    "batch", "sort", "splice", "compact", "clear"
+};
+
+#ifdef LIST_STATS
+
+_Thread_local ListStats list_stats = {.enabled = true};
+_Thread_local uint64_t list_stats_hops = 0;
+// the number of operations the calling thread is inside of
+static _Thread_local uint64_t stats_depth = 0;
+
+static uint64_t stats_now_ns() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+StatsScope stats_begin(ListOp op) {
+    StatsScope scope = {-1, 0, 0};
+    if (stats_depth++ == 0) {
+        scope.op = (int) op;
+        scope.start_hops = list_stats_hops;
+        scope.start_ns = stats_now_ns();
+    }
+    return scope;
+}
+
+void stats_end(StatsScope* scope) {
+    stats_depth--;
+    if (scope->op < 0) {
+        return;
+    }
+    uint64_t elapsed = stats_now_ns() - scope->start_ns;
+    OpStats* op_stats = &(list_stats.ops[scope->op]);
+    op_stats->calls++;
+    op_stats->hops += list_stats_hops - scope->start_hops;
+    op_stats->total_ns += elapsed;
+    if (elapsed > op_stats->max_ns) {
+        op_stats->max_ns = elapsed;
+    }
+    uint64_t bucket = (elapsed == 0) ? 0 : (uint64_t) (63 - __builtin_clzll(elapsed));
+    op_stats->latency[(bucket < STATS_BUCKETS) ? bucket : STATS_BUCKETS - 1]++;
+}
+
+void stats_malloc(uint64_t bytes) {
+    list_stats.mallocs++;
+    list_stats.live_bytes += bytes;
+    if (list_stats.live_bytes > list_stats.peak_bytes) {
+        list_stats.peak_bytes = list_stats.live_bytes;
+    }
+}
+
+void stats_free(uint64_t bytes) {
+    list_stats.frees++;
+    // memory allocated by another thread may be freed by this one
+    list_stats.live_bytes = (list_stats.live_bytes > bytes) ? list_stats.live_bytes - bytes : 0;
+}
+
+#endif
+
+/*** Snapshot Functions ***/
+
+ListStats list_stats_snapshot() {
+#ifdef LIST_STATS
+    return list_stats;
+#else
+    ListStats stats;
+    memset(&stats, 0, sizeof(ListStats));
+    return stats;
+#endif
+}
+
+void list_stats_reset() {
+#ifdef LIST_STATS
+    uint64_t live_bytes = list_stats.live_bytes;
+    memset(&list_stats, 0, sizeof(ListStats));
+    list_stats.enabled = true;
+    list_stats.live_bytes = live_bytes;
+    list_stats.peak_bytes = live_bytes;
+#endif
+}
+
+const char* list_op_name(ListOp op) {
+    return ((op >= 0) && (op < LIST_OP_COUNT)) ? OP_NAMES[op] : "unknown";
+}
+
+uint64_t list_stats_percentile(const OpStats* op_stats, double percentile) {
+    if (op_stats->calls == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t) (percentile / 100.0 * (double) (op_stats->calls - 1)) + 1;
+    uint64_t seen = 0;
+    for (uint64_t bucket = 0; bucket < STATS_BUCKETS; bucket++) {
+        seen += op_stats->latency[bucket];
+        if (seen >= rank) {
+            return (UINT64_C(2) << bucket) - 1;
+        }
+    }
+    return op_stats->max_ns;
+}
+
+void list_stats_print(const ListStats* stats) {
+    if (!stats->enabled) {
+        printf("List instrumentation is not compiled in (build with STATS=1).\n");
+        return;
+    }
+    for (int op = 0; op < LIST_OP_COUNT; op++) {
+        const OpStats* op_stats = &(stats->ops[op]);
+        if (op_stats->calls == 0) {
+            continue;
+        }
+        printf("%-8s %12lu calls %10.1f hops/call %10.1f ns/call  p50 <= %lu ns  p99 <= %lu ns  max %lu ns\n",
+               list_op_name((ListOp) op), op_stats->calls, (double) op_stats->hops / op_stats->calls,
+               (double) op_stats->total_ns / op_stats->calls, list_stats_percentile(op_stats, 50),
+               list_stats_percentile(op_stats, 99), op_stats->max_ns);
+    }
+    printf("%lu node mallocs, %lu node frees, %lu live bytes, %lu peak bytes\n",
+           stats->mallocs, stats->frees, stats->live_bytes, stats->peak_bytes);
+}
@@ -0,0 +1,151 @@
+/*
+This header file is used to declare the instrumentation shared by the linked
+lists: the number of node hops, node allocations and live node bytes, and a
+latency histogram, for every kind of list operation. It is only compiled in
+when LIST_STATS is defined (make STATS=1). Otherwise the macros the lists use
+expand to nothing, and the snapshot functions report that it is disabled.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef LISTSTATS_H
+#define LISTSTATS_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+
+/*** Constants ***/
+// bucket b of a latency histogram counts the calls which took from 2^b up to
+// 2^(b + 1) - 1 nanoseconds, and the last bucket counts every longer call too
+#define STATS_BUCKETS 40
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief The kinds of list operations which are counted apart. Every list maps
+ *        its public functions onto these, so the lists can be compared.
+ */
+typedef enum {
+    LIST_OP_APPEND,
+    LIST_OP_PREPEND,
+    LIST_OP_INSERT,
+    LIST_OP_DELETE,
+    LIST_OP_GET,
+    LIST_OP_FIND,
+    LIST_OP_BATCH,
+    LIST_OP_SORT,
+    LIST_OP_SPLICE,
+    LIST_OP_COMPACT,
+    LIST_OP_CLEAR,
+    LIST_OP_COUNT
+} ListOp;
+
+/**
+ * @brief The counters of one kind of list operation.
+ * Contains the number of calls, the nodes hopped over by all of them, their
+ * total and longest time, and the histogram of their times.
+ */
+typedef struct {
+    uint64_t calls;
+    uint64_t hops;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t latency[STATS_BUCKETS];
+} OpStats;
+
+/**
+ * @brief A snapshot of the instrumentation of one thread.
+ * Contains whether the instrumentation is compiled in, the counters of every
+ * kind of operation, and the number of node allocations and frees with the
+ * bytes they hold now and at most. Node bytes are the nodes allocated one at
+ * a time and the slabs of node pools.
+ */
+typedef struct {
+    bool enabled;
+    OpStats ops[LIST_OP_COUNT];
+    uint64_t mallocs;
+    uint64_t frees;
+    uint64_t live_bytes;
+    uint64_t peak_bytes;
+} ListStats;
+
+
+/*** Instrumentation Macros ***/
+
+#ifdef LIST_STATS
+
+/**
+ * @brief The operation being timed, when it was started, and the hop count at
+ *        that time. op is -1 for calls made from inside another operation, which
+ *        are counted as part of it.
+ */
+typedef struct {
+    int op;
+    uint64_t start_ns;
+    uint64_t start_hops;
+} StatsScope;
+
+// the counters of the calling thread, and the hops made by it so far
+extern _Thread_local ListStats list_stats;
+extern _Thread_local uint64_t list_stats_hops;
+
+StatsScope stats_begin(ListOp op);
+void stats_end(StatsScope* scope);
+void stats_malloc(uint64_t bytes);
+void stats_free(uint64_t bytes);
+
+// times the rest of the enclosing function as one call of op, up to whichever return it takes
+#define STATS_OP(op) StatsScope stats_scope_ __attribute__((cleanup(stats_end))) = stats_begin(op)
+#define STATS_HOPS(n) (list_stats_hops += (uint64_t) (n))
+#define STATS_MALLOC(bytes) stats_malloc(bytes)
+#define STATS_FREE(bytes) stats_free(bytes)
+
+#else
+
+#define STATS_OP(op)
+#define STATS_HOPS(n)
+#define STATS_MALLOC(bytes)
+#define STATS_FREE(bytes)
+
+#endif
+
+
+/*** Snapshot Functions ***/
+
+/**
+ * @brief Returns a copy of the counters of the calling thread. The counters are
+ *        kept per thread, so that no two threads write to the same ones.
+ *        Every field is 0 if the instrumentation is not compiled in.
+ */
+ListStats list_stats_snapshot();
+
+/**
+ * @brief Sets every counter of the calling thread back to 0, except for the live
+ *        bytes, which are still held.
+ */
+void list_stats_reset();
+
+/**
+ * @brief Returns the name of the operation, as used by list_stats_print.
+ * @param op The operation.
+ */
+const char* list_op_name(ListOp op);
+
+/**
+ * @brief Returns an upper bound of the given percentile of the latencies of an
+ *        operation, from its histogram: the end of the bucket holding it. Returns 0
+ *        if the operation was never called.
+ * @param op_stats The counters of the operation.
+ * @param percentile The percentile, from 0 to 100.
+ */
+uint64_t list_stats_percentile(const OpStats* op_stats, double percentile);
+
+/**
+ * @brief Prints a line for every operation which was called in the snapshot,
+ *        followed by the allocation counters.
+ * @param stats The snapshot to print.
+ */
+void list_stats_print(const ListStats* stats);
+#endif
@@ -0,0 +1,195 @@
+/*
+This file is used to benchmark scans of the UnrolledLinkedList against a chain
+of one-value nodes laid out like those of the SinglyLinkedList, and a plain
+dynamic array. Every structure is searched for a value it does not hold, with
+its nodes allocated in order and then relinked at random, at sizes from 10 up
+to the size given on the command line (10,000,000 by default). Results are
+printed and written to logs/bench.csv so that runs can be compared with diff.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include"unrolled-linked.h"
+#include"../bench/bench-harness.h"
+
+/*** Constants ***/
+#define LIST_NAME "UnrolledLinkedList"
+#define CHAIN_NAME "SinglyLinkedList"
+#define ARRAY_NAME "DynamicArray"
+
+// keeps the compiler from throwing away the results of measured calls
+volatile int64_t sink;
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief A node of the same size and layout as the Node of the SinglyLinkedList
+ *        in ../singly, which can not be linked into this program since both lists
+ *        name their functions the same.
+ * Contains the value of the node and a pointer to the next node.
+ */
+typedef struct ChainNode {
+    int64_t data;
+    struct ChainNode* next;
+} ChainNode;
+
+
+/*** Benchmark Functions ***/
+
+/**
+ * @brief Returns the index of the first node of the chain holding data, or
+ *        UINT64_MAX, the way find does on the SinglyLinkedList without an index.
+ */
+uint64_t chain_find(ChainNode* head, int64_t data) {
+    uint64_t index = 0;
+    for (ChainNode* node = head; node != NULL; node = node->next) {
+        if (node->data == data) {
+            return index;
+        }
+        index++;
+    }
+    return UINT64_MAX;
+}
+
+/**
+ * @brief Allocates length chain nodes one malloc at a time, in order, and links
+ *        them holding 0 to length - 1. The nodes are also stored in nodes.
+ */
+ChainNode* build_chain(ChainNode** nodes, uint64_t length) {
+    for (uint64_t i = 0; i < length; i++) {
+        nodes[i] = (ChainNode *) malloc(sizeof(ChainNode));
+        nodes[i]->data = (int64_t) i;
+        nodes[i]->next = NULL;
+        if (i > 0) {
+            nodes[i - 1]->next = nodes[i];
+        }
+    }
+    return nodes[0];
+}
+
+/**
+ * @brief Shuffles the count pointers of items in place, with Fisher-Yates.
+ */
+void shuffle_pointers(void** items, uint64_t count) {
+    for (uint64_t i = count - 1; i > 0; i--) {
+        uint64_t j = bench_random() % (i + 1);
+        void* swap = items[i];
+        items[i] = items[j];
+        items[j] = swap;
+    }
+}
+
+/**
+ * @brief Relinks the nodes of the UnrolledLinkedList in a random order, without
+ *        moving any of them, so that walking the list jumps around memory.
+ */
+void shuffle_links(UnrolledLinkedList* list_ptr) {
+    Node** nodes = (Node **) malloc(sizeof(Node *) * list_ptr->num_nodes);
+    uint64_t count = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        nodes[count++] = node;
+    }
+    shuffle_pointers((void **) nodes, count);
+    for (uint64_t i = 0; i + 1 < count; i++) {
+        nodes[i]->next = nodes[i + 1];
+    }
+    nodes[count - 1]->next = NULL;
+    list_ptr->head = nodes[0];
+    list_ptr->tail = nodes[count - 1];
+    free(nodes);
+}
+
+/**
+ * @brief Measures find of a value the UnrolledLinkedList does not hold, so that
+ *        every value is compared. Each sample is one scan.
+ */
+void bench_list_scan(UnrolledLinkedList* list_ptr, const char* operation, uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = (int64_t) find(list_ptr, -1);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+    } while (bench_wants_more(samples));
+    bench_report(samples, LIST_NAME, operation, length);
+}
+
+/**
+ * @brief Measures chain_find of a value the chain does not hold. Each sample is
+ *        one scan.
+ */
+void bench_chain_scan(ChainNode* head, const char* operation, uint64_t length) {
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = (int64_t) chain_find(head, -1);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+    } while (bench_wants_more(samples));
+    bench_report(samples, CHAIN_NAME, operation, length);
+}
+
+/**
+ * @brief Measures a scan for a missing value of the UnrolledLinkedList and of the
+ *        chain of one-value nodes, first with their nodes allocated in order and
+ *        then relinked in a random order, and of a DynamicArray. ops/s counts
+ *        whole scans per second, and the latencies are those of one scan.
+ */
+void bench_scans(uint64_t length) {
+    int64_t* values = (int64_t *) malloc(sizeof(int64_t) * length);
+    for (uint64_t i = 0; i < length; i++) {
+        values[i] = (int64_t) i;
+    }
+    UnrolledLinkedList* list_ptr = list_from_array(values, length);
+    bench_list_scan(list_ptr, "find_in_order", length);
+    shuffle_links(list_ptr);
+    bench_list_scan(list_ptr, "find_shuffled", length);
+    clear(list_ptr);
+    free(list_ptr);
+
+    ChainNode** nodes = (ChainNode **) malloc(sizeof(ChainNode *) * length);
+    ChainNode* head = build_chain(nodes, length);
+    bench_chain_scan(head, "find_in_order", length);
+    shuffle_pointers((void **) nodes, length);
+    for (uint64_t i = 0; i + 1 < length; i++) {
+        nodes[i]->next = nodes[i + 1];
+    }
+    nodes[length - 1]->next = NULL;
+    bench_chain_scan(nodes[0], "find_shuffled", length);
+    for (uint64_t i = 0; i < length; i++) {
+        free(nodes[i]);
+    }
+    free(nodes);
+
+    DynamicArray array = {0};
+    for (uint64_t i = 0; i < length; i++) {
+        array_append(&array, values[i]);
+    }
+    BenchSamples* samples = bench_start();
+    do {
+        uint64_t start = bench_now_ns();
+        sink = (int64_t) array_find(&array, -1);
+        bench_add_sample(samples, bench_now_ns() - start, 1);
+    } while (bench_wants_more(samples));
+    bench_report(samples, ARRAY_NAME, "find", length);
+    array_clear(&array);
+    free(values);
+}
+
+/*** Program Starting Point */
+int main(int argc, char** argv) {
+    uint64_t max_size = bench_max_size(argc, argv);
+    if (!bench_open_csv(BENCH_CSV_PATH)) {
+        printf("Could not open %s, results are only printed.\n", BENCH_CSV_PATH);
+    }
+    bench_seed(12);
+    for (uint64_t length = 10; length <= max_size; length *= 10) {
+        bench_scans(length);
+    }
+    bench_close_csv();
+    return 0;
+}
@@ -0,0 +1,532 @@
+/*
+This file is used to test the UnrolledLinkedList implementation. Each of the functions
+implemented will have their own testing methods, and will be run sequentially when this
+program is executed.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include"unrolled-linked.h"
+
+/*** Constants ***/
+// for clarity in code
+#define PASS true
+#define FAIL false
+
+// for Node functions
+uint8_t DANGLING_NODE_NUM_TESTS = 3;
+uint8_t SEARCH_FORWARD_NUM_TESTS = 3;
+
+// for UnrolledLinkedList functions
+uint8_t LIST_FROM_ARRAY_NUM_TESTS = 4;
+uint8_t APPEND_PREPEND_NUM_TESTS = 4;
+uint8_t GET_NUM_TESTS = 4;
+uint8_t FIND_NUM_TESTS = 4;
+uint8_t INSERT_NODE_NUM_TESTS = 5;
+uint8_t DELETE_NODE_NUM_TESTS = 5;
+uint8_t RANDOM_OPS_NUM_TESTS = 1;
+
+/*** Helper Functions */
+
+/**
+ * @brief Returns true if the values of the list are equal to the values of the array.
+ */
+bool list_equals(UnrolledLinkedList* list_ptr, int64_t* arr, uint64_t arr_length) {
+    if (size(list_ptr) != arr_length) {
+        return false;
+    }
+    uint64_t i = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        for (uint64_t j = 0; j < node->count; j++) {
+            if ((i >= arr_length) || (node->data[j] != arr[i])) {
+                return false;
+            }
+            i++;
+        }
+    }
+    return (i == arr_length);
+}
+
+/*** Node Unit Tests ***/
+
+/**
+ * @brief Tests the dangling_node function for proper node creation
+ *
+ * This function performs three tests on the dangling_node functionality:
+ * 1. Verifies that the new node has no values
+ * 2. Verifies that the new node has its next pointer set to NULL
+ * 3. Verifies that the new node is aligned to a cache line
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains DANGLING_NODE_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_dangling_node() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * DANGLING_NODE_NUM_TESTS);
+    Node* node = dangling_node();
+
+    // Test 1: the node is empty
+    tests_status[0] = (node->count == 0);
+
+    // Test 2: the next pointer is NULL
+    tests_status[1] = (node->next == NULL);
+
+    // Test 3: the node starts on a cache line
+    tests_status[2] = (((uintptr_t) node) % CACHE_LINE_SIZE == 0);
+
+    free(node);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the search_forward function for finding data in a chain of nodes
+ *
+ * This function performs three tests on the search_forward functionality:
+ * 1. Verifies that data in the first node of the chain is found
+ * 2. Verifies that data in the last slot of the last node of the chain is found
+ * 3. Verifies that data outside the used slots of a node is not found
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains SEARCH_FORWARD_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_search_forward() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * SEARCH_FORWARD_NUM_TESTS);
+    Node* start = dangling_node();
+    Node* end = dangling_node();
+    start->next = end;
+    start->data[0] = 1;
+    start->count = 1;
+    for (uint64_t i = 0; i < NODE_CAPACITY; i++) {
+        end->data[i] = 100 + i;
+    }
+    end->count = NODE_CAPACITY - 1;
+
+    // Test 1: data is in the first node
+    tests_status[0] = search_forward(start, 1);
+
+    // Test 2: data is in the last used slot of the last node
+    tests_status[1] = search_forward(start, 100 + NODE_CAPACITY - 2);
+
+    // Test 3: data in an unused slot is ignored
+    tests_status[2] = !search_forward(start, 100 + NODE_CAPACITY - 1);
+
+    free(start);
+    free(end);
+    return tests_status;
+}
+
+/*** UnrolledLinkedList Unit Tests ***/
+
+/**
+ * @brief Tests the list_from_array and list_to_array functions
+ *
+ * This function performs four tests:
+ * 1. Verifies that an empty array creates an empty list
+ * 2. Verifies that the list holds the array values in order
+ * 3. Verifies that every node but the last is filled to NODE_CAPACITY
+ * 4. Verifies that list_to_array returns the original array
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains LIST_FROM_ARRAY_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_list_from_array() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * LIST_FROM_ARRAY_NUM_TESTS);
+    int64_t arr[50];
+    for (int64_t i = 0; i < 50; i++) {
+        arr[i] = i * 3 - 20;
+    }
+
+    // Test 1: empty array
+    UnrolledLinkedList* list_ptr = list_from_array(arr, 0);
+    tests_status[0] = is_empty(list_ptr) && (list_ptr->head == NULL);
+    free(list_ptr);
+
+    // Test 2: values are in order
+    list_ptr = list_from_array(arr, 50);
+    tests_status[1] = list_equals(list_ptr, arr, 50);
+
+    // Test 3: nodes are packed
+    tests_status[2] = (list_ptr->num_nodes == (50 + NODE_CAPACITY - 1) / NODE_CAPACITY)
+                      && (list_ptr->head->count == NODE_CAPACITY)
+                      && (list_ptr->tail->count == 50 % NODE_CAPACITY);
+
+    // Test 4: list_to_array round trips
+    int64_t* out = list_to_array(list_ptr);
+    tests_status[3] = (memcmp(out, arr, sizeof(arr)) == 0);
+
+    free(out);
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the append_node and prepend_node functions
+ *
+ * This function performs four tests:
+ * 1. Verifies that appending to an empty list creates one node
+ * 2. Verifies that appends only create a new node once the tail node is full
+ * 3. Verifies that prepends go into the head node while it has room
+ * 4. Verifies that the list holds the values in order
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains APPEND_PREPEND_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_append_prepend() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * APPEND_PREPEND_NUM_TESTS);
+    UnrolledLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: a single append creates a single node
+    append_node(list_ptr, 5);
+    tests_status[0] = (list_ptr->num_nodes == 1) && (list_ptr->head == list_ptr->tail);
+
+    // Test 2: the tail fills up before a new node is made
+    for (int64_t i = 6; i < 5 + NODE_CAPACITY; i++) {
+        append_node(list_ptr, i);
+    }
+    bool one_node = (list_ptr->num_nodes == 1);
+    append_node(list_ptr, 5 + NODE_CAPACITY);
+    tests_status[1] = one_node && (list_ptr->num_nodes == 2);
+
+    // Test 3: the head is full, so a prepend makes a new head, and the next prepend reuses it
+    prepend_node(list_ptr, 4);
+    prepend_node(list_ptr, 3);
+    tests_status[2] = (list_ptr->num_nodes == 3) && (list_ptr->head->count == 2);
+
+    // Test 4: values are in order
+    int64_t expected[NODE_CAPACITY + 3];
+    for (int64_t i = 0; i < NODE_CAPACITY + 3; i++) {
+        expected[i] = i + 3;
+    }
+    tests_status[3] = list_equals(list_ptr, expected, NODE_CAPACITY + 3);
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the get and replace_node functions
+ *
+ * This function performs four tests:
+ * 1. Verifies that get returns NULL on an empty list
+ * 2. Verifies that get returns the right value across node boundaries
+ * 3. Verifies that get returns NULL for an out of bounds index
+ * 4. Verifies that replace_node changes the value at an index
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains GET_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_get() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * GET_NUM_TESTS);
+    UnrolledLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: empty list
+    tests_status[0] = (get(list_ptr, 0) == NULL);
+
+    // Test 2: every index returns its value
+    for (int64_t i = 0; i < 40; i++) {
+        append_node(list_ptr, i * i);
+    }
+    bool all_found = true;
+    for (uint64_t i = 0; i < 40; i++) {
+        all_found = all_found && (*get(list_ptr, i) == (int64_t) (i * i));
+    }
+    tests_status[1] = all_found;
+
+    // Test 3: out of bounds
+    tests_status[2] = (get(list_ptr, 40) == NULL);
+
+    // Test 4: replace a value in the second node
+    tests_status[3] = replace_node(list_ptr, -1, NODE_CAPACITY + 1) && (*get(list_ptr, NODE_CAPACITY + 1) == -1)
+                      && !replace_node(list_ptr, -1, 40);
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the find and contains functions
+ *
+ * This function performs four tests:
+ * 1. Verifies that find returns UINT64_MAX on an empty list
+ * 2. Verifies that find returns the index of the first occurrence
+ * 3. Verifies that find returns UINT64_MAX for a missing value
+ * 4. Verifies that contains agrees with find
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains FIND_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_find() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * FIND_NUM_TESTS);
+    UnrolledLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: empty list
+    tests_status[0] = (find(list_ptr, 0) == UINT64_MAX) && !contains(list_ptr, 0);
+
+    // Test 2: first occurrence
+    for (int64_t i = 0; i < 60; i++) {
+        append_node(list_ptr, i % 20);
+    }
+    tests_status[1] = (find(list_ptr, 19) == 19) && (find(list_ptr, 0) == 0);
+
+    // Test 3: missing value
+    tests_status[2] = (find(list_ptr, 20) == UINT64_MAX);
+
+    // Test 4: contains
+    tests_status[3] = contains(list_ptr, 7) && !contains(list_ptr, -7);
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the insert_node function
+ *
+ * This function performs five tests:
+ * 1. Verifies that inserting into an empty list fails
+ * 2. Verifies that inserting past the end of the list fails
+ * 3. Verifies that inserting into a full node splits it into two nodes
+ * 4. Verifies that inserting at the size of the list appends
+ * 5. Verifies that the values are in order after the inserts
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains INSERT_NODE_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_insert_node() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * INSERT_NODE_NUM_TESTS);
+    UnrolledLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: empty list
+    tests_status[0] = !insert_node(list_ptr, 1, 0);
+
+    // Test 2: out of bounds
+    int64_t expected[NODE_CAPACITY + 2];
+    for (int64_t i = 0; i < NODE_CAPACITY; i++) {
+        append_node(list_ptr, i);
+    }
+    tests_status[1] = !insert_node(list_ptr, 1, NODE_CAPACITY + 1);
+
+    // Test 3: the full node is split
+    tests_status[2] = insert_node(list_ptr, -1, 3) && (list_ptr->num_nodes == 2)
+                      && (list_ptr->head->count + list_ptr->tail->count == NODE_CAPACITY + 1);
+
+    // Test 4: append through insert
+    tests_status[3] = insert_node(list_ptr, 99, NODE_CAPACITY + 1) && (*get(list_ptr, NODE_CAPACITY + 1) == 99);
+
+    // Test 5: order is kept
+    for (int64_t i = 0, j = 0; i < NODE_CAPACITY; i++, j++) {
+        if (i == 3) {
+            expected[j++] = -1;
+        }
+        expected[j] = i;
+    }
+    expected[NODE_CAPACITY + 1] = 99;
+    tests_status[4] = list_equals(list_ptr, expected, NODE_CAPACITY + 2);
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the delete_node function
+ *
+ * This function performs five tests:
+ * 1. Verifies that deleting from an empty list or out of bounds does nothing
+ * 2. Verifies that a node below NODE_MIN_COUNT takes values from the next node
+ * 3. Verifies that a node below NODE_MIN_COUNT is merged with a small next node
+ * 4. Verifies that deleting every value frees every node
+ * 5. Verifies that the values are in order after the deletes
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains DELETE_NODE_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_delete_node() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * DELETE_NODE_NUM_TESTS);
+    int64_t arr[3 * NODE_CAPACITY];
+    for (int64_t i = 0; i < 3 * NODE_CAPACITY; i++) {
+        arr[i] = i;
+    }
+    UnrolledLinkedList* list_ptr = create_empty_list();
+
+    // Test 1: nothing to delete
+    delete_node(list_ptr, 0);
+    tests_status[0] = is_empty(list_ptr);
+    free(list_ptr);
+    list_ptr = list_from_array(arr, 2 * NODE_CAPACITY);
+    delete_node(list_ptr, 2 * NODE_CAPACITY);
+    delete_node(list_ptr, -1);
+    tests_status[0] = tests_status[0] && (size(list_ptr) == 2 * NODE_CAPACITY);
+
+    // Test 2: drop the head below NODE_MIN_COUNT, it borrows one value from the full next node
+    for (int64_t i = 0; i < NODE_CAPACITY - NODE_MIN_COUNT + 1; i++) {
+        delete_node(list_ptr, 0);
+    }
+    tests_status[1] = (list_ptr->num_nodes == 2) && (list_ptr->head->count == NODE_MIN_COUNT)
+                      && (list_ptr->tail->count == NODE_CAPACITY - 1);
+
+    // Test 3: keep deleting until both nodes fit in one
+    while (list_ptr->num_nodes == 2) {
+        delete_node(list_ptr, 0);
+    }
+    tests_status[2] = (list_ptr->head == list_ptr->tail) && (list_ptr->head->count == size(list_ptr));
+
+    // Test 5 (checked before the list is emptied): the remaining values are the tail of arr
+    uint64_t remaining = size(list_ptr);
+    tests_status[4] = list_equals(list_ptr, arr + 2 * NODE_CAPACITY - remaining, remaining);
+
+    // Test 4: delete everything from the back
+    while (!is_empty(list_ptr)) {
+        delete_node(list_ptr, size(list_ptr) - 1);
+    }
+    tests_status[3] = (list_ptr->head == NULL) && (list_ptr->tail == NULL) && (list_ptr->num_nodes == 0);
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Tests the list against a plain array under a long series of random operations
+ *
+ * This function performs one test:
+ * 1. Verifies that after every random insert, delete, append and prepend the list holds
+ *    the same values as an array that received the same operations
+ *
+ * @return bool* An array of boolean values where each element represents the pass (1) or fail (0)
+ *         status of a test. The array contains RANDOM_OPS_NUM_TESTS elements and must be freed by
+ *         the caller when no longer needed.
+ */
+bool* test_random_ops() {
+    bool* tests_status = (bool *) malloc(sizeof(bool) * RANDOM_OPS_NUM_TESTS);
+    UnrolledLinkedList* list_ptr = create_empty_list();
+    int64_t arr[2000];
+    uint64_t length = 0;
+    bool all_equal = true;
+    srand(12);
+    for (int i = 0; i < 5000; i++) {
+        int op = rand() % 4;
+        int64_t value = rand() % 1000;
+        if ((op == 0) && (length < 2000)) {
+            append_node(list_ptr, value);
+            arr[length++] = value;
+        } else if ((op == 1) && (length < 2000)) {
+            prepend_node(list_ptr, value);
+            memmove(arr + 1, arr, sizeof(int64_t) * length++);
+            arr[0] = value;
+        } else if ((op == 2) && (length > 0) && (length < 2000)) {
+            uint64_t index = rand() % (length + 1);
+            insert_node(list_ptr, value, index);
+            memmove(arr + index + 1, arr + index, sizeof(int64_t) * (length++ - index));
+            arr[index] = value;
+        } else if (length > 0) {
+            uint64_t index = rand() % length;
+            delete_node(list_ptr, index);
+            memmove(arr + index, arr + index + 1, sizeof(int64_t) * (--length - index));
+        }
+        all_equal = all_equal && list_equals(list_ptr, arr, length);
+    }
+    tests_status[0] = all_equal;
+
+    clear(list_ptr);
+    free(list_ptr);
+    return tests_status;
+}
+
+/**
+ * @brief Displays the results of unit test functions
+ *
+ * This function processes an array of test results and displays whether tests passed or failed.
+ * It can show detailed results for each individual test when verbose mode is enabled,
+ * and always displays a summary message indicating overall test success or failure.
+ *
+ * @param tests_status Pointer to a boolean array containing test results (PASS/FAIL)
+ * @param num_tests The number of test results in the array
+ * @param verbose If true, displays detailed results for each individual test
+ */
+void display_test_results(bool* tests_status, int8_t num_tests, bool verbose) {
+    bool all_passed = true;
+    for (int8_t i = 0; i < num_tests; i++) {
+        if (tests_status[i] == PASS) {
+            if (verbose) {
+                printf("Test %d passed", i + 1);
+            }
+        } else {
+            if (verbose) {
+                printf("Test %d failed\n", i + 1);
+            }
+            all_passed = false;
+        }
+    }
+    if (all_passed) {
+        printf("All tests passed!\n");
+    } else {
+        printf("Some tests failed!\n");
+    }
+}
+
+/*** Program Starting Point */
+
+int main() {
+    bool* tests_status = test_dangling_node();
+    printf("Testing dangling_node function: ");
+    display_test_results(tests_status, DANGLING_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_search_forward();
+    printf("Testing search_forward function: ");
+    display_test_results(tests_status, SEARCH_FORWARD_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_list_from_array();
+    printf("Testing list_from_array function: ");
+    display_test_results(tests_status, LIST_FROM_ARRAY_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_append_prepend();
+    printf("Testing append_node and prepend_node functions: ");
+    display_test_results(tests_status, APPEND_PREPEND_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_get();
+    printf("Testing get function: ");
+    display_test_results(tests_status, GET_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_find();
+    printf("Testing find function: ");
+    display_test_results(tests_status, FIND_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_insert_node();
+    printf("Testing insert_node function: ");
+    display_test_results(tests_status, INSERT_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_delete_node();
+    printf("Testing delete_node function: ");
+    display_test_results(tests_status, DELETE_NODE_NUM_TESTS, false);
+    free(tests_status);
+
+    tests_status = test_random_ops();
+    printf("Testing random operations: ");
+    display_test_results(tests_status, RANDOM_OPS_NUM_TESTS, false);
+    free(tests_status);
+
+    return 0;
+}
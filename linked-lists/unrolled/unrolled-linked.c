@@ -0,0 +1,286 @@
+/*
+This document is meant to store the implementation of the unrolled linked list
+data structure. Since C does not have the ability to handle generics, the data type
+of each value is a 64-bit signed integer;
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdlib.h>
+#include<string.h>
+#include"unrolled-linked.h"
+
+/*** Helper Functions ***/
+
+/**
+ * @brief Finds the node holding the value at the given index of the list.
+ *        On return, index is the position of the value inside that node,
+ *        and prev (if not NULL) points to the node before it.
+ */
+static Node* locate(UnrolledLinkedList* list_ptr, uint64_t* index, Node** prev) {
+    Node* prev_node = NULL;
+    Node* node = list_ptr->head;
+    while (*index >= node->count) {
+        *index -= node->count;
+        prev_node = node;
+        node = node->next;
+    }
+    if (prev != NULL) {
+        *prev = prev_node;
+    }
+    return node;
+}
+
+/**
+ * @brief Creates a new node right after the given node, or as the head of the
+ *        list if node is NULL, and updates the tail of the list if needed.
+ *        Returns NULL, leaving the list unchanged, if allocation fails.
+ */
+static Node* link_node_after(UnrolledLinkedList* list_ptr, Node* node) {
+    Node* new = dangling_node();
+    if (new == NULL) {
+        return NULL;
+    } else if (node == NULL) {
+        new->next = list_ptr->head;
+        list_ptr->head = new;
+    } else {
+        new->next = node->next;
+        node->next = new;
+    }
+    if (list_ptr->tail == node) {
+        list_ptr->tail = new;
+    }
+    list_ptr->num_nodes++;
+    return new;
+}
+
+/*** Node Function Implementations ***/
+
+Node* dangling_node() {
+    Node* new = (Node *) aligned_alloc(CACHE_LINE_SIZE, sizeof(Node));
+    if (new == NULL) {
+        return NULL;
+    }
+    new->next = NULL;
+    new->count = 0;
+    return new;
+}
+
+bool search_forward(Node* start, int64_t data) {
+    for (Node* node = start; node != NULL; node = node->next) {
+        // the inner loop runs over one contiguous block, so the compiler
+        // is free to unroll and vectorize it
+        for (uint64_t i = 0; i < node->count; i++) {
+            if (node->data[i] == data) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*** UnrolledLinkedList Function Implementations ***/
+
+UnrolledLinkedList* create_empty_list() {
+    return (UnrolledLinkedList *) calloc(1, sizeof(UnrolledLinkedList));
+}
+
+UnrolledLinkedList* list_from_array(int64_t* arr, uint64_t arr_length) {
+    UnrolledLinkedList* list_ptr = create_empty_list();
+    if (list_ptr == NULL) {
+        return NULL;
+    }
+    uint64_t i = 0;
+    while (i < arr_length) {
+        Node* node = link_node_after(list_ptr, list_ptr->tail);
+        if (node == NULL) {
+            clear(list_ptr);
+            free(list_ptr);
+            return NULL;
+        }
+        uint64_t count = arr_length - i;
+        if (count > NODE_CAPACITY) {
+            count = NODE_CAPACITY;
+        }
+        memcpy(node->data, arr + i, sizeof(int64_t) * count);
+        node->count = count;
+        i += count;
+    }
+    list_ptr->size = arr_length;
+    return list_ptr;
+}
+
+bool is_empty(UnrolledLinkedList* list_ptr) {
+    return (list_ptr->size == 0);
+}
+
+uint64_t size(UnrolledLinkedList* list_ptr) {
+    return list_ptr->size;
+}
+
+int64_t* list_to_array(UnrolledLinkedList* list_ptr) {
+    if (is_empty(list_ptr)) {
+        return NULL;
+    }
+    int64_t* arr = (int64_t *) malloc(sizeof(int64_t) * list_ptr->size);
+    if (arr == NULL) {
+        return NULL;
+    }
+    uint64_t i = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        memcpy(arr + i, node->data, sizeof(int64_t) * node->count);
+        i += node->count;
+    }
+    return arr;
+}
+
+int64_t* get(UnrolledLinkedList* list_ptr, uint64_t index) {
+    if (index >= list_ptr->size) {
+        return NULL;
+    }
+    Node* node = locate(list_ptr, &index, NULL);
+    return &(node->data[index]);
+}
+
+bool contains(UnrolledLinkedList* list_ptr, int64_t data) {
+    return search_forward(list_ptr->head, data);
+}
+
+uint64_t find(UnrolledLinkedList* list_ptr, int64_t data) {
+    uint64_t index = 0;
+    for (Node* node = list_ptr->head; node != NULL; node = node->next) {
+        for (uint64_t i = 0; i < node->count; i++) {
+            if (node->data[i] == data) {
+                return index + i;
+            }
+        }
+        index += node->count;
+    }
+    return UINT64_MAX;
+}
+
+void append_node(UnrolledLinkedList* list_ptr, int64_t data) {
+    Node* node = list_ptr->tail;
+    if ((node == NULL) || (node->count == NODE_CAPACITY)) {
+        node = link_node_after(list_ptr, node);
+        if (node == NULL) {
+            return;
+        }
+    }
+    node->data[node->count] = data;
+    node->count++;
+    list_ptr->size++;
+}
+
+void prepend_node(UnrolledLinkedList* list_ptr, int64_t data) {
+    Node* node = list_ptr->head;
+    if ((node == NULL) || (node->count == NODE_CAPACITY)) {
+        node = link_node_after(list_ptr, NULL);
+        if (node == NULL) {
+            return;
+        }
+    } else {
+        memmove(node->data + 1, node->data, sizeof(int64_t) * node->count);
+    }
+    node->data[0] = data;
+    node->count++;
+    list_ptr->size++;
+}
+
+bool insert_node(UnrolledLinkedList* list_ptr, int64_t data, uint64_t index) {
+    if (is_empty(list_ptr) || (index > list_ptr->size)) {
+        return false;
+    } else if (index == list_ptr->size) {
+        append_node(list_ptr, data);
+        return (list_ptr->size > index);
+    }
+    Node* node = locate(list_ptr, &index, NULL);
+    if (node->count == NODE_CAPACITY) {
+        // split the full node, moving its upper half into a new node
+        Node* half = link_node_after(list_ptr, node);
+        if (half == NULL) {
+            return false;
+        }
+        uint64_t keep = NODE_CAPACITY / 2;
+        half->count = NODE_CAPACITY - keep;
+        memcpy(half->data, node->data + keep, sizeof(int64_t) * half->count);
+        node->count = keep;
+        if (index > keep) {
+            node = half;
+            index -= keep;
+        }
+    }
+    memmove(node->data + index + 1, node->data + index, sizeof(int64_t) * (node->count - index));
+    node->data[index] = data;
+    node->count++;
+    list_ptr->size++;
+    return true;
+}
+
+bool replace_node(UnrolledLinkedList* list_ptr, int64_t data, uint64_t index) {
+    int64_t* value = get(list_ptr, index);
+    if (value == NULL) {
+        return false;
+    }
+    *value = data;
+    return true;
+}
+
+void delete_node(UnrolledLinkedList* list_ptr, int64_t index) {
+    if ((index < 0) || ((uint64_t) index >= list_ptr->size)) {
+        return;
+    }
+    uint64_t offset = (uint64_t) index;
+    Node* prev = NULL;
+    Node* node = locate(list_ptr, &offset, &prev);
+    memmove(node->data + offset, node->data + offset + 1, sizeof(int64_t) * (node->count - offset - 1));
+    node->count--;
+    list_ptr->size--;
+
+    Node* next = node->next;
+    if ((node->count >= NODE_MIN_COUNT) || ((next == NULL) && (node->count > 0))) {
+        return;
+    } else if (next == NULL) {
+        // the tail node is empty, so unlink it
+        if (prev == NULL) {
+            list_ptr->head = NULL;
+        } else {
+            prev->next = NULL;
+        }
+        list_ptr->tail = prev;
+        list_ptr->num_nodes--;
+        free(node);
+    } else if (node->count + next->count <= NODE_CAPACITY) {
+        // merge the next node into this one
+        memcpy(node->data + node->count, next->data, sizeof(int64_t) * next->count);
+        node->count += next->count;
+        node->next = next->next;
+        if (list_ptr->tail == next) {
+            list_ptr->tail = node;
+        }
+        list_ptr->num_nodes--;
+        free(next);
+    } else {
+        // take just enough values from the next node to refill this one
+        uint64_t moved = NODE_MIN_COUNT - node->count;
+        memcpy(node->data + node->count, next->data, sizeof(int64_t) * moved);
+        node->count += moved;
+        next->count -= moved;
+        memmove(next->data, next->data + moved, sizeof(int64_t) * next->count);
+    }
+}
+
+void clear(UnrolledLinkedList* list_ptr) {
+    Node* node = list_ptr->head;
+    while (node != NULL) {
+        Node* next = node->next;
+        free(node);
+        node = next;
+    }
+    list_ptr->head = NULL;
+    list_ptr->tail = NULL;
+    list_ptr->size = 0;
+    list_ptr->num_nodes = 0;
+}
@@ -0,0 +1,200 @@
+/*
+This header file is used to declare the Node struct, and the
+functions used to manage an unrolled linked list of Nodes, where
+every node stores a block of values instead of a single value.
+Author: Zara Phukan.
+Creation Date: October 17, 2026.
+*/
+#ifndef UNROLLEDLINKEDLIST_H
+#define UNROLLEDLINKEDLIST_H
+
+/*** Dependencies ***/
+#include<stdint.h>
+#include<stdbool.h>
+
+/*** Constants ***/
+#define CACHE_LINE_SIZE 64
+// a Node is two cache lines: the next pointer and count take 16 bytes,
+// and the remaining 112 bytes hold the values
+#define NODE_CAPACITY 14
+// nodes which drop below this count are refilled from, or merged with,
+// the next node
+#define NODE_MIN_COUNT (NODE_CAPACITY / 2)
+
+
+/*** Struct Definitions ***/
+
+
+/**
+ * @brief A structure representing a node in an unrolled linked list.
+ * Contains a pointer to the next Node, the number of values in use,
+ * and a block of values stored in list order. Only data[0] up to
+ * data[count - 1] are valid.
+ */
+typedef struct Node {
+    struct Node* next;
+    uint64_t count;
+    int64_t data[NODE_CAPACITY];
+} Node;
+
+/**
+ * @brief A structure representing an unrolled linked list. It has
+ *        the same interface as a SinglyLinkedList, but each node
+ *        holds up to NODE_CAPACITY values, so walking the list
+ *        follows one pointer per block of values instead of one
+ *        pointer per value.
+ * Contains pointers to the head and tail nodes, the number of values
+ * in the list, and the number of nodes used to store them.
+ */
+typedef struct {
+    Node* head;
+    Node* tail;
+    uint64_t size;
+    uint64_t num_nodes;
+} UnrolledLinkedList;
+
+
+/*** Node Functions ***/
+
+
+/**
+ * @brief Creates a new empty node, aligned to a cache line, with the
+ *        next pointer set to NULL and a count of 0.
+ * @return A pointer to the new node, or NULL if allocation fails.
+ */
+Node* dangling_node();
+
+/**
+ * @brief Searches a chain of nodes, starting with the given node, and
+ *        returns true if one of the values in the chain is equal to data,
+ *        returns false otherwise.
+ * @param start The node to start the search.
+ * @param data The data to search for.
+ */
+bool search_forward(Node* start, int64_t data);
+
+
+/*** UnrolledLinkedList Functions ***/
+
+/**
+ * @brief Creates an empty UnrolledLinkedList with no nodes.
+ *        Note: The user must call clear and free this list pointer
+ *        when it is no longer needed to prevent memory leaks.
+ * @return A pointer to a new empty UnrolledLinkedList.
+ */
+UnrolledLinkedList* create_empty_list();
+
+/**
+ * @brief Creates an UnrolledLinkedList from the provided array. Every
+ *        node except the last one is filled to NODE_CAPACITY.
+ *        Returns an empty list if the array length is 0.
+ * @param arr A pointer to the array of 64-bit integers.
+ * @param arr_length The length of the array.
+ * @return A pointer to a new UnrolledLinkedList containing the array elements,
+ *         or NULL if allocation fails.
+ */
+UnrolledLinkedList* list_from_array(int64_t* arr, uint64_t arr_length);
+
+/**
+ * @brief Returns true if the list is empty and false otherwise.
+ * @param list_ptr A pointer to an UnrolledLinkedList.
+ */
+bool is_empty(UnrolledLinkedList* list_ptr);
+
+/**
+ * @brief Returns the number of values in the given list.
+ * @param list_ptr A pointer to an UnrolledLinkedList.
+ */
+uint64_t size(UnrolledLinkedList* list_ptr);
+
+/**
+ * @brief Converts the UnrolledLinkedList to an array of 64-bit integers.
+ *        Returns a pointer to the array, allocated on the heap, which
+ *        must be freed by the user. Returns NULL if the list is empty
+ *        or allocation fails.
+ * @param list_ptr A pointer to the UnrolledLinkedList to convert.
+ */
+int64_t* list_to_array(UnrolledLinkedList* list_ptr);
+
+/**
+ * @brief Returns a pointer to the value at the specified index of the list.
+ *        Returns NULL if the list is empty or the index is out of bounds.
+ *        The pointer is only valid until the list is next modified, since
+ *        inserts and deletes move values between nodes.
+ * @param list_ptr A pointer to the UnrolledLinkedList to get from.
+ * @param index The index of the value.
+ */
+int64_t* get(UnrolledLinkedList* list_ptr, uint64_t index);
+
+/**
+ * @brief Searches the whole list to see if it contains the data.
+ *        Returns true if the data is found, returns false otherwise.
+ * @param list_ptr A pointer to the UnrolledLinkedList to be searched.
+ * @param data The data to search for.
+ */
+bool contains(UnrolledLinkedList* list_ptr, int64_t data);
+
+/**
+ * @brief Returns the index of the first value equal to data, or
+ *        UINT64_MAX if the data is not in the list.
+ * @param list_ptr A pointer to the UnrolledLinkedList to be searched.
+ * @param data The data to search for.
+ */
+uint64_t find(UnrolledLinkedList* list_ptr, int64_t data);
+
+/**
+ * @brief Appends a value to the end of the list. A new tail node is
+ *        only created when the current tail node is full, and the list is
+ *        left unchanged if it can not be allocated.
+ * @param list_ptr A pointer to the UnrolledLinkedList to append to.
+ * @param data The value to append.
+ */
+void append_node(UnrolledLinkedList* list_ptr, int64_t data);
+
+/**
+ * @brief Prepends a value to the start of the list. A new head node is
+ *        only created when the current head node is full, and the list is
+ *        left unchanged if it can not be allocated.
+ * @param list_ptr A pointer to the UnrolledLinkedList to modify.
+ * @param data The value to prepend.
+ */
+void prepend_node(UnrolledLinkedList* list_ptr, int64_t data);
+
+/**
+ * @brief Inserts a value at the given index (if possible). If the node
+ *        holding that index is full, it is split in two halves first.
+ *        An index equal to the size of the list appends the value.
+ *        Returns true if successful, and false if the list is empty, the
+ *        index is out of bounds, or a new node can not be allocated.
+ * @param list_ptr A pointer to the UnrolledLinkedList to modify.
+ * @param data The value to insert.
+ * @param index The index at which to insert the value.
+ */
+bool insert_node(UnrolledLinkedList* list_ptr, int64_t data, uint64_t index);
+
+/**
+ * @brief Replaces the value at the specified index of the list. Returns
+ *        true if the value was replaced, and false if the index is out of bounds.
+ * @param list_ptr A pointer to the UnrolledLinkedList to modify.
+ * @param data The new value.
+ * @param index The index of the value to replace.
+ */
+bool replace_node(UnrolledLinkedList* list_ptr, int64_t data, uint64_t index);
+
+/**
+ * @brief Deletes the value at the specified index of the list. If its node
+ *        drops below NODE_MIN_COUNT values, it takes values from the next
+ *        node, or is merged with it when both fit in one node.
+ *        If the list is empty or the index is out of bounds, no action is performed.
+ * @param list_ptr A pointer to the UnrolledLinkedList to modify.
+ * @param index The index of the value to delete.
+ */
+void delete_node(UnrolledLinkedList* list_ptr, int64_t index);
+
+/**
+ * @brief Clears the list by freeing all nodes and setting the head
+ *        and tail nodes to NULL.
+ * @param list_ptr A pointer to the UnrolledLinkedList to clear.
+ */
+void clear(UnrolledLinkedList* list_ptr);
+#endif